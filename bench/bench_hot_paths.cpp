@@ -0,0 +1,291 @@
+/**
+ * @file bench_hot_paths.cpp
+ * @brief Microbenchmarks for the per-frame hot paths
+ *
+ * Covers the CPU-bound stages that run for every frame on every camera:
+ * BYTETracker::update, PolygonZone containment, LineZone crossing
+ * detection, base64 encoding (thumbnail path) and TelemetryEvent::toJson.
+ *
+ * All datasets are generated with fixed-seed std::mt19937 engines so runs
+ * are reproducible across machines and commits — compare numbers from the
+ * same pinned core (the `make bench` target runs under taskset -c 0).
+ *
+ * DatabaseSink batch inserts are deliberately not benchmarked here: the
+ * sink requires a live Camera and the full component stack plus an open
+ * SQLite handle, so isolating it would measure mostly harness setup. Its
+ * throughput is visible in the tapi_stage_latency_seconds{stage="sink"}
+ * histogram on GET /metrics instead.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bytetrack/BYTETracker.h"
+#include "components/telemetry.h"
+#include "geometry/line_zone.h"
+#include "geometry/polygon_zone.h"
+#include "utils/base64_codec.h"
+#include "utils/cencode.h"
+
+namespace {
+
+constexpr int kFrameWidth = 1920;
+constexpr int kFrameHeight = 1080;
+constexpr uint32_t kDatasetSeed = 20240901;
+
+/**
+ * @brief Generate per-frame detection sets for the tracker benchmark
+ *
+ * Each object starts at a random position and drifts a few pixels per
+ * frame with jittered box sizes, which keeps the IoU association matrix
+ * realistically dense instead of trivially diagonal.
+ */
+std::vector<std::vector<Object>> makeTrackerFrames(int objectCount, int frameCount) {
+    std::mt19937 rng(kDatasetSeed);
+    std::uniform_real_distribution<float> xDist(0.0f, kFrameWidth - 200.0f);
+    std::uniform_real_distribution<float> yDist(0.0f, kFrameHeight - 200.0f);
+    std::uniform_real_distribution<float> sizeDist(40.0f, 180.0f);
+    std::uniform_real_distribution<float> driftDist(-4.0f, 4.0f);
+    std::uniform_real_distribution<float> probDist(0.3f, 0.95f);
+
+    std::vector<Object> objects(objectCount);
+    std::vector<float> driftX(objectCount);
+    std::vector<float> driftY(objectCount);
+    for (int i = 0; i < objectCount; i++) {
+        objects[i].rect = cv::Rect_<float>(xDist(rng), yDist(rng), sizeDist(rng), sizeDist(rng));
+        objects[i].label = i % 4;
+        objects[i].prob = probDist(rng);
+        driftX[i] = driftDist(rng);
+        driftY[i] = driftDist(rng);
+    }
+
+    std::vector<std::vector<Object>> frames;
+    frames.reserve(frameCount);
+    for (int f = 0; f < frameCount; f++) {
+        for (int i = 0; i < objectCount; i++) {
+            objects[i].rect.x += driftX[i];
+            objects[i].rect.y += driftY[i];
+            objects[i].prob = probDist(rng);
+        }
+        frames.push_back(objects);
+    }
+    return frames;
+}
+
+/**
+ * @brief Generate a convex polygon with the given vertex count
+ */
+std::vector<cv::Point2f> makePolygon(int vertexCount) {
+    std::vector<cv::Point2f> polygon;
+    polygon.reserve(vertexCount);
+    const float cx = kFrameWidth / 2.0f;
+    const float cy = kFrameHeight / 2.0f;
+    for (int i = 0; i < vertexCount; i++) {
+        const float angle = 2.0f * static_cast<float>(CV_PI) * i / vertexCount;
+        polygon.emplace_back(cx + 400.0f * std::cos(angle), cy + 400.0f * std::sin(angle));
+    }
+    return polygon;
+}
+
+/**
+ * @brief Generate detections scattered across the frame
+ */
+std::vector<tapi::Detection> makeDetections(int count) {
+    std::mt19937 rng(kDatasetSeed + 1);
+    std::uniform_int_distribution<int> xDist(0, kFrameWidth - 120);
+    std::uniform_int_distribution<int> yDist(0, kFrameHeight - 120);
+    std::uniform_int_distribution<int> sizeDist(30, 120);
+    std::uniform_real_distribution<float> confDist(0.3f, 0.95f);
+
+    std::vector<tapi::Detection> detections(count);
+    for (int i = 0; i < count; i++) {
+        detections[i].bbox = cv::Rect(xDist(rng), yDist(rng), sizeDist(rng), sizeDist(rng));
+        detections[i].classId = std::to_string(i % 4);
+        detections[i].className = "person";
+        detections[i].confidence = confDist(rng);
+        detections[i].timestamp = 0;
+    }
+    return detections;
+}
+
+/**
+ * @brief Generate per-frame track sets that sweep across the frame
+ *
+ * Tracks move horizontally with per-track speeds so a vertical line in
+ * the frame center sees a steady stream of genuine crossings.
+ */
+std::vector<std::vector<tapi::Track>> makeSweepingTracks(int trackCount, int frameCount) {
+    std::mt19937 rng(kDatasetSeed + 2);
+    std::uniform_int_distribution<int> yDist(0, kFrameHeight - 120);
+    std::uniform_int_distribution<int> sizeDist(30, 120);
+    std::uniform_int_distribution<int> speedDist(4, 24);
+    std::uniform_real_distribution<float> confDist(0.3f, 0.95f);
+
+    std::vector<tapi::Track> tracks(trackCount);
+    std::vector<int> speeds(trackCount);
+    for (int i = 0; i < trackCount; i++) {
+        tracks[i].trackId = i + 1;
+        tracks[i].bbox = cv::Rect((i * 97) % kFrameWidth, yDist(rng), sizeDist(rng), sizeDist(rng));
+        tracks[i].classId = std::to_string(i % 4);
+        tracks[i].className = "person";
+        tracks[i].confidence = confDist(rng);
+        tracks[i].timestamp = 0;
+        speeds[i] = speedDist(rng);
+    }
+
+    std::vector<std::vector<tapi::Track>> frames;
+    frames.reserve(frameCount);
+    for (int f = 0; f < frameCount; f++) {
+        for (int i = 0; i < trackCount; i++) {
+            tracks[i].bbox.x = (tracks[i].bbox.x + speeds[i]) % kFrameWidth;
+        }
+        frames.push_back(tracks);
+    }
+    return frames;
+}
+
+/**
+ * @brief BYTETracker::update at varying detection counts
+ */
+void BM_BYTETrackerUpdate(benchmark::State& state) {
+    const int objectCount = static_cast<int>(state.range(0));
+    const auto frames = makeTrackerFrames(objectCount, 64);
+
+    BYTETracker tracker(30, 30);
+    size_t frameIdx = 0;
+    for (auto _ : state) {
+        auto tracks = tracker.update(frames[frameIdx]);
+        benchmark::DoNotOptimize(tracks);
+        frameIdx = (frameIdx + 1) % frames.size();
+    }
+    state.SetItemsProcessed(state.iterations() * objectCount);
+}
+BENCHMARK(BM_BYTETrackerUpdate)->Arg(4)->Arg(16)->Arg(64)->Arg(256);
+
+/**
+ * @brief PolygonZone containment test at varying polygon/detection sizes
+ */
+void BM_PolygonZoneContainment(benchmark::State& state) {
+    const int vertexCount = static_cast<int>(state.range(0));
+    const int detectionCount = static_cast<int>(state.range(1));
+
+    tapi::PolygonZone zone("bench-zone", makePolygon(vertexCount), "bench-camera");
+    zone.initialize();
+    const auto detections = makeDetections(detectionCount);
+
+    for (auto _ : state) {
+        auto inZone = zone.computeAnchorsInZone(detections);
+        benchmark::DoNotOptimize(inZone);
+    }
+    state.SetItemsProcessed(state.iterations() * detectionCount);
+}
+BENCHMARK(BM_PolygonZoneContainment)
+    ->Args({4, 16})
+    ->Args({4, 256})
+    ->Args({32, 16})
+    ->Args({32, 256});
+
+/**
+ * @brief LineZone crossing detection with tracks sweeping across the line
+ */
+void BM_LineZoneCrossing(benchmark::State& state) {
+    const int trackCount = static_cast<int>(state.range(0));
+    const auto frames = makeSweepingTracks(trackCount, 64);
+
+    tapi::LineZone zone("bench-line", kFrameWidth / 2.0f, 0.0f,
+                        kFrameWidth / 2.0f, static_cast<float>(kFrameHeight),
+                        "bench-camera");
+    zone.initialize();
+
+    size_t frameIdx = 0;
+    for (auto _ : state) {
+        auto events = zone.processTracks(frames[frameIdx]);
+        benchmark::DoNotOptimize(events);
+        frameIdx = (frameIdx + 1) % frames.size();
+    }
+    state.SetItemsProcessed(state.iterations() * trackCount);
+}
+BENCHMARK(BM_LineZoneCrossing)->Arg(4)->Arg(16)->Arg(64);
+
+/**
+ * @brief base64 encoding throughput (frame payload path)
+ *
+ * Exercises the shared vectorized codec every HTTP image transfer uses;
+ * the vendored libb64 streaming encoder is kept as a baseline for
+ * comparison.
+ */
+void BM_Base64Encode(benchmark::State& state) {
+    const size_t inputSize = static_cast<size_t>(state.range(0));
+
+    std::mt19937 rng(kDatasetSeed + 3);
+    std::uniform_int_distribution<int> byteDist(0, 255);
+    std::vector<unsigned char> input(inputSize);
+    for (auto& byte : input) {
+        byte = static_cast<unsigned char>(byteDist(rng));
+    }
+
+    for (auto _ : state) {
+        std::string encoded = tapi::utils::Base64Codec::encode(input.data(), input.size());
+        benchmark::DoNotOptimize(encoded.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(inputSize));
+}
+BENCHMARK(BM_Base64Encode)->Arg(1024)->Arg(64 * 1024)->Arg(1024 * 1024);
+
+/**
+ * @brief Scalar libb64 baseline for the codec comparison
+ */
+void BM_Base64EncodeLibb64(benchmark::State& state) {
+    const size_t inputSize = static_cast<size_t>(state.range(0));
+
+    std::mt19937 rng(kDatasetSeed + 3);
+    std::uniform_int_distribution<int> byteDist(0, 255);
+    std::vector<char> input(inputSize);
+    for (auto& byte : input) {
+        byte = static_cast<char>(byteDist(rng));
+    }
+    // Worst-case output: 4/3 expansion plus line breaks and terminator
+    std::vector<char> output(inputSize * 2 + 8);
+
+    for (auto _ : state) {
+        triton::client::libb64::base64_encodestate encodeState;
+        triton::client::libb64::base64_init_encodestate(&encodeState);
+        int written = triton::client::libb64::base64_encode_block(
+            input.data(), static_cast<int>(input.size()), output.data(), &encodeState);
+        written += triton::client::libb64::base64_encode_blockend(
+            output.data() + written, &encodeState);
+        benchmark::DoNotOptimize(written);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(inputSize));
+}
+BENCHMARK(BM_Base64EncodeLibb64)->Arg(1024)->Arg(64 * 1024)->Arg(1024 * 1024);
+
+/**
+ * @brief TelemetryEvent::toJson for a representative tracking event
+ */
+void BM_TelemetryEventToJson(benchmark::State& state) {
+    tapi::TelemetryEvent event(tapi::TelemetryEventType::TRACKING, "bench-tracker", 1725148800000);
+    event.setCameraId("bench-camera");
+    event.setClassName("person");
+    event.setConfidence(0.87f);
+    event.setTrackId(42);
+    event.setBBox(tapi::TelemetryBBox{640, 360, 120, 240});
+    event.setProperty("velocity_x", 3.5);
+    event.setProperty("velocity_y", -1.2);
+
+    for (auto _ : state) {
+        auto json = event.toJson();
+        benchmark::DoNotOptimize(json);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TelemetryEventToJson);
+
+} // namespace
+
+BENCHMARK_MAIN();
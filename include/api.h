@@ -10,9 +10,11 @@
 #include <mutex>
 #include <chrono>
 #include "camera_manager.h"
+#include "mjpeg_streamer.h"
 #include <iostream>
 #include <future>
 #include <queue>
+#include <unordered_set>
 #include <condition_variable>
 #include <nlohmann/json.hpp>
 #include <uuid/uuid.h>
@@ -49,14 +51,23 @@ public:
  */
 class BackgroundTaskManager {
 public:
+    // Scheduling class for a task. Latency-critical tasks (license
+    // refreshes, config saves) always have a worker available; bulk tasks
+    // (ONVIF scans, camera deletions) share the remaining workers.
+    enum class TaskPriority {
+        LATENCY_CRITICAL,
+        BULK
+    };
+
     struct TaskStatus {
         enum class State {
             PENDING,
             RUNNING,
             COMPLETED,
-            FAILED
+            FAILED,
+            CANCELLED
         };
-        
+
         State state;
         std::string taskId;
         std::string taskType;
@@ -66,53 +77,74 @@ public:
         std::chrono::system_clock::time_point createdAt;
         std::chrono::system_clock::time_point updatedAt;
     };
-    
+
     static BackgroundTaskManager& getInstance() {
         static BackgroundTaskManager instance;
         return instance;
     }
-    
+
     BackgroundTaskManager(const BackgroundTaskManager&) = delete;
     BackgroundTaskManager& operator=(const BackgroundTaskManager&) = delete;
-    
+
     ~BackgroundTaskManager() {
         shutdown();
     }
-    
-    // Submit a task to be executed asynchronously
-    std::string submitTask(std::string taskType, std::string targetId, 
-                          std::function<bool(std::function<void(double, std::string)>)> taskFunc);
-    
+
+    // Submit a task to be executed asynchronously. timeoutSecs > 0 cancels
+    // the task cooperatively at its next progress report past the deadline.
+    std::string submitTask(std::string taskType, std::string targetId,
+                          std::function<bool(std::function<void(double, std::string)>)> taskFunc,
+                          TaskPriority priority = TaskPriority::BULK,
+                          int timeoutSecs = 0);
+
+    // Run a fire-and-forget function on the worker pool without creating a
+    // tracked task. Used by REST handlers that complete their deferred
+    // responses themselves — per-request entries would swamp the task list.
+    void runDetached(std::function<void()> fn,
+                     TaskPriority priority = TaskPriority::LATENCY_CRITICAL);
+
+    // Request cancellation of a task. Pending tasks are cancelled outright;
+    // running tasks are cancelled at their next progress report.
+    bool cancelTask(const std::string& taskId);
+
     // Get status of a specific task
     TaskStatus getTaskStatus(const std::string& taskId);
-    
+
     // Get all tasks
     std::vector<TaskStatus> getAllTasks();
-    
+
     // Clean up completed tasks older than specified duration (in seconds)
     void cleanupOldTasks(int maxAgeSecs = 3600);
-    
+
     // Shutdown the task manager
     void shutdown();
-    
+
 private:
     BackgroundTaskManager();
-    
-    void workerThread();
-    
+
+    // latencyOnly workers never pick up bulk tasks, so a slow scan can
+    // never starve latency-critical work
+    void workerThread(bool latencyOnly);
+
     struct Task {
         std::string id;
         std::string type;
         std::string targetId;
         std::function<bool(std::function<void(double, std::string)>)> func;
         std::chrono::system_clock::time_point createdAt;
+        TaskPriority priority;
+        int timeoutSecs;
+        std::shared_ptr<std::atomic<bool>> cancelRequested;
+        bool tracked = true;  ///< Detached tasks skip status bookkeeping
     };
-    
+
     std::unordered_map<std::string, TaskStatus> taskStatuses_;
-    std::queue<Task> taskQueue_;
+    std::unordered_map<std::string, std::shared_ptr<std::atomic<bool>>> cancelFlags_;
+    std::queue<Task> latencyQueue_;
+    std::queue<Task> bulkQueue_;
     std::mutex mutex_;
     std::condition_variable cv_;
-    std::thread workerThread_;
+    std::vector<std::thread> workerThreads_;
     std::atomic<bool> running_;
 };
 
@@ -167,6 +199,16 @@ private:
     crow::App<crow::CORSHandler, ApiLoggingMiddleware> app_; ///< Crow application with CORS support and API logging
     int port_; ///< Port to listen on
     std::string configDbPath_; ///< Path to the configuration database
+    std::unique_ptr<MjpegStreamer> mjpegStreamer_; ///< Dedicated server for MJPEG live streams
+
+    std::atomic<bool> licenseSnapshotValid_; ///< Cached license validity served by checkLicense()
+    std::atomic<bool> licenseSnapshotReady_; ///< Cached camera manager initialization state
+    std::atomic<long long> licenseSnapshotExpiry_; ///< Snapshot refresh deadline (steady clock, seconds)
+    std::atomic<bool> licenseRefreshInFlight_; ///< Guards against queueing duplicate refresh tasks
+
+    std::unordered_set<std::string> dirtyCameraConfigs_; ///< Cameras with unsaved config changes
+    std::mutex dirtyConfigMutex_; ///< Protects dirtyCameraConfigs_
+    std::atomic<bool> configFlushScheduled_; ///< Guards against queueing duplicate flush tasks
     
     /**
      * @brief Set up all API routes
@@ -233,6 +275,16 @@ private:
      */
     void setupApiLoggingRoutes();
 
+    /**
+     * @brief Set up WebSocket routes for pushed telemetry events
+     */
+    void setupWebSocketRoutes();
+
+    /**
+     * @brief Set up ONVIF camera discovery routes
+     */
+    void setupDiscoveryRoutes();
+
     /**
      * @brief Check if a valid license is present
      * 
@@ -242,6 +294,17 @@ private:
      */
     bool checkLicense(const crow::request& req, crow::response& res);
 
+    /**
+     * @brief Refresh the cached license validity snapshot
+     *
+     * Re-evaluates camera manager initialization and license validity and
+     * publishes the result to the atomics consulted by checkLicense(). Runs
+     * as a background task when the snapshot passes its deadline, and is
+     * called directly after license mutations so changes take effect
+     * immediately.
+     */
+    void refreshLicenseSnapshot();
+
     /**
      * @brief Check license compliance for all cameras and stop non-compliant ones
      * 
@@ -254,19 +317,63 @@ private:
     
     /**
      * @brief Save camera configuration to database
-     * 
+     *
      * @param cameraId Camera ID
      * @return true if successful, false otherwise
      */
     bool saveCameraConfigToDB(const std::string& cameraId);
+
+    /**
+     * @brief Queue a camera's configuration for debounced persistence
+     *
+     * Marks the camera dirty and arms a short debounce window, after which
+     * every dirty camera is written in a single transactional batch by a
+     * background task. REST handlers use this instead of writing to disk
+     * inline, so a dashboard "apply" touching many components costs one
+     * write instead of one per change.
+     *
+     * @param cameraId Camera ID
+     */
+    void scheduleCameraConfigSave(const std::string& cameraId);
+
+    /**
+     * @brief Write all dirty camera configurations in one batch
+     *
+     * @return true if every dirty configuration was persisted
+     */
+    bool flushDirtyCameraConfigs();
+
+    /**
+     * @brief Build the persistable configuration JSON for a camera
+     *
+     * @param cameraId Camera ID
+     * @param config Built configuration (valid only when true is returned)
+     * @return true if the camera exists and its config was built
+     */
+    bool buildCameraConfigJson(const std::string& cameraId, nlohmann::json& config);
     
     /**
      * @brief Load camera configuration from database
-     * 
+     *
      * @param cameraId Camera ID
      * @return true if successful, false otherwise
      */
     bool loadCameraConfigFromDB(const std::string& cameraId);
+
+    /**
+     * @brief Rebuild and start a single camera from its saved configuration
+     *
+     * Runs as a background task during loadSavedConfig() so cameras
+     * restore in parallel. Progress reports double as cancellation and
+     * timeout checkpoints.
+     *
+     * @param cameraId Camera ID
+     * @param cameraConfig Saved camera configuration
+     * @param progressCallback Task progress callback
+     * @return true if the camera was restored, false otherwise
+     */
+    bool restoreCameraFromConfig(const std::string& cameraId, const nlohmann::json& cameraConfig,
+                                 const std::function<void(double, std::string)>& progressCallback);
     
     /**
      * @brief Initialize the configuration database
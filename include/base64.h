@@ -1,50 +1,11 @@
 #pragma once
 
+#include "utils/base64_codec.h"
+
 #include <string>
-#include <vector>
 
+// Thin compatibility wrapper: every caller funnels into the shared
+// vectorized codec in utils/base64_codec.h
 inline std::string base64_encode(const unsigned char* data, size_t size) {
-    static const std::string base64_chars = 
-                 "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-                 "abcdefghijklmnopqrstuvwxyz"
-                 "0123456789+/";
-    
-    std::string ret;
-    ret.reserve(((size + 2) / 3) * 4);
-    
-    int i = 0;
-    int j = 0;
-    unsigned char char_array_3[3];
-    unsigned char char_array_4[4];
-    
-    while (size--) {
-        char_array_3[i++] = *(data++);
-        if (i == 3) {
-            char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-            char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-            char_array_4[2] = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-            char_array_4[3] = char_array_3[2] & 0x3f;
-            
-            for(i = 0; (i < 4) ; i++)
-                ret += base64_chars[char_array_4[i]];
-            i = 0;
-        }
-    }
-    
-    if (i) {
-        for(j = i; j < 3; j++)
-            char_array_3[j] = '\0';
-        
-        char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-        char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-        char_array_4[2] = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-        
-        for (j = 0; (j < i + 1); j++)
-            ret += base64_chars[char_array_4[j]];
-        
-        while((i++ < 3))
-            ret += '=';
-    }
-    
-    return ret;
-} 
\ No newline at end of file
+    return tapi::utils::Base64Codec::encode(data, size);
+}
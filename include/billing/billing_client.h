@@ -6,6 +6,7 @@
 #include <optional>
 #include <functional>
 #include <curl/curl.h>
+#include "utils/circuit_breaker.h"
 
 namespace brinkbyte {
 namespace billing {
@@ -113,6 +114,17 @@ public:
      */
     std::optional<UsageBatchResponse> reportUsageBatch(const UsageBatchRequest& request);
 
+    /**
+     * Report a pre-serialized usage batch, deflate-compressed on the wire
+     *
+     * Catch-up path for spooled records: the caller hands over the whole
+     * {"events":[...]} body (hundreds of records), which is compressed
+     * with zlib and posted once with Content-Encoding: deflate — usage
+     * JSON is highly repetitive, so a week of spooled records ships as a
+     * few kilobytes in one request.
+     */
+    std::optional<UsageBatchResponse> reportUsageBatchCompressed(const std::string& json_body);
+
     /**
      * Send device heartbeat
      */
@@ -131,6 +143,7 @@ public:
 private:
     // HTTP methods
     std::optional<std::string> httpPost(const std::string& endpoint, const std::string& json_body);
+    std::optional<std::string> httpPostDeflate(const std::string& endpoint, const std::string& json_body);
     std::optional<std::string> httpGet(const std::string& endpoint);
 
     // CURL helpers
@@ -186,6 +199,13 @@ public:
      */
     bool reportUsageBatch(const std::vector<UsageEventReport>& events);
 
+    /**
+     * Report a pre-serialized, spool-drained usage batch with retry.
+     * The body is compressed on the wire (see
+     * BillingHttpClient::reportUsageBatchCompressed).
+     */
+    bool reportUsageSpoolBatch(const std::string& json_body);
+
     /**
      * Send heartbeat with retry
      */
@@ -201,6 +221,11 @@ public:
      */
     bool isAvailable();
 
+    /**
+     * Circuit breaker state ("closed", "open", "half_open") for status reporting
+     */
+    std::string getBreakerState() const { return breaker_.stateName(); }
+
     /**
      * Get last error
      */
@@ -217,6 +242,10 @@ private:
     std::shared_ptr<BillingConfig> config_;
     std::shared_ptr<BillingHttpClient> http_client_;
     std::string last_error_;
+
+    // Fails fast after repeated backend failures so a flaky WAN never adds
+    // timeout x retries to the caller; callers fall back to cached state
+    tapi::utils::CircuitBreaker breaker_;
 };
 
 } // namespace billing
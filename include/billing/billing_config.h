@@ -19,6 +19,8 @@ struct BillingConfig {
     int billing_timeout_ms = 5000;
     int billing_max_retries = 3;
     bool mock_billing_service = false;  // Use mock for local development
+    int billing_breaker_failure_threshold = 5;   // Consecutive failures before failing fast
+    int billing_breaker_open_duration_ms = 60000; // Fail-fast window before probing again
     
     // ===== Edge Device Identity =====
     std::string device_id = "auto";  // Auto-generate from hardware UUID if "auto"
@@ -6,6 +6,8 @@
 #include <map>
 #include <chrono>
 #include <mutex>
+#include <atomic>
+#include <functional>
 #include "billing_client.h"
 #include "database/redis_cache.h"
 #include "database/postgres_connection.h"
@@ -187,17 +189,48 @@ public:
     static FeatureCategory stringToFeatureCategory(const std::string& category_str);
 
 private:
+    /**
+     * @brief Entitlement entry in the published snapshot
+     */
+    struct SnapshotEntry {
+        EntitlementResult result;
+        std::chrono::system_clock::time_point expires;  // Refresh deadline (cache TTL)
+    };
+
+    /**
+     * @brief Immutable entitlement state published to readers
+     *
+     * A snapshot is never mutated after publication: refreshes build a new
+     * copy under mutex_ and swap it in atomically, so hot-path checks read
+     * it with a single atomic load and zero locking (RCU-style).
+     */
+    struct Snapshot {
+        std::map<std::string, SnapshotEntry> entitlements;              // Keyed by entitlement cache key
+        std::map<std::string, SnapshotEntry> growth_packs;              // Keyed by tenant ID
+        std::map<std::string, std::vector<std::string>> pack_names;     // Enabled packs per tenant ID
+    };
+
     std::shared_ptr<BillingClient> billing_client_;
     std::shared_ptr<tapi::database::RedisCache> redis_cache_;
     std::shared_ptr<FeatureEntitlementRepository> entitlement_repo_;
-    
+
     int cache_ttl_seconds_;
-    
+
     // Growth pack to feature mapping
     std::map<std::string, std::vector<std::string>> growth_pack_features_;
-    
+
+    // Serializes refreshes (writers) only; readers go through the snapshot
     mutable std::mutex mutex_;
-    
+
+    // Current published snapshot; swapped atomically on refresh
+    std::shared_ptr<const Snapshot> snapshot_;
+
+    /// Atomically load the current snapshot (lock-free read side)
+    std::shared_ptr<const Snapshot> readSnapshot() const;
+
+    /// Build a copy of the current snapshot, apply the mutation and publish it (call with mutex_ held)
+    void publishSnapshot(const std::function<void(Snapshot&)>& mutate);
+
     // Cache key generators
     std::string getEntitlementCacheKey(
         const std::string& tenant_id,
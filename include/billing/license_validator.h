@@ -1,7 +1,9 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <chrono>
 #include <mutex>
@@ -29,6 +31,9 @@ struct LicenseValidationResult {
  * Features:
  * - Validates camera licenses with the billing server
  * - Caches validation results in Redis (1 hour TTL)
+ * - Memoizes parsed results in-process by payload hash, so repeat
+ *   validations of the same unchanged license skip Redis and the parse
+ *   entirely (lock-free snapshot read, same pattern as LatencyMetrics)
  * - Stores licenses in PostgreSQL
  * - Graceful degradation when billing server is offline
  * - Trial vs. Base license enforcement
@@ -167,6 +172,38 @@ private:
         const std::string& tenant_id
     );
     void setDegradedMode(bool degraded);
+
+    /**
+     * @brief One memoized validation: parsed claims plus the hash of the
+     * payload they were parsed from
+     *
+     * License material is immutable between refreshes, so as long as the
+     * payload hash matches, the stored claims are the claims — only
+     * genuinely new material pays for parsing and verification again.
+     * Entries are immutable once published; updates swap the whole map
+     * copy-on-write.
+     */
+    struct MemoizedValidation {
+        size_t payload_hash;                               ///< Hash of the serialized payload
+        LicenseValidationResult result;                    ///< Parsed, validated claims
+        std::chrono::system_clock::time_point expires_at;  ///< Memo expiry (cache TTL)
+    };
+
+    using ValidationMemo =
+        std::unordered_map<std::string, std::shared_ptr<const MemoizedValidation>>;
+
+    /// Lock-free lookup in the current memo snapshot
+    std::shared_ptr<const MemoizedValidation> lookupMemo(const std::string& camera_id) const;
+
+    /// Publish a new memo entry (copy-on-write, call with mutex_ held)
+    void storeMemo(const std::string& camera_id, size_t payload_hash,
+                   const LicenseValidationResult& result);
+
+    /// Drop a memo entry, e.g. on revocation (copy-on-write, call with mutex_ held)
+    void eraseMemo(const std::string& camera_id);
+
+    /// Current memo snapshot, atomically swapped on update
+    std::shared_ptr<const ValidationMemo> validation_memo_;
 };
 
 } // namespace billing
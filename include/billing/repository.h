@@ -70,6 +70,19 @@ struct UsageEvent {
     bool synced;
 };
 
+// Usage rollup entity: one pre-aggregated bucket per
+// (tenant, device, event type, unit, bucket start, bucket size)
+struct UsageRollup {
+    std::string tenant_id;
+    std::string device_id;
+    std::string event_type;
+    std::string unit;
+    time_t bucket_timestamp;  // Bucket start, aligned to bucket_size
+    int bucket_size;          // Bucket width in seconds (60, 3600, 86400)
+    double total_quantity;
+    long long event_count;
+};
+
 // Billing sync status entity
 struct BillingSyncStatus {
     std::string sync_id;
@@ -169,33 +182,52 @@ private:
 
 /**
  * Repository for usage event operations
+ *
+ * Writes maintain minute/hour/day rollups in usage_rollups incrementally
+ * (same pattern as the event rollups in DatabaseSink), so reconciliation
+ * aggregates read small pre-summed tables instead of scanning raw
+ * usage_events. Raw rows only need to live long enough to sync to the
+ * billing server; the rollups carry the month-end numbers.
  */
 class UsageEventRepository {
 public:
     explicit UsageEventRepository(std::shared_ptr<tapi::database::PostgreSQLConnectionPool> pool);
-    
+
     // CRUD operations
     std::string save(const UsageEvent& event);
     bool saveBatch(const std::vector<UsageEvent>& events);
     bool markSynced(const std::vector<std::string>& event_ids);
-    
+
     // Query operations
     std::vector<UsageEvent> findUnsynced(int limit = 1000);
     std::vector<UsageEvent> findByTenant(const std::string& tenant_id, time_t start_time, time_t end_time);
-    std::vector<UsageEvent> findByType(const std::string& tenant_id, const std::string& event_type, 
+    std::vector<UsageEvent> findByType(const std::string& tenant_id, const std::string& event_type,
                                        time_t start_time, time_t end_time);
-    
-    // Aggregation operations
-    double sumQuantity(const std::string& tenant_id, const std::string& event_type, 
+
+    // Aggregation operations, served from the rollups at the coarsest
+    // bucket the range aligns to (exact for minute-aligned ranges, which
+    // is what reconciliation uses)
+    double sumQuantity(const std::string& tenant_id, const std::string& event_type,
                       time_t start_time, time_t end_time);
     std::map<std::string, double> sumByType(const std::string& tenant_id, time_t start_time, time_t end_time);
-    
-    // Maintenance operations
+    std::vector<UsageRollup> findRollups(const std::string& tenant_id, int bucket_size,
+                                         time_t start_time, time_t end_time);
+
+    // Maintenance operations. deleteOld trims raw events only — with the
+    // rollups in place it can run on a much shorter retention than the
+    // billing cycle. deleteOldRollups trims minute buckets early and
+    // keeps hour/day buckets for the given retention.
     int deleteOld(int days_retention);
+    int deleteOldRollups(int days_retention);
     int countUnsynced();
-    
+
 private:
     std::shared_ptr<tapi::database::PostgreSQLConnectionPool> pool_;
+
+    // Fold a batch into per-bucket sums and upsert them (one statement per
+    // touched bucket rather than per event). Caller owns the transaction.
+    bool upsertRollups(tapi::database::PostgreSQLConnection& conn,
+                       const std::vector<UsageEvent>& events);
 };
 
 /**
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace brinkbyte {
+namespace billing {
+
+/**
+ * @brief Durable append-only spool for usage records awaiting upload
+ *
+ * When the billing service is unreachable, UsageTracker spills batches
+ * here instead of growing an in-memory queue: each record is framed as
+ * [u32 length][u32 crc32][payload] and appended to a spool file, so a
+ * week offline costs disk, not RAM. Readers mmap the file and walk it
+ * from the committed cursor, which is the byte offset of the last
+ * acknowledged record, persisted in a sidecar file — records are only
+ * removed from the spool by advancing the cursor after the billing
+ * service has accepted them. Once everything is acknowledged both files
+ * are truncated so the spool never grows without bound.
+ *
+ * Frames with a mismatched checksum (torn write on power loss) end the
+ * walk; everything before the corruption is still delivered.
+ *
+ * All methods are thread-safe; append and drain may run concurrently.
+ */
+class UsageSpool {
+public:
+    explicit UsageSpool(const std::string& path);
+    ~UsageSpool();
+
+    // Disable copy
+    UsageSpool(const UsageSpool&) = delete;
+    UsageSpool& operator=(const UsageSpool&) = delete;
+
+    /**
+     * Open (or create) the spool and recover the committed cursor
+     */
+    bool open();
+
+    /**
+     * Close the spool file descriptors
+     */
+    void close();
+
+    /**
+     * Append one serialized record. Framing is written in a single
+     * write() call; call sync() after a batch of appends to make the
+     * batch durable with one fdatasync instead of one per record.
+     */
+    bool append(const std::string& record);
+
+    /**
+     * Flush appended records to disk (one fdatasync)
+     */
+    void sync();
+
+    /**
+     * Read up to max_records records starting at the committed cursor
+     * without consuming them. next_cursor receives the offset to pass to
+     * commit() once the billing service has acknowledged the batch.
+     */
+    std::vector<std::string> peekBatch(size_t max_records, uint64_t& next_cursor);
+
+    /**
+     * Durably advance the committed cursor past acknowledged records.
+     * When the cursor reaches the end of the spool both files are
+     * truncated back to empty.
+     */
+    bool commit(uint64_t cursor);
+
+    /**
+     * Bytes of spooled records not yet acknowledged
+     */
+    uint64_t pendingBytes() const;
+
+private:
+    /// Persist the committed cursor to the sidecar file
+    bool writeCursorFile(uint64_t cursor);
+
+    std::string path_;            ///< Spool file path
+    std::string cursor_path_;     ///< Sidecar file holding the committed cursor
+    int fd_;                      ///< Spool file descriptor (-1 when closed)
+    int cursor_fd_;               ///< Cursor file descriptor (-1 when closed)
+    uint64_t size_;               ///< Current spool file size in bytes
+    uint64_t committed_;          ///< Byte offset of the first unacknowledged record
+    mutable std::mutex mutex_;    ///< Serializes appenders and the drainer
+};
+
+} // namespace billing
+} // namespace brinkbyte
@@ -6,9 +6,12 @@
 #include <queue>
 #include <chrono>
 #include <mutex>
+#include <shared_mutex>
 #include <thread>
 #include <atomic>
+#include <unordered_map>
 #include "billing_client.h"
+#include "billing/usage_spool.h"
 #include "database/postgres_connection.h"
 #include "billing/repository.h"
 
@@ -146,6 +149,26 @@ public:
      * @param event Usage event to track
      */
     void trackEvent(const UsageEvent& event);
+
+    /**
+     * @brief Track a counter-style usage increment on the hot path
+     *
+     * Increments an atomic per-(tenant, camera, type) counter instead of
+     * building and queueing a UsageEvent; the sync thread folds counters
+     * into batched events on its next flush. Use this from per-frame and
+     * per-request paths where event metadata is not needed.
+     *
+     * @param tenant_id Tenant identifier
+     * @param camera_id Camera identifier (empty for tenant-level usage)
+     * @param event_type Usage event type
+     * @param quantity Amount to add (default: 1)
+     */
+    void trackCounter(
+        const std::string& tenant_id,
+        const std::string& camera_id,
+        UsageEventType event_type,
+        double quantity = 1.0
+    );
     
     /**
      * @brief Flush all pending events to billing server immediately
@@ -196,6 +219,21 @@ private:
     // Event queue
     std::queue<UsageEvent> event_queue_;
     mutable std::mutex queue_mutex_;
+
+    // Hot-path usage counter. Quantities are stored in fixed-point
+    // micro-units so increments are a single atomic fetch_add.
+    struct UsageCounter {
+        std::string tenant_id;
+        std::string camera_id;
+        UsageEventType event_type;
+        std::atomic<long long> micro_units{0};
+    };
+
+    // Counters keyed by tenant|camera|type. Increments take the shared
+    // lock (no contention between tracking threads); only the first hit
+    // for a new key and the flush take the exclusive lock.
+    std::unordered_map<std::string, std::unique_ptr<UsageCounter>> counters_;
+    mutable std::shared_mutex counters_mutex_;
     
     // Background sync thread
     std::thread sync_thread_;
@@ -205,16 +243,29 @@ private:
     // Sync state
     std::chrono::system_clock::time_point last_sync_time_;
     int consecutive_failures_;
+
+    // Durable spool for records awaiting upload while the WAN is down
+    std::unique_ptr<UsageSpool> spool_;
     
     // Thread-safe queue operations
     void enqueueEvent(const UsageEvent& event);
     std::vector<UsageEvent> dequeueBatch(int max_count);
+
+    // Fold non-zero counters into queued events (called by the sync thread)
+    void flushCounters();
     
     // Sync logic
     void syncLoop();
     bool sendBatchToBillingServer(const std::vector<UsageEvent>& events);
     void storeBatchInDatabase(const std::vector<UsageEvent>& events);
     void loadUnsentEventsFromDatabase();
+
+    // Offline spooling: failed batches go to the durable spool instead of
+    // back into the in-memory queue; the sync thread drains the spool as
+    // compressed catch-up batches once the billing service is reachable
+    std::string serializeEventRecord(const UsageEvent& event) const;
+    void spillToSpool(const std::vector<UsageEvent>& events);
+    bool drainSpool();
     
     // Helpers
     std::string getDeviceId() const;
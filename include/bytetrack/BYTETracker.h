@@ -16,8 +16,18 @@ public:
 	~BYTETracker();
 
 	vector<STrack> update(const vector<Object>& objects);
+
+	//advance activated tracks one frame via Kalman prediction without
+	//consuming detections - bridges frames where the detector is skipped
+	vector<STrack> predict();
+
 	Scalar get_color(int idx);
 
+	//serialize live track state (Kalman mean/covariance, ids, frame
+	//counters) to a compact binary blob for warm restarts
+	vector<unsigned char> save_state();
+	bool load_state(const vector<unsigned char> &blob);
+
 private:
 	vector<STrack*> joint_stracks(vector<STrack*> &tlista, vector<STrack> &tlistb);
 	vector<STrack> joint_stracks(vector<STrack> &tlista, vector<STrack> &tlistb);
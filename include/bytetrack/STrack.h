@@ -23,6 +23,8 @@ public:
 	void mark_lost();
 	void mark_removed();
 	int next_id();
+	static int get_id_count();
+	static void set_id_count(int count);
 	int end_frame();
 	
 	void activate(byte_kalman::KalmanFilter &kalman_filter, int frame_id);
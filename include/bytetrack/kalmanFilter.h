@@ -2,6 +2,8 @@
 
 #include "bytetrack/dataType.h"
 
+#include <vector>
+
 namespace byte_kalman
 {
 	class KalmanFilter
@@ -11,6 +13,7 @@ namespace byte_kalman
 		KalmanFilter();
 		KAL_DATA initiate(const DETECTBOX& measurement);
 		void predict(KAL_MEAN& mean, KAL_COVA& covariance);
+		void predict_batch(std::vector<KAL_MEAN*>& means, std::vector<KAL_COVA*>& covariances);
 		KAL_HDATA project(const KAL_MEAN& mean, const KAL_COVA& covariance);
 		KAL_DATA update(const KAL_MEAN& mean,
 			const KAL_COVA& covariance,
@@ -8,12 +8,16 @@
 #include <thread>
 #include <atomic>
 #include <condition_variable>
+#include <future>
 #include <nlohmann/json.hpp>
 #include <opencv2/opencv.hpp>
 #include "component.h"
 #include "components/processor/object_detector_processor.h"
 #include "components/processor/object_tracker_processor.h"
 #include "components/telemetry.h"
+#include "utils/frame_pool.h"
+#include "utils/motion_gate.h"
+#include "utils/pipeline_heartbeat.h"
 
 namespace tapi {
 
@@ -177,6 +181,62 @@ public:
      */
     nlohmann::json getStatus(bool includeComponents = true) const;
 
+    /**
+     * @brief Lock-free mirror of the fields the dashboard polls
+     *
+     * Published copy-on-write from the mutation sites (component
+     * add/remove, start/stop, rename), so status readers never touch
+     * mutex_ and cannot stall the processing thread.
+     */
+    struct StatusSnapshot {
+        std::string id;            ///< Camera ID
+        std::string name;          ///< Camera name
+        bool running = false;      ///< Whether camera is running
+        bool hasSource = false;    ///< Whether a source component is attached
+        size_t processorCount = 0; ///< Number of processor components
+        size_t sinkCount = 0;      ///< Number of sink components
+    };
+
+    /**
+     * @brief Get the current status snapshot without taking any locks
+     *
+     * The returned snapshot stays valid and immutable for as long as the
+     * caller holds it; concurrent mutations publish a fresh copy instead
+     * of touching it.
+     *
+     * @return std::shared_ptr<const StatusSnapshot> Current snapshot
+     */
+    std::shared_ptr<const StatusSnapshot> getStatusSnapshot() const;
+
+    /**
+     * @brief Per-stage pipeline heartbeats (lock-free)
+     *
+     * Read by the watchdog and the status fast path; written from the
+     * processing threads with relaxed atomics.
+     */
+    const utils::PipelineHeartbeats& getHeartbeats() const { return heartbeats_; }
+
+    /**
+     * @brief Whether the watchdog currently considers this camera stalled
+     */
+    bool isStalled() const { return stalled_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Set the watchdog's stall verdict (watchdog thread only)
+     */
+    void setStalled(bool stalled) { stalled_.store(stalled, std::memory_order_relaxed); }
+
+    /**
+     * @brief Stop and restart the source component in place
+     *
+     * The camera's reconnect path for the watchdog: processors, sinks and
+     * the processing task keep running; only the source is bounced, which
+     * rebuilds its capture pipeline from the cached description.
+     *
+     * @return true if the source restarted successfully
+     */
+    bool restartSource();
+
     /**
      * @brief Process a single frame from the source through the pipeline
      * 
@@ -202,6 +262,18 @@ public:
      */
     std::vector<uchar> getLatestFrameJpeg(int quality = 90) const;
 
+    /**
+     * @brief Get latest frame encoded as JPEG from the shared encode cache
+     *
+     * Encodes at most once per published frame and quality; concurrent
+     * callers share the cached buffer without re-encoding.
+     *
+     * @param quality JPEG quality (0-100)
+     * @param generation Set to the frame generation the bytes were encoded from
+     * @return Shared JPEG buffer (nullptr if no frame available)
+     */
+    std::shared_ptr<const std::vector<uchar>> getLatestFrameJpegCached(int quality, uint64_t& generation) const;
+
     /**
      * @brief Get the latest raw (unprocessed) frame
      * 
@@ -217,6 +289,25 @@ public:
      */
     std::vector<uchar> getRawFrameJpeg(int quality = 90) const;
 
+    /**
+     * @brief Get latest raw frame encoded as JPEG from the shared encode cache
+     *
+     * @param quality JPEG quality (0-100)
+     * @param generation Set to the frame generation the bytes were encoded from
+     * @return Shared JPEG buffer (nullptr if no frame available)
+     */
+    std::shared_ptr<const std::vector<uchar>> getRawFrameJpegCached(int quality, uint64_t& generation) const;
+
+    /**
+     * @brief Get the frame generation counter
+     *
+     * Incremented each time a new frame pair is published. Frame routes use
+     * it to key the encoded-frame cache and ETag/304 handling.
+     *
+     * @return uint64_t Current frame generation
+     */
+    uint64_t getFrameGeneration() const;
+
     /**
      * @brief Get the latest detections from object detector processors
      * 
@@ -240,19 +331,99 @@ public:
 
 private:
     /**
-     * @brief Background processing thread function
-     * 
-     * Continuously processes frames as long as the camera is running
+     * @brief Run one processing cycle on a shared worker
+     *
+     * Processes a single frame and returns the delay before the next cycle,
+     * preserving the pacing previously implemented by the per-camera thread
+     * (file sources defer to GStreamer timing, live sources skip waits when
+     * processing falls behind real time).
+     *
+     * @return std::chrono::milliseconds Delay before the next cycle
+     */
+    std::chrono::milliseconds runProcessingCycle();
+
+    /**
+     * @brief Result of the asynchronous detection stage for one frame
+     */
+    struct DetectionStageResult {
+        cv::Mat processedFrame;                                     ///< Frame after detector annotations
+        std::vector<ObjectDetectorProcessor::Detection> detections; ///< Detections from all detectors
+        std::vector<TelemetryEvent> telemetryEvents;                ///< Detection telemetry events
+        bool ok = true;                                             ///< Whether the stage succeeded
+        bool detectionsFresh = true;                                ///< False on frames the detector stride skipped
+    };
+
+    /**
+     * @brief In-flight detection stage for the previous frame
+     *
+     * The detector stage runs asynchronously so the next frame's capture and
+     * preprocessing overlap with the inference round trip; the tracker and
+     * downstream stages consume the result when it lands one cycle later.
+     */
+    struct PendingDetection {
+        bool active = false;                       ///< Whether a stage is in flight
+        std::future<DetectionStageResult> future;  ///< Joins the async detector stage
+        FramePtr rawHandle;                        ///< Keeps the pooled raw frame alive
+        int64_t timestamp = 0;                     ///< Capture timestamp (ms since epoch)
+    };
+
+    /**
+     * @brief Run all object detectors for one frame
+     *
+     * Executed on a separate thread via std::async; everything it touches is
+     * private to the call (frame header, detections, telemetry).
+     *
+     * @param processors Snapshot of the camera's processors
+     * @param frame Frame to run detection on (annotated in place)
+     * @param timestamp Capture timestamp for telemetry events
+     * @param frameIndex Pipeline frame counter, gates per-detector strides
+     * @param motionRois Motion regions for ROI-cropped detection (may be empty)
+     * @param detectorPlane Source-produced frame pre-scaled to the model
+     *                      input size (may be null; detectors resize then)
+     * @return DetectionStageResult Annotated frame, detections and events
      */
-    void processingThread();
+    DetectionStageResult runDetectionStage(
+        const std::vector<std::shared_ptr<ProcessorComponent>>& processors,
+        cv::Mat frame, int64_t timestamp, uint64_t frameIndex,
+        std::vector<cv::Rect> motionRois, FramePtr detectorPlane);
+
+    /**
+     * @brief Run the post-detection stages for one frame
+     *
+     * Trackers, zone managers, classifiers, sinks and result publication,
+     * consuming the output of a (possibly asynchronous) detection stage.
+     *
+     * @param rawFrame Unannotated frame the stage belongs to
+     * @param stage Detection stage output for that frame
+     * @param timestamp Capture timestamp for telemetry events
+     * @return true if the frame completed successfully
+     */
+    bool completeFrame(const cv::Mat& rawFrame, DetectionStageResult stage, int64_t timestamp);
+
+    /**
+     * @brief Record that a consumer requested the annotated frame
+     *
+     * Keeps annotation drawing alive for kAnnotationIdleTimeoutMs; called
+     * by the frame getters on every snapshot or stream request.
+     */
+    void markFrameRequested() const;
 
     /**
      * @brief Helper method to stop components in case of startup failure
-     * 
+     *
      * Ensures clean shutdown of any components that were started
      */
     void stopComponents();
 
+    /**
+     * @brief Rebuild and publish the status snapshot (call with mutex_ held)
+     *
+     * Copies the polled fields into a fresh StatusSnapshot and swaps it
+     * in atomically; readers on getStatusSnapshot() keep whichever copy
+     * they already loaded.
+     */
+    void publishStatusSnapshot();
+
 private:
     std::string id_;                                   ///< Camera ID
     std::string name_;                                 ///< Camera name
@@ -268,15 +439,69 @@ private:
     cv::Mat latestFrame_;                              ///< Latest processed frame
     std::vector<ObjectDetectorProcessor::Detection> latestDetections_; ///< Latest object detections
     std::vector<ObjectTrackerProcessor::TrackedObject> latestTrackedObjects_; ///< Latest tracked objects
-    std::vector<TelemetryEvent> latestTelemetryEvents_; ///< Latest telemetry events
+    TelemetryEventList latestTelemetryEvents_;         ///< Latest frame's shared event batch
     mutable std::mutex mutex_;                         ///< Mutex for thread safety
     mutable std::mutex frameMutex_;                    ///< Mutex for frame access
 
-    // Background processing
-    std::thread processingThread_;                     ///< Background thread for continuous processing
-    std::atomic<bool> stopProcessing_;                 ///< Flag to stop the processing thread
-    std::condition_variable processingCV_;             ///< Condition variable for thread synchronization
-    std::mutex processingMutex_;                       ///< Mutex for condition variable
+    /// Copy-on-write status mirror; access only via std::atomic_load/store
+    std::shared_ptr<const StatusSnapshot> statusSnapshot_;
+
+    /**
+     * @brief Cached JPEG encode of a published frame
+     *
+     * Valid while generation matches frameGeneration_ and quality matches
+     * the requested quality; otherwise the next request re-encodes.
+     */
+    struct EncodedFrameCache {
+        std::shared_ptr<const std::vector<uchar>> jpeg; ///< Encoded bytes, shared with responses
+        uint64_t generation = 0;                        ///< Frame generation the bytes were encoded from
+        int quality = -1;                               ///< JPEG quality used for the encode
+    };
+
+    std::atomic<uint64_t> frameGeneration_;            ///< Bumped on each published frame pair
+    mutable EncodedFrameCache latestFrameJpegCache_;   ///< Encode cache for the processed frame
+    mutable EncodedFrameCache rawFrameJpegCache_;      ///< Encode cache for the raw frame
+    mutable std::mutex encodeMutex_;                   ///< Serializes on-demand JPEG encodes
+
+    /**
+     * Annotation is demand-driven: frame getters stamp this on every
+     * request, and the processing thread keeps drawing only while a
+     * request landed within the timeout (or an annotated-frame sink is
+     * running). Headless cameras skip all draw work and frame clones.
+     */
+    mutable std::atomic<int64_t> lastFrameRequestMs_;  ///< Last time an annotated frame was requested
+    static constexpr int64_t kAnnotationIdleTimeoutMs = 5000; ///< Viewer inactivity before drawing stops
+
+    /**
+     * Idle decode suspension: raw and annotated frame getters both stamp
+     * this clock, and when it goes stale with no processor or sink
+     * running the source parks in grab-only mode (see
+     * GStreamerSource::setSuspended). The next consumer request resumes
+     * decode on the following processing cycle.
+     */
+    mutable std::atomic<int64_t> lastConsumerRequestMs_; ///< Last time any frame consumer asked for pixels
+    static constexpr int64_t kIdleSuspendTimeoutMs = 10000; ///< Consumer inactivity before decode suspends
+
+    /**
+     * Glass-to-glass latency guard: each frame carries its capture time
+     * from the source, the age is published as the "frame_age" stage
+     * histogram, and a frame already older than the budget when it
+     * reaches processing sheds its inference pass so the pipeline can
+     * catch up (the tracker bridges the gap like any stride frame).
+     */
+    LatencyMetrics::StageHandle frameAgeHandle_;       ///< Cached (frame_age, camera) histogram handle
+    static constexpr int64_t kFrameAgeBudgetMs = 750;  ///< Capture-to-processing age that sheds inference
+
+    // Background processing (scheduled on the CameraManager worker pool)
+    std::atomic<bool> stopProcessing_;                 ///< Flag to stop processing cycles
+    utils::PipelineHeartbeats heartbeats_;             ///< Lock-free per-stage progress beacons
+    std::atomic<bool> stalled_{false};                 ///< Watchdog stall verdict (relaxed)
+    bool isFileSource_;                                ///< Whether the source is a file (affects pacing)
+    int64_t lastFrameTimestamp_;                       ///< Timestamp of the last processed frame (ms)
+    int skippedFrames_;                                ///< Waits skipped to catch up with real time
+    PendingDetection pendingDetection_;                ///< Detection stage in flight for the previous frame
+    uint64_t frameIndex_;                              ///< Pipeline frame counter for stride scheduling
+    MotionGate motionGate_;                            ///< Suppresses inference on static frames when configured
 };
 
 } // namespace tapi 
\ No newline at end of file
@@ -4,8 +4,13 @@
 #include <memory>
 #include <unordered_map>
 #include <mutex>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
 #include "camera.h"
 #include "license.h"
+#include "utils/worker_pool.h"
 
 namespace tapi {
 
@@ -76,10 +81,17 @@ public:
     
     /**
      * @brief Get all cameras
-     * 
-     * @return std::vector<std::shared_ptr<Camera>> Vector of all cameras
+     *
+     * Returns the current registry snapshot with a single atomic load —
+     * no lock and no per-call copy. The snapshot is immutable; camera
+     * add/remove swaps in a fresh list, and callers iterating an older
+     * one simply see the registry as of their load. Reads outnumber
+     * registry changes by orders of magnitude, so the copy cost sits on
+     * the rare writer.
+     *
+     * @return Immutable shared list of all cameras
      */
-    std::vector<std::shared_ptr<Camera>> getAllCameras();
+    std::shared_ptr<const std::vector<std::shared_ptr<Camera>>> getAllCameras() const;
     
     /**
      * @brief Delete a camera by ID
@@ -91,15 +103,78 @@ public:
     
     /**
      * @brief Get the camera license manager
-     * 
+     *
      * @return const CameraLicenseManager& Reference to the camera license manager
      */
     const CameraLicenseManager& getCameraLicenseManager() const;
-    
+
+    /**
+     * @brief Validate licenses for a batch of cameras in one pass
+     *
+     * Pass-through to CameraLicenseManager::validateCameraLicenses so a
+     * fleet restore revalidates every camera from one entitlement
+     * snapshot instead of one lock round-trip per camera.
+     *
+     * @param cameraIds Camera IDs to validate
+     * @return Map of camera ID to validity
+     */
+    std::unordered_map<std::string, bool> validateCameraLicenses(const std::vector<std::string>& cameraIds);
+
+    /**
+     * @brief Restrict this process to one shard of the camera id space
+     *
+     * In shard mode each worker process owns the cameras whose id hashes
+     * to its shard index; createCamera() refuses ids owned by other
+     * shards, so workers restoring the shared saved configuration each
+     * bring up only their subset. Call before any cameras are created.
+     *
+     * @param shardIndex This worker's shard (0-based)
+     * @param shardCount Total number of shards
+     */
+    void setShardPolicy(int shardIndex, int shardCount);
+
+    /**
+     * @brief Whether this process's shard owns the given camera id
+     *
+     * Always true when no shard policy is set (single-process mode).
+     *
+     * @param id Camera ID
+     * @return true if this process should host the camera
+     */
+    bool ownsCameraId(const std::string& id) const;
+
+    /**
+     * @brief Get the shared pipeline worker pool
+     *
+     * All per-camera frame processing is scheduled on this pool, so the
+     * number of processing threads is bounded by core count rather than
+     * camera count.
+     *
+     * @return WorkerPool& Reference to the worker pool
+     */
+    WorkerPool& getWorkerPool();
+
 private:
     // Private constructor for singleton
     CameraManager();
-    
+
+    /**
+     * @brief Destructor - stops the watchdog thread
+     */
+    ~CameraManager();
+
+    /**
+     * @brief Watchdog loop scanning every camera's pipeline heartbeats
+     *
+     * Reads the lock-free per-stage heartbeats a few times a second and
+     * flags cameras whose processing loop or source has gone silent past
+     * the stall threshold (TAPI_WATCHDOG_STALL_SECONDS, default 10). A
+     * capture stall with a live processing loop triggers the camera's
+     * source-restart path, rate-limited per camera; set
+     * TAPI_WATCHDOG_RESTART=0 to only flag and log.
+     */
+    void watchdogLoop();
+
     // Disable copy and move
     CameraManager(const CameraManager&) = delete;
     CameraManager& operator=(const CameraManager&) = delete;
@@ -108,9 +183,24 @@ private:
     
     // Generate a unique ID for cameras
     std::string generateUniqueId();
-    
+
+    /**
+     * @brief Rebuild and publish the registry snapshot (call with camerasMutex_ held)
+     */
+    void publishCameraList();
+
     std::unordered_map<std::string, std::shared_ptr<Camera>> cameras_;
     mutable std::mutex camerasMutex_;
+
+    /// Copy-on-write registry snapshot; access only via std::atomic_load/store
+    std::shared_ptr<const std::vector<std::shared_ptr<Camera>>> cameraList_;
+    WorkerPool workerPool_;          // Shared workers for all camera pipelines
+    std::thread watchdogThread_;     // Scans pipeline heartbeats for stalls
+    std::atomic<bool> watchdogStop_{false};
+    std::mutex watchdogMutex_;       // Pairs with watchdogCv_ for prompt shutdown
+    std::condition_variable watchdogCv_;
+    int shardIndex_;                 // This worker's shard (-1 = no sharding)
+    int shardCount_;                 // Total shards (1 = no sharding)
     LicenseManager licenseManager_;  // Legacy license manager for backward compatibility
     CameraLicenseManager cameraLicenseManager_;  // New per-camera license manager
     bool initialized_;
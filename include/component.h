@@ -4,7 +4,10 @@
 #include <memory>
 #include <vector>
 #include <unordered_map>
+#include <atomic>
 #include <nlohmann/json.hpp>
+#include "utils/component_stats.h"
+#include "utils/latency_metrics.h"
 
 namespace tapi {
 
@@ -110,12 +113,63 @@ public:
      */
     virtual nlohmann::json getStatus() const;
 
+    /**
+     * @brief Export counter/timer state that should survive a restart
+     *
+     * Components with operator-visible accumulations (zone counts, dwell
+     * timers) return them here for the periodic state snapshot; the
+     * default is an empty object for components with nothing to persist.
+     *
+     * @return nlohmann::json Restorable state
+     */
+    virtual nlohmann::json getPersistentState() const { return nlohmann::json::object(); }
+
+    /**
+     * @brief Restore state previously returned by getPersistentState()
+     *
+     * Called once on startup after the component's configuration has been
+     * restored. Unknown or stale entries are skipped, never an error.
+     *
+     * @param state Snapshot produced by getPersistentState()
+     * @return true if the state was applied
+     */
+    virtual bool restorePersistentState(const nlohmann::json& state) { (void)state; return true; }
+
+    /**
+     * @brief Pre-resolved latency histogram handle for this component
+     *
+     * A component belongs to exactly one pipeline stage, so the
+     * (stage, id) pair is resolved once on first use and cached;
+     * per-frame timing then does no string building or map lookup.
+     *
+     * @param stage Pipeline stage name (e.g. "detector", "sink")
+     */
+    const LatencyMetrics::StageHandle& latencyHandle(const std::string& stage);
+
+    /**
+     * @brief Seqlock-published pipeline counters for this component
+     *
+     * The pipeline thread records each processed frame here with two
+     * atomic bumps; metrics and status readers copy the block without
+     * ever taking a lock the frame loop could contend on.
+     */
+    utils::ComponentStats& stats() { return stats_; }
+
+    /**
+     * @brief Read-side access to the published pipeline counters
+     */
+    const utils::ComponentStats& stats() const { return stats_; }
+
 protected:
     std::string id_;               ///< Component ID
     ComponentType type_;           ///< Component type
     Camera* camera_;               ///< Parent camera
     bool running_;                 ///< Whether component is running
     nlohmann::json config_;        ///< Component configuration
+
+private:
+    LatencyMetrics::StageHandle latencyHandle_; ///< Cached (stage, id) handle
+    utils::ComponentStats stats_;               ///< Seqlock-published counters
 };
 
 /**
@@ -222,10 +276,31 @@ public:
     
     /**
      * @brief Get component configuration
-     * 
+     *
      * @return nlohmann::json Current configuration
      */
     nlohmann::json getConfig() const override { return config_; }
+
+    /**
+     * @brief Enable or disable annotation drawing for this processor
+     *
+     * Set by the camera each frame from frame-consumer state so draw work
+     * (and the frame clones it requires) is skipped while nobody is
+     * consuming the annotated stream.
+     *
+     * @param active Whether annotation drawing is wanted
+     */
+    void setAnnotationActive(bool active) { annotationActive_.store(active, std::memory_order_relaxed); }
+
+    /**
+     * @brief Check whether annotation drawing is currently wanted
+     *
+     * @return true if draw work should run this frame
+     */
+    bool isAnnotationActive() const { return annotationActive_.load(std::memory_order_relaxed); }
+
+protected:
+    std::atomic<bool> annotationActive_{true}; ///< Whether annotation drawing is wanted
 };
 
 /**
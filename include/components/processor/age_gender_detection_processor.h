@@ -97,15 +97,58 @@ public:
      */
     std::pair<cv::Mat, std::vector<AgeGenderResult>> processFrame(const cv::Mat& frame);
 
+    /**
+     * @brief Process a frame using candidate regions as crop batches
+     *
+     * Extracts a padded, fixed-size crop per region and packs all crops
+     * into a single batched request instead of shipping the full frame,
+     * then scatters the results back to frame coordinates. Falls back to
+     * the full-frame path when crop batching is disabled or no regions
+     * are supplied.
+     *
+     * @param frame Input frame
+     * @param regions Candidate regions (e.g. tracked-object boxes) in frame coordinates
+     * @return std::pair<cv::Mat, std::vector<AgeGenderResult>> Processed frame with annotations and results
+     */
+    std::pair<cv::Mat, std::vector<AgeGenderResult>> processFrame(const cv::Mat& frame,
+                                                                  const std::vector<cv::Rect>& regions);
+
     /**
      * @brief Detect age and gender in an image
-     * 
+     *
      * @param image Image to process
      * @return std::vector<AgeGenderResult> Detection results
      */
     std::vector<AgeGenderResult> detectAgeGender(const cv::Mat& image);
-    
+
 private:
+    /**
+     * @brief Detect age and gender in a batch of crops with a single request
+     *
+     * @param frame Source frame the crop rects refer to
+     * @param cropRects Clamped crop rectangles in frame coordinates
+     * @return std::vector<AgeGenderResult> Results remapped to frame coordinates
+     */
+    std::vector<AgeGenderResult> detectAgeGenderBatched(const cv::Mat& frame,
+                                                        const std::vector<cv::Rect>& cropRects);
+
+    /**
+     * @brief Expand a candidate region by the configured padding and clamp it to the frame
+     *
+     * @param region Candidate region in frame coordinates
+     * @param frameSize Size of the source frame
+     * @return cv::Rect Clamped crop rectangle (may be empty)
+     */
+    cv::Rect buildCropRect(const cv::Rect& region, const cv::Size& frameSize) const;
+
+    /**
+     * @brief Draw detection results onto a frame
+     *
+     * @param frame Frame to annotate
+     * @param results Results to draw
+     */
+    void drawResults(cv::Mat& frame, const std::vector<AgeGenderResult>& results);
+
     /**
      * @brief Convert image to base64 string
      * 
@@ -153,7 +196,20 @@ private:
      * @return bool Success status
      */
     bool curlPost(const std::string& endpoint, const nlohmann::json& requestJson, nlohmann::json& responseJson);
-    
+
+    /**
+     * @brief Helper function to perform a POST request and return the raw body
+     *
+     * Used by the per-frame detection path, which parses the response with a
+     * SAX handler instead of building a JSON DOM.
+     *
+     * @param endpoint API endpoint (without hostname)
+     * @param requestJson JSON data to send in request body
+     * @param responseBody Output string containing the unparsed response body
+     * @return bool Success status
+     */
+    bool curlPost(const std::string& endpoint, const nlohmann::json& requestJson, std::string& responseBody);
+
     /**
      * @brief Initialize CURL with common settings
      */
@@ -177,6 +233,9 @@ private:
     bool drawDetections_;                 ///< Whether to draw detections on frame
     bool useSharedMemory_;                ///< Whether to use shared memory for image transfer
     float textFontScale_;                 ///< Font scale for text
+    bool cropBatching_;                   ///< Whether to batch region crops into one request
+    int cropSize_;                        ///< Fixed side length crops are resized to
+    int cropPadding_;                     ///< Padding added around candidate regions (pixels)
     int sharedMemoryFd_;                  ///< Shared memory file descriptor
     std::string sharedMemoryKey_;         ///< Current shared memory segment name
     
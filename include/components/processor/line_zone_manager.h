@@ -26,9 +26,20 @@ struct LineCrossingEvent {
     std::map<std::string, std::string> metadata; ///< Additional metadata
 };
 
+/**
+ * @brief Aggregated in/out count change for one zone over one interval
+ */
+struct ZoneCountDelta {
+    std::string zoneId;       ///< Line zone ID
+    int inCount;              ///< "in" crossings during the interval
+    int outCount;             ///< "out" crossings during the interval
+    int64_t intervalStartMs;  ///< Interval start timestamp (ms)
+    int64_t intervalEndMs;    ///< Interval end timestamp (ms)
+};
+
 /**
  * @brief Component for managing line zones to detect object crossings
- * 
+ *
  * This component manages multiple line zones for detecting when objects 
  * cross defined lines. It visualizes the lines and crossing counts on the frame.
  * 
@@ -91,7 +102,24 @@ public:
      * @return JSON object with status information
      */
     nlohmann::json getStatus() const override;
-    
+
+    /**
+     * @brief Export per-zone crossing totals for the state snapshot
+     *
+     * @return JSON object {"zones": {id: {"in": N, "out": N}}}
+     */
+    nlohmann::json getPersistentState() const override;
+
+    /**
+     * @brief Restore per-zone crossing totals after a restart
+     *
+     * Zones that no longer exist in the configuration are skipped.
+     *
+     * @param state Snapshot produced by getPersistentState()
+     * @return true if the state was applied
+     */
+    bool restorePersistentState(const nlohmann::json& state) override;
+
     /**
      * @brief Process a frame with tracked objects to check for line crossings
      * 
@@ -155,6 +183,29 @@ public:
      */
     void clearCrossingEvents();
 
+    /**
+     * @brief Whether per-crossing telemetry events should be published
+     *
+     * True unless count aggregation is enabled (aggregate_counts), in which
+     * case the periodic deltas replace the per-crossing stream unless
+     * emit_crossing_events explicitly keeps it on as well.
+     *
+     * @return true if per-crossing events should be published
+     */
+    bool emitPerCrossingEvents() const;
+
+    /**
+     * @brief Collect aggregated count deltas once the cadence has elapsed
+     *
+     * Returns one delta per zone that saw crossings since the last drain
+     * when at least aggregate_interval_seconds have passed, and an empty
+     * vector otherwise (including when aggregation is disabled).
+     *
+     * @param nowMs Current timestamp in milliseconds
+     * @return Vector of per-zone count deltas, possibly empty
+     */
+    std::vector<ZoneCountDelta> drainCountDeltas(int64_t nowMs);
+
     /**
      * @brief Convert normalized coordinates to pixel coordinates
      * 
@@ -231,6 +282,14 @@ private:
     
     // Stored crossing events
     std::vector<LineCrossingEvent> crossingEvents_;
+
+    // Count aggregation: when enabled, per-crossing telemetry is replaced
+    // by periodic per-zone in/out deltas at the configured cadence
+    bool aggregateCounts_;
+    int aggregateIntervalSeconds_;
+    bool emitCrossingEvents_;
+    std::map<std::string, std::pair<int, int>> pendingDeltas_;  // zone -> (in, out)
+    int64_t intervalStartMs_;
     
     // Mutex for thread safety
     mutable std::mutex mutex_;
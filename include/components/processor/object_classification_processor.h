@@ -1,9 +1,11 @@
 #pragma once
 
 #include "component.h"
+#include "components/processor/object_tracker_processor.h"
 #include <opencv2/opencv.hpp>
 #include <string>
 #include <vector>
+#include <map>
 #include <mutex>
 #include <nlohmann/json.hpp>
 #include <utility> // for std::pair
@@ -92,7 +94,23 @@ public:
      * @return std::pair<cv::Mat, std::vector<Classification>> Processed frame with annotations and classifications
      */
     std::pair<cv::Mat, std::vector<Classification>> processFrame(const cv::Mat& frame);
-    
+
+    /**
+     * @brief Process a frame with per-track classification caching
+     *
+     * Classifies each tracked object's crop on track birth and serves the
+     * cached label afterwards, refreshing on a slow interval or when the
+     * crop appearance drifts (histogram distance). Falls back to the
+     * full-frame path when track caching is disabled or no tracks exist.
+     *
+     * @param frame Input frame
+     * @param trackedObjects Tracked objects from the tracker stage
+     * @return std::pair<cv::Mat, std::vector<Classification>> Processed frame with annotations and classifications
+     */
+    std::pair<cv::Mat, std::vector<Classification>> processFrame(
+        const cv::Mat& frame,
+        const std::vector<ObjectTrackerProcessor::TrackedObject>& trackedObjects);
+
     /**
      * @brief Get available models from the current AI server
      * 
@@ -140,6 +158,24 @@ public:
     std::vector<Classification> classifyImage(const cv::Mat& image);
     
 private:
+    /**
+     * @brief Cached classification state for a single track
+     */
+    struct TrackCacheEntry {
+        std::vector<Classification> classifications; ///< Last accepted results
+        cv::Mat histogram;                           ///< Appearance histogram of the last classified crop
+        int64_t lastRefreshMs = 0;                   ///< When the crop was last sent for inference
+        int64_t lastSeenMs = 0;                      ///< When the track was last observed
+    };
+
+    /**
+     * @brief Compute a normalized hue/saturation histogram for cheap appearance comparison
+     *
+     * @param crop Object crop to summarize
+     * @return cv::Mat Normalized histogram
+     */
+    cv::Mat computeAppearanceHistogram(const cv::Mat& crop) const;
+
     /**
      * @brief Convert image to base64 string
      * 
@@ -212,6 +248,12 @@ private:
     bool drawClassification_;             ///< Whether to draw classification on frame
     bool useSharedMemory_;                ///< Whether to use shared memory for image transfer
     float textFontScale_;                 ///< Font scale for text
+    bool trackCaching_;                   ///< Whether to cache classifications per track
+    int cacheRefreshIntervalMs_;          ///< Slow-path refresh interval for cached tracks
+    float appearanceThreshold_;           ///< Histogram distance that forces a refresh [0-1]
+    std::map<int, TrackCacheEntry> trackCache_; ///< Per-track classification cache
+    uint64_t cacheHits_;                  ///< Frames served from the cache
+    uint64_t cacheMisses_;                ///< Crops sent for inference
     int sharedMemoryFd_;                  ///< Shared memory file descriptor
     std::string sharedMemoryKey_;         ///< Current shared memory segment name
     
@@ -10,8 +10,10 @@
 #include <random>  // for std::mt19937
 #include <memory>  // for std::unique_ptr
 #include <optional> // for std::optional
+#include <fstream> // for the detection trace record stream
 #include <curl/curl.h> // Keep CURL for backwards compatibility
 #include "utils/shm_utils.h" // Add our new utility
+#include "utils/cuda_shm_utils.h" // CUDA shared memory region for GPU-resident tensors
 #include "utils/http_client.h" // Use our custom HTTP client
 #include "utils/grpc_client.h" // Use the actual Triton gRPC client
 #include <chrono> // For std::chrono
@@ -98,6 +100,11 @@ public:
         std::vector<std::string> classes;
         bool drawBoundingBoxes = true;
         float labelFontScale = 0.5f;
+        int frameStride = 1;
+        nlohmann::json motionGating = nlohmann::json::object();
+        bool roiCropping = false;
+        int roiPadding = 32;
+        nlohmann::json cascade = nlohmann::json::object();
     };
     
     InferenceConfig() = default;
@@ -315,7 +322,62 @@ public:
      * @return std::pair<cv::Mat, std::vector<Detection>> Processed frame with annotations and detected objects
      */
     std::pair<cv::Mat, std::vector<Detection>> processFrame(const cv::Mat& frame);
-    
+
+    /**
+     * @brief Process a frame, optionally cropping to motion regions
+     *
+     * With roi_cropping enabled and non-empty motion ROIs, inference
+     * runs on a single merged, padded crop snapped to a model-friendly
+     * multiple of 32, and detections are remapped into full-frame
+     * coordinates. Smaller crops mean smaller shared-memory transfers
+     * and more images per GPU batch.
+     *
+     * When the source supplies a pre-scaled detector plane matching the
+     * model input size, the uncropped path consumes it directly and the
+     * per-frame resize here disappears; detection coordinates are still
+     * remapped from the full frame's dimensions. The ROI-cropped path
+     * ignores the plane since its geometry no longer matches.
+     *
+     * @param frame Input frame
+     * @param motionRois Coarse motion regions from the camera's motion gate
+     * @param detectorPlane Frame pre-scaled to the model input size by the
+     *                      source (may be empty; resize happens here then)
+     * @return std::pair<cv::Mat, std::vector<Detection>> Processed frame with annotations and detected objects
+     */
+    std::pair<cv::Mat, std::vector<Detection>> processFrame(const cv::Mat& frame,
+                                                            const std::vector<cv::Rect>& motionRois,
+                                                            const cv::Mat& detectorPlane = cv::Mat());
+
+    /**
+     * @brief Get the configured model input size in pixels (square)
+     *
+     * Lets the camera size the source's detector plane to match.
+     */
+    int getInputSize() const;
+
+    /**
+     * @brief Get the detector's frame stride
+     *
+     * A stride of N means the camera pipeline runs this detector every
+     * Nth frame; the tracker bridges the gap frames via Kalman
+     * prediction.
+     *
+     * @return int Frame stride (always >= 1)
+     */
+    int getFrameStride() const;
+
+    /**
+     * @brief Get the detector's motion gating configuration
+     *
+     * The camera pipeline uses this to suppress inference on static
+     * frames (see MotionGate). Empty object when gating is not
+     * configured.
+     *
+     * @return nlohmann::json The motion_gating config object
+     */
+    nlohmann::json getMotionGatingConfig() const;
+
+
     /**
      * @brief Get available models from the current AI server
      * 
@@ -355,20 +417,61 @@ public:
     
     /**
      * @brief Send an image to the AI server for detection (legacy version)
-     * 
+     *
      * @param image Image to process
      * @return std::vector<Detection> Detected objects
      */
     std::vector<Detection> detectObjects(const cv::Mat& image);
-    
+
 private:
     // New improved methods
-    
+
     /**
      * @brief Get model configuration for current model
      */
     InferenceConfig::ModelConfig getModelConfiguration() const;
-    
+
+    /**
+     * @brief Run one detection pass with an explicit model configuration
+     *
+     * The shared inference path behind detectObjectsImproved and the
+     * cascade gate: preprocess, session setup, (batched) inference,
+     * result parsing and NMS, all against the given model.
+     */
+    Result<std::vector<Detection>> detectWithModel(const cv::Mat& image,
+                                                   const InferenceConfig::ModelConfig& modelConfig);
+
+    /**
+     * @brief Run the cheap first-stage model over the frame
+     *
+     * Returns true when the gating model found anything at or above the
+     * gate threshold (so the heavy model should run), false when the
+     * frame can be declared empty without paying for the heavy model.
+     * Gate failures fail open — a broken gating model must not blind
+     * the camera.
+     */
+    bool runCascadeGate(const cv::Mat& image);
+
+    /**
+     * @brief Load a recorded detection-response trace for replay
+     *
+     * The trace is JSONL, one line per inferred frame:
+     * {"frame": N, "detections": [{"class_name", "confidence",
+     * "bbox": [x, y, w, h]}]}. While a trace is loaded the live
+     * inference backend is bypassed entirely, so a file-source camera
+     * replays the full tracker/zones/sinks pipeline deterministically.
+     *
+     * @param path Trace file path
+     * @return true if the trace was loaded
+     */
+    bool loadDetectionTrace(const std::string& path);
+
+    /**
+     * @brief Append one frame's detections to the trace being recorded
+     */
+    void recordTraceFrame(uint64_t frameIndex, const std::vector<Detection>& detections);
+
+
     /**
      * @brief Preprocess image for inference
      */
@@ -383,9 +486,20 @@ private:
     /**
      * @brief Parse inference results into detections
      */
-    Result<std::vector<Detection>> parseInferenceResults(const triton::client::InferResult& result, 
-                                                       const InferenceContext& context, 
+    Result<std::vector<Detection>> parseInferenceResults(const triton::client::InferResult& result,
+                                                       const InferenceContext& context,
                                                        const InferenceConfig::ModelConfig& config);
+
+    /**
+     * @brief Parse a demultiplexed slice of a batched inference response
+     *
+     * Equivalent to parseInferenceResults but reads raw output buffers
+     * returned by the cross-camera InferenceBatcher.
+     */
+    Result<std::vector<Detection>> parseBatchedResults(
+        const std::map<std::string, std::vector<uint8_t>>& outputs,
+        const InferenceContext& context,
+        const InferenceConfig::ModelConfig& config);
     
     /**
      * @brief Apply non-maximum suppression to detections
@@ -397,6 +511,16 @@ private:
      * @brief Draw bounding boxes on image
      */
     void drawDetections(cv::Mat& image, const std::vector<Detection>& detections) const;
+
+    /**
+     * @brief Build the inference crop window from motion ROIs
+     *
+     * Merges the ROIs into one bounding rect, pads it, snaps width and
+     * height up to multiples of 32 and clamps to the frame. Returns an
+     * empty rect when cropping would not shrink the tensor meaningfully.
+     */
+    cv::Rect buildRoiCropRect(const std::vector<cv::Rect>& motionRois,
+                              const cv::Size& frameSize, int padding) const;
     
     /**
      * @brief Log inference latency information
@@ -409,7 +533,10 @@ private:
     
     /**
      * @brief Convert image to base64 string
-     * 
+     *
+     * Last-resort fallback only; the inference hot path sends raw tensor
+     * bytes (binary HTTP/gRPC or shared memory) and never base64 JSON.
+     *
      * @param image Image to convert
      * @return std::string Base64-encoded image
      */
@@ -504,8 +631,12 @@ private:
     std::unique_ptr<InferenceClient> inferenceClient_;
     
     // Shared memory utility
-    std::unique_ptr<utils::TritonSharedMemory> shm_;
-    
+    std::shared_ptr<utils::TritonSharedMemory> shm_;  ///< Segment leased from SharedMemoryPool
+
+    // CUDA shared memory upgrade for the grpc_shm protocol
+    std::unique_ptr<utils::TritonCudaSharedMemory> cudaShm_;  ///< Device-resident input region
+    bool useCudaSharedMemory_ = false;    ///< Whether to upgrade grpc_shm to CUDA shared memory
+
     // Legacy HTTP clients (for backward compatibility)
     std::unique_ptr<triton::client::InferenceServerHttpClient> http_client_;
     std::unique_ptr<triton::client::InferenceServerGrpcClient> grpc_client_;
@@ -517,6 +648,7 @@ private:
     mutable std::mutex mutex_;            ///< Mutex for thread safety
     
     std::string lastError_;               ///< Last error message
+    cv::Mat detectorPlane_;               ///< Pre-scaled model input for the current frame (detection-stage thread only)
     int processedFrames_;                 ///< Counter for processed frames
     int detectionCount_;                  ///< Counter for total detected objects
     std::mt19937 rng_;                    ///< Random number generator for shared memory keys
@@ -535,6 +667,45 @@ private:
     
     //! Flag to control verbose logging (latency measurements every frame)
     bool verboseLogging_;
+
+    //! Whether to coalesce inference calls through the cross-camera batcher
+    bool batchedInference_ = true;
+
+    //! QoS tier passed to the batcher; higher tiers preempt queue position
+    int inferencePriority_ = 0;
+
+    //! Freshness budget for batched frames in milliseconds (0 = no deadline)
+    int inferenceDeadlineMs_ = 0;
+
+    //! Whether a cheap first-stage model gates the configured heavy model
+    bool cascadeEnabled_ = false;
+
+    //! Model id of the first-stage gating model
+    std::string cascadeModelId_;
+
+    //! Minimum gate confidence that triggers the heavy model
+    float cascadeGateThreshold_ = 0.25f;
+
+    //! Frames the gate evaluated since start
+    int cascadeGatedFrames_ = 0;
+
+    //! Frames where the gate let the heavy model be skipped
+    int cascadeSuppressedFrames_ = 0;
+
+    //! Trace file being recorded, empty when not recording
+    std::string traceRecordPath_;
+
+    //! Trace file being replayed, empty when replaying is off
+    std::string traceReplayPath_;
+
+    //! Open record stream (JSONL, one line per inferred frame)
+    std::unique_ptr<std::ofstream> traceRecordFile_;
+
+    //! Per-frame detections loaded from the replay trace
+    std::vector<std::vector<Detection>> traceReplayFrames_;
+
+    //! Next frame index into the trace (record and replay)
+    uint64_t traceFrameIndex_ = 0;
 };
 
 } // namespace tapi 
\ No newline at end of file
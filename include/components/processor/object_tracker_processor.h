@@ -1,7 +1,6 @@
 #pragma once
 
 #include "component.h"
-//#include "ByteTrack/BYTETracker.h"
 #include "components/processor/object_detector_processor.h"
 #include <opencv2/opencv.hpp>
 #include <string>
@@ -20,6 +19,14 @@ namespace tapi {
 
 /**
  * @brief Object tracking processor component using ByteTracker
+ *
+ * Tracking is partitioned per class: each class label gets its own
+ * ByteTracker instance, so association solves several small cost
+ * matrices instead of one spanning every class. Cross-class matches
+ * were never kept anyway, and the assignment step is superlinear in
+ * matrix size, so mixed scenes get cheaper without changing results.
+ * Track IDs stay globally unique because STrack draws them from a
+ * shared counter.
  */
 class ObjectTrackerProcessor : public ProcessorComponent {
 public:
@@ -102,9 +109,22 @@ public:
      * @return std::pair<cv::Mat, std::vector<TrackedObject>> Processed frame with annotations and tracked objects
      */
     std::pair<cv::Mat, std::vector<TrackedObject>> processFrame(
-        const cv::Mat& frame, 
+        const cv::Mat& frame,
         const std::vector<ObjectDetectorProcessor::Detection>& detections);
-    
+
+    /**
+     * @brief Advance tracks one frame without fresh detections
+     *
+     * Used on frames the detector skips (frame stride > 1): existing
+     * tracks are moved forward via Kalman prediction so zones and sinks
+     * keep seeing smooth motion, without ageing or dropping any track.
+     *
+     * @param frame Input frame
+     * @return std::pair<cv::Mat, std::vector<TrackedObject>> Processed frame with annotations and predicted tracks
+     */
+    std::pair<cv::Mat, std::vector<TrackedObject>> predictFrame(const cv::Mat& frame);
+
+
 private:
     /**
      * @brief Convert ObjectDetectorProcessor::Detection to Object
@@ -113,7 +133,15 @@ private:
      * @return Object ByteTracker compatible object
      */
     Object convertDetection(const ObjectDetectorProcessor::Detection& detection);
-    
+
+    /**
+     * @brief Get (or lazily create) the tracker for a class partition
+     *
+     * @param label Numeric class label the partition is keyed on
+     * @return BYTETracker& Tracker instance for that class
+     */
+    BYTETracker& trackerForLabel(int label);
+
     /**
      * @brief Draw tracking information on the frame
      * 
@@ -122,7 +150,21 @@ private:
      * @return cv::Mat Frame with tracking visualizations
      */
     cv::Mat drawTracking(const cv::Mat& frame, const std::vector<TrackedObject>& trackedObjects);
-    
+
+    /**
+     * @brief Douglas-Peucker tolerance for trajectories serialized into events
+     *
+     * @return double Tolerance in pixels (0 = simplification off)
+     */
+    double getTrajectoryEpsilon() const { return trajectoryEpsilon_; }
+
+    /**
+     * @brief Cap on trajectory points serialized per tracking event
+     *
+     * @return size_t Maximum points (0 = uncapped)
+     */
+    size_t getTrajectoryMaxPoints() const { return trajectoryMaxPoints_; }
+
 private:
     std::string type_;                    ///< Component type
     int frameRate_;                       ///< Camera frame rate for tracking calculations
@@ -141,8 +183,9 @@ private:
     std::vector<cv::Scalar> classColorMap_;   ///< Colors mapped to class names (same index as uniqueClassNames_)
     mutable std::mutex mutex_;            ///< Mutex for thread safety
     
-    std::unique_ptr<BYTETracker> tracker_; ///< ByteTracker instance
-    
+    std::map<int, std::unique_ptr<BYTETracker>> trackers_; ///< Per-class ByteTracker instances keyed by numeric label
+    std::map<int, std::vector<unsigned char>> trackerStates_; ///< Saved per-class tracker state for warm restarts
+
     int totalTrackedObjects_;             ///< Total number of objects tracked
     int activeTrackedObjects_;            ///< Number of currently active tracked objects
     int processedFrames_;                 ///< Counter for processed frames
@@ -158,6 +201,8 @@ private:
     size_t trajectoryMaxLength_;          ///< Maximum number of trajectory points to keep
     float maxAllowedDistanceRatio_;       ///< Maximum allowed distance between consecutive points as ratio of frame width
     int trajectoryCleanupThreshold_;      ///< Number of frames after which to remove disappeared tracks
+    double trajectoryEpsilon_;            ///< Douglas-Peucker tolerance (pixels) for serialized trajectories, 0 = off
+    size_t trajectoryMaxPoints_;          ///< Cap on serialized trajectory points per event, 0 = uncapped
     
     // Trajectory storage (moved from static variables in processFrame)
     std::map<int, std::vector<cv::Point>> trajectoryHistory_; ///< Trajectory history per track ID
@@ -2,6 +2,7 @@
 
 #include "component.h"
 #include "geometry/polygon_zone.h"
+#include "geometry/zone_grid.h"
 #include "components/processor/object_tracker_processor.h"
 #include "components/processor/zone_timer.h"
 #include "components/telemetry.h"
@@ -88,6 +89,24 @@ public:
      * @return Component status as JSON
      */
     nlohmann::json getStatus() const override;
+
+    /**
+     * @brief Export per-zone occupancy totals and dwell accumulations
+     *
+     * @return JSON object {"zones": {id: {"in": N, "out": N}},
+     *         "dwell": ZoneTimer accumulations}
+     */
+    nlohmann::json getPersistentState() const override;
+
+    /**
+     * @brief Restore per-zone totals and dwell accumulations after a restart
+     *
+     * Zones that no longer exist in the configuration are skipped.
+     *
+     * @param state Snapshot produced by getPersistentState()
+     * @return true if the state was applied
+     */
+    bool restorePersistentState(const nlohmann::json& state) override;
     
     /**
      * @brief Process a frame with tracked objects to detect zone events
@@ -243,6 +262,7 @@ private:
     mutable std::mutex mutex_; ///< Mutex for thread safety
     std::vector<PolygonZoneEvent> zoneEvents_; ///< List of zone events
     ZoneTimer zoneTimer_; ///< Timer for tracking time in zones
+    ZoneGrid zoneGrid_; ///< Spatial index over zone bounding boxes
     
     // Visualization options
     bool drawZones_; ///< Whether to draw zones on the output frame
@@ -4,14 +4,22 @@
 #include <string>
 #include <chrono>
 #include <mutex>
+#include <queue>
 #include <vector>
+#include <nlohmann/json.hpp>
 
 namespace tapi {
 
 /**
  * @brief Class for tracking how long objects stay in zones
- * 
+ *
  * This class keeps track of the time that objects spend inside polygon zones.
+ *
+ * Accounting is interval-based: only entry timestamps are recorded, dwell
+ * is computed lazily on exit or on query, and state for long-departed
+ * objects is retired through a time-ordered heap. Per-frame work is
+ * proportional to membership changes, not to the number of objects
+ * standing still.
  */
 class ZoneTimer {
 public:
@@ -19,20 +27,24 @@ public:
      * @brief Constructor
      */
     ZoneTimer();
-    
+
     /**
      * @brief Reset all timers
      */
     void reset();
-    
+
     /**
-     * @brief Update timers for objects in a zone
-     * 
+     * @brief Record zone membership for this frame
+     *
+     * New objects get an entry timestamp, departed objects fold their
+     * session into the accumulated total, and objects still in the zone
+     * cost one hash lookup each. Dwell times are computed on demand by
+     * the query methods, not here.
+     *
      * @param zoneId ID of the zone
      * @param objectIds List of track IDs currently in the zone
-     * @return Map of object IDs to durations in seconds
      */
-    std::unordered_map<int, double> update(const std::string& zoneId, const std::vector<int>& objectIds);
+    void update(const std::string& zoneId, const std::vector<int>& objectIds);
     
     /**
      * @brief Get time spent in zone for a specific object
@@ -50,14 +62,59 @@ public:
      * @return Map of object IDs to durations in seconds
      */
     std::unordered_map<int, double> getAllTimesInZone(const std::string& zoneId) const;
-    
+
+    /**
+     * @brief Export accumulated durations for a restart-safe snapshot
+     *
+     * Only completed sessions are exported; entry timestamps of objects
+     * still in a zone are wall-clock-relative and meaningless after a
+     * restart (their tracks are gone anyway).
+     *
+     * @return nlohmann::json Map of zone ID to {object ID: seconds}
+     */
+    nlohmann::json exportAccumulated() const;
+
+    /**
+     * @brief Merge previously exported accumulated durations
+     *
+     * @param state Snapshot produced by exportAccumulated()
+     */
+    void importAccumulated(const nlohmann::json& state);
+
 private:
+    using SteadyTime = std::chrono::time_point<std::chrono::steady_clock>;
+
+    /**
+     * @brief Scheduled retirement of a departed object's accumulated state
+     *
+     * Pushed on exit; when it comes due, the accumulated duration is
+     * dropped unless the object re-entered or exited again since (in
+     * which case a newer heap entry owns the retirement).
+     */
+    struct Retirement {
+        SteadyTime due;      ///< When the state becomes eligible to drop
+        std::string zoneId;  ///< Zone the object left
+        int objectId;        ///< Track ID
+
+        bool operator>(const Retirement& other) const { return due > other.due; }
+    };
+
+    /// Drop state for objects gone past the retention window (due entries only)
+    void retireExpired(SteadyTime currentTime);
+
     // Map of zone IDs to maps of object IDs to entry timestamps
-    std::unordered_map<std::string, std::unordered_map<int, std::chrono::time_point<std::chrono::steady_clock>>> zoneEntryTimes_;
-    
+    std::unordered_map<std::string, std::unordered_map<int, SteadyTime>> zoneEntryTimes_;
+
     // Map of zone IDs to maps of object IDs to accumulated durations (for objects that leave and re-enter)
     std::unordered_map<std::string, std::unordered_map<int, double>> accumulatedTimes_;
-    
+
+    // Last exit timestamp per departed object, consulted when retirements
+    // come due so a re-exit extends the retention window
+    std::unordered_map<std::string, std::unordered_map<int, SteadyTime>> lastExitTimes_;
+
+    // Time-ordered retirement queue; only due entries do per-frame work
+    std::priority_queue<Retirement, std::vector<Retirement>, std::greater<Retirement>> retireHeap_;
+
     // Mutex for thread safety
     mutable std::mutex mutex_;
 };
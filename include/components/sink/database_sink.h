@@ -2,6 +2,8 @@
 
 #include "component.h"
 #include "components/telemetry.h"
+#include "components/sink/frame_store.h"
+#include "utils/jpeg_encoder.h"
 #include <opencv2/opencv.hpp>
 #include <string>
 #include <mutex>
@@ -9,6 +11,9 @@
 #include <sqlite3.h>
 #include <atomic>
 #include <functional>
+#include <thread>
+#include <condition_variable>
+#include <queue>
 
 namespace tapi {
 
@@ -32,7 +37,9 @@ public:
         BOTTOM_RIGHT
     };
 
-    // Structure to hold a batch of telemetry data
+    // Structure to hold a batch of telemetry data. The frame is a shared
+    // header of the camera's published (immutable, pool-backed) frame;
+    // queueing it costs a refcount, not a copy.
     struct TelemetryBatch {
         cv::Mat frame;
         std::vector<TelemetryEvent> events;
@@ -140,7 +147,54 @@ public:
     nlohmann::json getEventSummary(const std::string& cameraId) const;
     nlohmann::json getZoneLineCounts(const std::string& cameraId, int64_t start_time = 0, int64_t end_time = 0) const;
     nlohmann::json getClassBasedHeatmapData(const std::string& cameraId) const;
-    
+
+    /**
+     * @brief Serialize one page of telemetry events straight to JSON text
+     *
+     * Cursor-based export path: rows are appended to the output string as
+     * SQLite steps them, so memory stays flat at one row plus the page
+     * buffer no matter how many events the camera has. The cursor is the
+     * last seen event id (keyset pagination — no OFFSET scans); pass 0 to
+     * start and the returned next_cursor to continue. The stored
+     * properties column is already validated JSON and is spliced into the
+     * output verbatim, skipping a parse/re-dump round trip per row.
+     *
+     * @param cameraId Camera whose events to export
+     * @param cursor Last event id of the previous page (0 = from start)
+     * @param limit Page size (clamped to 1-1000)
+     * @param start_time Optional timestamp lower bound (0 = unbounded)
+     * @param end_time Optional timestamp upper bound (0 = unbounded)
+     * @return std::string Complete JSON payload:
+     *         {"events":[...],"next_cursor":N,"has_more":bool}
+     */
+    std::string streamEvents(const std::string& cameraId, int64_t cursor, int limit,
+                             int64_t start_time = 0, int64_t end_time = 0) const;
+
+    /**
+     * @brief Export a time range of events as a compact columnar payload
+     *
+     * Bulk-export path for offline analytics: instead of paging JSON rows,
+     * the whole range is written once as little-endian column blocks —
+     * int64 timestamps, uint8 event types, and dictionary-encoded
+     * source/class/zone ids (each distinct string stored once, rows carry
+     * uint32 dictionary indices). For typical traffic the repeated string
+     * columns collapse to a few bytes per row, so a day of events is a
+     * few MB instead of hundreds of MB of JSON. Rows stream from one
+     * SQLite cursor straight into the output buffer; peak memory is the
+     * encoded payload plus the dictionaries.
+     *
+     * Layout: "TAPC" magic, uint32 version, uint64 row count, uint32
+     * header length + JSON column descriptions, then the column blocks in
+     * header order.
+     *
+     * @param cameraId Camera whose events to export
+     * @param start_time Optional timestamp lower bound (0 = unbounded)
+     * @param end_time Optional timestamp upper bound (0 = unbounded)
+     * @return std::string Binary payload (empty on database error)
+     */
+    std::string exportEventsColumnar(const std::string& cameraId,
+                                     int64_t start_time = 0, int64_t end_time = 0) const;
+
     /**
      * @brief Generate a heatmap image (simplified stub)
      */
@@ -191,7 +245,54 @@ private:
      * @brief Create database tables if they don't exist
      */
     bool createTables();
-    
+
+    /**
+     * @brief Mutex guarding the database connection
+     *
+     * The per-sink mutex in the default one-database-per-camera layout;
+     * the registry-owned mutex when shared_store is enabled, so batch
+     * transactions from different cameras serialize on the single shared
+     * connection instead of interleaving.
+     */
+    std::mutex& dbLock() const { return sharedDbMutex_ ? *sharedDbMutex_ : dbMutex_; }
+
+    /**
+     * @brief Close or release the database connection (call with dbLock() held)
+     *
+     * Per-camera stores are closed directly; shared-store leases are
+     * handed back to the registry, which closes the one connection when
+     * the last sink detaches.
+     */
+    void closeConnection();
+
+    /**
+     * @brief Prepare the cached insert statements (call with dbMutex_ held)
+     */
+    bool prepareStatements();
+
+    /**
+     * @brief Finalize the cached insert statements (call with dbMutex_ held)
+     */
+    void finalizeStatements();
+
+    /**
+     * @brief Background thread that periodically checkpoints the WAL
+     */
+    void checkpointThreadFunction();
+
+    /**
+     * @brief Run one bounded retention slice (called from the checkpoint thread)
+     *
+     * Deletes at most kRetentionSliceRows expired rows per table per call
+     * — events, frames and rollups each against their own retention
+     * policy — followed by a small incremental vacuum, so space is
+     * reclaimed in rate-limited steps instead of one long pause. Slices
+     * only run while the writer queue is idle; once a pass finds nothing
+     * left to delete the next one is scheduled an hour out. Deleted rows
+     * are published as tapi_retention_deleted_total by table.
+     */
+    void runRetentionSlice();
+
     /**
      * @brief Insert a telemetry event into the database
      */
@@ -217,6 +318,13 @@ private:
      */
     void updateTimeSeriesBuckets(const std::string& cameraId, int64_t timestamp, int eventType, const std::string& className);
     
+    /**
+     * @brief Update per-zone count rollups (minute and hour buckets)
+     */
+    void updateZoneCountBuckets(const std::string& cameraId, const std::string& zoneId,
+                                const std::string& direction, const std::string& className,
+                                int64_t timestamp);
+
     /**
      * @brief Update dwell times aggregate table
      */
@@ -229,8 +337,14 @@ private:
     
     /**
      * @brief Generate a thumbnail from frame
-     */
-    std::string generateThumbnail(const cv::Mat& frame);
+     *
+     * Encodes through the process-wide JpegEncoder so the bytes land in
+     * a pooled, refcounted buffer shared with every other consumer of
+     * that encoder instead of a private copy.
+     *
+     * @return utils::JpegBuffer Encoded thumbnail, nullptr on failure
+     */
+    utils::JpegBuffer generateThumbnail(const cv::Mat& frame);
     
     /**
      * @brief Clean up old data based on retention period
@@ -272,11 +386,18 @@ private:
     bool storeThumbnails_;                ///< Whether to store frame thumbnails
     int thumbnailWidth_;                  ///< Width of thumbnails to store
     int thumbnailHeight_;                 ///< Height of thumbnails to store
-    int retentionDays_;                   ///< Number of days to retain data (0 = forever)
+    int retentionDays_;                   ///< Days to retain raw events (0 = forever)
+    int frameRetentionDays_;              ///< Days to retain frame thumbnails (0 = forever)
+    int rollupRetentionDays_;             ///< Days to retain rollup/aggregate rows (0 = forever)
+    int64_t nextRetentionDueMs_;          ///< Next retention pass (checkpoint-thread only)
     
-    sqlite3* db_;                         ///< SQLite database handle
+    sqlite3* db_;                         ///< SQLite database handle (registry-owned in shared mode)
+    std::shared_ptr<FrameStore> frameStore_; ///< Segment file store for thumbnail blobs (shared in shared mode)
     sqlite3* writerDb_;                   ///< Legacy writer handle (unused in simplified version)
-    mutable std::mutex dbMutex_;          ///< Mutex for database access
+    mutable std::mutex dbMutex_;          ///< Mutex for database access (per-sink layout only)
+    bool sharedStore_;                    ///< Whether this sink uses the process-wide shared store
+    bool sharedMaintenance_;              ///< Whether this sink runs checkpoints/retention for the shared store
+    std::shared_ptr<std::mutex> sharedDbMutex_; ///< Registry-owned connection mutex (shared mode only)
     bool isInitialized_;                  ///< Whether the database is initialized
     int64_t insertedFrames_;              ///< Number of frames inserted
     int64_t insertedEvents_;              ///< Number of events inserted
@@ -284,11 +405,27 @@ private:
     bool storeTrackingEvents_;            ///< Whether to store tracking events
     bool storeCountingEvents_;            ///< Whether to store counting events
 
+    sqlite3_stmt* eventInsertStmt_;       ///< Cached prepared statement for event inserts
+    sqlite3_stmt* frameInsertStmt_;       ///< Cached prepared statement for frame inserts
+
+    std::thread checkpointThread_;        ///< Background WAL checkpoint thread
+    std::atomic<bool> checkpointThreadRunning_; ///< Whether the checkpoint thread should keep running
+    std::condition_variable checkpointCv_; ///< Wakes the checkpoint thread for shutdown
+    std::mutex checkpointMutex_;          ///< Mutex for the checkpoint condition variable
+
+    // Async writer: batches are queued on the camera processing path and
+    // drained by a dedicated writer thread so SQLite latency never shows
+    // up in frame processing
+    std::thread writerThread_;            ///< Dedicated database writer thread
+    std::queue<TelemetryBatch> batchQueue_; ///< Pending batches for the writer thread
+    std::mutex queueMutex_;               ///< Mutex for the batch queue
+    std::condition_variable queueCv_;     ///< Wakes the writer thread on new batches
+    std::atomic<bool> writerThreadRunning_; ///< Whether the writer thread should keep running
+    int maxQueueSize_;                    ///< Queue depth beyond which frame blobs are dropped
+    std::atomic<int> queuedBatches_;      ///< Current number of queued batches
+
     // Legacy fields (kept for compatibility but unused in simplified version)
-    std::atomic<bool> writerThreadRunning_;
-    int maxQueueSize_;
     int batchSize_;
-    std::atomic<int> queuedBatches_;
     size_t maxMemoryUsage_;
     std::atomic<size_t> currentMemoryUsage_;
 };
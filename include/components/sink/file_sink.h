@@ -1,8 +1,11 @@
 #pragma once
 
 #include "component.h"
+#include "components/telemetry.h"
 #include <opencv2/opencv.hpp>
 #include <string>
+#include <deque>
+#include <vector>
 #include <mutex>
 #include <memory>
 
@@ -73,29 +76,170 @@ public:
     
     /**
      * @brief Process a frame and write it to file
-     * 
+     *
      * @param frame The frame to process
      * @return true if processing succeeded, false otherwise
      */
     bool processFrame(const cv::Mat& frame);
+
+    /**
+     * @brief Process a frame with the telemetry events from the same pass
+     *
+     * In event-gated mode (record_on_event) frames are held in a ring
+     * buffer of the last pre_event_seconds and only flushed to disk when a
+     * triggering event fires, followed by post_event_seconds of recording.
+     *
+     * @param frame The frame to process
+     * @param events Telemetry events produced for this frame
+     * @return true if processing succeeded, false otherwise
+     */
+    bool processFrame(const cv::Mat& frame, const std::vector<TelemetryEvent>& events);
     
     /**
      * @brief Get the file path
-     * 
+     *
      * @return std::string The current file path
      */
     std::string getFilePath() const;
 
+    /**
+     * @brief Get recording segments overlapping a time range
+     *
+     * Maps timestamps to segment files via the in-memory segment index
+     * so clip retrieval serves existing files byte-for-byte — no decode
+     * or re-encode. An end of 0 marks the segment still being written.
+     *
+     * @param fromMs Range start (epoch milliseconds, 0 = from the oldest)
+     * @param toMs Range end (epoch milliseconds, 0 = up to now)
+     * @return nlohmann::json Array of {file, path, start_ms, end_ms}
+     */
+    nlohmann::json getSegmentsInRange(int64_t fromMs, int64_t toMs) const;
+
+    /**
+     * @brief Resolve a segment file name to its full path
+     *
+     * Only names present in the segment index resolve, so callers can
+     * hand untrusted request input straight in without a traversal risk.
+     *
+     * @param fileName Segment file name (no directory part)
+     * @return std::string Full path, empty if unknown
+     */
+    std::string resolveSegmentPath(const std::string& fileName) const;
+
 private:
+    /**
+     * @brief Detect available hardware encoders
+     *
+     * Probes GStreamer for hardware H.264 encoder elements:
+     * - NVIDIA: nvv4l2h264enc (with nvvidconv)
+     * - VA-API: vaapih264enc
+     * Sets hwAccelType_ to the detected type, or "none" if unavailable.
+     */
+    void detectHardwareAcceleration();
+
+    /**
+     * @brief Build a GStreamer appsrc encoding pipeline for the detected encoder
+     *
+     * @return std::string Pipeline description, empty if no hardware encoder
+     */
+    std::string buildEncoderPipeline() const;
+
+    /**
+     * @brief Check whether any event in the list should trigger recording
+     *
+     * @param events Telemetry events produced for this frame
+     * @return true if recording should be triggered
+     */
+    bool shouldTrigger(const std::vector<TelemetryEvent>& events) const;
+
+    /**
+     * @brief Write an annotated frame to the video writer
+     *
+     * Rotates to the next segment first when segmented recording is
+     * enabled and the current segment has reached its duration.
+     *
+     * @param frame Frame to write (already sized and annotated)
+     * @return true if the frame was written
+     */
+    bool writeFrame(const cv::Mat& frame);
+
+    /**
+     * @brief Open the video writer for the given output path
+     *
+     * Tries the hardware encoder pipeline first and falls back to the
+     * software VideoWriter (call with videoWriterMutex_ held).
+     *
+     * @param path Output file path
+     * @return true if a writer was opened
+     */
+    bool openWriter(const std::string& path);
+
+    /**
+     * @brief Build the output path for the next recording segment
+     *
+     * Segments are numbered siblings of the configured path, e.g.
+     * /recordings/cam1.mp4 becomes /recordings/cam1_000001.mp4.
+     */
+    std::string nextSegmentPath();
+
+    /**
+     * @brief Close the current segment and open the next one
+     *
+     * Appends the finished segment to the index, unlinks whole segments
+     * beyond max_segments and rewrites the index file atomically
+     * (call with videoWriterMutex_ held).
+     *
+     * @return true if the next segment's writer was opened
+     */
+    bool rotateSegmentLocked();
+
+    /**
+     * @brief Rewrite the on-disk segment index via temp file and rename
+     *
+     * The rename is atomic, so a crash mid-rotation never leaves a torn
+     * index; playback and retention tooling always see a complete list.
+     */
+    void writeSegmentIndex() const;
+
     std::string type_;                    ///< Component type name
-    std::string filePath_;                ///< Path to output file
+    std::string filePath_;                ///< Path to output file (segment base when segmenting)
     int frameWidth_;                      ///< Width of output frames
     int frameHeight_;                     ///< Height of output frames
     int fps_;                             ///< Frames per second
     std::string fourcc_;                  ///< FourCC codec code
     bool useRawFrame_;                    ///< Whether to use raw (unannotated) frames
-    
-    std::mutex videoWriterMutex_;         ///< Mutex for video writer access
+    bool useHardwareAccel_;               ///< Whether to try hardware encoding
+    std::string hwAccelType_;             ///< Hardware encoder type (nvidia, vaapi, none, auto)
+    std::string activeEncoder_;           ///< Encoder actually in use (nvidia, vaapi, software)
+
+    // Event-gated recording
+    bool recordOnEvent_;                  ///< Whether to record only around triggering events
+    int preEventSeconds_;                 ///< Seconds of pre-roll to keep buffered
+    int postEventSeconds_;                ///< Seconds of post-roll to record after a trigger
+    std::deque<cv::Mat> preEventBuffer_;  ///< Ring buffer of the last pre_event_seconds of frames
+    int postRollFramesLeft_;              ///< Frames of post-roll still to write
+
+    /**
+     * @brief One entry in the segment index
+     */
+    struct Segment {
+        std::string path;                 ///< Segment file path
+        int64_t startMs = 0;              ///< Wall-clock start (epoch milliseconds)
+        int64_t endMs = 0;                ///< Wall-clock end, 0 while still being written
+    };
+
+    // Segment rotation: fixed-duration segments keep files small and
+    // contiguous (long growing files fragment eMMC and slow both writes
+    // and playback seeks), and retention unlinks whole segments instead
+    // of rewriting one large recording
+    int segmentSeconds_;                  ///< Segment duration (0 = single growing file)
+    int maxSegments_;                     ///< Segments kept before the oldest is unlinked (0 = unlimited)
+    uint64_t segmentIndex_;               ///< Monotonic segment number
+    size_t segmentFrameCount_;            ///< Frames written into the current segment
+    std::string currentSegmentPath_;      ///< Path of the segment being written
+    std::deque<Segment> segments_;        ///< Finished and current segments, oldest first
+
+    mutable std::mutex videoWriterMutex_; ///< Mutex for video writer access
     cv::VideoWriter videoWriter_;         ///< OpenCV video writer
     bool isInitialized_;                  ///< Whether the writer is initialized
     size_t frameCount_;                   ///< Number of frames written
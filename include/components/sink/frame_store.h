@@ -0,0 +1,126 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <mutex>
+
+namespace tapi {
+
+/**
+ * @brief Append-only segment file store for frame thumbnail blobs
+ *
+ * Blobs are appended to memory-mapped segment files instead of being stored
+ * as SQLite BLOBs; the database only keeps (segment_id, offset, length)
+ * locators. This keeps the SQLite file small and makes retention cheap:
+ * expired data is reclaimed by unlinking whole segment files rather than
+ * deleting and vacuuming blob rows.
+ */
+class FrameStore {
+public:
+    /**
+     * @brief Location of a blob within the store
+     */
+    struct Location {
+        int64_t segmentId;  ///< Segment file the blob lives in
+        int64_t offset;     ///< Byte offset within the segment
+        int64_t length;     ///< Blob length in bytes
+    };
+
+    /**
+     * @brief Construct a new Frame Store object
+     *
+     * @param directory Directory holding the segment files
+     * @param segmentSize Maximum segment file size in bytes
+     */
+    explicit FrameStore(const std::string& directory, size_t segmentSize = 64 * 1024 * 1024);
+
+    /**
+     * @brief Destructor - closes the active segment
+     */
+    ~FrameStore();
+
+    /**
+     * @brief Open the store, creating the directory and a fresh segment
+     *
+     * @return true if the store is ready for appends
+     */
+    bool open();
+
+    /**
+     * @brief Close the active segment, trimming it to its used size
+     */
+    void close();
+
+    /**
+     * @brief Append a blob to the active segment
+     *
+     * Rotates to a new segment when the active one is full.
+     *
+     * @param data Blob bytes to append
+     * @param location Filled with the blob's location on success
+     * @return true if the blob was written
+     */
+    bool append(const std::string& data, Location& location);
+
+    /**
+     * @brief Append a blob given as raw bytes
+     *
+     * Writes straight from the caller's buffer (e.g. the shared encoder
+     * output) without an intermediate string copy.
+     *
+     * @param data Blob bytes to append
+     * @param size Number of bytes
+     * @param location Filled with the blob's location on success
+     * @return true if the blob was written
+     */
+    bool append(const uint8_t* data, size_t size, Location& location);
+
+    /**
+     * @brief Read a blob back from the store
+     *
+     * @param location Location previously returned by append()
+     * @return std::string Blob bytes, empty on failure
+     */
+    std::string read(const Location& location) const;
+
+    /**
+     * @brief Unlink all segment files older than the given segment
+     *
+     * @param oldestLiveSegmentId Lowest segment ID still referenced
+     * @return int Number of segment files removed
+     */
+    int removeSegmentsBefore(int64_t oldestLiveSegmentId);
+
+    /**
+     * @brief Get the directory holding the segment files
+     */
+    const std::string& getDirectory() const { return directory_; }
+
+private:
+    /**
+     * @brief Map a fresh segment file as the active append target
+     */
+    bool openSegment(int64_t segmentId);
+
+    /**
+     * @brief Unmap the active segment and trim it to writeOffset_
+     */
+    void closeSegment();
+
+    /**
+     * @brief Build the path of a segment file
+     */
+    std::string segmentPath(int64_t segmentId) const;
+
+    std::string directory_;       ///< Directory holding the segment files
+    size_t segmentSize_;          ///< Maximum segment file size in bytes
+
+    int fd_;                      ///< File descriptor of the active segment
+    uint8_t* mapped_;             ///< Mapping of the active segment
+    int64_t currentSegmentId_;    ///< ID of the active segment
+    size_t writeOffset_;          ///< Next append offset in the active segment
+
+    mutable std::mutex mutex_;    ///< Protects the active segment state
+};
+
+} // namespace tapi
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "component.h"
+#include "components/telemetry.h"
+#include "tapi_shm_export.h"
+#include <opencv2/opencv.hpp>
+#include <string>
+#include <mutex>
+#include <vector>
+
+namespace tapi {
+
+/**
+ * @brief Sink that publishes frames and telemetry into shared-memory rings
+ *
+ * Partner analytics running on the same box used to pull frames over
+ * localhost HTTP, paying a JPEG encode/decode round trip per frame. This
+ * sink instead writes decoded BGR frames and the frame's telemetry JSON
+ * into named POSIX shared-memory rings guarded by a per-slot seqlock, so
+ * co-located consumers read them with zero copies over the wire. The ring
+ * layout and reader protocol live in the standalone C header
+ * include/tapi_shm_export.h, which consumers compile against directly.
+ *
+ * The writer never blocks on readers: frames are published at the
+ * pipeline's pace and a slow reader is simply lapped and retries.
+ */
+class ShmExportSink : public SinkComponent {
+public:
+    /**
+     * @brief Construct a new Shm Export Sink object
+     *
+     * @param id Component ID
+     * @param camera Parent camera
+     * @param type Component type (should be "shm_export")
+     * @param config Initial configuration
+     */
+    ShmExportSink(const std::string& id, Camera* camera, const std::string& type, const nlohmann::json& config);
+
+    /**
+     * @brief Destructor
+     */
+    ~ShmExportSink() override;
+
+    /**
+     * @brief Create and map the shared-memory rings
+     *
+     * @return true if initialization succeeded, false otherwise
+     */
+    bool initialize() override;
+
+    /**
+     * @brief Start the sink
+     *
+     * @return true if start succeeded, false otherwise
+     */
+    bool start() override;
+
+    /**
+     * @brief Stop the sink and unlink the shared-memory regions
+     *
+     * @return true if stop succeeded, false otherwise
+     */
+    bool stop() override;
+
+    /**
+     * @brief Update component configuration
+     *
+     * @param config JSON configuration
+     * @return true if update succeeded, false otherwise
+     */
+    bool updateConfig(const nlohmann::json& config) override;
+
+    /**
+     * @brief Get component configuration
+     *
+     * @return nlohmann::json Current configuration
+     */
+    nlohmann::json getConfig() const override;
+
+    /**
+     * @brief Get component status
+     *
+     * @return nlohmann::json Component status
+     */
+    nlohmann::json getStatus() const override;
+
+    /**
+     * @brief Publish a frame and its telemetry events to the rings
+     *
+     * The frame is resized to the configured export resolution if needed
+     * and written into the frame ring; when the frame produced telemetry
+     * events they are serialized once and written into the event ring.
+     *
+     * @param frame The frame to publish
+     * @param events Telemetry events produced for this frame
+     * @return true if the frame was published, false otherwise
+     */
+    bool processFrame(const cv::Mat& frame, const std::vector<TelemetryEvent>& events);
+
+private:
+    /**
+     * @brief One mapped shared-memory ring (frames or events)
+     */
+    struct Ring {
+        std::string key;       ///< shm_open name (with leading slash)
+        int fd = -1;           ///< Region descriptor, -1 when closed
+        void* addr = nullptr;  ///< Mapped base address
+        size_t size = 0;       ///< Total mapped bytes
+        uint64_t sequence = 0; ///< Frames published into this ring
+    };
+
+    /**
+     * @brief Create, map and format one ring
+     *
+     * @param ring Ring to set up (key must be filled in)
+     * @param payloadCapacity Maximum payload bytes per slot
+     * @return true if the ring is ready
+     */
+    bool createRing(Ring& ring, size_t payloadCapacity);
+
+    /**
+     * @brief Unmap, close and unlink one ring
+     */
+    void destroyRing(Ring& ring);
+
+    /**
+     * @brief Seqlock-publish one payload into the ring's next slot
+     *
+     * @param ring Target ring
+     * @param payload Payload bytes (truncated to the slot capacity)
+     * @param payloadBytes Number of payload bytes
+     * @param width Frame width in pixels (0 for event payloads)
+     * @param height Frame height in pixels (0 for event payloads)
+     * @param channels Channel count (0 for event payloads)
+     * @return true if the slot was published
+     */
+    bool publish(Ring& ring, const uint8_t* payload, size_t payloadBytes,
+                 uint32_t width, uint32_t height, uint32_t channels);
+
+    std::string type_;        ///< Component type name
+    std::string name_;        ///< Region name prefix (shm keys <name>_frames/_events)
+    int slotCount_;           ///< Slots per ring
+    int frameWidth_;          ///< Export frame width
+    int frameHeight_;         ///< Export frame height
+    bool exportEvents_;       ///< Whether to publish the telemetry ring
+    int eventCapacity_;       ///< Event slot payload capacity in bytes
+
+    mutable std::mutex mutex_; ///< Serializes publishing and reconfiguration
+    Ring frameRing_;          ///< Decoded-frame ring
+    Ring eventRing_;          ///< Telemetry JSON ring
+    bool isInitialized_;      ///< Whether the rings are mapped
+    cv::Mat scaled_;          ///< Reused resize destination
+};
+
+} // namespace tapi
@@ -1,10 +1,13 @@
 #pragma once
 
 #include "component.h"
+#include "utils/frame_pool.h"
+#include "utils/spsc_ring.h"
 #include <string>
 #include <thread>
 #include <mutex>
 #include <atomic>
+#include <chrono>
 #include <opencv2/opencv.hpp>
 #include <nlohmann/json.hpp>
 
@@ -91,11 +94,98 @@ public:
     
     /**
      * @brief Get the latest frame
-     * 
+     *
+     * Compatibility wrapper around getFrameHandle(); the returned header
+     * shares the pooled buffer, so treat it as read-only.
+     *
      * @return cv::Mat The latest frame
      */
     cv::Mat getFrame();
-    
+
+    /**
+     * @brief Get a shared handle to the latest frame (zero-copy)
+     *
+     * The handle references a buffer from the source's frame pool; holders
+     * must not mutate the pixels. The buffer is recycled once every handle
+     * and header referencing it has been dropped.
+     *
+     * @return FramePtr Handle to the latest frame, or nullptr if none available
+     */
+    FramePtr getFrameHandle();
+
+    /**
+     * @brief Request a second, model-input-sized plane per frame
+     *
+     * When set, the capture thread downscales each captured frame once
+     * into a dedicated pool, so the detector consumes a ready-made plane
+     * instead of resizing the full frame on the processing path. The
+     * closest this architecture gets to a GStreamer tee: cv::VideoCapture
+     * exposes a single appsink, so the second output is produced on the
+     * capture thread rather than by a second pipeline branch.
+     *
+     * @param width Plane width in pixels (0 disables the plane)
+     * @param height Plane height in pixels (0 disables the plane)
+     */
+    void setDetectorPlaneSize(int width, int height);
+
+    /**
+     * @brief Get the detector plane paired with the last getFrameHandle()
+     *
+     * Valid only on the frame-consumer thread, immediately after
+     * getFrameHandle() returned a frame. Returns nullptr when the plane
+     * is disabled or not yet produced; callers must fall back to
+     * resizing the full frame themselves.
+     *
+     * @return FramePtr Handle to the downscaled plane, or nullptr
+     */
+    FramePtr getDetectorPlaneHandle();
+
+    /**
+     * @brief Decode an encoded image straight into the frame pipeline
+     *
+     * Ingestion path for push:// sources: the encoded bytes (JPEG/PNG)
+     * are decoded directly into a pooled buffer and published through
+     * the same ring as captured frames — no intermediate string or Mat
+     * copies. Callers may invoke this from several HTTP handler threads;
+     * pushes are serialized internally.
+     *
+     * @param data Encoded image bytes
+     * @param size Number of bytes
+     * @return true if the frame was decoded and published
+     */
+    bool pushFrame(const unsigned char* data, size_t size);
+
+    /**
+     * @brief Capture timestamp of the last frame returned by getFrameHandle()
+     *
+     * Taken when the frame left the decoder, before pooling and the ring,
+     * so (now - captureTime) is the true capture-to-consumer age including
+     * any time spent queued. Same single-consumer contract as
+     * getDetectorPlaneHandle().
+     *
+     * @return std::chrono::steady_clock::time_point Capture time
+     */
+    std::chrono::steady_clock::time_point getLastCaptureTime() const { return lastCaptureTime_; }
+
+    /**
+     * @brief Park or resume the capture loop while nobody consumes frames
+     *
+     * Suspended, the capture thread keeps the session alive with grab()
+     * calls but skips the retrieve conversion, the pool copy, the
+     * detector plane and the ring push, so an idle camera costs little
+     * more than the decode itself. Resume takes effect on the next loop
+     * iteration — well under a second — because the pipeline never
+     * leaves the PLAYING state.
+     *
+     * @param suspended Whether to park the capture loop
+     */
+    void setSuspended(bool suspended) { suspended_.store(suspended, std::memory_order_relaxed); }
+
+    /**
+     * @brief Whether the capture loop is currently parked
+     */
+    bool isSuspended() const { return suspended_.load(std::memory_order_relaxed); }
+
     /**
      * @brief Enable or disable adaptive timing - no longer used, kept for compatibility
      * 
@@ -111,12 +201,23 @@ public:
 private:
     /**
      * @brief Build the GStreamer pipeline string based on configuration
-     * 
+     *
      * Creates an optimized pipeline based on source type and available hardware acceleration
-     * 
+     *
      * @return std::string The GStreamer pipeline string
      */
     std::string buildPipeline();
+
+    /**
+     * @brief Cached pipeline description for (re)connects
+     *
+     * Protocol parsing and decoder selection run once per configuration;
+     * every reconnect reuses the cached string instead of re-deriving it.
+     * Invalidated by updateConfig().
+     *
+     * @return const std::string& The pipeline description
+     */
+    const std::string& pipelineDescription();
     
     /**
      * @brief Parse source URL to determine protocol type
@@ -133,6 +234,14 @@ private:
      * @brief Thread function for capturing frames
      */
     void captureThread();
+
+    /**
+     * @brief Downscale a captured frame into the detector plane pool
+     *
+     * @param full Full-resolution frame to downscale
+     * @return FramePtr The pooled plane, or nullptr when the plane is disabled
+     */
+    FramePtr makeDetectorPlane(const cv::Mat& full);
     
     /**
      * @brief Helper function to reopen RTSP stream when connection is lost
@@ -161,10 +270,31 @@ private:
     float quality_;                    ///< Video quality (0.0-1.0)
     
     cv::VideoCapture cap_;             ///< OpenCV video capture
+    std::atomic<bool> suspended_{false}; ///< Capture loop parked in grab-only mode
     std::thread captureThread_;        ///< Thread for frame capturing
     std::mutex frameMutex_;            ///< Mutex for thread-safe frame access
     std::atomic<bool> stopRequested_;  ///< Flag to signal thread to stop
-    cv::Mat latestFrame_;              ///< Latest captured frame
+    std::shared_ptr<FramePool> framePool_; ///< Pool of reusable frame buffers
+    std::shared_ptr<FramePool> detectorPlanePool_; ///< Pool for the downscaled detector plane (separate geometry)
+
+    /**
+     * @brief One captured frame plus its optional downscaled detector plane
+     *
+     * The two handles travel through the ring together so a drop-oldest
+     * displacement can never leave the consumer with a plane from a
+     * different frame than the full-res buffer.
+     */
+    struct CapturedFrame {
+        FramePtr full;     ///< Full-resolution frame
+        FramePtr plane;    ///< Detector-input-sized plane (may be null)
+        std::chrono::steady_clock::time_point captureTime; ///< When the frame left the decoder
+    };
+
+    SpscRing<CapturedFrame> frameRing_; ///< Lock-free capture-to-processing handoff (drop-oldest)
+    FramePtr lastDetectorPlane_;       ///< Plane paired with the last frame handed out (consumer thread only)
+    std::chrono::steady_clock::time_point lastCaptureTime_; ///< Capture time of the last frame handed out (consumer thread only)
+    std::atomic<int> detectorPlaneWidth_{0};  ///< Requested plane width (0 = disabled)
+    std::atomic<int> detectorPlaneHeight_{0}; ///< Requested plane height (0 = disabled)
     
     // Hardware acceleration options
     bool useHardwareAccel_;            ///< Whether to use hardware acceleration
@@ -187,7 +317,14 @@ private:
     
     // File source handling
     bool isFileSource_;                ///< Whether this is a file source (uses direct reading)
+    bool isPushSource_;                ///< Whether frames arrive via pushFrame() instead of a capture pipeline
+    std::mutex pushMutex_;             ///< Serializes pushFrame() callers (the ring is single-producer)
     bool needsScaling_;                ///< Whether frames need to be scaled to match requested dimensions
+
+    // Reconnection handling (capture thread only)
+    std::string cachedPipeline_;       ///< Pipeline description reused across reconnects (empty = rebuild)
+    static constexpr int kInitialReconnectDelayMs = 250;  ///< First reconnect backoff step
+    static constexpr int kMaxReconnectDelayMs = 5000;     ///< Backoff ceiling between reconnects
 };
 
 } // namespace tapi 
\ No newline at end of file
@@ -3,7 +3,11 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <memory>
 #include <chrono>
+#include <type_traits>
+#include <utility>
+#include <cmath>
 #include <opencv2/opencv.hpp>
 #include <nlohmann/json.hpp>
 
@@ -150,41 +154,133 @@ public:
      */
     int64_t getTimestamp() const { return timestamp_; }
     
+    // --- Typed fixed fields ---
+    //
+    // The attributes nearly every detection/tracking event carries are
+    // stored in plain members instead of the JSON property map, so
+    // building an event per detection per frame does no string-keyed
+    // allocations. setProperty/getProperty transparently route the
+    // well-known keys here, so existing call sites keep working.
+
+    /// Set the detected/tracked object class
+    void setClassName(const std::string& className) { className_ = className; hasClassName_ = true; }
+    /// Get the object class (empty if unset)
+    const std::string& getClassName() const { return className_; }
+    /// Check whether the object class is set
+    bool hasClassName() const { return hasClassName_; }
+
+    /// Set the detection/track confidence (0-1)
+    void setConfidence(float confidence) { confidence_ = confidence; hasConfidence_ = true; }
+    /// Get the confidence (0 if unset)
+    float getConfidence() const { return confidence_; }
+    /// Check whether the confidence is set
+    bool hasConfidence() const { return hasConfidence_; }
+
+    /// Set the track identifier
+    void setTrackId(int trackId) { trackId_ = trackId; hasTrackId_ = true; }
+    /// Get the track identifier (-1 if unset)
+    int getTrackId() const { return trackId_; }
+    /// Check whether the track identifier is set
+    bool hasTrackId() const { return hasTrackId_; }
+
+    /// Set the zone identifier
+    void setZoneId(const std::string& zoneId) { zoneId_ = zoneId; hasZoneId_ = true; }
+    /// Get the zone identifier (empty if unset)
+    const std::string& getZoneId() const { return zoneId_; }
+    /// Check whether the zone identifier is set
+    bool hasZoneId() const { return hasZoneId_; }
+
+    /// Set the bounding box
+    void setBBox(const TelemetryBBox& bbox) { bbox_ = bbox; hasBBox_ = true; }
+    /// Get the bounding box (zeroed if unset)
+    const TelemetryBBox& getBBox() const { return bbox_; }
+    /// Check whether the bounding box is set
+    bool hasBBox() const { return hasBBox_; }
+
     /**
      * @brief Set a property on this event
-     * 
+     *
+     * Well-known keys (class_name, confidence, track_id, zone_id, bbox)
+     * land in the typed fields; everything else goes to the custom
+     * property list.
+     *
      * @param key Property name
      * @param value Property value (any JSON-serializable type)
      */
     template<typename T>
     void setProperty(const std::string& key, const T& value) {
-        properties_[key] = value;
+        if (interceptTypedSet(key, value)) {
+            return;
+        }
+        for (auto& entry : customProperties_) {
+            if (entry.first == key) {
+                entry.second = value;
+                return;
+            }
+        }
+        customProperties_.emplace_back(key, nlohmann::json(value));
     }
-    
+
     /**
      * @brief Get a property value
-     * 
+     *
      * @param key Property name
      * @param defaultValue Default value if property not found
      * @return T The property value
      */
     template<typename T>
     T getProperty(const std::string& key, const T& defaultValue) const {
-        auto it = properties_.find(key);
-        if (it != properties_.end()) {
-            return it.value().get<T>();
+        if constexpr (std::is_constructible_v<T, const std::string&>) {
+            if (key == "class_name" && hasClassName_) return T(className_);
+            if (key == "zone_id" && hasZoneId_) return T(zoneId_);
+        } else if constexpr (std::is_arithmetic_v<T>) {
+            if (key == "confidence" && hasConfidence_) return static_cast<T>(confidence_);
+            if (key == "track_id" && hasTrackId_) return static_cast<T>(trackId_);
+        } else if constexpr (std::is_same_v<T, nlohmann::json>) {
+            if (key == "bbox" && hasBBox_) return bbox_.toJson();
+        }
+
+        for (const auto& entry : customProperties_) {
+            if (entry.first == key) {
+                try {
+                    return entry.second.get<T>();
+                } catch (...) {
+                    return defaultValue;
+                }
+            }
         }
         return defaultValue;
     }
-    
+
     /**
      * @brief Check if property exists
-     * 
+     *
      * @param key Property name
      * @return bool True if property exists
      */
     bool hasProperty(const std::string& key) const {
-        return properties_.contains(key);
+        if ((key == "class_name" && hasClassName_) ||
+            (key == "zone_id" && hasZoneId_) ||
+            (key == "confidence" && hasConfidence_) ||
+            (key == "track_id" && hasTrackId_) ||
+            (key == "bbox" && hasBBox_)) {
+            return true;
+        }
+        for (const auto& entry : customProperties_) {
+            if (entry.first == key) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Get the custom (non-typed) properties
+     *
+     * @return The custom property key/value pairs, in insertion order
+     */
+    const std::vector<std::pair<std::string, nlohmann::json>>& getCustomProperties() const {
+        return customProperties_;
     }
     
     /**
@@ -205,7 +301,10 @@ public:
     
     /**
      * @brief Convert the telemetry event to JSON
-     * 
+     *
+     * The JSON object is materialized on demand; events that never reach
+     * a JSON consumer never build one.
+     *
      * @return nlohmann::json JSON representation of the event
      */
     nlohmann::json toJson() const {
@@ -214,13 +313,23 @@ public:
         j["source_id"] = sourceId_;
         j["timestamp"] = timestamp_;
         j["camera_id"] = cameraId_;
-        j["properties"] = properties_;
+
+        nlohmann::json properties = nlohmann::json::object();
+        for (const auto& entry : customProperties_) {
+            properties[entry.first] = entry.second;
+        }
+        if (hasClassName_) properties["class_name"] = className_;
+        if (hasConfidence_) properties["confidence"] = confidence_;
+        if (hasTrackId_) properties["track_id"] = trackId_;
+        if (hasZoneId_) properties["zone_id"] = zoneId_;
+        if (hasBBox_) properties["bbox"] = bbox_.toJson();
+        j["properties"] = std::move(properties);
         return j;
     }
-    
+
     /**
      * @brief Create a telemetry event from JSON
-     * 
+     *
      * @param j JSON representation of the event
      * @return TelemetryEvent The created event
      */
@@ -228,28 +337,84 @@ public:
         TelemetryEventType type = static_cast<TelemetryEventType>(j.value("type", 0));
         std::string sourceId = j.value("source_id", "");
         int64_t timestamp = j.value("timestamp", int64_t(0));
-        
+
         TelemetryEvent event(type, sourceId, timestamp);
-        
+
         if (j.contains("camera_id")) {
             event.setCameraId(j["camera_id"]);
         }
-        
+
         if (j.contains("properties") && j["properties"].is_object()) {
-            event.properties_ = j["properties"];
+            for (const auto& item : j["properties"].items()) {
+                const std::string& key = item.key();
+                const nlohmann::json& value = item.value();
+                if (key == "class_name" && value.is_string()) {
+                    event.setClassName(value.get<std::string>());
+                } else if (key == "zone_id" && value.is_string()) {
+                    event.setZoneId(value.get<std::string>());
+                } else if (key == "confidence" && value.is_number()) {
+                    event.setConfidence(value.get<float>());
+                } else if (key == "track_id" && value.is_number()) {
+                    event.setTrackId(value.get<int>());
+                } else if (key == "bbox" && value.is_object()) {
+                    event.setBBox(TelemetryBBox::fromJson(value));
+                } else {
+                    event.customProperties_.emplace_back(key, value);
+                }
+            }
         }
-        
+
         return event;
     }
-    
+
 private:
+    /// Route well-known setProperty keys into the typed fields
+    template<typename T>
+    bool interceptTypedSet(const std::string& key, const T& value) {
+        if constexpr (std::is_constructible_v<std::string, const T&>) {
+            if (key == "class_name") { setClassName(std::string(value)); return true; }
+            if (key == "zone_id") { setZoneId(std::string(value)); return true; }
+        } else if constexpr (std::is_arithmetic_v<T>) {
+            if (key == "confidence") { setConfidence(static_cast<float>(value)); return true; }
+            if (key == "track_id") { setTrackId(static_cast<int>(value)); return true; }
+        } else if constexpr (std::is_same_v<T, nlohmann::json>) {
+            if (key == "bbox" && value.is_object()) { setBBox(TelemetryBBox::fromJson(value)); return true; }
+        }
+        return false;
+    }
+
     TelemetryEventType type_;
     std::string sourceId_;
     std::string cameraId_;
     int64_t timestamp_;
-    nlohmann::json properties_;
+
+    // Typed fixed fields; see the accessor block above
+    std::string className_;
+    std::string zoneId_;
+    TelemetryBBox bbox_{0, 0, 0, 0};
+    float confidence_ = 0.0f;
+    int trackId_ = -1;
+    bool hasClassName_ = false;
+    bool hasZoneId_ = false;
+    bool hasBBox_ = false;
+    bool hasConfidence_ = false;
+    bool hasTrackId_ = false;
+
+    // Escape hatch for everything else. A linear scan over a small flat
+    // vector beats a string-keyed JSON object at typical property counts.
+    std::vector<std::pair<std::string, nlohmann::json>> customProperties_;
 };
 
+/**
+ * @brief Immutable, shareable batch of one frame's telemetry events
+ *
+ * The pipeline freezes each frame's events into one of these once and
+ * every consumer — sinks, the WebSocket broadcaster, status readers —
+ * holds a reference at its own pace, so N consumers cost one event
+ * construction instead of N copies.
+ */
+using TelemetryEventList = std::shared_ptr<const std::vector<TelemetryEvent>>;
+
 /**
  * @brief Helper class for common telemetry event creation
  */
@@ -273,15 +438,102 @@ public:
         int64_t timestamp = 0) {
         
         TelemetryEvent event(TelemetryEventType::DETECTION, sourceId, timestamp);
-        event.setProperty("class_name", className);
-        event.setProperty("confidence", confidence);
-        event.setProperty("bbox", bbox.toJson());
+        event.setClassName(className);
+        event.setConfidence(confidence);
+        event.setBBox(bbox);
         return event;
     }
     
+    /**
+     * @brief Simplify a trajectory before it is serialized into an event
+     *
+     * Douglas-Peucker with the given epsilon (pixels): points whose
+     * perpendicular distance from the simplified polyline stays under
+     * epsilon are dropped, so long straight runs collapse to their
+     * endpoints with no visible fidelity loss. If the result still
+     * exceeds maxPoints it is decimated uniformly (endpoints kept).
+     * Epsilon 0 disables simplification, maxPoints 0 disables the cap.
+     *
+     * @param trajectory Full trajectory points
+     * @param epsilon Maximum allowed deviation in pixels
+     * @param maxPoints Hard cap on points after simplification
+     * @return std::vector<TelemetryPoint> Simplified trajectory
+     */
+    static std::vector<TelemetryPoint> simplifyTrajectory(
+        const std::vector<TelemetryPoint>& trajectory,
+        double epsilon,
+        size_t maxPoints) {
+
+        std::vector<TelemetryPoint> result;
+        if (trajectory.size() > 2 && epsilon > 0.0) {
+            // Iterative Douglas-Peucker over index ranges
+            std::vector<bool> keep(trajectory.size(), false);
+            keep.front() = keep.back() = true;
+            std::vector<std::pair<size_t, size_t>> stack;
+            stack.emplace_back(0, trajectory.size() - 1);
+            while (!stack.empty()) {
+                auto [first, last] = stack.back();
+                stack.pop_back();
+                if (last <= first + 1) {
+                    continue;
+                }
+                const double dx = static_cast<double>(trajectory[last].x - trajectory[first].x);
+                const double dy = static_cast<double>(trajectory[last].y - trajectory[first].y);
+                const double norm = std::sqrt(dx * dx + dy * dy);
+                double maxDist = -1.0;
+                size_t maxIndex = first;
+                for (size_t i = first + 1; i < last; i++) {
+                    double dist;
+                    if (norm > 0.0) {
+                        dist = std::abs(dy * (trajectory[i].x - trajectory[first].x) -
+                                        dx * (trajectory[i].y - trajectory[first].y)) / norm;
+                    } else {
+                        const double px = static_cast<double>(trajectory[i].x - trajectory[first].x);
+                        const double py = static_cast<double>(trajectory[i].y - trajectory[first].y);
+                        dist = std::sqrt(px * px + py * py);
+                    }
+                    if (dist > maxDist) {
+                        maxDist = dist;
+                        maxIndex = i;
+                    }
+                }
+                if (maxDist > epsilon) {
+                    keep[maxIndex] = true;
+                    stack.emplace_back(first, maxIndex);
+                    stack.emplace_back(maxIndex, last);
+                }
+            }
+            for (size_t i = 0; i < trajectory.size(); i++) {
+                if (keep[i]) {
+                    result.push_back(trajectory[i]);
+                }
+            }
+        } else {
+            result = trajectory;
+        }
+
+        // Uniform decimation as the hard cap; endpoints always survive
+        if (maxPoints >= 2 && result.size() > maxPoints) {
+            std::vector<TelemetryPoint> capped;
+            capped.reserve(maxPoints);
+            const double step = static_cast<double>(result.size() - 1) / (maxPoints - 1);
+            for (size_t i = 0; i < maxPoints; i++) {
+                capped.push_back(result[static_cast<size_t>(i * step + 0.5)]);
+            }
+            capped.back() = result.back();
+            result = std::move(capped);
+        }
+
+        return result;
+    }
+
     /**
      * @brief Create a tracking event
-     * 
+     *
+     * The trajectory is simplified at creation time (see
+     * simplifyTrajectory) so long-lived tracks don't serialize thousands
+     * of points into every event, database row and push message.
+     *
      * @param sourceId Component that generated the event
      * @param trackId Track identifier
      * @param className Tracked object class
@@ -289,6 +541,8 @@ public:
      * @param bbox Current bounding box
      * @param trajectory Vector of trajectory points
      * @param timestamp Event timestamp (0 for current time)
+     * @param trajectoryEpsilon Simplification tolerance in pixels (0 = off)
+     * @param trajectoryMaxPoints Cap on serialized points (0 = uncapped)
      * @return TelemetryEvent The created event
      */
     static TelemetryEvent createTrackingEvent(
@@ -298,20 +552,25 @@ public:
         float confidence,
         const TelemetryBBox& bbox,
         const std::vector<TelemetryPoint>& trajectory,
-        int64_t timestamp = 0) {
-        
+        int64_t timestamp = 0,
+        double trajectoryEpsilon = 0.0,
+        size_t trajectoryMaxPoints = 0) {
+
         TelemetryEvent event(TelemetryEventType::TRACKING, sourceId, timestamp);
-        event.setProperty("track_id", trackId);
-        event.setProperty("class_name", className);
-        event.setProperty("confidence", confidence);
-        event.setProperty("bbox", bbox.toJson());
-        
+        event.setTrackId(trackId);
+        event.setClassName(className);
+        event.setConfidence(confidence);
+        event.setBBox(bbox);
+
+        std::vector<TelemetryPoint> simplified =
+            simplifyTrajectory(trajectory, trajectoryEpsilon, trajectoryMaxPoints);
+
         nlohmann::json trajectoryJson = nlohmann::json::array();
-        for (const auto& point : trajectory) {
+        for (const auto& point : simplified) {
             trajectoryJson.push_back(point.toJson());
         }
         event.setProperty("trajectory", trajectoryJson);
-        
+
         return event;
     }
     
@@ -337,9 +596,9 @@ public:
         int64_t timestamp = 0) {
         
         TelemetryEvent event(TelemetryEventType::CROSSING, sourceId, timestamp);
-        event.setProperty("zone_id", zoneId);
-        event.setProperty("track_id", trackId);
-        event.setProperty("class_name", className);
+        event.setZoneId(zoneId);
+        event.setTrackId(trackId);
+        event.setClassName(className);
         event.setProperty("direction", direction);
         event.setProperty("crossing_point", crossingPoint.toJson());
         return event;
@@ -366,9 +625,9 @@ public:
         
         TelemetryEvent event(TelemetryEventType::CUSTOM, sourceId, timestamp);
         event.setProperty("event_type", "zone_entry");
-        event.setProperty("zone_id", zoneId);
-        event.setProperty("track_id", trackId);
-        event.setProperty("class_name", className);
+        event.setZoneId(zoneId);
+        event.setTrackId(trackId);
+        event.setClassName(className);
         event.setProperty("entry_point", entryPoint.toJson());
         return event;
     }
@@ -394,9 +653,9 @@ public:
         
         TelemetryEvent event(TelemetryEventType::CUSTOM, sourceId, timestamp);
         event.setProperty("event_type", "zone_exit");
-        event.setProperty("zone_id", zoneId);
-        event.setProperty("track_id", trackId);
-        event.setProperty("class_name", className);
+        event.setZoneId(zoneId);
+        event.setTrackId(trackId);
+        event.setClassName(className);
         event.setProperty("exit_point", exitPoint.toJson());
         return event;
     }
@@ -417,8 +676,8 @@ public:
         int64_t timestamp = 0) {
         
         TelemetryEvent event(TelemetryEventType::CLASSIFICATION, sourceId, timestamp);
-        event.setProperty("class_name", className);
-        event.setProperty("confidence", confidence);
+        event.setClassName(className);
+        event.setConfidence(confidence);
         return event;
     }
     
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "components/telemetry.h"
+
+namespace tapi {
+
+/**
+ * @brief Converts telemetry events to and from the protobuf wire format
+ *
+ * The binary encoding (protobuf/telemetry.proto) is used wherever events
+ * leave the process for machine consumers — currently the WebSocket push
+ * channel's binary mode — so JSON is only rendered at the REST boundary.
+ * Typed event fields map to typed proto fields; custom properties are
+ * carried as JSON-encoded key/value pairs.
+ */
+class TelemetryCodec {
+public:
+    /**
+     * @brief Encode a single event to protobuf bytes
+     *
+     * @param event Event to encode
+     * @return std::string Serialized tapi.telemetry.TelemetryEvent
+     */
+    static std::string encode(const TelemetryEvent& event);
+
+    /**
+     * @brief Encode a batch of events to protobuf bytes
+     *
+     * @param events Events to encode
+     * @param dropped Events dropped since the previous batch (0 if none)
+     * @return std::string Serialized tapi.telemetry.TelemetryEventBatch
+     */
+    static std::string encodeBatch(const std::vector<TelemetryEvent>& events, size_t dropped = 0);
+
+    /**
+     * @brief Encode shared event batches into one protobuf batch message
+     *
+     * Overload for the broadcaster's copy-free fan-out: batches are
+     * serialized straight from the shared immutable lists without being
+     * flattened into a temporary vector first.
+     *
+     * @param batches Shared event batches in publish order
+     * @param dropped Number of events dropped before this batch
+     * @return std::string Serialized TelemetryEventBatch
+     */
+    static std::string encodeBatch(const std::vector<TelemetryEventList>& batches, size_t dropped = 0);
+
+    /**
+     * @brief Decode a single event from protobuf bytes
+     *
+     * @param data Serialized tapi.telemetry.TelemetryEvent
+     * @param event Decoded event (valid only when true is returned)
+     * @return true if decoding succeeded, false otherwise
+     */
+    static bool decode(const std::string& data, TelemetryEvent& event);
+
+    /**
+     * @brief Decode a batch of events from protobuf bytes
+     *
+     * @param data Serialized tapi.telemetry.TelemetryEventBatch
+     * @param events Decoded events appended here on success
+     * @return true if decoding succeeded, false otherwise
+     */
+    static bool decodeBatch(const std::string& data, std::vector<TelemetryEvent>& events);
+};
+
+} // namespace tapi
@@ -4,8 +4,11 @@
 #include <memory>
 #include <nlohmann/json.hpp>
 #include <sqlite3.h>
+#include <atomic>
 #include <mutex>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace tapi {
 
@@ -14,6 +17,13 @@ namespace tapi {
  * 
  * This class manages storing and retrieving configuration data using SQLite.
  * Configuration is stored as JSON in a simple key-value structure.
+ *
+ * Cached configuration is published as an immutable snapshot map that is
+ * swapped atomically whenever a key changes. Cache hits — the common case
+ * once the cache is warm — cost one atomic shared_ptr load and a map
+ * lookup, with no lock taken, so pipelines reading config per frame are
+ * never stalled by concurrent updates. Writers serialize on the mutex,
+ * update SQLite, then copy-and-swap the snapshot.
  */
 class ConfigManager {
 public:
@@ -80,7 +90,16 @@ public:
      * @return true if successful, false otherwise
      */
     bool saveCameraConfig(const std::string& cameraId, const nlohmann::json& config);
-    
+
+    /**
+     * @brief Save several camera configurations in one transaction
+     *
+     * @param configs Camera ID / configuration pairs
+     * @return true if all configurations were saved, false otherwise
+     */
+    bool saveCameraConfigs(const std::vector<std::pair<std::string, nlohmann::json>>& configs);
+
+
     /**
      * @brief Delete camera configuration
      * 
@@ -132,16 +151,23 @@ private:
     // Last SQLite error message
     std::string getLastError() const;
     
-    // Cache to avoid frequent database reads
+    /// Immutable cache generation shared with lock-free readers
+    using ConfigCache = std::unordered_map<std::string, nlohmann::json>;
+
+    // Cache maintenance; callers must hold mutex_. Each helper builds a
+    // new snapshot map and swaps it in atomically.
     void updateConfigCache(const std::string& key, const nlohmann::json& value);
     void clearConfigCache(const std::string& key);
     void refreshConfigCache();
-    
+
+    /// Get the current cache snapshot without locking
+    std::shared_ptr<const ConfigCache> cacheSnapshot() const;
+
     sqlite3* db_;                              ///< SQLite database handle
     std::string dbPath_;                       ///< Path to database file
-    bool isInitialized_;                       ///< Flag indicating if DB is initialized
-    mutable std::mutex mutex_;                 ///< Mutex for thread safety
-    std::unordered_map<std::string, nlohmann::json> configCache_;  ///< In-memory cache of config
+    std::atomic<bool> isInitialized_;          ///< Flag indicating if DB is initialized
+    mutable std::mutex mutex_;                 ///< Serializes database access and cache swaps
+    std::shared_ptr<const ConfigCache> configCache_;  ///< Current cache snapshot, atomically swapped
 };
 
 } // namespace tapi 
\ No newline at end of file
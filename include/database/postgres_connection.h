@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <map>
 #include <memory>
 #include <vector>
 #include <queue>
@@ -13,6 +14,9 @@
 namespace tapi {
 namespace database {
 
+class CachedStatement;
+class QueryResult;
+
 /**
  * @brief PostgreSQL connection wrapper with automatic reconnection
  */
@@ -41,7 +45,23 @@ public:
     // Execute a parameterized query
     PGresult* executeParams(const std::string& query,
                            const std::vector<std::string>& params);
-    
+
+    // Prepare a parameterized query against this connection's statement
+    // cache. The first call for a given query text runs PQprepare and
+    // stores the server-side plan under a generated name; subsequent calls
+    // reuse it, so repeated billing queries skip the parse/plan round trip.
+    // Returns nullptr if the connection is down and cannot be re-established.
+    std::shared_ptr<CachedStatement> prepare(const std::string& query,
+                                             const std::vector<std::string>& params);
+
+    // Execute a query through the named-statement cache (used by CachedStatement)
+    PGresult* executePrepared(const std::string& query,
+                              const std::vector<std::string>& params);
+
+    // Round-trip liveness probe. PQstatus alone can report OK on a dead
+    // TCP link; this issues SELECT 1 to confirm the server is reachable.
+    bool ping();
+
     // Clear result (free memory)
     static void clearResult(PGresult* result);
     
@@ -57,9 +77,66 @@ private:
     PGconn* conn_;
     std::string conninfo_;
     mutable std::mutex conn_mutex_;
-    
+
+    // Query text -> server-side statement name. Cleared on (re)connect
+    // because named statements die with the session.
+    std::map<std::string, std::string> prepared_statements_;
+
     bool connect();
     void handleConnectionError();
+
+    // Resolve or create the named statement for a query. Caller must hold
+    // conn_mutex_. Returns empty string if PQprepare fails.
+    std::string statementNameLocked(const std::string& query);
+};
+
+/**
+ * @brief Handle to a server-side prepared statement with bound parameters
+ *
+ * Created via PostgreSQLConnection::prepare(). Valid only while the
+ * originating connection is checked out; execute() retries once through
+ * a reconnect if the link dropped since the statement was prepared.
+ */
+class CachedStatement {
+public:
+    CachedStatement(PostgreSQLConnection* conn, std::string query,
+                    std::vector<std::string> params);
+
+    // Execute the statement; returns nullptr on failure
+    std::shared_ptr<QueryResult> execute();
+
+private:
+    PostgreSQLConnection* conn_;
+    std::string query_;
+    std::vector<std::string> params_;
+};
+
+/**
+ * @brief Owning result wrapper returned by CachedStatement::execute
+ */
+class QueryResult {
+public:
+    explicit QueryResult(PGresult* result);
+    ~QueryResult();
+
+    // Disable copy
+    QueryResult(const QueryResult&) = delete;
+    QueryResult& operator=(const QueryResult&) = delete;
+
+    // Row and command info
+    size_t rowCount() const;
+    long affectedRows() const;
+
+    // Data access
+    bool isNull(size_t row, int col) const;
+    std::string getString(size_t row, int col) const;
+    int getInt(size_t row, int col) const;
+    long long getInt64(size_t row, int col) const;
+    double getDouble(size_t row, int col) const;
+    bool getBool(size_t row, int col) const;
+
+private:
+    PGresult* result_;
 };
 
 /**
@@ -110,7 +187,10 @@ public:
         const PostgreSQLConnection& operator*() const { return *conn_; }
         
         bool isValid() const { return conn_ && conn_->isConnected(); }
-        
+
+        explicit operator bool() const { return isValid(); }
+
+
     private:
         PostgreSQLConnectionPool* pool_;
         std::shared_ptr<PostgreSQLConnection> conn_;
@@ -133,6 +213,11 @@ public:
     bool isHealthy() const;
     int getAvailableConnections() const;
     int getTotalConnections() const;
+
+    // Ping every idle connection and reconnect the dead ones. Intended to
+    // run from a periodic maintenance timer so billing flushes never pay
+    // for a reconnect inline. Returns the number of healthy connections.
+    int healthCheck();
     
     // Execute a query with automatic connection management
     bool executeQuick(const std::string& query);
@@ -1,18 +1,28 @@
 #pragma once
 
 #include <string>
+#include <list>
 #include <memory>
 #include <chrono>
 #include <functional>
 #include <mutex>
+#include <vector>
 #include <hiredis/hiredis.h>
 #include <nlohmann/json.hpp>
+#include "utils/circuit_breaker.h"
 
 namespace tapi {
 namespace database {
 
 /**
  * @brief Redis cache manager for license and entitlement caching
+ *
+ * get()/getJson() are fronted by a small sharded in-process LRU so the
+ * handful of hot keys (license status, camera entitlements) read every
+ * frame never leave the process in steady state. The local cache is
+ * updated by this instance's own writes and bounded by a short TTL;
+ * writes made to Redis by other processes are only picked up when the
+ * local entry expires, so local_cache_ttl_seconds is the staleness bound.
  */
 class RedisCache {
 public:
@@ -23,11 +33,59 @@ public:
         int timeout_ms = 3000;
         int max_retries = 3;
         int max_memory_mb = 256;
+        int local_cache_shards = 8;
+        int local_cache_entries_per_shard = 128;
+        int local_cache_ttl_seconds = 30;  // 0 disables the in-process cache
+        int breaker_failure_threshold = 5;
+        int breaker_open_duration_ms = 30000;
     };
     
+    /**
+     * @brief Result of one command in a pipelined batch
+     */
+    struct PipelineReply {
+        bool ok = false;          ///< Command succeeded (false for NIL/error replies)
+        std::string value;        ///< String reply payload (GET), error text on failure
+        long long integer = 0;    ///< Integer reply payload (EXISTS, DEL, INCR, ...)
+    };
+
+    /**
+     * @brief Builder for pipelined command batches
+     *
+     * Queues commands locally and sends them to Redis in a single write,
+     * reading all replies afterwards, so a batch costs one network
+     * round-trip instead of one per command:
+     *
+     *   auto replies = cache->pipeline()
+     *       .get(licenseKey)
+     *       .get(entitlementKey)
+     *       .exists(quotaKey)
+     *       .execute();
+     */
+    class Pipeline {
+    public:
+        Pipeline& get(const std::string& key);
+        Pipeline& set(const std::string& key, const std::string& value, int ttl_seconds = -1);
+        Pipeline& del(const std::string& key);
+        Pipeline& exists(const std::string& key);
+        Pipeline& expire(const std::string& key, int ttl_seconds);
+
+        /// Send all queued commands and collect their replies (in queue order)
+        std::vector<PipelineReply> execute();
+
+        size_t size() const { return commands_.size(); }
+
+    private:
+        friend class RedisCache;
+        explicit Pipeline(RedisCache& cache) : cache_(cache) {}
+
+        RedisCache& cache_;
+        std::vector<std::vector<std::string>> commands_;
+    };
+
     RedisCache(const Config& config);
     ~RedisCache();
-    
+
     // Disable copy
     RedisCache(const RedisCache&) = delete;
     RedisCache& operator=(const RedisCache&) = delete;
@@ -66,6 +124,13 @@ public:
     // Batch operations
     bool mset(const std::map<std::string, std::string>& keyvals);
     std::map<std::string, std::string> mget(const std::vector<std::string>& keys);
+
+    // Pipelined batch operations (one round-trip for the whole batch)
+    std::map<std::string, std::string> getMany(const std::vector<std::string>& keys);
+    bool setMany(const std::map<std::string, std::string>& keyvals, int ttl_seconds);
+
+    /// Start a pipelined command batch
+    Pipeline pipeline() { return Pipeline(*this); }
     
     // Pattern operations
     std::vector<std::string> keys(const std::string& pattern);
@@ -86,6 +151,7 @@ public:
     bool ping();
     std::string info();
     long long dbsize();
+    std::string breakerState() const { return breaker_.stateName(); }
     
     // Helper: Generate cache keys
     static std::string makeLicenseKey(const std::string& camera_id);
@@ -93,15 +159,51 @@ public:
     static std::string makeUsageQuotaKey(const std::string& tenant_id, const std::string& quota_type);
     
 private:
+    /**
+     * @brief One shard of the in-process LRU fronting GET
+     *
+     * Keys hash onto shards so concurrent entitlement checks on different
+     * cameras do not contend on one mutex. Within a shard the lru list
+     * orders keys most-recently-used first and the map holds the values
+     * with their local expiry.
+     */
+    struct LocalCacheShard {
+        struct Entry {
+            std::string value;
+            std::chrono::steady_clock::time_point expiry;
+            std::list<std::string>::iterator lru_it;
+        };
+
+        std::mutex mutex;
+        std::map<std::string, Entry> entries;
+        std::list<std::string> lru;
+    };
+
     Config config_;
     redisContext* context_;
     mutable std::mutex redis_mutex_;
-    
+    std::vector<std::unique_ptr<LocalCacheShard>> local_shards_;
+
+    // Fails fast when Redis stalls so callers never stack timeout x retries;
+    // while open, get() serves expired local entries as last-known-good state
+    utils::CircuitBreaker breaker_;
+
     bool connect();
     void disconnect();
     void handleError(const std::string& operation);
+    std::vector<PipelineReply> executePipeline(const std::vector<std::vector<std::string>>& commands);
     bool checkReply(redisReply* reply);
     void freeReply(redisReply* reply);
+
+    // In-process LRU helpers. Writes through this instance keep the local
+    // cache coherent: set/mset populate, del/expire/incr evict, pattern
+    // deletes and FLUSHALL clear everything.
+    bool localCacheEnabled() const { return config_.local_cache_ttl_seconds > 0; }
+    LocalCacheShard& shardFor(const std::string& key);
+    bool localGet(const std::string& key, std::string& value, bool allow_stale = false);
+    void localPut(const std::string& key, const std::string& value, int ttl_seconds);
+    void localErase(const std::string& key);
+    void localClear();
     
     // Retry wrapper
     template<typename Func>
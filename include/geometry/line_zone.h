@@ -5,7 +5,7 @@
 #include <vector>
 #include <map>
 #include <unordered_map>
-#include <deque>
+#include <cstdint>
 #include <mutex>
 #include <memory>
 #include <nlohmann/json.hpp>
@@ -287,9 +287,21 @@ private:
     Vector startRegionLimit_;
     Vector endRegionLimit_;
     
+    // Incremental crossing state for one track. The windowed state deque
+    // reduced to this: a crossing fires when the side flips and then stays
+    // stable for crossingHistoryLength_ - 1 consecutive observations, so
+    // only the current side and run length are needed - O(1) per track.
+    struct CrossingState {
+        bool side = false;           // Side of the line on the current run
+        bool hasPreviousRun = false; // Whether the track has flipped sides before
+        int runLength = 0;           // Consecutive observations on the current side
+        uint64_t lastSeen = 0;       // Frame counter at last update (for pruning)
+    };
+
     // Tracking state
     int crossingHistoryLength_;
-    std::unordered_map<int, std::deque<bool>> crossingStateHistory_;
+    std::unordered_map<int, CrossingState> crossingStates_;
+    uint64_t frameCounter_ = 0;
     
     // Counts
     int inCount_;
@@ -2,6 +2,7 @@
 
 #include <opencv2/opencv.hpp>
 #include "geometry/line_zone.h"
+#include "geometry/point_in_polygon.h"
 #include <string>
 #include <vector>
 #include <map>
@@ -84,7 +85,21 @@ public:
      * @return std::vector<Event> List of zone events
      */
     std::vector<Event> processTracks(const std::vector<Track>& tracks);
-    
+
+    /**
+     * @brief Process tracks using precomputed zone membership
+     *
+     * Single-pass variant for callers that already evaluated the zone
+     * geometry: the membership flags drive entry/exit event detection
+     * without re-deriving anchors or re-testing the polygon.
+     *
+     * @param tracks Tracks to process
+     * @param inZone Zone membership flag per track (same indexing as tracks)
+     * @return std::vector<Event> List of zone events
+     */
+    std::vector<Event> processTracks(const std::vector<Track>& tracks,
+                                     const std::vector<bool>& inZone);
+
     /**
      * @brief Get the zone ID
      * 
@@ -126,7 +141,21 @@ public:
      * @return int Current count
      */
     int getCurrentCount() const { return inCount_ - outCount_; }
-    
+
+    /**
+     * @brief Set the in count manually (used by state restore)
+     *
+     * @param count New in count value
+     */
+    void setInCount(int count) { inCount_ = count; }
+
+    /**
+     * @brief Set the out count manually (used by state restore)
+     *
+     * @param count New out count value
+     */
+    void setOutCount(int count) { outCount_ = count; }
+
     /**
      * @brief Get the list of triggering anchor points
      * 
@@ -148,27 +177,89 @@ public:
      * @return std::vector<bool> Vector of boolean values indicating if each detection is in the zone
      */
     std::vector<bool> computeAnchorsInZone(const std::vector<Detection>& detections) const;
-    
+
+    /**
+     * @brief Check if tracks are in the zone
+     *
+     * Overload for callers holding Track buffers; zone membership only
+     * depends on the bounding box, so no Detection conversion is needed.
+     *
+     * @param tracks Tracks to check
+     * @return std::vector<bool> Vector of boolean values indicating if each track is in the zone
+     */
+    std::vector<bool> computeAnchorsInZone(const std::vector<Track>& tracks) const;
+
+    /**
+     * @brief Check whether the zone holds state history for a track
+     *
+     * Used by the zone manager to keep feeding tracks the zone has already
+     * seen, so exit events still fire when a track leaves the zone's area.
+     *
+     * @param trackId Track ID to look up
+     * @return true if the zone has state history for the track
+     */
+    bool hasTrackState(int trackId) const { return zoneStateHistory_.count(trackId) > 0; }
+
 private:
     /**
-     * @brief Create mask from polygon for efficient point-in-polygon testing
+     * @brief Rebuild the preprocessed edge set used for point-in-polygon testing
      */
-    void createMask();
-    
+    void rebuildEdges();
+
+    /**
+     * @brief Rebuild the rasterized containment mask from the current polygon
+     */
+    void rebuildMask() const;
+
+    /**
+     * @brief Hash of the current vertex set, used to detect polygon changes
+     */
+    uint64_t polygonSignature() const;
+
+    /**
+     * @brief Shared anchor-in-zone kernel for any item exposing a bbox
+     *
+     * Both Detection and Track buffers feed the same packed-point test;
+     * only the bounding box is read. Defined in the translation unit.
+     */
+    template <typename BoxedItem>
+    std::vector<bool> anchorsInZoneImpl(const std::vector<BoxedItem>& items) const;
+
     /**
      * @brief Update class ID to name mapping
-     * 
+     *
      * @param detections Detections to extract class info from
      */
     void updateClassIdToName(const std::vector<Detection>& detections);
+
+    /**
+     * @brief Update class ID to name mapping from tracks
+     *
+     * @param tracks Tracks to extract class info from
+     */
+    void updateClassIdToName(const std::vector<Track>& tracks);
     
     // Zone properties
     std::string id_;              ///< Zone ID
     std::string streamId_;        ///< Stream ID
     std::vector<cv::Point2f> polygon_; ///< Polygon vertices (using float points for normalized coords)
-    cv::Mat mask_;               ///< Binary mask for point-in-polygon testing
-    cv::Size frameResolution_;   ///< Frame resolution
-    
+    PolygonEdgeSet edges_;       ///< Preprocessed edges for vectorized point-in-polygon testing
+
+    // Rasterized containment lookup (optional, use_zone_mask). The polygon
+    // is rasterized into a downsampled grid over its bounding box; cells
+    // are classified as fully inside, fully outside, or boundary, so
+    // containment becomes one cell load with only boundary cells falling
+    // back to the exact edge test. The mask is keyed on a hash of the
+    // vertex set, so it survives the manager's normalized/pixel polygon
+    // swaps and rebuilds only when the pixel polygon actually changes
+    // (zone edit or resolution change).
+    bool maskEnabled_;               ///< use_zone_mask config flag
+    int maskCellSize_;               ///< zone_mask_scale: pixels per mask cell
+    mutable cv::Mat mask_;           ///< CV_8U grid: 0 outside, 1 inside, 2 boundary
+    mutable float maskOriginX_;      ///< Pixel x of mask cell (0,0)
+    mutable float maskOriginY_;      ///< Pixel y of mask cell (0,0)
+    mutable uint64_t maskSignature_; ///< Vertex hash the mask was built from
+
     // Zone state
     int inCount_;                ///< Number of objects entering the zone
     int outCount_;               ///< Number of objects exiting the zone
@@ -178,10 +269,28 @@ private:
     
     // Track state history
     std::map<int, std::deque<bool>> zoneStateHistory_; ///< Track state history (in zone or not)
-    
+
+    /**
+     * @brief Debounced per-track zone state
+     *
+     * Drives the entry/exit hysteresis: the raw membership flag must
+     * disagree with the confirmed state for the configured number of
+     * consecutive frames before the state flips and an event fires.
+     */
+    struct TrackZoneState {
+        bool inside = false;      ///< Confirmed zone membership
+        int streak = 0;           ///< Consecutive frames disagreeing with the confirmed state
+        int64_t lastEventMs = 0;  ///< When this track last emitted an event for this zone
+    };
+
+    std::map<int, TrackZoneState> trackStates_; ///< Debounced state machine per track
+
     // Zone configuration
     std::vector<Position> triggeringAnchors_; ///< List of anchor points that trigger the zone
     std::vector<std::string> triggeringClasses_; ///< List of class names that can trigger zone events
+    int entryDebounceFrames_;     ///< Consecutive inside frames required to confirm an entry
+    int exitDebounceFrames_;      ///< Consecutive outside frames required to confirm an exit
+    int64_t minEventIntervalMs_;  ///< Per-track floor between emitted events (0 = uncapped)
     
     // Thread safety
     bool initialized_;           ///< Whether the zone is initialized
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace tapi {
+
+/**
+ * @brief Uniform spatial grid over zone bounding boxes
+ *
+ * Zone managers evaluate every zone against every detection even though most
+ * pairs are trivially disjoint. The grid buckets zone AABBs into fixed cells
+ * so a detection only collects the zones whose bounding box overlaps its
+ * own; the exact geometry test then runs on that short candidate list.
+ *
+ * Rebuilt whenever the zone set or frame dimensions change; queries are
+ * read-only and deduplicate results with a stamp so a zone spanning several
+ * cells is reported once.
+ */
+class ZoneGrid {
+public:
+    /**
+     * @brief Build the grid from zone bounding boxes
+     *
+     * @param frameWidth Frame width in pixels
+     * @param frameHeight Frame height in pixels
+     * @param bounds Bounding box per zone, in pixel coordinates
+     */
+    void build(float frameWidth, float frameHeight, const std::vector<cv::Rect2f>& bounds) {
+        cols_ = kGridCells;
+        rows_ = kGridCells;
+        cellWidth_ = frameWidth > 0 ? frameWidth / cols_ : 1.0f;
+        cellHeight_ = frameHeight > 0 ? frameHeight / rows_ : 1.0f;
+        cells_.assign(cols_ * rows_, {});
+        stamps_.assign(bounds.size(), 0);
+        stamp_ = 0;
+
+        for (size_t i = 0; i < bounds.size(); i++) {
+            int minCol, minRow, maxCol, maxRow;
+            cellRange(bounds[i], minCol, minRow, maxCol, maxRow);
+            for (int r = minRow; r <= maxRow; r++) {
+                for (int c = minCol; c <= maxCol; c++) {
+                    cells_[r * cols_ + c].push_back(static_cast<int>(i));
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Collect zones whose bounding box may overlap the given box
+     *
+     * @param box Query box in pixel coordinates
+     * @param out Receives candidate zone indices (appended, deduplicated)
+     */
+    void query(const cv::Rect2f& box, std::vector<int>& out) const {
+        if (cells_.empty()) {
+            return;
+        }
+        stamp_++;
+        int minCol, minRow, maxCol, maxRow;
+        cellRange(box, minCol, minRow, maxCol, maxRow);
+        for (int r = minRow; r <= maxRow; r++) {
+            for (int c = minCol; c <= maxCol; c++) {
+                for (int zone : cells_[r * cols_ + c]) {
+                    if (stamps_[zone] != stamp_) {
+                        stamps_[zone] = stamp_;
+                        out.push_back(zone);
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    static constexpr int kGridCells = 16; ///< Grid resolution per axis
+
+    void cellRange(const cv::Rect2f& box, int& minCol, int& minRow,
+                   int& maxCol, int& maxRow) const {
+        minCol = clampCell(static_cast<int>(box.x / cellWidth_), cols_);
+        maxCol = clampCell(static_cast<int>((box.x + box.width) / cellWidth_), cols_);
+        minRow = clampCell(static_cast<int>(box.y / cellHeight_), rows_);
+        maxRow = clampCell(static_cast<int>((box.y + box.height) / cellHeight_), rows_);
+    }
+
+    static int clampCell(int cell, int count) {
+        if (cell < 0) return 0;
+        if (cell >= count) return count - 1;
+        return cell;
+    }
+
+    int cols_ = 0;                        ///< Number of grid columns
+    int rows_ = 0;                        ///< Number of grid rows
+    float cellWidth_ = 1.0f;              ///< Cell width in pixels
+    float cellHeight_ = 1.0f;             ///< Cell height in pixels
+    std::vector<std::vector<int>> cells_; ///< Zone indices per cell
+    mutable std::vector<uint32_t> stamps_; ///< Last query stamp per zone
+    mutable uint32_t stamp_ = 0;          ///< Current query stamp
+};
+
+} // namespace tapi
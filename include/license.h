@@ -97,7 +97,8 @@ enum class SinkType {
     FILE,
     DATABASE,
     WEBSOCKET,
-    MQTT
+    MQTT,
+    SHM_EXPORT
 };
 
 // Helper functions to convert between enum and string
@@ -179,7 +180,21 @@ public:
      * @return true if license is valid, false otherwise
      */
     bool validateCameraLicense(const std::string& camera_id);
-    
+
+    /**
+     * @brief Validate licenses for a batch of cameras in one pass
+     *
+     * Fleet startup used to validate cameras one by one, paying a lock
+     * acquisition and clock read per camera on the camera-start path.
+     * This takes one snapshot of the entitlement table and distributes
+     * per-camera results from it; heartbeats for valid cameras are
+     * stamped in the same pass.
+     *
+     * @param camera_ids Camera IDs to validate
+     * @return Map of camera ID to validity (missing licenses map to false)
+     */
+    std::unordered_map<std::string, bool> validateCameraLicenses(const std::vector<std::string>& camera_ids);
+
     /**
      * @brief Add camera license for a tenant
      * @param camera_id Camera ID
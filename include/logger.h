@@ -7,6 +7,9 @@
 #include <atomic>
 #include <memory>
 #include <sstream>
+#include <condition_variable>
+#include <thread>
+#include <vector>
 
 namespace tapi {
 
@@ -72,6 +75,19 @@ public:
      */
     void log(LogLevel level, const std::string& source, const std::string& message);
 
+    /**
+     * @brief Check whether a record at this level would be emitted
+     *
+     * Used by the LOG_* macros to skip message construction entirely when
+     * the level is filtered out.
+     *
+     * @param level The level to check
+     * @return true if a log call at this level would be emitted
+     */
+    bool shouldLog(LogLevel level) const {
+        return level >= currentLevel_.load(std::memory_order_relaxed);
+    }
+
     // Convenience methods for different log levels
     void trace(const std::string& source, const std::string& message);
     void debug(const std::string& source, const std::string& message);
@@ -105,23 +121,98 @@ private:
 
     /**
      * @brief Get current timestamp as string
-     * 
+     *
      * @return std::string Formatted timestamp
      */
     static std::string getCurrentTimestamp();
 
+    /**
+     * @brief One preformatted record slot in the MPSC ring
+     *
+     * The sequence number doubles as the slot's hand-off protocol (Vyukov
+     * bounded queue): producers claim a slot with a CAS on enqueuePos_ and
+     * publish it by advancing the sequence; the single writer thread
+     * consumes it and recycles the slot one lap later.
+     */
+    struct Slot {
+        std::atomic<size_t> sequence{0};
+        LogLevel level = LogLevel::INFO;
+        std::string message;
+    };
+
+    /// A drained record, detached from its ring slot
+    struct Record {
+        LogLevel level;
+        std::string message;
+    };
+
+    /**
+     * @brief Enqueue a preformatted record into the ring
+     *
+     * @param level Log level of the record
+     * @param message Fully formatted log line
+     * @return false if the ring is full and the record was dropped
+     */
+    bool enqueue(LogLevel level, std::string message);
+
+    /**
+     * @brief Drain loop run by the writer thread
+     */
+    void writerLoop();
+
+    /**
+     * @brief Write a batch of records to console and file
+     *
+     * @param records Records to write, in enqueue order
+     */
+    void writeBatch(const std::vector<Record>& records);
+
     std::atomic<LogLevel> currentLevel_;
     std::atomic<bool> consoleLogging_;
     std::ofstream logFile_;
-    std::mutex logMutex_;
+    std::mutex logMutex_;                 ///< Protects logFile_ and output interleaving
+
+    std::vector<Slot> ring_;              ///< MPSC ring buffer of pending records
+    std::atomic<size_t> enqueuePos_;      ///< Next producer position
+    std::atomic<size_t> dequeuePos_;      ///< Next consumer position (writer thread only)
+    std::atomic<size_t> droppedCount_;    ///< Records dropped since the last report
+    std::thread writerThread_;            ///< Background batch writer
+    std::atomic<bool> running_;           ///< Whether the writer thread runs
+    std::condition_variable writerCv_;    ///< Wakes the writer for urgent records / shutdown
+    std::mutex writerMutex_;              ///< Paired with writerCv_
 };
 
-// Macro for easy logging
-#define LOG_TRACE(source, message) tapi::Logger::getInstance().trace(source, message)
-#define LOG_DEBUG(source, message) tapi::Logger::getInstance().debug(source, message)
-#define LOG_INFO(source, message) tapi::Logger::getInstance().info(source, message)
-#define LOG_WARN(source, message) tapi::Logger::getInstance().warn(source, message)
-#define LOG_ERROR(source, message) tapi::Logger::getInstance().error(source, message)
-#define LOG_FATAL(source, message) tapi::Logger::getInstance().fatal(source, message)
-
-} // namespace tapi 
\ No newline at end of file
+} // namespace tapi
+
+// Compile-time log level floor. LOG_* sites below the floor compile away
+// entirely, including their message-building arguments. Values match the
+// LogLevel enum: 0=TRACE, 1=DEBUG, 2=INFO, 3=WARN, 4=ERROR, 5=FATAL.
+// Override with -DTAPI_MIN_LOG_LEVEL=<n>.
+#ifndef TAPI_MIN_LOG_LEVEL
+#ifdef NDEBUG
+#define TAPI_MIN_LOG_LEVEL 2  // Release builds elide TRACE and DEBUG sites
+#else
+#define TAPI_MIN_LOG_LEVEL 0
+#endif
+#endif
+
+// Logging macros. The level check runs before the message expression is
+// evaluated, so call sites that concatenate strings pay nothing when their
+// level is filtered out — and nothing at all when it is below the
+// compile-time floor.
+#define TAPI_LOG_AT(levelEnum, source, message)                                \
+    do {                                                                       \
+        if constexpr (static_cast<int>(levelEnum) >= TAPI_MIN_LOG_LEVEL) {     \
+            tapi::Logger& tapiLoggerInstance = tapi::Logger::getInstance();    \
+            if (tapiLoggerInstance.shouldLog(levelEnum)) {                     \
+                tapiLoggerInstance.log(levelEnum, source, message);            \
+            }                                                                  \
+        }                                                                      \
+    } while (0)
+
+#define LOG_TRACE(source, message) TAPI_LOG_AT(tapi::LogLevel::TRACE, source, message)
+#define LOG_DEBUG(source, message) TAPI_LOG_AT(tapi::LogLevel::DEBUG, source, message)
+#define LOG_INFO(source, message) TAPI_LOG_AT(tapi::LogLevel::INFO, source, message)
+#define LOG_WARN(source, message) TAPI_LOG_AT(tapi::LogLevel::WARN, source, message)
+#define LOG_ERROR(source, message) TAPI_LOG_AT(tapi::LogLevel::ERROR, source, message)
+#define LOG_FATAL(source, message) TAPI_LOG_AT(tapi::LogLevel::FATAL, source, message) 
\ No newline at end of file
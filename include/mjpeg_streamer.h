@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <mutex>
+
+namespace tapi {
+
+/**
+ * @brief Minimal HTTP server for multipart/x-mixed-replace MJPEG live views
+ *
+ * Crow cannot flush a response body incrementally, so live streams are
+ * served by this dedicated listener instead of the REST app. Each accepted
+ * connection gets a writer thread that pulls frames from the camera's
+ * shared encoded-frame cache — one JPEG encode per published frame
+ * regardless of subscriber count — and throttles delivery to the client's
+ * requested frame rate.
+ *
+ * The REST API exposes GET /api/v1/cameras/{id}/stream, which redirects
+ * here after the usual license and camera checks.
+ */
+class MjpegStreamer {
+public:
+    /**
+     * @brief Construct a new MjpegStreamer object
+     *
+     * @param port Port to listen on
+     */
+    explicit MjpegStreamer(int port);
+
+    /**
+     * @brief Destructor, stops the server if running
+     */
+    ~MjpegStreamer();
+
+    /**
+     * @brief Start the listener and accept thread
+     *
+     * @return true if the server is listening, false otherwise
+     */
+    bool start();
+
+    /**
+     * @brief Stop the server and join all client threads
+     */
+    void stop();
+
+    /**
+     * @brief Get the port the streamer listens on
+     *
+     * @return int Listen port
+     */
+    int getPort() const;
+
+private:
+    /**
+     * @brief Per-connection writer thread plus its completion flag
+     *
+     * The flag lets the accept loop join and discard finished writers;
+     * without it every reconnecting viewer would leave a joinable thread
+     * (and its stack) behind for the server's lifetime.
+     */
+    struct ClientWorker {
+        std::thread thread;                      ///< Writer thread
+        std::shared_ptr<std::atomic<bool>> done; ///< Set when the writer returns
+    };
+
+    /**
+     * @brief Accept loop run by the listener thread
+     */
+    void acceptLoop();
+
+    /**
+     * @brief Join and drop client threads that have finished
+     */
+    void reapFinishedClients();
+
+    /**
+     * @brief Serve one MJPEG client connection until it disconnects
+     *
+     * @param clientFd Connected socket file descriptor
+     */
+    void handleClient(int clientFd);
+
+    int port_;                               ///< Listen port
+    int listenFd_;                           ///< Listening socket (-1 when stopped)
+    std::atomic<bool> running_;              ///< Whether the server is running
+    std::thread acceptThread_;               ///< Thread running acceptLoop()
+    std::mutex clientsMutex_;                ///< Protects clients_
+    std::vector<ClientWorker> clients_;      ///< Per-connection writer threads
+};
+
+} // namespace tapi
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <string>
 #include <vector>
 #include <nlohmann/json.hpp>
@@ -24,19 +25,30 @@ struct OnvifCamera {
  */
 class OnvifDiscovery {
 public:
+    /// Invoked as each new camera is discovered, before the scan finishes
+    using CameraFoundCallback = std::function<void(const OnvifCamera&)>;
+
     /**
      * @brief Constructor
      */
     OnvifDiscovery();
-    
+
     /**
      * @brief Discover ONVIF cameras on the network
-     * 
+     *
+     * Sends WS-Discovery probes over multicast and broadcast, plus unicast
+     * probes to every host of each local /24, then collects responses on a
+     * single non-blocking socket until the timeout expires. Probes are
+     * re-sent every few seconds for cameras that missed the first round.
+     *
      * @param timeoutSeconds Timeout in seconds for the discovery process
      * @param networkInterface Network interface to use for discovery (optional)
+     * @param onCameraFound Called for each camera as it is found (optional),
+     *                      so callers can surface results incrementally
      * @return Vector of discovered cameras
      */
-    std::vector<OnvifCamera> discoverCameras(int timeoutSeconds = 5, const std::string& networkInterface = "");
+    std::vector<OnvifCamera> discoverCameras(int timeoutSeconds = 5, const std::string& networkInterface = "",
+                                             CameraFoundCallback onCameraFound = nullptr);
     
     /**
      * @brief Convert cameras to JSON format
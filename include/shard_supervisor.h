@@ -0,0 +1,36 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace tapi {
+
+/**
+ * @brief Supervisor loop for multi-process camera sharding
+ *
+ * In shard mode one supervisor process spawns N workers, each a copy of
+ * this binary serving its own API port (base+1 .. base+N) and owning the
+ * camera subset that hashes to its shard index (see
+ * CameraManager::setShardPolicy). A GStreamer plugin crash then costs
+ * one worker's cameras instead of the fleet, and the supervisor restarts
+ * the dead worker with exponential backoff while the others keep
+ * streaming.
+ *
+ * The supervisor itself serves no requests: it forwards SIGINT/SIGTERM
+ * to the workers, reaps them, and exits once all have gone down for a
+ * shutdown signal. Workers are fully independent processes — frames
+ * never cross a process boundary because each worker runs its pipelines
+ * end to end.
+ */
+
+/**
+ * @brief Run the supervisor until shutdown
+ *
+ * @param binaryPath Path to this executable (argv[0])
+ * @param workerArgs Per-worker argument lists, excluding argv[0]
+ * @return int Process exit code
+ */
+int runShardSupervisor(const std::string& binaryPath,
+                       const std::vector<std::vector<std::string>>& workerArgs);
+
+} // namespace tapi
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace tapi {
+
+/**
+ * @brief Periodic crash-safe snapshots of operator-visible counter state
+ *
+ * Zone crossing totals and dwell accumulations live only in memory, so a
+ * crash resets every counter mid-shift. This service walks all cameras
+ * every few seconds, collects each component's getPersistentState(), and
+ * writes the result to disk with a write-temp-then-rename swap — the
+ * file on disk is always a complete snapshot, never a torn one. On
+ * startup (after the saved configuration has recreated the components)
+ * restore() feeds the state back through restorePersistentState(), so a
+ * restart costs at most one snapshot interval of counting.
+ *
+ * Tracker internals are deliberately not checkpointed: track identities
+ * are meaningless across a restart and the tracker rebuilds them within
+ * a few frames; only the accumulated totals need to survive.
+ */
+class StateSnapshotService {
+public:
+    /**
+     * @brief Get the singleton instance
+     */
+    static StateSnapshotService& getInstance();
+
+    /**
+     * @brief Start the periodic snapshot thread (idempotent)
+     */
+    void start();
+
+    /**
+     * @brief Stop the thread, taking one final snapshot
+     */
+    void stop();
+
+    /**
+     * @brief Restore component state from the snapshot file, if present
+     *
+     * Call after the saved camera configuration has been loaded so the
+     * components exist.
+     *
+     * @return true if a snapshot was found and applied
+     */
+    bool restore();
+
+    /**
+     * @brief Serialize all camera state and atomically swap the file
+     *
+     * @return true if the snapshot was written
+     */
+    bool snapshotNow();
+
+private:
+    StateSnapshotService();
+
+    // Disable copy and move
+    StateSnapshotService(const StateSnapshotService&) = delete;
+    StateSnapshotService& operator=(const StateSnapshotService&) = delete;
+
+    /**
+     * @brief Periodic thread body
+     */
+    void snapshotThreadFunction();
+
+    /// Interval between snapshots; a crash loses at most this much counting
+    static constexpr int kSnapshotIntervalMs = 5000;
+
+    std::string snapshotPath_;          ///< Snapshot file location
+    std::thread thread_;                ///< Periodic snapshot thread
+    std::atomic<bool> running_;         ///< Whether the thread should keep running
+    std::condition_variable cv_;        ///< Wakes the thread for shutdown
+    std::mutex cvMutex_;                ///< Mutex for the condition variable
+};
+
+} // namespace tapi
@@ -0,0 +1,88 @@
+#ifndef TAPI_SHM_EXPORT_H
+#define TAPI_SHM_EXPORT_H
+
+/*
+ * Shared-memory export ring layout for co-located consumers.
+ *
+ * This header is plain C so partner processes can compile against it
+ * without any tAPI sources. A camera with a "shm_export" sink publishes
+ * into two POSIX shared-memory regions (shm_open names):
+ *
+ *   /<name>_frames  - decoded BGR frames, one per processed frame
+ *   /<name>_events  - UTF-8 JSON telemetry, one slot per frame with events
+ *
+ * Each region starts with a tapi_shm_ring_header followed by slot_count
+ * slots of slot_stride bytes; a slot is a tapi_shm_slot_header followed
+ * immediately by its payload. Frame n (1-based) lands in slot
+ * (n - 1) % slot_count.
+ *
+ * Slots are guarded by a per-slot seqlock. The writer increments seq to
+ * an odd value, fills the slot, then increments it to 2*n. A reader:
+ *
+ *   1. loads head (acquire); if 0 nothing has been published yet
+ *   2. locates slot (head - 1) % slot_count
+ *   3. loads seq (acquire); retries while odd
+ *   4. copies the header fields and payload out
+ *   5. loads seq again; if it changed, the writer lapped it - retry
+ *
+ * Readers never block the writer; a slow reader simply re-reads. Use
+ * atomic (or at minimum volatile) loads for seq and head - the writer
+ * publishes them with release stores.
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TAPI_SHM_MAGIC 0x4d485354u /* "TSHM" little-endian */
+#define TAPI_SHM_VERSION 1u
+
+/* Region header at offset 0. All fields are little-endian host order. */
+typedef struct tapi_shm_ring_header {
+    uint32_t magic;            /* TAPI_SHM_MAGIC */
+    uint32_t version;          /* TAPI_SHM_VERSION */
+    uint32_t slot_count;       /* Number of slots in the ring */
+    uint32_t slot_stride;      /* Bytes from one slot header to the next */
+    uint32_t payload_capacity; /* Maximum payload bytes per slot */
+    uint32_t reserved;         /* Zero; pads head to an 8-byte boundary */
+    volatile uint64_t head;    /* 1-based sequence of the newest published
+                                  slot; 0 until the first publish */
+    uint8_t reserved2[32];     /* Zero; pads the header to a full cache
+                                  line so slots start line-aligned */
+} tapi_shm_ring_header;
+
+/* Per-slot header; the payload follows immediately after. */
+typedef struct tapi_shm_slot_header {
+    volatile uint64_t seq;     /* Seqlock word: odd while the writer is in
+                                  the slot, 2*n once frame n is published */
+    uint64_t frame_index;      /* 1-based frame sequence (matches head) */
+    int64_t timestamp_ms;      /* Unix milliseconds at publish time */
+    uint32_t width;            /* Frame rings: pixels; event rings: 0 */
+    uint32_t height;           /* Frame rings: pixels; event rings: 0 */
+    uint32_t channels;         /* Frame rings: 3 (BGR8); event rings: 0 */
+    uint32_t payload_bytes;    /* Valid bytes of payload in this slot */
+} tapi_shm_slot_header;
+
+/* Address of slot i within a mapped region. */
+static inline tapi_shm_slot_header*
+tapi_shm_slot(void* region_base, const tapi_shm_ring_header* header, uint32_t i)
+{
+    return (tapi_shm_slot_header*)((char*)region_base +
+                                   sizeof(tapi_shm_ring_header) +
+                                   (uint64_t)i * header->slot_stride);
+}
+
+/* Address of a slot's payload. */
+static inline void*
+tapi_shm_slot_payload(tapi_shm_slot_header* slot)
+{
+    return (char*)slot + sizeof(tapi_shm_slot_header);
+}
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* TAPI_SHM_EXPORT_H */
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "components/telemetry.h"
+
+namespace tapi {
+
+/**
+ * @brief In-process pub/sub fan-out for telemetry events
+ *
+ * The pipeline publishes each frame's telemetry events here; WebSocket
+ * subscribers receive them pushed instead of polling the database routes.
+ * Events are buffered per subscriber as-is and only serialized at flush
+ * time — as a JSON batch object, or as a protobuf TelemetryEventBatch for
+ * subscribers that opted into binary mode — so a burst of events costs
+ * one message per subscriber per flush window rather than one per
+ * event, and JSON is rendered only for consumers that asked for it.
+ * The flush window is both time- and size-bounded: batches go out on a
+ * fixed interval, or earlier when a subscriber's buffer fills up during
+ * an event storm.
+ *
+ * Publishing is near-free when nobody is subscribed (a single atomic
+ * load), so the pipeline can publish unconditionally.
+ */
+class TelemetryBroadcaster {
+public:
+    /// Callback used to deliver a serialized batch to one subscriber; the
+    /// flag says whether the payload is protobuf (true) or JSON text
+    using SendFunction = std::function<void(const std::string&, bool binary)>;
+
+    /**
+     * @brief Get the singleton instance
+     *
+     * @return TelemetryBroadcaster& The singleton instance
+     */
+    static TelemetryBroadcaster& getInstance();
+
+    /**
+     * @brief Publish a camera's frame event batch to all subscribers
+     *
+     * Subscribers buffer references to the shared immutable batch, so
+     * publishing to N subscribers costs N refcount bumps, not N copies.
+     *
+     * @param cameraId Camera the events belong to
+     * @param events Shared immutable batch produced for the current frame
+     */
+    void publish(const std::string& cameraId, const TelemetryEventList& events);
+
+    /**
+     * @brief Register a subscriber
+     *
+     * @param handle Opaque identity of the subscriber (e.g. connection pointer)
+     * @param cameraFilter Only deliver events for this camera (empty = all)
+     * @param send Callback invoked with each serialized batch
+     */
+    void addSubscriber(void* handle, const std::string& cameraFilter, SendFunction send);
+
+    /**
+     * @brief Switch an existing subscriber between JSON and binary batches
+     *
+     * @param handle Subscriber identity passed to addSubscriber()
+     * @param binary true for protobuf TelemetryEventBatch, false for JSON
+     */
+    void setSubscriberFormat(void* handle, bool binary);
+
+    /**
+     * @brief Change the camera filter of an existing subscriber
+     *
+     * @param handle Subscriber identity passed to addSubscriber()
+     * @param cameraFilter New camera filter (empty = all)
+     */
+    void setSubscriberFilter(void* handle, const std::string& cameraFilter);
+
+    /**
+     * @brief Remove a subscriber
+     *
+     * Blocks until any batch currently being delivered to this subscriber
+     * has finished sending, so the caller (typically a WebSocket onclose
+     * handler) can safely destroy whatever the send callback references.
+     *
+     * @param handle Subscriber identity passed to addSubscriber()
+     */
+    void removeSubscriber(void* handle);
+
+    /**
+     * @brief Get the number of connected subscribers
+     *
+     * @return size_t Subscriber count
+     */
+    size_t getSubscriberCount() const;
+
+    /**
+     * @brief Per-subscriber lag statistics
+     *
+     * @return nlohmann::json Array of {id, camera_filter, pending_events,
+     *         dropped_total} — pending_events is how far the consumer
+     *         currently lags the publish head
+     */
+    nlohmann::json getSubscriberStats() const;
+
+    /**
+     * @brief Stop the flush thread and drop all subscribers
+     */
+    void shutdown();
+
+private:
+    TelemetryBroadcaster();
+    ~TelemetryBroadcaster();
+
+    /**
+     * @brief Flush loop run by the background thread
+     */
+    void flushLoop();
+
+    /// Per-connection subscription state. Pending events are held as
+    /// references to the publisher's shared immutable batches; a slow
+    /// consumer lags by holding more references, never by owning copies.
+    struct Subscriber {
+        uint64_t id = 0;                      ///< Stable id for lag metrics
+        std::string cameraFilter;             ///< Camera ID filter (empty = all cameras)
+        SendFunction send;                    ///< Delivery callback
+        std::vector<TelemetryEventList> pending; ///< Shared batches until the next flush
+        size_t pendingEvents = 0;             ///< Events across pending batches (consumer lag)
+        size_t dropped = 0;                   ///< Events dropped since the last flush
+        uint64_t droppedTotal = 0;            ///< Events dropped since subscribing
+        bool binary = false;                  ///< Serialize batches as protobuf instead of JSON
+        bool inDelivery = false;              ///< A flush is sending to this subscriber right now
+    };
+
+    std::map<void*, Subscriber> subscribers_; ///< Registered subscribers by handle
+    uint64_t nextSubscriberId_ = 1;           ///< Monotonic id source for lag metrics
+    mutable std::mutex mutex_;                ///< Protects subscribers_
+    std::condition_variable cv_;              ///< Wakes the flush thread
+    std::condition_variable deliveryDoneCV_;  ///< Signals completed deliveries to removers
+    std::thread flushThread_;                 ///< Background batch flusher
+    std::atomic<bool> running_;               ///< Whether the flush thread runs
+    std::atomic<size_t> subscriberCount_;     ///< Lock-free publish fast path check
+};
+
+} // namespace tapi
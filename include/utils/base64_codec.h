@@ -0,0 +1,196 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "utils/cpu_features.h"
+
+#if defined(TAPI_SIMD_AVX2)
+#include <immintrin.h>
+#elif defined(TAPI_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace tapi {
+namespace utils {
+
+/**
+ * @brief Shared base64 encoder for image payloads
+ *
+ * Every HTTP transfer of an encoded frame funnels through this one
+ * encoder. The hot loop uses the lookup-shuffle technique: on AVX2,
+ * 24 input bytes are expanded to 32 six-bit indices and translated to
+ * ASCII with a single shuffle per vector; on NEON, vld3q deinterleaves
+ * 48 input bytes and a four-table vqtbl4q lookup emits 64 characters per
+ * iteration. A scalar loop handles the tail and non-SIMD builds. On x86
+ * the AVX2 path is chosen at runtime (see utils/cpu_features.h), so the
+ * same binary runs on pre-AVX2 hosts.
+ * Output is newline-free standard base64 with '=' padding,
+ * byte-identical to the scalar encoder it replaces.
+ */
+class Base64Codec {
+public:
+    /**
+     * @brief Encode a buffer to a base64 string
+     *
+     * @param data Input bytes
+     * @param size Number of input bytes
+     * @return std::string Base64 text with padding
+     */
+    static std::string encode(const unsigned char* data, size_t size) {
+        std::string out;
+        if (size == 0) {
+            return out;
+        }
+        out.resize(((size + 2) / 3) * 4);
+
+        char* dst = &out[0];
+        size_t consumed = 0;
+
+#if defined(TAPI_SIMD_AVX2)
+        if (cpu::avx2Available()) {
+            consumed = encodeAvx2(data, size, dst);
+        }
+#elif defined(TAPI_SIMD_NEON)
+        consumed = encodeNeon(data, size, dst);
+#endif
+        dst += (consumed / 3) * 4;
+        encodeScalar(data + consumed, size - consumed, dst);
+
+        return out;
+    }
+
+private:
+    static const char* alphabet() {
+        static const char kAlphabet[] =
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+            "abcdefghijklmnopqrstuvwxyz"
+            "0123456789+/";
+        return kAlphabet;
+    }
+
+    // Scalar tail: standard 3-in/4-out loop with '=' padding
+    static void encodeScalar(const unsigned char* data, size_t size, char* dst) {
+        const char* table = alphabet();
+
+        size_t i = 0;
+        for (; i + 3 <= size; i += 3) {
+            uint32_t triple = (static_cast<uint32_t>(data[i]) << 16) |
+                              (static_cast<uint32_t>(data[i + 1]) << 8) |
+                              static_cast<uint32_t>(data[i + 2]);
+            *dst++ = table[(triple >> 18) & 0x3f];
+            *dst++ = table[(triple >> 12) & 0x3f];
+            *dst++ = table[(triple >> 6) & 0x3f];
+            *dst++ = table[triple & 0x3f];
+        }
+
+        if (i < size) {
+            uint32_t triple = static_cast<uint32_t>(data[i]) << 16;
+            if (i + 1 < size) {
+                triple |= static_cast<uint32_t>(data[i + 1]) << 8;
+            }
+            *dst++ = table[(triple >> 18) & 0x3f];
+            *dst++ = table[(triple >> 12) & 0x3f];
+            *dst++ = (i + 1 < size) ? table[(triple >> 6) & 0x3f] : '=';
+            *dst++ = '=';
+        }
+    }
+
+#if defined(TAPI_SIMD_AVX2)
+    // AVX2 lookup-shuffle: 24 input bytes become 32 output characters per
+    // iteration. Returns the number of input bytes consumed (multiple of 3).
+    TAPI_TARGET_AVX2
+    static size_t encodeAvx2(const unsigned char* data, size_t size, char* dst) {
+        if (size < 32) {
+            return 0;
+        }
+
+        // Reorders each lane's 12 source bytes so every 32-bit element
+        // holds one 3-byte group in the order the bit extraction expects
+        const __m256i shuffle = _mm256_setr_epi8(
+            1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+            1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+
+        // Maps the 6-bit index ranges onto ASCII offsets: index 0-25 adds
+        // 'A', 26-51 adds 'a'-26, 52-61 adds '0'-52, 62 maps to '+', 63 to '/'
+        const __m256i offsets = _mm256_setr_epi8(
+            71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 65, 0, 0,
+            71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 65, 0, 0);
+
+        size_t i = 0;
+        // Each iteration reads 28 bytes (two overlapping 16-byte loads),
+        // so stop while a full load window remains
+        while (i + 28 <= size) {
+            __m256i in = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 12)), 1);
+
+            in = _mm256_shuffle_epi8(in, shuffle);
+
+            // Extract the four 6-bit fields of each 3-byte group
+            const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+            const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+            const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+            const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+            const __m256i indices = _mm256_or_si256(t1, t3);
+
+            // Classify each index into its alphabet range and add the
+            // range's ASCII offset via one shuffle
+            __m256i selector = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+            const __m256i lower = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+            selector = _mm256_blendv_epi8(selector, _mm256_set1_epi8(13), lower);
+
+            const __m256i ascii = _mm256_add_epi8(
+                indices, _mm256_shuffle_epi8(offsets, selector));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), ascii);
+            dst += 32;
+            i += 24;
+        }
+
+        return i;
+    }
+#elif defined(TAPI_SIMD_NEON)
+    // NEON lookup: vld3q deinterleaves 48 input bytes into the three byte
+    // planes of each group, and a four-table lookup translates all 64
+    // indices at once. Returns input bytes consumed (multiple of 3).
+    static size_t encodeNeon(const unsigned char* data, size_t size, char* dst) {
+        if (size < 48) {
+            return 0;
+        }
+
+        const uint8x16x4_t table = vld1q_u8_x4(
+            reinterpret_cast<const uint8_t*>(alphabet()));
+
+        size_t i = 0;
+        while (i + 48 <= size) {
+            const uint8x16x3_t in = vld3q_u8(data + i);
+
+            uint8x16x4_t indices;
+            indices.val[0] = vshrq_n_u8(in.val[0], 2);
+            indices.val[1] = vorrq_u8(vshlq_n_u8(vandq_u8(in.val[0], vdupq_n_u8(0x03)), 4),
+                                      vshrq_n_u8(in.val[1], 4));
+            indices.val[2] = vorrq_u8(vshlq_n_u8(vandq_u8(in.val[1], vdupq_n_u8(0x0f)), 2),
+                                      vshrq_n_u8(in.val[2], 6));
+            indices.val[3] = vandq_u8(in.val[2], vdupq_n_u8(0x3f));
+
+            uint8x16x4_t ascii;
+            ascii.val[0] = vqtbl4q_u8(table, indices.val[0]);
+            ascii.val[1] = vqtbl4q_u8(table, indices.val[1]);
+            ascii.val[2] = vqtbl4q_u8(table, indices.val[2]);
+            ascii.val[3] = vqtbl4q_u8(table, indices.val[3]);
+
+            vst4q_u8(reinterpret_cast<uint8_t*>(dst), ascii);
+            dst += 64;
+            i += 48;
+        }
+
+        return i;
+    }
+#endif
+};
+
+} // namespace utils
+} // namespace tapi
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <string>
+
+namespace tapi {
+namespace utils {
+
+/**
+ * @brief Circuit breaker for flaky backend dependencies
+ *
+ * Guards a remote backend (Redis, the billing service) so a stalled or
+ * unreachable endpoint fails fast instead of making every caller sit
+ * through its full timeout-and-retry budget. Standard three-state
+ * machine:
+ *
+ *  - CLOSED: requests flow normally; consecutive failures are counted
+ *  - OPEN: after failure_threshold consecutive failures, allowRequest()
+ *    returns false for open_duration_ms and callers fall back to their
+ *    last-known-good cached state immediately
+ *  - HALF_OPEN: once the cooldown elapses, a single probe request is let
+ *    through; success closes the circuit, failure re-opens it for
+ *    another cooldown
+ *
+ * Thread-safe; all methods take one uncontended mutex.
+ */
+class CircuitBreaker {
+public:
+    struct Config {
+        int failure_threshold = 5;    ///< Consecutive failures before opening
+        int open_duration_ms = 30000; ///< Fail-fast window before probing
+    };
+
+    enum class State { CLOSED, OPEN, HALF_OPEN };
+
+    CircuitBreaker() : CircuitBreaker(Config{}) {}
+
+    explicit CircuitBreaker(const Config& config)
+        : config_(config) {}
+
+    /**
+     * @brief Whether the caller should attempt the backend request
+     *
+     * Returns false while the circuit is open; when the cooldown has
+     * elapsed, transitions to HALF_OPEN and lets one probe through.
+     */
+    bool allowRequest() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        switch (state_) {
+            case State::CLOSED:
+                return true;
+            case State::OPEN: {
+                auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - opened_at_).count();
+                if (elapsed < config_.open_duration_ms) {
+                    return false;
+                }
+                state_ = State::HALF_OPEN;
+                probe_in_flight_ = true;
+                return true;
+            }
+            case State::HALF_OPEN:
+                // One probe at a time; everyone else keeps failing fast
+                if (probe_in_flight_) {
+                    return false;
+                }
+                probe_in_flight_ = true;
+                return true;
+        }
+        return true;
+    }
+
+    /// Record a successful backend interaction
+    void recordSuccess() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        consecutive_failures_ = 0;
+        probe_in_flight_ = false;
+        state_ = State::CLOSED;
+    }
+
+    /// Record a failed backend interaction
+    void recordFailure() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        probe_in_flight_ = false;
+        if (state_ == State::HALF_OPEN) {
+            // Probe failed; back to failing fast for another cooldown
+            open();
+            return;
+        }
+        consecutive_failures_++;
+        if (state_ == State::CLOSED && consecutive_failures_ >= config_.failure_threshold) {
+            open();
+        }
+    }
+
+    State state() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return state_;
+    }
+
+    /// Human-readable state for logs and status endpoints
+    std::string stateName() const {
+        switch (state()) {
+            case State::OPEN: return "open";
+            case State::HALF_OPEN: return "half_open";
+            case State::CLOSED: break;
+        }
+        return "closed";
+    }
+
+private:
+    // Caller must hold mutex_
+    void open() {
+        state_ = State::OPEN;
+        opened_at_ = std::chrono::steady_clock::now();
+        consecutive_failures_ = 0;
+    }
+
+    Config config_;
+    mutable std::mutex mutex_;
+    State state_ = State::CLOSED;
+    int consecutive_failures_ = 0;
+    bool probe_in_flight_ = false;
+    std::chrono::steady_clock::time_point opened_at_{};
+};
+
+} // namespace utils
+} // namespace tapi
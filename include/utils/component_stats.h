@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace tapi {
+namespace utils {
+
+/**
+ * @brief Seqlock-published per-component telemetry counters
+ *
+ * Simple counters (frames processed, items emitted, FPS) used to live
+ * behind each component's status mutex, so API pollers contended with
+ * the frame loop just to read two integers. Each component instead
+ * publishes them into this POD block guarded by a seqlock, the same
+ * protocol the shared-memory export ring uses per slot: the single
+ * writer (the pipeline thread) bumps the sequence word to odd, stores
+ * the block, and bumps it back to even; readers copy the block and
+ * retry if the sequence changed or was odd. Writes are two relaxed
+ * atomic bumps plus plain stores — strictly wait-free on the pipeline
+ * side — and readers never block the writer.
+ */
+class ComponentStats {
+public:
+    /**
+     * @brief The published counter block
+     */
+    struct Block {
+        uint64_t framesProcessed = 0;   ///< Frames this component has handled
+        uint64_t itemsEmitted = 0;      ///< Detections/tracks/events produced
+        double fps = 0.0;               ///< Smoothed processing rate
+        int64_t lastFrameMs = 0;        ///< Wall-clock time of the last frame
+    };
+
+    /**
+     * @brief Record one processed frame (writer side, pipeline thread only)
+     *
+     * @param items Items this frame emitted (detections, tracks, events)
+     */
+    void recordFrame(uint64_t items) {
+        const int64_t nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+
+        Block next = block_;
+        next.framesProcessed++;
+        next.itemsEmitted += items;
+        if (next.lastFrameMs > 0 && nowMs > next.lastFrameMs) {
+            const double instant = 1000.0 / static_cast<double>(nowMs - next.lastFrameMs);
+            // Light EWMA so the gauge is readable without hiding stalls
+            next.fps = (next.fps > 0.0) ? (0.9 * next.fps + 0.1 * instant) : instant;
+        }
+        next.lastFrameMs = nowMs;
+        publish(next);
+    }
+
+    /**
+     * @brief Take a consistent copy of the block (reader side, never blocks)
+     */
+    Block read() const {
+        for (;;) {
+            const uint64_t before = seq_.load(std::memory_order_acquire);
+            if (before & 1) {
+                continue; // Writer mid-publish
+            }
+            Block copy = block_;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (seq_.load(std::memory_order_relaxed) == before) {
+                return copy;
+            }
+        }
+    }
+
+private:
+    /**
+     * @brief Seqlock-publish a new block (single writer)
+     */
+    void publish(const Block& next) {
+        const uint64_t seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        block_ = next;
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    std::atomic<uint64_t> seq_{0};  ///< Odd while a publish is in flight
+    Block block_;                   ///< Published counters (guarded by seq_)
+};
+
+} // namespace utils
+} // namespace tapi
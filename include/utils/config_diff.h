@@ -0,0 +1,48 @@
+#pragma once
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace tapi {
+
+/**
+ * @brief Result of diffing an incoming component config against the live one
+ *
+ * Each top-level key whose value actually differs is classified as either
+ * hot-applicable (can be absorbed by the running component) or
+ * restart-required (alters state that is only read at startup, e.g. the
+ * GStreamer pipeline description). Keys whose value is unchanged are dropped
+ * so a client PUTting back the full config it just read costs nothing.
+ */
+struct ConfigDiff {
+    std::vector<std::string> hotKeys;      ///< Changed keys that can be applied live
+    std::vector<std::string> restartKeys;  ///< Changed keys that need a component restart
+
+    bool hasChanges() const { return !hotKeys.empty() || !restartKeys.empty(); }
+    bool requiresRestart() const { return !restartKeys.empty(); }
+
+    /// Comma-separated restart-required keys, for log messages
+    std::string restartKeysSummary() const;
+};
+
+/**
+ * @brief Classify the changes an incoming config would make to the current one
+ *
+ * Only keys present in the incoming config are considered; a key absent from
+ * the current config counts as changed. Values are compared with JSON
+ * equality, so "5" vs 5 is a change.
+ *
+ * @param current Config the component is currently running with
+ * @param incoming Config from the update request
+ * @param restartRequiredKeys Keys that can only be applied by a restart;
+ *        every other changed key is classified as hot-applicable
+ * @return ConfigDiff The changed keys, classified
+ */
+ConfigDiff diffConfig(
+    const nlohmann::json& current,
+    const nlohmann::json& incoming,
+    const std::unordered_set<std::string>& restartRequiredKeys);
+
+} // namespace tapi
@@ -0,0 +1,67 @@
+#pragma once
+
+namespace tapi {
+namespace cpu {
+
+// Runtime CPU-feature dispatch plumbing for the vectorized kernels (IoU,
+// point-in-polygon, base64, motion diff).
+//
+// One binary serves both x86 servers and ARM boxes, so the kernels must
+// not hard-require AVX2. On x86 the AVX2 bodies are compiled behind a
+// per-function target attribute — legal in a TU built without -mavx2 —
+// and selected at startup via cpuid (__builtin_cpu_supports). On aarch64
+// NEON is part of the baseline ISA, so the NEON paths stay compile-time.
+// Builds made with -mavx2 keep static dispatch: the whole binary already
+// assumes the instruction set, and avx2Available() folds to a constant.
+//
+// TAPI_SIMD_AVX2   - the AVX2 kernel bodies can be compiled in this TU
+// TAPI_TARGET_AVX2 - attribute for those bodies (empty under -mavx2)
+// TAPI_SIMD_NEON   - the NEON kernel bodies can be compiled in this TU
+#if defined(__AVX2__)
+#define TAPI_SIMD_AVX2 1
+#define TAPI_TARGET_AVX2
+#elif (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__clang__) || defined(__GNUC__))
+#define TAPI_SIMD_AVX2 1
+#define TAPI_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define TAPI_SIMD_NEON 1
+#endif
+
+/**
+ * @brief Whether the AVX2 kernel paths may run on this machine
+ *
+ * Detected once on first use; constant-true when the build already
+ * targets AVX2 and constant-false off x86.
+ */
+inline bool avx2Available() {
+#if defined(__AVX2__)
+    return true;
+#elif defined(TAPI_SIMD_AVX2)
+    static const bool value = __builtin_cpu_supports("avx2");
+    return value;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief The vector tier the kernels actually execute on this machine
+ *
+ * Reported through the metrics endpoint so the fleet can be audited for
+ * boxes silently running the scalar fallbacks.
+ *
+ * @return const char* "avx2", "neon" or "scalar"
+ */
+inline const char* simdTier() {
+#if defined(TAPI_SIMD_NEON)
+    return "neon";
+#else
+    return avx2Available() ? "avx2" : "scalar";
+#endif
+}
+
+} // namespace cpu
+} // namespace tapi
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <string>
+#include "utils/common.h"
+#include "utils/ipc.h"
+#include "utils/grpc_client.h"
+
+namespace tapi {
+namespace utils {
+
+/**
+ * @brief Manages a CUDA shared memory region for use with Triton Inference Server
+ *
+ * When built with TRITON_ENABLE_GPU the region lives in device memory and is
+ * exposed to the server through its cudaIpc handle, so the input tensor
+ * crosses PCIe once (our host-to-device copy) instead of twice (host to
+ * server, then server to device). Without GPU support every operation fails
+ * gracefully so callers fall back to system shared memory.
+ */
+class TritonCudaSharedMemory {
+public:
+    /**
+     * @brief Construct a new Triton Cuda Shared Memory object
+     */
+    TritonCudaSharedMemory();
+
+    /**
+     * @brief Destroy the Triton Cuda Shared Memory object
+     */
+    ~TritonCudaSharedMemory();
+
+    /**
+     * @brief Allocate a device memory region and export its cudaIpc handle
+     *
+     * @param byteSize Size of the region in bytes
+     * @param name Optional specific name to use (generates random name if empty)
+     * @return std::string The name of the region, empty on failure
+     */
+    std::string createRegion(size_t byteSize, const std::string& name = "");
+
+    /**
+     * @brief Register the region with Triton server over gRPC
+     *
+     * @param client gRPC client connected to the inference server
+     * @return true If registration was successful
+     * @return false If registration failed
+     */
+    bool registerWithTritonServer(triton::client::InferenceServerGrpcClient* client);
+
+    /**
+     * @brief Unregister the region from Triton server
+     *
+     * @return true If unregistration was successful
+     * @return false If unregistration failed
+     */
+    bool unregisterFromTritonServer();
+
+    /**
+     * @brief Copy host data into the device region (single host-to-device copy)
+     *
+     * @param data Host buffer to copy from
+     * @param byteSize Number of bytes to copy
+     * @return true If the copy succeeded
+     * @return false If the copy failed or the region is invalid
+     */
+    bool copyFromHost(const void* data, size_t byteSize);
+
+    /**
+     * @brief Get the name of the region
+     */
+    const std::string& getName() const { return name_; }
+
+    /**
+     * @brief Get the size of the region in bytes
+     */
+    size_t getSize() const { return size_; }
+
+    /**
+     * @brief Check if the region has been allocated
+     */
+    bool isValid() const;
+
+    /**
+     * @brief Check if the region is registered with the server
+     */
+    bool isRegistered() const { return registered_; }
+
+    /**
+     * @brief Unregister and free the device memory
+     */
+    void cleanup();
+
+private:
+    std::string name_;
+    void* devPtr_;
+    size_t size_;
+    bool isValid_;
+    bool registered_;
+    cudaIpcMemHandle_t handle_;
+    triton::client::InferenceServerGrpcClient* registeredClient_; ///< Client used for registration (not owned)
+};
+
+} // namespace utils
+} // namespace tapi
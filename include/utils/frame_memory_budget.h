@@ -0,0 +1,125 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace tapi {
+
+class FramePool;
+
+namespace utils {
+
+/**
+ * @brief Process-wide budget for pooled frame memory
+ *
+ * Frame pools account every buffer they own here, so the process has a
+ * single number for frame memory instead of RSS ballooning invisibly
+ * under event storms. A ceiling comes from TAPI_FRAME_BUDGET_MB (unset
+ * or 0 = unlimited, the previous behavior).
+ *
+ * Degradation under pressure is tiered and predictable instead of
+ * ending at the OOM killer:
+ *
+ *  - crossing 90% of the budget sheds annotated-frame work (viewers see
+ *    raw frames; inference is untouched),
+ *  - crossing 100% additionally sheds recording frame blobs (telemetry
+ *    events are still written, thumbnails are dropped),
+ *  - idle free-list buffers are trimmed whenever the ceiling is crossed,
+ *  - live inference buffers are never shed — capture and detector plane
+ *    pools keep allocating, which is why the ceiling should leave them
+ *    headroom.
+ *
+ * Shed decisions are advisory reads on a relaxed atomic, so checking
+ * costs nothing on the frame path. Callers that act on a shed decision
+ * bump tapi_frame_budget_shed_total with a class label.
+ */
+class FrameMemoryBudget {
+public:
+    /**
+     * @brief Work classes that may be shed, in shedding order
+     */
+    enum class ShedClass {
+        Annotation, ///< Annotated-frame clones and drawing (sheds first)
+        Recording   ///< Recording/thumbnail frame blobs (sheds at the ceiling)
+    };
+
+    /**
+     * @brief Get the singleton instance
+     */
+    static FrameMemoryBudget& getInstance();
+
+    /**
+     * @brief Whether the given work class should currently be shed
+     *
+     * Always false when no budget is configured.
+     */
+    bool shouldShed(ShedClass cls) const;
+
+    /**
+     * @brief Configured ceiling in bytes (0 = unlimited)
+     */
+    size_t budgetBytes() const { return budgetBytes_; }
+
+    /**
+     * @brief Bytes currently owned by registered pools
+     */
+    size_t usedBytes() const { return usedBytes_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Budget and usage statistics
+     *
+     * @return nlohmann::json {budget_bytes, used_bytes, pools}
+     */
+    nlohmann::json getStats() const;
+
+    // Accounting interface used by FramePool ---------------------------
+
+    /**
+     * @brief Record newly owned frame bytes (trims idle buffers when the
+     * ceiling is crossed)
+     */
+    void addBytes(size_t bytes);
+
+    /**
+     * @brief Record released frame bytes
+     */
+    void subBytes(size_t bytes);
+
+    /**
+     * @brief Register a pool for idle-buffer trimming under pressure
+     */
+    void registerPool(FramePool* pool);
+
+    /**
+     * @brief Unregister a pool (called from the pool destructor)
+     */
+    void unregisterPool(FramePool* pool);
+
+private:
+    FrameMemoryBudget();
+
+    // Disable copy and move
+    FrameMemoryBudget(const FrameMemoryBudget&) = delete;
+    FrameMemoryBudget& operator=(const FrameMemoryBudget&) = delete;
+
+    /**
+     * @brief Drop idle free-list buffers across all registered pools
+     */
+    void shedIdleBuffers();
+
+    /// Annotation work sheds at this fraction of the budget
+    static constexpr double kAnnotationShedRatio = 0.9;
+
+    size_t budgetBytes_;                ///< Ceiling in bytes (0 = unlimited)
+    std::atomic<size_t> usedBytes_;     ///< Bytes currently owned by pools
+    std::atomic<uint64_t> trims_;       ///< Times idle buffers were shed
+
+    mutable std::mutex poolsMutex_;     ///< Guards the pool registry
+    std::vector<FramePool*> pools_;     ///< Registered pools (raw; unregistered in dtor)
+};
+
+} // namespace utils
+} // namespace tapi
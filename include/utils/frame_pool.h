@@ -0,0 +1,112 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <opencv2/opencv.hpp>
+#include <nlohmann/json.hpp>
+
+namespace tapi {
+
+/**
+ * @brief Shared handle to a pooled frame buffer
+ *
+ * The underlying cv::Mat is returned to its pool automatically when the
+ * last handle is dropped, so frames can be passed through the pipeline
+ * by reference instead of by deep copy.
+ */
+using FramePtr = std::shared_ptr<cv::Mat>;
+
+/**
+ * @brief Reference-counted pool of frame buffers
+ *
+ * Decoding and processing a 1080p stream allocates and frees multi-megabyte
+ * buffers on every frame if each stage clones the image. The pool keeps a
+ * small free list of cv::Mat objects and hands them out as shared handles;
+ * when the last holder releases a handle the buffer goes back on the free
+ * list with its allocation intact, so steady-state operation performs no
+ * frame-sized allocations at all.
+ *
+ * Consumers that only read a frame can share the handle (or a cv::Mat
+ * header copy) freely. A consumer that needs to mutate pixels must take a
+ * private copy first (see FramePool::clone), giving copy-on-write
+ * semantics across the pipeline.
+ *
+ * The pool must be owned by a std::shared_ptr (handles keep a weak
+ * reference back to it so that buffers outliving the pool are simply
+ * freed instead of recycled).
+ */
+class FramePool : public std::enable_shared_from_this<FramePool> {
+public:
+    /**
+     * @brief Construct a new Frame Pool
+     *
+     * @param maxFree Maximum number of idle buffers kept for reuse
+     */
+    explicit FramePool(size_t maxFree = 8);
+
+    /**
+     * @brief Destructor
+     */
+    ~FramePool();
+
+    /**
+     * @brief Acquire a frame buffer with the given geometry
+     *
+     * Reuses an idle buffer when one is available; cv::Mat::create is a
+     * no-op when the geometry already matches, so recycled buffers keep
+     * their allocation.
+     *
+     * @param rows Frame height
+     * @param cols Frame width
+     * @param type OpenCV pixel type (e.g. CV_8UC3)
+     * @return FramePtr Handle that recycles the buffer when released
+     */
+    FramePtr acquire(int rows, int cols, int type);
+
+    /**
+     * @brief Deep-copy an existing frame into a pooled buffer
+     *
+     * This is the copy-on-write point: call it only when a stage actually
+     * needs to mutate pixels.
+     *
+     * @param src Frame to copy
+     * @return FramePtr Pooled copy of the source frame
+     */
+    FramePtr clone(const cv::Mat& src);
+
+    /**
+     * @brief Get pool statistics (allocations, reuses, outstanding handles)
+     *
+     * @return nlohmann::json Pool statistics
+     */
+    nlohmann::json getStats() const;
+
+    /**
+     * @brief Drop all idle buffers (called by the frame memory budget
+     * under pressure)
+     *
+     * Outstanding handles are unaffected; the free list refills as they
+     * come back once usage is under the ceiling again.
+     */
+    void trimFree();
+
+private:
+    /**
+     * @brief Return a buffer to the free list (called by handle deleters)
+     *
+     * If an outside cv::Mat header still shares the pixel data (e.g. a
+     * frame kept by the API layer), the data reference is dropped instead
+     * of recycling the buffer out from under the reader.
+     */
+    void release(cv::Mat* mat);
+
+    size_t maxFree_;                                  ///< Free-list capacity
+    mutable std::mutex mutex_;                        ///< Guards the free list and counters
+    std::vector<std::unique_ptr<cv::Mat>> freeList_;  ///< Idle buffers ready for reuse
+    size_t allocated_;                                ///< Total buffers ever created
+    size_t outstanding_;                              ///< Buffers currently handed out
+    size_t reuses_;                                   ///< Times an idle buffer was recycled
+};
+
+} // namespace tapi
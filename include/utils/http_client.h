@@ -27,10 +27,15 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "common.h"
 #include "ipc.h"
 
+// From libcurl; only referenced by pointer here so the curl header is
+// not pulled into every consumer of this one.
+struct curl_slist;
+
 namespace triton { namespace client {
 
 class HttpInferRequest;
@@ -624,6 +629,23 @@ class InferenceServerHttpClient : public InferenceServerClient {
       const Headers& headers, const Parameters& query_params,
       std::string* response);
 
+  // Acquire an easy handle for an asynchronous request, reusing a
+  // previously pooled handle when one is available.
+  void* GetAsyncEasyHandle();
+  // Reset an easy handle and return it to the pool for reuse by a
+  // subsequent asynchronous request.
+  void ReleaseAsyncEasyHandle(void* easy_handle);
+
+  // Acquire a pooled header list whose static portion matches
+  // 'signature', rewriting the per-request inference-header-length
+  // entry to 'infer_hdr'. Returns nullptr when no matching list is
+  // pooled and a fresh one must be built.
+  struct curl_slist* AcquireHeaderList(
+      const std::string& signature, const std::string& infer_hdr);
+  // Return a completed request's header list to the pool instead of
+  // freeing it, so the next request reuses the allocations.
+  void ReclaimHeaderList(HttpInferRequest* request);
+
   static size_t ResponseHandler(
       void* contents, size_t size, size_t nmemb, void* userp);
   static size_t InferRequestProvider(
@@ -646,6 +668,18 @@ class InferenceServerHttpClient : public InferenceServerClient {
   // map to record new asynchronous requests with pointer to easy handle
   // or tag id as key
   AsyncReqMap new_async_requests_;
+  // pool of reset easy handles available for reuse by asynchronous
+  // requests; keeps the multi handle's keep-alive connections warm
+  // instead of paying connection setup per request
+  std::vector<void*> easy_handle_pool_;
+  // pool of header lists from completed requests; only the
+  // inference-header-length entry varies between steady-state requests,
+  // so the list allocations are reused instead of rebuilt per request
+  struct PooledHeaderList {
+    struct curl_slist* list;
+    std::string signature;
+  };
+  std::vector<PooledHeaderList> header_list_pool_;
 };
 
 }}  // namespace triton::client
\ No newline at end of file
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "utils/http_client.h"
+#include "utils/grpc_client.h"
+
+namespace tapi {
+
+/**
+ * @brief Process-wide aggregator that batches inference requests across cameras
+ *
+ * Per-frame unary calls leave the GPU underutilized because Triton only
+ * sees batch-of-one tensors. The batcher collects preprocessed input
+ * tensors from all detector components for a short window (10 ms by
+ * default), concatenates compatible requests (same server, model, input
+ * and shape) into one batched Infer call, and splits the outputs back per
+ * submitter.
+ *
+ * Submitters receive a future that resolves with their slice of each
+ * output tensor, so the calling code stays synchronous.
+ *
+ * When the backend saturates, degradation follows the request's QoS tier
+ * rather than hitting every camera equally: higher-priority items seed
+ * and fill batches first, best-effort items past their deadline are
+ * dropped instead of dispatched stale, and best-effort admission is
+ * refused outright once the measured backend round trip exceeds the
+ * item's freshness budget.
+ */
+class InferenceBatcher {
+public:
+    /**
+     * @brief A single-item inference request to be coalesced into a batch
+     */
+    struct Request {
+        std::string serverUrl;                 ///< Inference server URL
+        std::string protocol;                  ///< "http" or "grpc"
+        std::string modelId;                   ///< Model to run
+        std::string inputName;                 ///< Model input tensor name
+        std::string datatype;                  ///< Input datatype (e.g. "FP32")
+        std::vector<int64_t> itemShape;        ///< Per-item shape with leading batch dim 1
+        std::vector<std::string> outputNames;  ///< Output tensors to request
+        std::vector<uint8_t> inputData;        ///< Raw input tensor bytes
+        int priority = 0;                      ///< QoS tier; higher dispatches first, <= 0 is best effort
+        int64_t deadlineMicros = 0;            ///< Freshness budget from submit time (0 = never expires)
+    };
+
+    /**
+     * @brief Per-submitter result: this item's slice of each output tensor
+     */
+    struct Response {
+        bool ok = false;                                    ///< Whether inference succeeded
+        std::string error;                                  ///< Error message when !ok
+        std::map<std::string, std::vector<uint8_t>> outputs; ///< Output name -> raw bytes for this item
+    };
+
+    /**
+     * @brief Get the singleton instance
+     */
+    static InferenceBatcher& getInstance();
+
+    /**
+     * @brief Submit a request for batched inference
+     *
+     * The returned future resolves once the batch containing this request
+     * has completed (at most one batch window plus the inference round
+     * trip later). A best-effort request (priority <= 0) with a deadline
+     * may instead resolve immediately with an admission error, or with a
+     * drop error if its deadline passes while it waits in the queue.
+     *
+     * @param request Single-item request
+     * @return std::future<Response> Future resolving with this item's outputs
+     */
+    std::future<Response> submit(Request request);
+
+    /**
+     * @brief Set the aggregation window in microseconds (default 10000)
+     */
+    void setBatchWindowMicros(int64_t micros);
+
+    /**
+     * @brief Set the maximum number of items per batch (default 16)
+     */
+    void setMaxBatchSize(size_t maxBatch);
+
+    /**
+     * @brief Enable or disable streaming inference over gRPC (default on)
+     *
+     * When enabled, the batcher holds one long-lived ModelStreamInfer
+     * stream per gRPC server and sends batches as stream writes instead
+     * of unary calls, avoiding per-request RPC setup and keeping result
+     * delivery ordered. Takes effect for servers connected after the
+     * call; HTTP servers always use unary requests.
+     */
+    void setStreamingEnabled(bool enabled);
+
+    /**
+     * @brief Get batching statistics
+     *
+     * @return nlohmann::json Statistics (batches, items, average batch size)
+     */
+    nlohmann::json getStats() const;
+
+private:
+    InferenceBatcher();
+    ~InferenceBatcher();
+
+    InferenceBatcher(const InferenceBatcher&) = delete;
+    InferenceBatcher& operator=(const InferenceBatcher&) = delete;
+
+    /**
+     * @brief Pending request with its completion promise
+     */
+    struct PendingItem {
+        Request request;
+        std::promise<Response> promise;
+        std::chrono::steady_clock::time_point enqueuedAt; ///< Anchors deadline and FIFO order
+    };
+
+    /**
+     * @brief Key identifying requests that can share a batch
+     */
+    static std::string batchKey(const Request& request);
+
+    /**
+     * @brief In-flight results for one server's bidirectional stream
+     *
+     * The stream callback runs on the client's stream worker thread and
+     * files results by request id; the dispatcher waits on the condition
+     * variable for its batch's id.
+     */
+    struct StreamState {
+        std::mutex mutex;                 ///< Guards results
+        std::condition_variable cv;       ///< Signals result arrival
+        std::map<std::string, std::unique_ptr<triton::client::InferResult>> results; ///< Results by request id
+    };
+
+    void dispatcherLoop();
+    void runBatch(std::vector<PendingItem> items);
+    triton::client::InferenceServerHttpClient* getHttpClient(const std::string& serverUrl);
+    triton::client::InferenceServerGrpcClient* getGrpcClient(const std::string& serverUrl);
+
+    mutable std::mutex mutex_;                    ///< Guards pending items and clients
+    std::condition_variable cv_;                  ///< Wakes the dispatcher
+    std::vector<PendingItem> pending_;            ///< Requests awaiting dispatch
+    std::thread dispatcher_;                      ///< Batch dispatcher thread
+    std::atomic<bool> stopRequested_;             ///< Shutdown flag
+    std::atomic<int64_t> batchWindowMicros_;      ///< Aggregation window
+    std::atomic<size_t> maxBatchSize_;            ///< Maximum items per batch
+
+    // Cached clients per server (shared by all detector components)
+    std::map<std::string, std::unique_ptr<triton::client::InferenceServerHttpClient>> httpClients_;
+    std::map<std::string, std::unique_ptr<triton::client::InferenceServerGrpcClient>> grpcClients_;
+
+    // Streaming state (dispatcher thread only, except StreamState contents)
+    std::atomic<bool> streamingEnabled_;          ///< Use gRPC streams when available
+    std::atomic<uint64_t> streamRequestSeq_;      ///< Correlates stream requests and responses
+    std::map<std::string, std::shared_ptr<StreamState>> grpcStreams_; ///< Active streams per server
+
+    // Statistics
+    std::atomic<uint64_t> batchCount_;            ///< Batches dispatched
+    std::atomic<uint64_t> itemCount_;             ///< Items processed
+    std::atomic<uint64_t> expiredCount_;          ///< Best-effort items dropped past deadline
+    std::atomic<uint64_t> rejectedCount_;         ///< Best-effort items refused at admission
+    std::atomic<int64_t> backendLatencyEwmaMicros_; ///< Smoothed batch round-trip time
+};
+
+} // namespace tapi
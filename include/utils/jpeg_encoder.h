@@ -0,0 +1,121 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <opencv2/opencv.hpp>
+
+namespace tapi {
+namespace utils {
+
+/// Encoded JPEG bytes backed by the encoder's buffer pool; the buffer is
+/// recycled once every holder has dropped its reference
+using JpegBuffer = std::shared_ptr<std::vector<uchar>>;
+
+/**
+ * @brief Process-wide JPEG encoder with a hardware fast path
+ *
+ * All snapshot and MJPEG traffic used to burn a CPU core in cv::imencode.
+ * On boxes with a hardware JPEG element (nvjpegenc on Jetson,
+ * vaapijpegenc on VAAPI-capable Intel/AMD) this encoder pushes frames
+ * through a persistent appsrc ! videoconvert ! <hwenc> ! appsink
+ * pipeline instead, falling back to cv::imencode when no element is
+ * available or the hardware path fails at runtime (sticky: one failure
+ * disables it for the process, logged once).
+ *
+ * Output buffers come from a small free list so steady-state encoding
+ * allocates nothing, mirroring FramePool on the input side. Set
+ * TAPI_HW_JPEG=off to force the software path.
+ */
+class JpegEncoder {
+public:
+    /**
+     * @brief Get the singleton instance
+     *
+     * The first call probes the GStreamer registry for hardware
+     * encoder elements.
+     */
+    static JpegEncoder& getInstance();
+
+    /**
+     * @brief Encode a BGR frame to JPEG
+     *
+     * Serialized internally; callers that already coalesce encodes per
+     * frame (Camera's generation cache) see no extra contention.
+     *
+     * @param frame BGR frame to encode
+     * @param quality JPEG quality (1-100)
+     * @return JpegBuffer Encoded bytes, or nullptr on failure
+     */
+    JpegBuffer encode(const cv::Mat& frame, int quality);
+
+    /**
+     * @brief Name of the active encoder element
+     *
+     * @return std::string "nvjpegenc", "vaapijpegenc" or "imencode"
+     */
+    std::string activeEncoder() const;
+
+private:
+    JpegEncoder();
+    ~JpegEncoder();
+
+    JpegEncoder(const JpegEncoder&) = delete;
+    JpegEncoder& operator=(const JpegEncoder&) = delete;
+
+    /**
+     * @brief Probe the GStreamer registry for a hardware JPEG element
+     */
+    void detectHardwareEncoder();
+
+    /**
+     * @brief (Re)build the hardware pipeline for the given geometry
+     *
+     * The pipeline persists between encodes and is only rebuilt when
+     * the frame geometry or quality changes.
+     *
+     * @return true if the pipeline is ready for pushes
+     */
+    bool ensurePipeline(int width, int height, int quality);
+
+    /**
+     * @brief Tear down the hardware pipeline
+     */
+    void destroyPipeline();
+
+    /**
+     * @brief Run one frame through the hardware pipeline
+     *
+     * @return true on success with *out filled, false to trigger fallback
+     */
+    bool encodeHardware(const cv::Mat& frame, int quality, std::vector<uchar>& out);
+
+    /**
+     * @brief Take a pooled output buffer (cleared, capacity retained)
+     */
+    JpegBuffer acquireBuffer();
+
+    /**
+     * @brief Return a buffer to the free list (called by handle deleters)
+     */
+    void releaseBuffer(std::vector<uchar>* buffer);
+
+    mutable std::mutex mutex_;        ///< Serializes pipeline access and rebuilds
+    std::string hwElement_;           ///< Hardware element name, empty if none
+    bool hwDisabled_ = false;         ///< Sticky: hardware path failed at runtime
+
+    void* pipeline_ = nullptr;        ///< GstElement* (kept opaque to spare every include of OpenCV headers the GStreamer ones)
+    void* appsrc_ = nullptr;          ///< GstElement* for the source
+    void* appsink_ = nullptr;         ///< GstElement* for the sink
+    int pipelineWidth_ = 0;           ///< Geometry the pipeline was built for
+    int pipelineHeight_ = 0;
+    int pipelineQuality_ = 0;
+
+    static constexpr size_t kMaxFreeBuffers = 8; ///< Free-list capacity
+    std::mutex bufferMutex_;          ///< Guards the buffer free list
+    std::vector<std::unique_ptr<std::vector<uchar>>> freeBuffers_; ///< Idle output buffers
+};
+
+} // namespace utils
+} // namespace tapi
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tapi {
+namespace utils {
+
+/**
+ * @brief Forward-only JSON serializer writing straight into a string
+ *
+ * The hot API routes used to build an nlohmann::json tree and then
+ * dump() it — two full materializations per response. JsonWriter emits
+ * tokens directly into the caller's buffer (typically the
+ * crow::response body), so serializing a response costs one pass and
+ * the buffer's own growth, with no intermediate DOM.
+ *
+ * Usage is strictly structural: begin/end calls must nest correctly and
+ * every object member needs key() before its value. rawValue() splices
+ * a pre-serialized fragment verbatim for sub-documents that already
+ * exist as JSON text (component getStatus() dumps, stored properties
+ * columns), the same trick the event export path uses.
+ */
+class JsonWriter {
+public:
+    /**
+     * @brief Construct a writer appending to the given buffer
+     *
+     * @param out Output buffer; the writer only ever appends
+     */
+    explicit JsonWriter(std::string& out) : out_(out) {
+        levels_.reserve(8);
+    }
+
+    void beginObject() {
+        prefix();
+        out_ += '{';
+        levels_.push_back(false);
+    }
+
+    void endObject() {
+        levels_.pop_back();
+        out_ += '}';
+    }
+
+    void beginArray() {
+        prefix();
+        out_ += '[';
+        levels_.push_back(false);
+    }
+
+    void endArray() {
+        levels_.pop_back();
+        out_ += ']';
+    }
+
+    /// Emit an object member key; the next call supplies its value
+    void key(std::string_view name) {
+        if (!levels_.empty() && levels_.back()) {
+            out_ += ',';
+        }
+        if (!levels_.empty()) {
+            levels_.back() = true;
+        }
+        appendEscaped(name);
+        out_ += ':';
+        afterKey_ = true;
+    }
+
+    void value(std::string_view text) {
+        prefix();
+        appendEscaped(text);
+    }
+
+    void value(const char* text) { value(std::string_view(text)); }
+
+    void value(bool flag) {
+        prefix();
+        out_ += flag ? "true" : "false";
+    }
+
+    void value(int64_t number) {
+        prefix();
+        out_ += std::to_string(number);
+    }
+
+    void value(uint64_t number) {
+        prefix();
+        out_ += std::to_string(number);
+    }
+
+    void value(int number) { value(static_cast<int64_t>(number)); }
+
+    void value(double number) {
+        prefix();
+        // Shortest round-trippable form, matching nlohmann's output closely
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.17g", number);
+        out_ += buffer;
+    }
+
+    void null() {
+        prefix();
+        out_ += "null";
+    }
+
+    /// Splice pre-serialized JSON verbatim (caller guarantees validity)
+    void rawValue(std::string_view json) {
+        prefix();
+        out_.append(json.data(), json.size());
+    }
+
+private:
+    /// Comma management shared by every value-position emission
+    void prefix() {
+        if (afterKey_) {
+            afterKey_ = false;
+            return;
+        }
+        if (!levels_.empty()) {
+            if (levels_.back()) {
+                out_ += ',';
+            }
+            levels_.back() = true;
+        }
+    }
+
+    void appendEscaped(std::string_view text) {
+        out_ += '"';
+        for (char c : text) {
+            switch (c) {
+                case '"': out_ += "\\\""; break;
+                case '\\': out_ += "\\\\"; break;
+                case '\b': out_ += "\\b"; break;
+                case '\f': out_ += "\\f"; break;
+                case '\n': out_ += "\\n"; break;
+                case '\r': out_ += "\\r"; break;
+                case '\t': out_ += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        char buffer[8];
+                        std::snprintf(buffer, sizeof(buffer), "\\u%04x",
+                                      static_cast<unsigned char>(c));
+                        out_ += buffer;
+                    } else {
+                        out_ += c;
+                    }
+            }
+        }
+        out_ += '"';
+    }
+
+    std::string& out_;
+    std::vector<bool> levels_;  ///< Per-depth "a sibling was already emitted"
+    bool afterKey_ = false;     ///< Last token was a key; no comma before its value
+};
+
+} // namespace utils
+} // namespace tapi
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace tapi {
+
+/**
+ * @brief Process-wide latency histograms for per-frame pipeline stages
+ *
+ * Each (stage, component) pair owns a histogram of power-of-two
+ * microsecond buckets backed by relaxed atomics, so recording a sample
+ * on the frame path costs one snapshot load, a map lookup and two
+ * atomic increments — no lock and no allocation once the histogram
+ * exists. The registry itself is an immutable snapshot map swapped
+ * copy-on-write when a new (stage, component) pair first reports, the
+ * same pattern ConfigManager uses for its config cache.
+ *
+ * renderPrometheus() serializes every histogram in Prometheus text
+ * exposition format for the GET /metrics endpoint.
+ */
+class LatencyMetrics {
+private:
+    struct Histogram;
+
+public:
+    /// Power-of-two microsecond buckets: 1us up to ~4.2min, plus overflow
+    static constexpr size_t BUCKET_COUNT = 28;
+
+    /**
+     * @brief Pre-resolved handle to one (stage, component) histogram
+     *
+     * Obtained once via stageHandle() when a component is wired up, so
+     * per-frame recording skips the key build and map lookup entirely —
+     * string work happens at configuration time, not on the frame path.
+     * A default-constructed handle records nothing.
+     */
+    class StageHandle {
+    public:
+        StageHandle() = default;
+
+        /// Record one latency sample in microseconds
+        void record(int64_t micros) const;
+
+        /// Whether the handle points at a histogram
+        bool valid() const { return histogram_ != nullptr; }
+
+    private:
+        friend class LatencyMetrics;
+        explicit StageHandle(std::shared_ptr<Histogram> histogram)
+            : histogram_(std::move(histogram)) {}
+
+        std::shared_ptr<Histogram> histogram_;
+    };
+
+    /**
+     * @brief Get the singleton instance
+     */
+    static LatencyMetrics& getInstance();
+
+    /**
+     * @brief Record one latency sample
+     *
+     * @param stage Pipeline stage name (e.g. "detector", "tracker")
+     * @param componentId Component (or camera) the sample belongs to
+     * @param micros Elapsed time in microseconds
+     */
+    void record(const std::string& stage, const std::string& componentId, int64_t micros);
+
+    /**
+     * @brief Resolve a (stage, component) pair to its histogram once
+     *
+     * Creates the histogram on first call. The returned handle stays
+     * valid for the process lifetime.
+     */
+    StageHandle stageHandle(const std::string& stage, const std::string& componentId);
+
+    /**
+     * @brief Records the lifetime of a scope through a pre-resolved handle
+     *
+     * The zero-allocation counterpart to ScopedTimer for call sites that
+     * resolved their StageHandle at configuration time.
+     */
+    class ScopedStageTimer {
+    public:
+        explicit ScopedStageTimer(const StageHandle& handle)
+            : handle_(handle), start_(std::chrono::steady_clock::now()) {}
+
+        ~ScopedStageTimer() {
+            auto micros = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start_).count();
+            handle_.record(micros);
+        }
+
+        ScopedStageTimer(const ScopedStageTimer&) = delete;
+        ScopedStageTimer& operator=(const ScopedStageTimer&) = delete;
+
+    private:
+        const StageHandle& handle_;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    /**
+     * @brief Records the lifetime of a scope as one latency sample
+     */
+    class ScopedTimer {
+    public:
+        ScopedTimer(std::string stage, std::string componentId)
+            : stage_(std::move(stage)), componentId_(std::move(componentId)),
+              start_(std::chrono::steady_clock::now()) {}
+
+        ~ScopedTimer() {
+            auto micros = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start_).count();
+            LatencyMetrics::getInstance().record(stage_, componentId_, micros);
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        std::string stage_;
+        std::string componentId_;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    /**
+     * @brief Increment a named counter by one
+     *
+     * Shares the registry's lock-free fast path: after the first
+     * increment for a (name, labels) pair the cost is a snapshot load
+     * and one atomic add.
+     *
+     * @param name Prometheus metric name (e.g. "tapi_http_requests_total")
+     * @param labels Rendered label list without braces
+     *               (e.g. "method=\"GET\",code=\"200\"")
+     */
+    void incrementCounter(const std::string& name, const std::string& labels);
+
+    /**
+     * @brief Add a delta to a named counter
+     *
+     * Same fast path as incrementCounter(); used by batched work (e.g.
+     * retention slices) that accounts many rows per call.
+     *
+     * @param name Prometheus metric name
+     * @param labels Rendered label list without braces
+     * @param delta Amount to add
+     */
+    void addToCounter(const std::string& name, const std::string& labels, uint64_t delta);
+
+    /**
+     * @brief Cumulative sample count and sum for one stage
+     */
+    struct StageTotals {
+        uint64_t count = 0;     ///< Total samples across all components
+        uint64_t sumMicros = 0; ///< Sum of all samples in microseconds
+    };
+
+    /**
+     * @brief Aggregate a stage's histograms across all components
+     *
+     * Totals are cumulative since startup; consumers that want recent
+     * behavior (e.g. the quality governor) difference two reads. Costs
+     * one snapshot load and a map walk, no locks.
+     *
+     * @param stage Pipeline stage name (e.g. "frame_age")
+     * @return StageTotals Summed count and microseconds for the stage
+     */
+    StageTotals stageTotals(const std::string& stage) const;
+
+    /**
+     * @brief Render all histograms and counters in Prometheus text
+     * exposition format
+     *
+     * @return std::string Metrics payload for GET /metrics
+     */
+    std::string renderPrometheus() const;
+
+private:
+    LatencyMetrics();
+
+    LatencyMetrics(const LatencyMetrics&) = delete;
+    LatencyMetrics& operator=(const LatencyMetrics&) = delete;
+
+    /**
+     * @brief One histogram: bucket counters plus running count and sum
+     */
+    struct Histogram {
+        std::string stage;                                   ///< Stage label
+        std::string componentId;                             ///< Component label
+        std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets; ///< Per-bucket sample counts
+        std::atomic<uint64_t> count{0};                      ///< Total samples
+        std::atomic<uint64_t> sumMicros{0};                  ///< Sum of all samples
+
+        Histogram(std::string stageName, std::string component);
+    };
+
+    /**
+     * @brief One monotonically increasing counter
+     */
+    struct Counter {
+        std::string name;                ///< Metric name
+        std::string labels;              ///< Rendered label list
+        std::atomic<uint64_t> value{0};  ///< Current count
+
+        Counter(std::string metricName, std::string labelList)
+            : name(std::move(metricName)), labels(std::move(labelList)) {}
+    };
+
+    /// Immutable registry generation shared with lock-free recorders
+    using HistogramMap = std::unordered_map<std::string, std::shared_ptr<Histogram>>;
+    using CounterMap = std::unordered_map<std::string, std::shared_ptr<Counter>>;
+
+    /// Get the current registry snapshot without locking
+    std::shared_ptr<const HistogramMap> snapshot() const;
+    std::shared_ptr<const CounterMap> counterSnapshot() const;
+
+    /// Insert a histogram for a new key (copy-on-write, takes the mutex)
+    std::shared_ptr<Histogram> getOrCreate(const std::string& key,
+                                           const std::string& stage,
+                                           const std::string& componentId);
+
+    /// Insert a counter for a new key (copy-on-write, takes the mutex)
+    std::shared_ptr<Counter> getOrCreateCounter(const std::string& key,
+                                                const std::string& name,
+                                                const std::string& labels);
+
+    mutable std::mutex mutex_;                    ///< Serializes registry swaps
+    std::shared_ptr<const HistogramMap> histograms_; ///< Current snapshot, atomically swapped
+    std::shared_ptr<const CounterMap> counters_;  ///< Current counter snapshot, atomically swapped
+};
+
+} // namespace tapi
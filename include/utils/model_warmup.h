@@ -0,0 +1,57 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace triton { namespace client {
+class InferenceServerGrpcClient;
+}}  // namespace triton::client
+
+namespace tapi {
+
+/**
+ * @brief Startup model preloading and warmup against the inference server
+ *
+ * The first inference after boot pays model load and CUDA graph capture
+ * on the server — often tens of seconds, during which freshly restored
+ * cameras time out and retry. warmupModels() issues an explicit
+ * LoadModel for every model referenced by the saved camera configs,
+ * polls readiness, then fires one dummy-tensor inference per model so
+ * the expensive first-request work is done before any pipeline starts.
+ */
+class ModelWarmup {
+public:
+    /**
+     * @brief Collect the model ids referenced by saved camera configs
+     *
+     * Scans every object_detection processor entry; entries without an
+     * explicit model_id contribute the detector default.
+     *
+     * @param allCameras All saved camera configurations, keyed by camera id
+     * @return std::vector<std::string> Deduplicated model ids
+     */
+    static std::vector<std::string> collectModelIds(const nlohmann::json& allCameras);
+
+    /**
+     * @brief Load, await readiness of, and warm the given models
+     *
+     * Failures are logged and skipped so one broken model cannot hold up
+     * boot — the affected cameras fall back to their existing retry
+     * logic.
+     *
+     * @param serverUrl Inference server URL (HTTP form; converted to gRPC)
+     * @param modelIds Models to preload and warm
+     * @param timeoutSecs Per-model readiness wait bound
+     * @return size_t Number of models that completed warmup
+     */
+    static size_t warmupModels(const std::string& serverUrl,
+                               const std::vector<std::string>& modelIds,
+                               int timeoutSecs = 60);
+
+private:
+    static bool warmupModel(triton::client::InferenceServerGrpcClient* client,
+                            const std::string& modelId, int timeoutSecs);
+};
+
+} // namespace tapi
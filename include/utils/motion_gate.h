@@ -0,0 +1,91 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <nlohmann/json.hpp>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "utils/motion_kernel.h"
+
+namespace tapi {
+
+/**
+ * @brief Suppresses detector inference on static frames
+ *
+ * Cheap per-frame motion test (MotionKernel: downscale + diff +
+ * threshold on a quarter-resolution plane) that gates the camera's
+ * detection stage: while the
+ * scene is static, inference only runs on a slow heartbeat so scene
+ * drift is still caught; the first frame with motion resumes full-rate
+ * inference immediately, and a cooldown keeps it running briefly after
+ * motion stops so trackers can wind tracks down cleanly.
+ *
+ * Owned by the Camera and driven from the processing thread; the
+ * statistics counters are atomic so getStatus() can be served from API
+ * threads.
+ */
+class MotionGate {
+public:
+    MotionGate();
+
+    /**
+     * @brief Apply gating parameters from a detector's motion_gating config
+     *
+     * Recognized keys: enabled (bool), sensitivity (fraction of changed
+     * pixels that counts as motion, default 0.01), heartbeat_interval_ms
+     * (default 3000), cooldown_ms (default 2000), pixel_threshold
+     * (per-pixel intensity delta, default 25). A null or empty object
+     * disables the gate.
+     *
+     * @param config The motion_gating config object
+     */
+    void configure(const nlohmann::json& config);
+
+    /**
+     * @brief Check whether gating is enabled
+     */
+    bool isEnabled() const { return enabled_; }
+
+    /**
+     * @brief Decide whether inference should run for this frame
+     *
+     * Always runs the motion test so the background reference stays
+     * current, then applies the heartbeat/cooldown policy.
+     *
+     * @param frame Raw frame for this cycle
+     * @param timestampMs Capture timestamp (ms since epoch)
+     * @return true if the detection stage should run
+     */
+    bool shouldRunInference(const cv::Mat& frame, int64_t timestampMs);
+
+    /**
+     * @brief Get the coarse motion regions from the last frame
+     *
+     * Full-frame coordinates from the kernel's block activity grid;
+     * empty when the last frame had no motion. Intended to feed
+     * ROI-cropped detection. Processing-thread only.
+     */
+    const std::vector<cv::Rect>& getMotionRois() const { return motionRois_; }
+
+    /**
+     * @brief Get gating statistics for status reporting
+     */
+    nlohmann::json getStatus() const;
+
+private:
+    bool enabled_;             ///< Whether gating is active
+    double sensitivity_;       ///< Changed-pixel fraction that counts as motion
+    int heartbeatIntervalMs_;  ///< Max ms between inferences while static
+    int cooldownMs_;           ///< Ms to keep inferring after the last motion
+    int pixelThreshold_;       ///< Per-pixel intensity delta that counts as changed
+
+    MotionKernel kernel_;                    ///< Downscale+diff+threshold kernel
+    std::vector<cv::Rect> motionRois_;       ///< Motion regions from the last frame
+    std::atomic<int64_t> lastMotionMs_;      ///< Timestamp of the last frame with motion
+    int64_t lastInferenceMs_;                ///< Timestamp of the last frame allowed through
+    std::atomic<uint64_t> suppressedFrames_; ///< Frames where inference was suppressed
+    std::atomic<uint64_t> totalFrames_;      ///< Frames evaluated by the gate
+};
+
+} // namespace tapi
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace tapi {
+namespace utils {
+
+/**
+ * @brief Lock-free heartbeat for one pipeline stage
+ *
+ * Each stage bumps its heartbeat once per frame with relaxed atomic
+ * stores — cheap enough to call on the hot path, unlike the
+ * mutex-guarded status updates. A watchdog (or the status fast path)
+ * reads the counter and the age of the last tick without taking any
+ * locks, so a stuck stage is visible within seconds instead of showing
+ * up as log silence.
+ */
+class StageHeartbeat {
+public:
+    /**
+     * @brief Record one unit of progress (call once per frame)
+     */
+    void tick() {
+        frames_.fetch_add(1, std::memory_order_relaxed);
+        lastTickMs_.store(nowMs(), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Total ticks since startup
+     */
+    uint64_t frames() const {
+        return frames_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Milliseconds since the last tick, or -1 if never ticked
+     */
+    int64_t ageMs() const {
+        const int64_t last = lastTickMs_.load(std::memory_order_relaxed);
+        return last == 0 ? -1 : nowMs() - last;
+    }
+
+private:
+    static int64_t nowMs() {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    std::atomic<uint64_t> frames_{0};  ///< Frames seen by this stage
+    std::atomic<int64_t> lastTickMs_{0}; ///< steady_clock ms of the last tick (0 = never)
+};
+
+/**
+ * @brief Per-camera heartbeat set, one per pipeline stage
+ *
+ * `process` ticks every processing cycle whether or not a frame arrived,
+ * so it measures loop liveness; the other stages tick on actual frame
+ * progress. A live `process` with a stale `capture` therefore means the
+ * source stopped delivering, while a stale `process` means the pipeline
+ * itself is wedged.
+ */
+struct PipelineHeartbeats {
+    StageHeartbeat capture; ///< A frame left the source
+    StageHeartbeat process; ///< A processing cycle ran
+    StageHeartbeat detect;  ///< The detection stage produced results
+    StageHeartbeat sink;    ///< Sinks consumed a completed frame
+};
+
+} // namespace utils
+} // namespace tapi
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <nlohmann/json.hpp>
+
+namespace tapi {
+namespace utils {
+
+/**
+ * @brief Global governor that trades quality for latency under load
+ *
+ * When CPU or the inference server saturates, the failure mode without
+ * intervention is rising latency on every camera at once. The governor
+ * samples system CPU and the process-wide "frame_age" latency stage a
+ * few times a minute and walks an escalation ladder:
+ *
+ *  - level 1 doubles every detector's effective frame stride,
+ *  - level 2 additionally sheds annotation drawing,
+ *  - level 3 quadruples the stride and sheds recording frame blobs.
+ *
+ * Each level is restored one step at a time after the box has been
+ * healthy for several consecutive samples, so recovery does not flap.
+ * Operators set policy once through environment variables instead of
+ * hand-tuning every camera when a box runs hot:
+ *
+ *  - TAPI_GOVERNOR=0 disables the governor entirely,
+ *  - TAPI_GOVERNOR_CPU_HIGH — CPU percentage that escalates (default 85),
+ *  - TAPI_GOVERNOR_FRAME_AGE_MS — average capture-to-processing age that
+ *    escalates (default 500),
+ *  - TAPI_GOVERNOR_MAX_STRIDE — floor on detection rate: the stride
+ *    multiplier never exceeds this (default 4).
+ *
+ * The knobs are advisory relaxed atomics, the same pattern as
+ * FrameMemoryBudget::shouldShed — reading them on the frame path costs
+ * nothing, and no camera configuration is ever rewritten, so operator
+ * settings survive untouched when load recedes.
+ */
+class QualityGovernor {
+public:
+    /**
+     * @brief Get the singleton instance (starts the monitor thread)
+     */
+    static QualityGovernor& getInstance();
+
+    /**
+     * @brief Multiplier applied to every detector's frame stride
+     *
+     * 1 when healthy; 2 or 4 under load, clamped to the configured
+     * maximum. Cameras multiply this into each detector's own stride.
+     */
+    int detectionStrideMultiplier() const {
+        return strideMultiplier_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Whether annotation drawing should currently be shed
+     */
+    bool shedAnnotation() const {
+        return shedAnnotation_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Whether recording frame blobs should currently be shed
+     */
+    bool shedRecording() const {
+        return shedRecording_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Current escalation level (0 = no degradation)
+     */
+    int level() const {
+        return level_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Governor state and last load sample
+     *
+     * @return nlohmann::json {enabled, level, stride_multiplier,
+     *         shed_annotation, shed_recording, cpu_percent, frame_age_ms}
+     */
+    nlohmann::json getStats() const;
+
+    /**
+     * @brief Stop the monitor thread
+     */
+    void shutdown();
+
+private:
+    QualityGovernor();
+    ~QualityGovernor();
+
+    QualityGovernor(const QualityGovernor&) = delete;
+    QualityGovernor& operator=(const QualityGovernor&) = delete;
+
+    /**
+     * @brief Monitor loop: sample load, walk the escalation ladder
+     */
+    void monitorThread();
+
+    /**
+     * @brief Sample system-wide CPU utilization from /proc/stat
+     *
+     * @return double Busy percentage since the previous call (-1 on the
+     *         first call or when /proc/stat is unavailable)
+     */
+    double sampleCpuPercent();
+
+    /**
+     * @brief Average frame age in milliseconds since the previous call
+     *
+     * Differences the cumulative "frame_age" stage totals between
+     * samples; -1 when no frames were processed in the window.
+     */
+    double sampleFrameAgeMs();
+
+    /**
+     * @brief Apply the knob settings for an escalation level
+     */
+    void applyLevel(int level);
+
+    /// Seconds between load samples
+    static constexpr int kSampleIntervalSecs = 2;
+
+    /// Consecutive healthy samples before stepping one level down
+    static constexpr int kRecoverSamples = 5;
+
+    /// Highest escalation level
+    static constexpr int kMaxLevel = 3;
+
+    bool enabled_;                ///< TAPI_GOVERNOR != 0
+    double cpuHighPct_;           ///< CPU percentage that escalates
+    double frameAgeHighMs_;       ///< Average frame age that escalates
+    int maxStrideMultiplier_;     ///< Floor on detection rate
+
+    std::atomic<int> level_{0};              ///< Current escalation level
+    std::atomic<int> strideMultiplier_{1};   ///< Published stride multiplier
+    std::atomic<bool> shedAnnotation_{false}; ///< Published annotation shed
+    std::atomic<bool> shedRecording_{false};  ///< Published recording shed
+
+    std::atomic<double> lastCpuPercent_{-1.0};  ///< Last CPU sample (for stats)
+    std::atomic<double> lastFrameAgeMs_{-1.0};  ///< Last frame-age sample (for stats)
+
+    uint64_t prevCpuBusy_ = 0;    ///< /proc/stat busy jiffies at last sample
+    uint64_t prevCpuTotal_ = 0;   ///< /proc/stat total jiffies at last sample
+    uint64_t prevAgeCount_ = 0;   ///< frame_age sample count at last sample
+    uint64_t prevAgeSumMicros_ = 0; ///< frame_age sum at last sample
+
+    std::atomic<bool> running_{false}; ///< Monitor thread run flag
+    std::thread thread_;               ///< Monitor thread
+};
+
+} // namespace utils
+} // namespace tapi
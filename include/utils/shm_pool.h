@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "utils/shm_utils.h"
+
+namespace tapi {
+namespace utils {
+
+/**
+ * @brief Process-wide pool of pre-registered shared memory segments
+ *
+ * Creating, mapping and unlinking a shm segment around individual transfers
+ * costs shm_open/ftruncate/mmap syscalls plus a register/unregister round
+ * trip to the inference server every time. The pool instead keeps
+ * size-classed segments (powers of two, 1 MB minimum) alive for the whole
+ * process: each segment is created, mapped and registered with the server
+ * exactly once, then leased and returned by detector components with no
+ * further syscalls or registration traffic.
+ */
+class SharedMemoryPool {
+public:
+    /**
+     * @brief Get the singleton instance
+     */
+    static SharedMemoryPool& getInstance();
+
+    /**
+     * @brief Lease a segment of at least byteSize bytes
+     *
+     * Reuses a free segment of the matching size class when one is
+     * available; otherwise creates and registers a new one. The returned
+     * pointer gives the segment back to the pool when it is reset.
+     *
+     * @param byteSize Minimum usable size in bytes
+     * @return std::shared_ptr<TritonSharedMemory> Leased segment, or nullptr on failure
+     */
+    std::shared_ptr<TritonSharedMemory> lease(size_t byteSize);
+
+    /**
+     * @brief Pre-create segments so startup, not the first frame, pays the
+     * creation and registration cost
+     *
+     * @param byteSize Minimum usable size in bytes per segment
+     * @param count Number of segments to create
+     * @return bool True if all segments were created and registered
+     */
+    bool preallocate(size_t byteSize, size_t count);
+
+    /**
+     * @brief Get pool statistics
+     *
+     * @return nlohmann::json Statistics (segments, leases, reuse count)
+     */
+    nlohmann::json getStats() const;
+
+private:
+    SharedMemoryPool() = default;
+    ~SharedMemoryPool() = default;
+
+    SharedMemoryPool(const SharedMemoryPool&) = delete;
+    SharedMemoryPool& operator=(const SharedMemoryPool&) = delete;
+
+    /**
+     * @brief Round a requested size up to its size class
+     */
+    static size_t sizeClassFor(size_t byteSize);
+
+    /**
+     * @brief Create, map and register a new segment of the given class size
+     */
+    std::unique_ptr<TritonSharedMemory> createSegment(size_t classSize);
+
+    /**
+     * @brief Return a leased segment to its size-class free list
+     */
+    void release(size_t classSize, std::unique_ptr<TritonSharedMemory> segment);
+
+    mutable std::mutex mutex_;                ///< Guards free lists and counters
+    std::map<size_t, std::vector<std::unique_ptr<TritonSharedMemory>>> freeSegments_; ///< Free segments by size class
+    size_t totalSegments_ = 0;                ///< Segments created over the lifetime of the pool
+    uint64_t leaseCount_ = 0;                 ///< Total leases served
+    uint64_t reuseCount_ = 0;                 ///< Leases served from the free lists
+};
+
+} // namespace utils
+} // namespace tapi
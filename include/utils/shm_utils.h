@@ -64,13 +64,26 @@ public:
     
     /**
      * @brief Create shared memory for an OpenCV image
-     * 
+     *
      * @param image The image to copy to shared memory
      * @param name Optional specific name to use (generates random name if empty)
      * @param skipRegistration Optional parameter to skip Triton server registration
      * @return std::string The name of the shared memory region
      */
     std::string createImageSharedMemory(const cv::Mat& image, const std::string& name = "", bool skipRegistration = false);
+
+    /**
+     * @brief Create an empty shared memory region of the given size
+     *
+     * Creates and maps the region without copying any data into it, so it
+     * can be reused for many transfers (see SharedMemoryPool).
+     *
+     * @param byteSize Size of the region in bytes
+     * @param name Optional specific name to use (generates random name if empty)
+     * @param skipRegistration Optional parameter to skip Triton server registration
+     * @return std::string The name of the shared memory region
+     */
+    std::string createRegion(size_t byteSize, const std::string& name = "", bool skipRegistration = false);
     
     /**
      * @brief Get information about the current shared memory
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace tapi {
+
+/**
+ * @brief Fixed-capacity lock-free ring buffer for frame handoff
+ *
+ * Designed for the single-producer/single-consumer path between a source's
+ * capture thread and the camera processing thread. When the ring is full
+ * the producer drops the oldest entry instead of blocking, so a slow
+ * consumer never stalls the capture thread and decode latency stays flat;
+ * every drop is counted for observability.
+ *
+ * Because drop-oldest makes the producer briefly act as a consumer, each
+ * slot carries a sequence number (Vyukov-style bounded queue) so that a
+ * concurrent pop and drop can never hand out the same slot twice.
+ *
+ * Capacity is rounded up to a power of two.
+ */
+template <typename T>
+class SpscRing {
+public:
+    /**
+     * @brief Construct a ring with at least the given capacity
+     *
+     * @param capacity Minimum number of slots (rounded up to a power of two)
+     */
+    explicit SpscRing(size_t capacity)
+        : slots_(roundUpPow2(capacity)),
+          mask_(slots_.size() - 1),
+          head_(0),
+          tail_(0),
+          droppedCount_(0) {
+        // Fill-construct the storage above: Slot holds an atomic, which is
+        // neither movable nor copyable, so vector(n) (in-place value-init)
+        // is required — resize() would try to move slots and not compile.
+        for (size_t i = 0; i < slots_.size(); i++) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Push a value, dropping the oldest entry if the ring is full
+     *
+     * @param value Value to enqueue
+     * @return true if the value was enqueued without displacing anything,
+     *         false if an older entry (or, in a rare race, the new value)
+     *         had to be dropped
+     */
+    bool push(T value) {
+        if (tryPush(value)) {
+            return true;
+        }
+        // Ring full: discard the oldest entry to make room, then retry.
+        T dropped;
+        if (tryPop(dropped)) {
+            droppedCount_.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (!tryPush(std::move(value))) {
+            // Consumer raced us and the ring filled again; count the new
+            // value as dropped rather than spinning.
+            droppedCount_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Pop the oldest value
+     *
+     * @param out Receives the popped value on success
+     * @return true if a value was popped, false if the ring was empty
+     */
+    bool pop(T& out) {
+        return tryPop(out);
+    }
+
+    /**
+     * @brief Number of entries currently queued (approximate under contention)
+     */
+    size_t size() const {
+        uint64_t tail = tail_.load(std::memory_order_acquire);
+        uint64_t head = head_.load(std::memory_order_acquire);
+        return tail > head ? static_cast<size_t>(tail - head) : 0;
+    }
+
+    /**
+     * @brief Total number of entries dropped by the drop-oldest policy
+     */
+    uint64_t dropped() const {
+        return droppedCount_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Capacity of the ring in slots
+     */
+    size_t capacity() const {
+        return slots_.size();
+    }
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> sequence{0};
+        T value{};
+    };
+
+    /**
+     * @brief Round a requested capacity up to a power of two (minimum 2)
+     */
+    static size_t roundUpPow2(size_t capacity) {
+        size_t cap = 2;
+        while (cap < capacity) {
+            cap <<= 1;
+        }
+        return cap;
+    }
+
+    bool tryPush(T value) {
+        uint64_t pos = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots_[pos & mask_];
+            uint64_t seq = slot.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.value = std::move(value);
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // Full
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool tryPop(T& out) {
+        uint64_t pos = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots_[pos & mask_];
+            uint64_t seq = slot.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    out = std::move(slot.value);
+                    slot.value = T();
+                    slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // Empty
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::vector<Slot> slots_;            ///< Ring storage with per-slot sequences
+    size_t mask_;                        ///< Capacity - 1 (power-of-two indexing)
+    std::atomic<uint64_t> head_;         ///< Next slot to pop
+    std::atomic<uint64_t> tail_;         ///< Next slot to push
+    std::atomic<uint64_t> droppedCount_; ///< Entries discarded by drop-oldest
+};
+
+} // namespace tapi
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <sqlite3.h>
+
+namespace tapi {
+namespace utils {
+
+/**
+ * @brief Process-wide pool of read-only SQLite connections for query routes
+ *
+ * The analytics and event-export routes used to run their queries on the
+ * DatabaseSink's writer connection, so a heavy dashboard query and the
+ * event writer queued on the same connection mutex despite WAL mode. The
+ * pool hands each query its own connection opened with
+ * SQLITE_OPEN_READONLY and PRAGMA query_only, so readers and the writer
+ * never contend: under WAL a read transaction sees a consistent snapshot
+ * while inserts proceed.
+ *
+ * Connections are keyed by database path and recycled through a
+ * shared_ptr lease (same pattern as the frame and channel pools); each
+ * connection keeps a cache of prepared statements for the common query
+ * shapes so repeat dashboard hits skip SQL compilation.
+ */
+class SqliteReadPool {
+public:
+    /**
+     * @brief One pooled read-only connection with its statement cache
+     */
+    class Connection {
+    public:
+        ~Connection();
+
+        /**
+         * @brief The underlying SQLite handle (read-only)
+         */
+        sqlite3* handle() const { return db_; }
+
+        /**
+         * @brief Get a cached prepared statement for the given SQL
+         *
+         * Prepares the statement on first use and caches it for the
+         * lifetime of the connection; later calls return it reset with
+         * bindings cleared. The cache owns the statement — callers must
+         * not finalize it, but should sqlite3_reset() it when done
+         * stepping so the read transaction is released promptly.
+         *
+         * @param sql Complete SQL text (also the cache key)
+         * @return sqlite3_stmt* Ready statement, or nullptr on error
+         */
+        sqlite3_stmt* prepareCached(const std::string& sql);
+
+    private:
+        friend class SqliteReadPool;
+        explicit Connection(sqlite3* db) : db_(db) {}
+
+        Connection(const Connection&) = delete;
+        Connection& operator=(const Connection&) = delete;
+
+        sqlite3* db_;                                   ///< Read-only handle
+        std::map<std::string, sqlite3_stmt*> statements_; ///< Cache by SQL text
+    };
+
+    /// Lease returning the connection to the pool when released
+    using Lease = std::shared_ptr<Connection>;
+
+    /**
+     * @brief Get the singleton instance
+     */
+    static SqliteReadPool& getInstance();
+
+    /**
+     * @brief Acquire a read-only connection to the given database file
+     *
+     * Pops an idle pooled connection or opens a fresh one. The lease
+     * returns the connection to the pool when it goes out of scope; a
+     * lease is meant for one query sequence on one thread.
+     *
+     * @param dbPath Path to the SQLite database file
+     * @return Lease Pooled connection, or nullptr if the open failed
+     */
+    Lease acquire(const std::string& dbPath);
+
+private:
+    SqliteReadPool() = default;
+
+    SqliteReadPool(const SqliteReadPool&) = delete;
+    SqliteReadPool& operator=(const SqliteReadPool&) = delete;
+
+    /// Idle connections kept per database path
+    static constexpr size_t kMaxIdlePerPath = 4;
+
+    /// Cached statements kept per connection before eviction
+    static constexpr size_t kMaxCachedStatements = 32;
+
+    std::mutex mutex_;  ///< Guards idle_
+    std::map<std::string, std::vector<std::unique_ptr<Connection>>> idle_; ///< Idle connections by path
+};
+
+} // namespace utils
+} // namespace tapi
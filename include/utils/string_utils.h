@@ -0,0 +1,122 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tapi {
+namespace utils {
+
+/**
+ * @brief Zero-allocation string helpers for hot parsing paths
+ *
+ * The per-request and per-frame paths (URL parsing, comma-separated
+ * config lookups, model output-name lists) used to spin up a
+ * stringstream and copy every token. These helpers work on
+ * std::string_view slices of the caller's buffer instead: trimming and
+ * splitting allocate nothing, and callers only pay for a std::string
+ * when they need to keep a token beyond the source's lifetime.
+ */
+
+/// Strip leading/trailing whitespace; returns a slice of the input
+inline std::string_view trimView(std::string_view s) {
+    constexpr std::string_view kWhitespace = " \t\r\n";
+    const size_t first = s.find_first_not_of(kWhitespace);
+    if (first == std::string_view::npos) {
+        return std::string_view();
+    }
+    const size_t last = s.find_last_not_of(kWhitespace);
+    return s.substr(first, last - first + 1);
+}
+
+inline bool startsWith(std::string_view s, std::string_view prefix) {
+    return s.size() >= prefix.size() && s.compare(0, prefix.size(), prefix) == 0;
+}
+
+inline bool endsWith(std::string_view s, std::string_view suffix) {
+    return s.size() >= suffix.size() &&
+           s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+/**
+ * @brief Lazily iterable split of a string_view on a single delimiter
+ *
+ * Yields string_view tokens (empty tokens included, matching getline
+ * semantics) without allocating:
+ *
+ *   for (std::string_view name : splitView(outputNames, ',')) { ... }
+ *
+ * The views point into the source buffer, which must outlive iteration.
+ */
+class SplitRange {
+public:
+    class iterator {
+    public:
+        iterator(std::string_view source, char delim, size_t pos)
+            : source_(source), delim_(delim), pos_(pos) {
+            advance();
+        }
+
+        std::string_view operator*() const { return token_; }
+
+        iterator& operator++() {
+            pos_ = next_;
+            advance();
+            return *this;
+        }
+
+        bool operator!=(const iterator& other) const { return pos_ != other.pos_; }
+        bool operator==(const iterator& other) const { return pos_ == other.pos_; }
+
+    private:
+        void advance() {
+            // pos_ one past the source size marks the end iterator
+            if (pos_ > source_.size()) {
+                return;
+            }
+            const size_t delim_pos = source_.find(delim_, pos_);
+            if (delim_pos == std::string_view::npos) {
+                token_ = source_.substr(pos_);
+                next_ = source_.size() + 1;
+            } else {
+                token_ = source_.substr(pos_, delim_pos - pos_);
+                next_ = delim_pos + 1;
+            }
+        }
+
+        std::string_view source_;
+        char delim_;
+        size_t pos_;
+        size_t next_ = 0;
+        std::string_view token_;
+    };
+
+    SplitRange(std::string_view source, char delim)
+        : source_(source), delim_(delim) {}
+
+    iterator begin() const { return iterator(source_, delim_, 0); }
+    iterator end() const { return iterator(source_, delim_, source_.size() + 1); }
+
+private:
+    std::string_view source_;
+    char delim_;
+};
+
+/// Split without allocating; tokens are slices of the caller's buffer
+inline SplitRange splitView(std::string_view s, char delim) {
+    return SplitRange(s, delim);
+}
+
+/// Convenience split for callers that need owned tokens; skips empties
+inline std::vector<std::string> split(std::string_view s, char delim) {
+    std::vector<std::string> tokens;
+    for (std::string_view token : splitView(s, delim)) {
+        if (!token.empty()) {
+            tokens.emplace_back(token);
+        }
+    }
+    return tokens;
+}
+
+} // namespace utils
+} // namespace tapi
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace tapi {
+namespace utils {
+
+/**
+ * @brief Opt-in CPU placement for pipeline and API threads
+ *
+ * On multi-socket recorders, frames decoded on one NUMA node and
+ * processed on the other pay a measurable cross-node memory tax. The
+ * placement policy here confines all pipeline work (worker pool threads,
+ * source capture threads) to one core group and leaves the API server on
+ * the rest, set via environment variables:
+ *
+ *   TAPI_PIPELINE_CORES  cpu list, e.g. "0-7,16-23" — pipeline threads
+ *   TAPI_API_CORES       cpu list — main/Crow threads (inherited by any
+ *                        thread that does not pin itself)
+ *
+ * With the pipeline group kept within a single node, first-touch
+ * allocation makes frame pool memory node-local for free: the capture
+ * thread that first writes each pooled buffer is pinned there, so the
+ * kernel places the pages on that node. No libnuma dependency needed.
+ *
+ * Everything is a no-op when the variable is unset or on non-Linux
+ * builds, so unconfigured deployments behave exactly as before.
+ */
+class ThreadAffinity {
+public:
+    /**
+     * @brief Pin the calling thread to the pipeline core group
+     *
+     * No-op if TAPI_PIPELINE_CORES is unset or unparseable.
+     *
+     * @param role Short thread role for the log line (e.g. "worker")
+     */
+    static void pinPipelineThread(const std::string& role);
+
+    /**
+     * @brief Pin the calling thread to the API core group
+     *
+     * Called once from main before the server threads are spawned;
+     * Crow workers inherit the mask. No-op if TAPI_API_CORES is unset.
+     *
+     * @param role Short thread role for the log line
+     */
+    static void pinApiThread(const std::string& role);
+
+    /**
+     * @brief Parse a kernel-style cpu list ("0-3,8,10-11") into core ids
+     *
+     * @param list Comma-separated cores and inclusive ranges
+     * @return std::vector<int> Parsed core ids (empty on parse failure)
+     */
+    static std::vector<int> parseCpuList(const std::string& list);
+
+private:
+    /**
+     * @brief Apply a core mask to the calling thread and log the outcome
+     */
+    static void pinCurrentThread(const std::vector<int>& cores, const std::string& role);
+
+    /**
+     * @brief Cached core group from an environment variable (parsed once)
+     */
+    static const std::vector<int>& coresFromEnv(const char* envVar);
+};
+
+} // namespace utils
+} // namespace tapi
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace tapi {
+
+/**
+ * @brief Shared worker pool for repeating pipeline work items
+ *
+ * Instead of one dedicated thread per camera, a fixed set of workers
+ * (defaulting to the number of hardware threads) runs repeating tasks such
+ * as per-camera frame processing. Each worker owns a double-ended ready
+ * queue and steals from its peers when idle, so camera count scales
+ * independently of thread count and a single stalled camera cannot starve
+ * the others.
+ *
+ * A task function returns the delay before its next run, which preserves
+ * the per-camera pacing previously implemented in each processing thread.
+ */
+class WorkerPool {
+public:
+    /**
+     * @brief Task function; returns the delay before the next invocation
+     */
+    using TaskFn = std::function<std::chrono::milliseconds()>;
+
+    /**
+     * @brief Construct a new Worker Pool
+     *
+     * @param numWorkers Number of worker threads (0 = hardware concurrency)
+     */
+    explicit WorkerPool(size_t numWorkers = 0);
+
+    /**
+     * @brief Destructor - stops all workers
+     */
+    ~WorkerPool();
+
+    /**
+     * @brief Start the worker threads (idempotent)
+     */
+    void start();
+
+    /**
+     * @brief Stop all workers and discard pending tasks
+     */
+    void stop();
+
+    /**
+     * @brief Register a repeating task
+     *
+     * The task is scheduled immediately and re-armed after each run using
+     * the delay it returns.
+     *
+     * @param id Unique task identifier
+     * @param fn Task function
+     * @return true if registered, false if the id already exists
+     */
+    bool addRepeatingTask(const std::string& id, TaskFn fn);
+
+    /**
+     * @brief Remove a repeating task
+     *
+     * Blocks until any in-flight execution of the task has finished, so
+     * the caller can safely tear down the state the task touches.
+     *
+     * @param id Task identifier
+     * @return true if the task existed, false otherwise
+     */
+    bool removeRepeatingTask(const std::string& id);
+
+    /**
+     * @brief Get pool statistics (workers, tasks, executed counts, steals)
+     *
+     * @return nlohmann::json Pool statistics
+     */
+    nlohmann::json getStats() const;
+
+    /**
+     * @brief Number of worker threads in the pool
+     */
+    size_t workerCount() const { return workers_.size(); }
+
+private:
+    /**
+     * @brief Internal task record shared between queues and the registry
+     */
+    struct Task {
+        std::string id;                     ///< Task identifier
+        TaskFn fn;                          ///< Work function
+        std::atomic<bool> cancelled{false}; ///< Set when the task is removed
+        std::atomic<bool> executing{false}; ///< True while a worker runs it
+    };
+    using TaskPtr = std::shared_ptr<Task>;
+
+    /**
+     * @brief Per-worker ready queue (stealable from the back)
+     */
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<TaskPtr> tasks;
+    };
+
+    /**
+     * @brief Timer entry for tasks waiting on their re-arm delay
+     */
+    struct TimedTask {
+        std::chrono::steady_clock::time_point due;
+        TaskPtr task;
+        bool operator>(const TimedTask& other) const { return due > other.due; }
+    };
+
+    void workerLoop(size_t index);
+    TaskPtr popLocal(size_t index);
+    TaskPtr steal(size_t thief);
+    void scheduleReady(const TaskPtr& task);
+    void scheduleAfter(const TaskPtr& task, std::chrono::milliseconds delay);
+
+    size_t numWorkers_;                              ///< Configured worker count
+    std::vector<std::thread> workers_;               ///< Worker threads
+    std::vector<std::unique_ptr<WorkerQueue>> queues_; ///< Per-worker ready queues
+    std::atomic<bool> running_;                      ///< Pool running flag
+    std::atomic<size_t> nextQueue_;                  ///< Round-robin placement cursor
+
+    mutable std::mutex timerMutex_;                  ///< Guards the timer heap
+    std::condition_variable timerCV_;                ///< Wakes idle workers
+    std::priority_queue<TimedTask, std::vector<TimedTask>,
+                        std::greater<TimedTask>> timerHeap_; ///< Delayed tasks
+
+    mutable std::mutex tasksMutex_;                  ///< Guards the task registry
+    std::condition_variable taskDoneCV_;             ///< Signals task completion
+    std::unordered_map<std::string, TaskPtr> tasks_; ///< Registered repeating tasks
+
+    std::atomic<uint64_t> executedCount_;            ///< Total task executions
+    std::atomic<uint64_t> stealCount_;               ///< Successful steals
+};
+
+} // namespace tapi
@@ -0,0 +1,213 @@
+#!/bin/bash
+set -e
+
+# End-to-end pipeline replay harness.
+#
+# Runs a camera from a recorded video file plus a recorded detection-response
+# trace (the detector's trace_replay config key bypasses the live inference
+# backend), so the full detector -> tracker -> zones -> sinks pipeline executes
+# deterministically. Outputs (frame/detection/event counts) and per-stage mean
+# timings are then compared against a checked-in golden file.
+#
+# Usage:
+#   VIDEO=/path/clip.mp4 TRACE=/path/clip.trace.jsonl ./scripts/pipeline_replay_test.sh
+#
+# Environment:
+#   API_URL              tAPI base URL (default http://localhost:8090)
+#   VIDEO                Input video file (required)
+#   TRACE                Detection trace JSONL (required; record one by running
+#                        the same video live with {"trace_record": "<path>"}
+#                        on the object_detection processor)
+#   GOLDEN               Golden file (default scripts/goldens/<trace>.golden.json)
+#   UPDATE_GOLDEN=1      Write the golden from this run instead of comparing
+#   RUN_SECONDS          Max seconds to wait for the trace to finish (default 60)
+#   TIMING_TOLERANCE_PCT Allowed per-stage mean latency drift (default 50)
+
+API_URL=${API_URL:-"http://localhost:8090"}
+VIDEO=${VIDEO:-""}
+TRACE=${TRACE:-""}
+RUN_SECONDS=${RUN_SECONDS:-60}
+TIMING_TOLERANCE_PCT=${TIMING_TOLERANCE_PCT:-50}
+UPDATE_GOLDEN=${UPDATE_GOLDEN:-0}
+
+SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
+GOLDEN=${GOLDEN:-"${SCRIPT_DIR}/goldens/$(basename "${TRACE}" .jsonl).golden.json"}
+
+GREEN='\033[0;32m'
+RED='\033[0;31m'
+YELLOW='\033[0;33m'
+NC='\033[0m'
+
+if [ -z "${VIDEO}" ] || [ -z "${TRACE}" ]; then
+    echo -e "${RED}VIDEO and TRACE must be set${NC}"
+    exit 1
+fi
+if [ ! -f "${VIDEO}" ] || [ ! -f "${TRACE}" ]; then
+    echo -e "${RED}VIDEO or TRACE file not found${NC}"
+    exit 1
+fi
+if ! curl -s "${API_URL}/api/v1/cameras" > /dev/null; then
+    echo -e "${RED}tAPI is not reachable at ${API_URL}${NC}"
+    exit 1
+fi
+
+function extract_id() {
+    echo "$1" | python3 -c "import sys, json; print(json.load(sys.stdin)['id'])"
+}
+
+function cleanup() {
+    if [ -n "${camera_id}" ]; then
+        curl -s -X PUT -H "Content-Type: application/json" -d '{"running": false}' \
+            "${API_URL}/api/v1/cameras/${camera_id}" > /dev/null || true
+        curl -s -X DELETE "${API_URL}/api/v1/cameras/${camera_id}" > /dev/null || true
+    fi
+}
+trap cleanup EXIT
+
+echo -e "${YELLOW}=== Setting up replay camera ===${NC}"
+
+response=$(curl -s -X POST -H "Content-Type: application/json" \
+    -d '{"name": "Pipeline Replay"}' "${API_URL}/api/v1/cameras")
+camera_id=$(extract_id "${response}")
+echo "Created replay camera: ${camera_id}"
+
+# File source; adaptive timing off so the clip plays back as fast as the
+# pipeline drains it and the run stays repeatable
+curl -s -X POST -H "Content-Type: application/json" \
+    -d "{\"type\": \"file\", \"config\": {\"url\": \"${VIDEO}\", \"width\": 640, \"height\": 480, \"fps\": 30, \"adaptive_timing\": false}}" \
+    "${API_URL}/api/v1/cameras/${camera_id}/source" > /dev/null
+
+# Detector in trace replay mode: detections come from the recorded trace,
+# never from the live backend
+response=$(curl -s -X POST -H "Content-Type: application/json" \
+    -d "{\"type\": \"object_detection\", \"config\": {\"model_id\": \"\", \"classes\": [\"person\"], \"trace_replay\": \"${TRACE}\"}}" \
+    "${API_URL}/api/v1/cameras/${camera_id}/processors")
+detector_id=$(extract_id "${response}")
+
+curl -s -X POST -H "Content-Type: application/json" \
+    -d '{"type": "object_tracking", "config": {"frame_rate": 30, "track_buffer": 30, "track_thresh": 0.5, "high_thresh": 0.6, "match_thresh": 0.8}}' \
+    "${API_URL}/api/v1/cameras/${camera_id}/processors" > /dev/null
+
+response=$(curl -s -X POST -H "Content-Type: application/json" \
+    -d '{"type": "line_zone_manager", "config": {"zones": [{"id": "midline", "start_x": 0.0, "start_y": 0.5, "end_x": 1.0, "end_y": 0.5, "min_crossing_threshold": 1, "triggering_anchors": ["BOTTOM_LEFT", "BOTTOM_RIGHT"]}]}}' \
+    "${API_URL}/api/v1/cameras/${camera_id}/processors")
+zones_id=$(extract_id "${response}")
+
+response=$(curl -s -X POST -H "Content-Type: application/json" \
+    -d '{"type": "database", "config": {"store_thumbnails": false, "retention_days": 1}}' \
+    "${API_URL}/api/v1/cameras/${camera_id}/sinks")
+db_sink_id=$(extract_id "${response}")
+
+echo -e "${YELLOW}=== Running replay ===${NC}"
+curl -s -X PUT -H "Content-Type: application/json" -d '{"running": true}' \
+    "${API_URL}/api/v1/cameras/${camera_id}" > /dev/null
+
+# Wait until the detector has consumed the whole trace (or the timeout)
+trace_frames=$(grep -c . "${TRACE}")
+deadline=$((SECONDS + RUN_SECONDS))
+while [ ${SECONDS} -lt ${deadline} ]; do
+    status=$(curl -s "${API_URL}/api/v1/cameras/${camera_id}/processors/${detector_id}")
+    consumed=$(echo "${status}" | python3 -c "import sys, json; print(json.load(sys.stdin).get('trace_frame_index', 0))" 2>/dev/null || echo 0)
+    if [ "${consumed}" -ge "${trace_frames}" ]; then
+        break
+    fi
+    sleep 1
+done
+
+curl -s -X PUT -H "Content-Type: application/json" -d '{"running": false}' \
+    "${API_URL}/api/v1/cameras/${camera_id}" > /dev/null
+
+echo -e "${YELLOW}=== Collecting outputs ===${NC}"
+detector_status=$(curl -s "${API_URL}/api/v1/cameras/${camera_id}/processors/${detector_id}")
+zones_status=$(curl -s "${API_URL}/api/v1/cameras/${camera_id}/processors/${zones_id}")
+db_status=$(curl -s "${API_URL}/api/v1/cameras/${camera_id}/sinks/${db_sink_id}")
+metrics=$(curl -s "${API_URL}/metrics")
+
+# Build the actual-results document and compare (or update the golden)
+result=$(DETECTOR="${detector_status}" ZONES="${zones_status}" DB="${db_status}" \
+    METRICS="${metrics}" CAMERA_ID="${camera_id}" GOLDEN="${GOLDEN}" \
+    UPDATE_GOLDEN="${UPDATE_GOLDEN}" TIMING_TOLERANCE_PCT="${TIMING_TOLERANCE_PCT}" \
+    python3 <<'EOF'
+import json, os, re, sys
+
+detector = json.loads(os.environ["DETECTOR"])
+zones = json.loads(os.environ["ZONES"])
+db = json.loads(os.environ["DB"])
+metrics = os.environ["METRICS"]
+camera_id = os.environ["CAMERA_ID"]
+
+actual = {
+    "counts": {
+        "processed_frames": detector.get("processed_frames", 0),
+        "detections": detector.get("detection_count", detector.get("detections", 0)),
+        "inserted_events": db.get("inserted_events", 0),
+    },
+    "zones": zones.get("zones", zones.get("counts", {})),
+    "stage_micros": {},
+}
+
+# Mean per-stage latency in microseconds from the Prometheus histograms,
+# restricted to this run's camera/components where the label allows it
+sums, counts = {}, {}
+for line in metrics.splitlines():
+    m = re.match(r'tapi_stage_latency_seconds_(sum|count)\{stage="([^"]+)",component="([^"]+)"\} ([0-9.eE+-]+)', line)
+    if not m:
+        continue
+    kind, stage, component, value = m.groups()
+    (sums if kind == "sum" else counts).setdefault(stage, 0.0)
+    if kind == "sum":
+        sums[stage] += float(value)
+    else:
+        counts[stage] += float(value)
+for stage in sums:
+    if counts.get(stage):
+        actual["stage_micros"][stage] = round(sums[stage] / counts[stage] * 1e6, 1)
+
+golden_path = os.environ["GOLDEN"]
+if os.environ["UPDATE_GOLDEN"] == "1":
+    os.makedirs(os.path.dirname(golden_path), exist_ok=True)
+    with open(golden_path + ".tmp", "w") as f:
+        json.dump(actual, f, indent=2, sort_keys=True)
+        f.write("\n")
+    os.replace(golden_path + ".tmp", golden_path)
+    print(f"UPDATED {golden_path}")
+    sys.exit(0)
+
+try:
+    with open(golden_path) as f:
+        golden = json.load(f)
+except FileNotFoundError:
+    print(f"FAIL no golden at {golden_path} (run with UPDATE_GOLDEN=1 to create it)")
+    sys.exit(1)
+
+failures = []
+
+# Counts and zone totals are deterministic under replay: exact match
+for key, expected in golden.get("counts", {}).items():
+    got = actual["counts"].get(key)
+    if got != expected:
+        failures.append(f"counts.{key}: expected {expected}, got {got}")
+if golden.get("zones") != actual["zones"]:
+    failures.append(f"zones: expected {golden.get('zones')}, got {actual['zones']}")
+
+# Timings are advisory: flag regressions beyond the tolerance band only
+tolerance = float(os.environ["TIMING_TOLERANCE_PCT"]) / 100.0
+for stage, expected in golden.get("stage_micros", {}).items():
+    got = actual["stage_micros"].get(stage)
+    if got is None:
+        failures.append(f"stage_micros.{stage}: missing from this run")
+    elif expected > 0 and got > expected * (1.0 + tolerance):
+        failures.append(f"stage_micros.{stage}: {got}us vs golden {expected}us "
+                        f"(+{(got / expected - 1) * 100:.0f}%, tolerance {tolerance * 100:.0f}%)")
+
+if failures:
+    print("FAIL")
+    for failure in failures:
+        print("  " + failure)
+    sys.exit(1)
+
+print("PASS")
+EOF
+) || { echo -e "${RED}${result}${NC}"; exit 1; }
+
+echo -e "${GREEN}${result}${NC}"
@@ -0,0 +1,130 @@
+#!/bin/bash
+set -e
+
+# Push-source ingestion test.
+#
+# Exercises both halves of the push:// path: the POST /push-frame endpoint
+# (producer side) and the camera processing loop actually consuming the
+# pushed frame out of the ring via getFrameHandle(). The consume side is
+# observed through the per-component counters on /metrics — the source's
+# tapi_component_frames_total only increments after the processing loop
+# has popped a frame — plus the ring draining back to empty in the source
+# status. A push source never opens a capture pipeline, so this catches
+# regressions where the frame intake gates on capture state.
+#
+# Usage:
+#   ./scripts/push_source_test.sh
+#
+# Environment:
+#   API_URL       tAPI base URL (default http://localhost:8090)
+#   IMAGE         Encoded image to push (default: embedded 1x1 JPEG)
+#   WAIT_SECONDS  Max seconds to wait for the frame to be consumed (default 10)
+
+API_URL=${API_URL:-"http://localhost:8090"}
+IMAGE=${IMAGE:-""}
+WAIT_SECONDS=${WAIT_SECONDS:-10}
+
+GREEN='\033[0;32m'
+RED='\033[0;31m'
+YELLOW='\033[0;33m'
+NC='\033[0m'
+
+if ! curl -s "${API_URL}/api/v1/cameras" > /dev/null; then
+    echo -e "${RED}tAPI is not reachable at ${API_URL}${NC}"
+    exit 1
+fi
+
+function extract_id() {
+    echo "$1" | python3 -c "import sys, json; print(json.load(sys.stdin)['id'])"
+}
+
+function cleanup() {
+    if [ -n "${camera_id}" ]; then
+        curl -s -X PUT -H "Content-Type: application/json" -d '{"running": false}' \
+            "${API_URL}/api/v1/cameras/${camera_id}" > /dev/null || true
+        curl -s -X DELETE "${API_URL}/api/v1/cameras/${camera_id}" > /dev/null || true
+    fi
+    rm -f /tmp/push_source_test.jpg
+}
+trap cleanup EXIT
+
+# Use the provided image, or fall back to an embedded 1x1 white JPEG so the
+# test has no file dependencies
+if [ -z "${IMAGE}" ]; then
+    IMAGE=/tmp/push_source_test.jpg
+    base64 -d > "${IMAGE}" <<'EOF'
+/9j/4AAQSkZJRgABAQEASABIAAD/2wBDAAEBAQEBAQEBAQEBAQEBAQEBAQEBAQEBAQEBAQEBAQEB
+AQEBAQEBAQEBAQEBAQEBAQEBAQEBAQEBAQEBAQEBAQH/wAALCAABAAEBAREA/8QAFAABAAAAAAAA
+AAAAAAAAAAAACf/EABQQAQAAAAAAAAAAAAAAAAAAAAD/2gAIAQEAAD8AKp//2Q==
+EOF
+fi
+if [ ! -f "${IMAGE}" ]; then
+    echo -e "${RED}Image ${IMAGE} not found${NC}"
+    exit 1
+fi
+
+echo -e "${YELLOW}=== Setting up push-source camera ===${NC}"
+
+response=$(curl -s -X POST -H "Content-Type: application/json" \
+    -d '{"name": "Push Source Test"}' "${API_URL}/api/v1/cameras")
+camera_id=$(extract_id "${response}")
+echo "Created camera: ${camera_id}"
+
+# Push source: no capture pipeline is opened; frames arrive only via the
+# push endpoint
+response=$(curl -s -X POST -H "Content-Type: application/json" \
+    -d '{"type": "push", "config": {"url": "push://test", "width": 640, "height": 480, "fps": 30}}' \
+    "${API_URL}/api/v1/cameras/${camera_id}/source")
+source_id=$(extract_id "${response}")
+echo "Added push source: ${source_id}"
+
+curl -s -X PUT -H "Content-Type: application/json" -d '{"running": true}' \
+    "${API_URL}/api/v1/cameras/${camera_id}" > /dev/null
+echo "Camera started"
+
+echo -e "${YELLOW}=== Pushing a frame ===${NC}"
+
+status_code=$(curl -s -o /dev/null -w "%{http_code}" -X POST \
+    -H "Content-Type: image/jpeg" --data-binary @"${IMAGE}" \
+    "${API_URL}/api/v1/cameras/${camera_id}/push-frame")
+if [ "${status_code}" != "200" ]; then
+    echo -e "${RED}FAIL: push-frame returned HTTP ${status_code}${NC}"
+    exit 1
+fi
+echo "Frame pushed (HTTP 200)"
+
+echo -e "${YELLOW}=== Waiting for the processing loop to consume it ===${NC}"
+
+# The source's tapi_component_frames_total counter is bumped only after
+# getFrameHandle() hands a frame to the processing loop, so it observing
+# the push proves the consume side — a 200 from the endpoint alone does not
+consumed=0
+for _ in $(seq 1 $((WAIT_SECONDS * 2))); do
+    frames=$(curl -s "${API_URL}/metrics" | \
+        grep "tapi_component_frames_total{camera=\"${camera_id}\",component=\"${source_id}\"}" | \
+        awk '{print $2}')
+    if [ -n "${frames}" ] && [ "${frames}" -ge 1 ] 2>/dev/null; then
+        consumed=1
+        break
+    fi
+    sleep 0.5
+done
+
+if [ "${consumed}" != "1" ]; then
+    echo -e "${RED}FAIL: pushed frame was never consumed by the processing loop${NC}"
+    curl -s "${API_URL}/api/v1/cameras/${camera_id}/source" || true
+    echo
+    exit 1
+fi
+echo "Source consumed-frame counter: ${frames}"
+
+# The ring should drain once consumed; frames_processed counts the push
+queued=$(curl -s "${API_URL}/api/v1/cameras/${camera_id}/source" | \
+    python3 -c "import sys, json; s = json.load(sys.stdin); print(s.get('status', s).get('queued_frames', -1))")
+if [ "${queued}" != "0" ]; then
+    echo -e "${RED}FAIL: frame ring did not drain (queued_frames=${queued})${NC}"
+    exit 1
+fi
+echo "Frame ring drained (queued_frames=0)"
+
+echo -e "${GREEN}PASS: pushed frame was decoded, queued and consumed${NC}"
@@ -5,15 +5,27 @@
 #include <uuid/uuid.h>
 #include "logger.h"
 #include "components/processor/object_detector_processor.h"
+#include "components/source/gstreamer_source.h"
 #include "components/sink/file_sink.h"
 #include "components/sink/database_sink.h"
 #include <fstream>
 #include "config_manager.h"
 #include <filesystem>
 #include "global_config.h"
+#include "onvif_discovery.h"
+#include "telemetry_broadcaster.h"
+#include "utils/latency_metrics.h"
+#include "utils/string_utils.h"
+#include "utils/json_writer.h"
+#include "utils/frame_memory_budget.h"
+#include "utils/model_warmup.h"
+#include "utils/quality_governor.h"
+#include "utils/cpu_features.h"
 #include <chrono>
 #include <iomanip>
 #include <sstream>
+#include <algorithm>
+#include <map>
 
 // For chrono literals (2s syntax)
 using namespace std::chrono_literals;
@@ -114,6 +126,39 @@ std::string getClientIP(const crow::request& req) {
     return "unknown";
 }
 
+// Collapse per-resource path segments (uuids, numeric ids) so request
+// metrics label by route shape instead of growing one label set per
+// camera or task id
+std::string normalizeRoutePath(const std::string& url) {
+    std::string path = url.substr(0, url.find('?'));
+
+    std::string normalized;
+    size_t pos = 0;
+    while (pos < path.size()) {
+        size_t next = path.find('/', pos);
+        if (next == std::string::npos) {
+            next = path.size();
+        }
+        std::string segment = path.substr(pos, next - pos);
+
+        if (!segment.empty()) {
+            bool allDigits = segment.find_first_not_of("0123456789") == std::string::npos;
+            bool uuidLike = segment.size() >= 8 &&
+                            segment.find_first_not_of("0123456789abcdefABCDEF-") == std::string::npos;
+            if (allDigits || uuidLike) {
+                segment = ":id";
+            }
+        }
+
+        normalized += segment;
+        if (next < path.size()) {
+            normalized += "/";
+        }
+        pos = next + 1;
+    }
+    return normalized;
+}
+
 
 
 // Implementation of ApiLoggingMiddleware methods
@@ -165,13 +210,23 @@ void ApiLoggingMiddleware::before_handle(crow::request& req, crow::response& res
 }
 
 void ApiLoggingMiddleware::after_handle(crow::request& req, crow::response& res, context& ctx) {
-    if (!g_apiLoggingConfig.enabled) return;
-    
     auto end_time = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
-        end_time - ctx.start_time);
-    
-    long duration_ms = duration.count();
+    auto duration_us = std::chrono::duration_cast<std::chrono::microseconds>(
+        end_time - ctx.start_time).count();
+
+    // Record into the same registry as the pipeline stage histograms so
+    // API latency and camera load land on one scrape. Always recorded,
+    // independent of whether request logging is enabled.
+    const std::string route = normalizeRoutePath(ctx.url);
+    LatencyMetrics::getInstance().record("http_request", ctx.method + " " + route, duration_us);
+    LatencyMetrics::getInstance().incrementCounter(
+        "tapi_http_requests_total",
+        "method=\"" + ctx.method + "\",path=\"" + route + "\",code=\"" +
+            std::to_string(res.code) + "\"");
+
+    if (!g_apiLoggingConfig.enabled) return;
+
+    long duration_ms = static_cast<long>(duration_us / 1000);
     bool is_slow = duration_ms >= g_apiLoggingConfig.slow_request_threshold_ms;
     bool is_timeout = duration_ms >= g_apiLoggingConfig.timeout_threshold_ms;
     
@@ -255,6 +310,26 @@ crow::response createJsonResponse(const nlohmann::json& data, int status_code =
     return res;
 }
 
+// Run a handler body on the background worker pool and complete the Crow
+// response when it finishes. Crow keeps the response alive until end() is
+// called, so the I/O thread returns to routing immediately and a handler
+// blocked on a pipeline mutex or a frame grab cannot exhaust the pool
+// configured by configureServerConcurrency. The work function must not
+// reference the crow::request — handlers copy what they need out of it
+// before dispatching.
+static void respondAsync(crow::response& res, std::function<crow::response()> work) {
+    BackgroundTaskManager::getInstance().runDetached([&res, work = std::move(work)]() {
+        crow::response out;
+        try {
+            out = work();
+        } catch (const std::exception& e) {
+            out = crow::response(500, std::string("Internal error: ") + e.what());
+        }
+        res = std::move(out);
+        res.end();
+    });
+}
+
 // Helper function to convert LogLevel to string
 std::string levelToString(LogLevel level) {
     switch (level) {
@@ -270,7 +345,12 @@ std::string levelToString(LogLevel level) {
 }
 
 Api::Api(int port)
-    : port_(port) {
+    : port_(port),
+      licenseSnapshotValid_(false),
+      licenseSnapshotReady_(false),
+      licenseSnapshotExpiry_(0),
+      licenseRefreshInFlight_(false),
+      configFlushScheduled_(false) {
     // Configure port from provided value or GlobalConfig
     if (port > 0) {
         app_.port(port);
@@ -363,6 +443,9 @@ bool Api::initialize(const std::string& licenseKey) {
     
     // Always set up API routes, even if license is invalid
     setupRoutes();
+
+    // Publish the initial license snapshot for checkLicense()
+    refreshLicenseSnapshot();
     
     // After initialization with a valid license, enforce license restrictions on all cameras
     if (licenseValid) {
@@ -399,207 +482,108 @@ bool Api::initializeConfigDB() {
     return success;
 }
 
+// Per-camera budget for restoration at startup; covers RTSP connect and
+// GStreamer preroll. The task manager cancels a restore at its next
+// progress checkpoint past this deadline so one dead camera cannot hold
+// up fleet recovery.
+static constexpr int CAMERA_RESTORE_TIMEOUT_SECS = 60;
+
 bool Api::loadSavedConfig() {
     if (!ConfigManager::getInstance().isReady()) {
         LOG_ERROR("API", "Configuration database is not initialized");
         return false;
     }
-    
+
     try {
         LOG_INFO("API", "Loading saved configuration from database");
-        
+
         // Get all saved camera configurations
         auto allCameras = ConfigManager::getInstance().getAllCameraConfigs();
         if (allCameras.empty()) {
             LOG_INFO("API", "No saved camera configurations found");
             return true;
         }
-        
-        // Load each camera configuration
+
+        // Preload and warm every referenced inference model before any
+        // pipeline starts, so restored cameras never pay the server's
+        // first-inference model load / CUDA graph capture cost and time
+        // out. Warmup failures are logged and skipped — affected cameras
+        // fall back to their existing retry logic.
+        auto modelIds = ModelWarmup::collectModelIds(allCameras);
+        if (!modelIds.empty()) {
+            std::string serverUrl = GlobalConfig::getInstance().getAiServerUrl();
+            LOG_INFO("API", "Warming " + std::to_string(modelIds.size()) +
+                     " inference model(s) before camera restore");
+            ModelWarmup::warmupModels(serverUrl, modelIds);
+        }
+
+        // Revalidate the whole fleet's entitlements from one snapshot
+        // before the restore tasks fan out, so license checking is a
+        // single pass instead of one round-trip per camera start.
+        // Cameras without an entry get their trial license auto-created
+        // in createCamera as before.
+        std::vector<std::string> restoreCameraIds;
+        restoreCameraIds.reserve(allCameras.size());
         for (auto it = allCameras.begin(); it != allCameras.end(); ++it) {
-            try {
-                std::string cameraId = it.key();
-                nlohmann::json cameraConfig = it.value();
-                
-                LOG_INFO("API", "Loading camera configuration for ID: " + cameraId);
-                
-                // Create or get the camera
-                std::shared_ptr<Camera> camera;
-                if (CameraManager::getInstance().cameraExists(cameraId)) {
-                    camera = CameraManager::getInstance().getCamera(cameraId);
-                } else {
-                    // Get camera name, handle type errors
-                    std::string name = cameraId;
-                    if (cameraConfig.contains("name") && cameraConfig["name"].is_string()) {
-                        name = cameraConfig["name"].get<std::string>();
-                    } else if (cameraConfig.contains("name")) {
-                        LOG_WARN("API", "Invalid name format for camera ID: " + cameraId + ", using ID as name");
-                    }
-                    
-                    camera = CameraManager::getInstance().createCamera(cameraId, name);
-                }
-                
-                if (!camera) {
-                    LOG_ERROR("API", "Failed to create camera with ID: " + cameraId);
-                    continue;
-                }
-                
-                // Set camera properties
-                if (cameraConfig.contains("name") && cameraConfig["name"].is_string()) {
-                    camera->setName(cameraConfig["name"]);
-                }
-                
-                // Load source component if present
-                if (cameraConfig.contains("source") && !cameraConfig["source"].is_null()) {
-                    try {
-                        auto sourceConfig = cameraConfig["source"];
-                        
-                        // Check that required fields exist and have the correct type
-                        if (!sourceConfig.contains("type") || !sourceConfig["type"].is_string()) {
-                            LOG_ERROR("API", "Missing or invalid type field in source component for camera " + cameraId);
-                            continue;
-                        }
-                        
-                        if (!sourceConfig.contains("id") || !sourceConfig["id"].is_string()) {
-                            LOG_ERROR("API", "Missing or invalid id field in source component for camera " + cameraId);
-                            continue;
-                        }
-                        
-                        std::string type = sourceConfig["type"];
-                        std::string id = sourceConfig["id"];
-                        
-                        // Extract config, defaulting to empty if missing or wrong type
-                        nlohmann::json config = nlohmann::json::object();
-                        if (sourceConfig.contains("config") && sourceConfig["config"].is_object()) {
-                            config = sourceConfig["config"];
-                        }
-                        
-                        // Remove any existing source component
-                        camera->setSourceComponent(nullptr);
-                        
-                        auto source = ComponentFactory::getInstance().createSourceComponent(
-                            id, camera.get(), type, config);
-                            
-                        if (source) {
-                            camera->setSourceComponent(source);
-                        }
-                    } catch (const std::exception& e) {
-                        LOG_ERROR("API", "Error loading source component for camera " + cameraId + ": " + e.what());
-                    }
-                }
-                
-                // Load processor components
-                if (cameraConfig.contains("processors") && cameraConfig["processors"].is_array()) {
-                    // Clear existing processors
-                    for (const auto& proc : camera->getProcessorComponents()) {
-                        camera->removeProcessorComponent(proc->getId());
-                    }
-                    
-                    // Add new processors from config
-                    for (const auto& procConfig : cameraConfig["processors"]) {
-                        try {
-                            // Check that required fields exist and have the correct type
-                            if (!procConfig.contains("type") || !procConfig["type"].is_string()) {
-                                LOG_ERROR("API", "Missing or invalid type field in processor component for camera " + cameraId);
-                                continue;
-                            }
-                            
-                            if (!procConfig.contains("id") || !procConfig["id"].is_string()) {
-                                LOG_ERROR("API", "Missing or invalid id field in processor component for camera " + cameraId);
-                                continue;
-                            }
-                            
-                            std::string type = procConfig["type"];
-                            std::string id = procConfig["id"];
-                            
-                            // Extract config, defaulting to empty if missing or wrong type
-                            nlohmann::json config = nlohmann::json::object();
-                            if (procConfig.contains("config") && procConfig["config"].is_object()) {
-                                config = procConfig["config"];
-                            }
-                            
-                            // Explicitly set shared memory from global setting
-                            bool useSharedMemory = GlobalConfig::getInstance().getUseSharedMemory();
-                            config["use_shared_memory"] = useSharedMemory;
-                            LOG_INFO("API", "Explicitly setting shared memory=" + 
-                                     std::string(useSharedMemory ? "true" : "false") + 
-                                     " for processor " + id);
-                            
-                            auto processor = ComponentFactory::getInstance().createProcessorComponent(
-                                id, camera.get(), type, config);
-                                
-                            if (processor) {
-                                camera->addProcessorComponent(processor);
-                            }
-                        } catch (const std::exception& e) {
-                            LOG_ERROR("API", "Error loading processor component for camera " + cameraId + ": " + e.what());
-                        }
-                    }
-                }
-                
-                // Load sink components
-                if (cameraConfig.contains("sinks") && cameraConfig["sinks"].is_array()) {
-                    // Clear existing sinks
-                    for (const auto& sink : camera->getSinkComponents()) {
-                        camera->removeSinkComponent(sink->getId());
-                    }
-                    
-                    // Add new sinks from config
-                    for (const auto& sinkConfig : cameraConfig["sinks"]) {
-                        try {
-                            // Check that required fields exist and have the correct type
-                            if (!sinkConfig.contains("type") || !sinkConfig["type"].is_string()) {
-                                LOG_ERROR("API", "Missing or invalid type field in sink component for camera " + cameraId);
-                                continue;
-                            }
-                            
-                            if (!sinkConfig.contains("id") || !sinkConfig["id"].is_string()) {
-                                LOG_ERROR("API", "Missing or invalid id field in sink component for camera " + cameraId);
-                                continue;
-                            }
-                            
-                            std::string type = sinkConfig["type"];
-                            std::string id = sinkConfig["id"];
-                            
-                            // Extract config, defaulting to empty if missing or wrong type
-                            nlohmann::json config = nlohmann::json::object();
-                            if (sinkConfig.contains("config") && sinkConfig["config"].is_object()) {
-                                config = sinkConfig["config"];
-                            }
-                            
-                            auto sink = ComponentFactory::getInstance().createSinkComponent(
-                                id, camera.get(), type, config);
-                                
-                            if (sink) {
-                                camera->addSinkComponent(sink);
-                            }
-                        } catch (const std::exception& e) {
-                            LOG_ERROR("API", "Error loading sink component for camera " + cameraId + ": " + e.what());
-                        }
-                    }
-                }
-                
-                // Start camera if it was running
-                if (cameraConfig.contains("running") && cameraConfig["running"].get<bool>()) {
-                    camera->start();
+            restoreCameraIds.push_back(it.key());
+        }
+        auto licenseResults = CameraManager::getInstance().validateCameraLicenses(restoreCameraIds);
+        for (const auto& [restoreId, valid] : licenseResults) {
+            if (!valid) {
+                LOG_WARN("API", "Camera " + restoreId +
+                         " has no valid license; restore will attempt a trial license");
+            }
+        }
+
+        // Fan restoration out across the bulk worker pool: each camera
+        // restores as its own background task (visible and cancellable
+        // through the task routes), so slow RTSP connects overlap instead
+        // of serializing a fleet restart
+        std::vector<std::string> restoreTaskIds;
+        restoreTaskIds.reserve(allCameras.size());
+
+        for (auto it = allCameras.begin(); it != allCameras.end(); ++it) {
+            std::string cameraId = it.key();
+            nlohmann::json cameraConfig = it.value();
+
+            std::string taskId = BackgroundTaskManager::getInstance().submitTask(
+                "camera_restore", cameraId,
+                [this, cameraId, cameraConfig](std::function<void(double, std::string)> progressCallback) -> bool {
+                    return restoreCameraFromConfig(cameraId, cameraConfig, progressCallback);
+                },
+                BackgroundTaskManager::TaskPriority::BULK,
+                CAMERA_RESTORE_TIMEOUT_SECS);
+            restoreTaskIds.push_back(taskId);
+        }
+
+        // Wait for the fleet to settle before enforcing the license, so
+        // enforcement sees every restored camera
+        auto& taskManager = BackgroundTaskManager::getInstance();
+        size_t restored = 0;
+        for (;;) {
+            restored = 0;
+            for (const auto& taskId : restoreTaskIds) {
+                auto status = taskManager.getTaskStatus(taskId);
+                if (status.state != BackgroundTaskManager::TaskStatus::State::PENDING &&
+                    status.state != BackgroundTaskManager::TaskStatus::State::RUNNING) {
+                    restored++;
                 }
-                
-                LOG_INFO("API", "Successfully loaded configuration for camera: " + cameraId);
-            } catch (const std::exception& e) {
-                LOG_ERROR("API", "Error processing camera " + it.key() + ": " + e.what());
-                // Continue with next camera, don't abort entire loading process
             }
+            if (restored == restoreTaskIds.size()) {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
         }
-        
-        LOG_INFO("API", "Successfully loaded all camera configurations");
-        
+
+        LOG_INFO("API", "Finished restoring " + std::to_string(restoreTaskIds.size()) + " camera configuration(s)");
+
         // After loading all cameras, enforce license restrictions
         int stoppedCameras = enforceLicenseRestrictions();
         if (stoppedCameras > 0) {
-            LOG_WARN("API", "License enforcement stopped " + std::to_string(stoppedCameras) + 
+            LOG_WARN("API", "License enforcement stopped " + std::to_string(stoppedCameras) +
                      " camera(s) that were using features not allowed by the current license");
         }
-        
+
         return true;
     } catch (const std::exception& e) {
         LOG_ERROR("API", "Failed to load saved configuration: " + std::string(e.what()));
@@ -607,6 +591,181 @@ bool Api::loadSavedConfig() {
     }
 }
 
+bool Api::restoreCameraFromConfig(const std::string& cameraId, const nlohmann::json& cameraConfig,
+                                  const std::function<void(double, std::string)>& progressCallback) {
+    LOG_INFO("API", "Loading camera configuration for ID: " + cameraId);
+    progressCallback(0.0, "Restoring camera configuration");
+
+    // Create or get the camera
+    std::shared_ptr<Camera> camera;
+    if (CameraManager::getInstance().cameraExists(cameraId)) {
+        camera = CameraManager::getInstance().getCamera(cameraId);
+    } else {
+        // Get camera name, handle type errors
+        std::string name = cameraId;
+        if (cameraConfig.contains("name") && cameraConfig["name"].is_string()) {
+            name = cameraConfig["name"].get<std::string>();
+        } else if (cameraConfig.contains("name")) {
+            LOG_WARN("API", "Invalid name format for camera ID: " + cameraId + ", using ID as name");
+        }
+
+        camera = CameraManager::getInstance().createCamera(cameraId, name);
+    }
+
+    if (!camera) {
+        LOG_ERROR("API", "Failed to create camera with ID: " + cameraId);
+        return false;
+    }
+
+    // Set camera properties
+    if (cameraConfig.contains("name") && cameraConfig["name"].is_string()) {
+        camera->setName(cameraConfig["name"]);
+    }
+
+    // Load source component if present
+    if (cameraConfig.contains("source") && !cameraConfig["source"].is_null()) {
+        try {
+            auto sourceConfig = cameraConfig["source"];
+
+            // Check that required fields exist and have the correct type
+            if (!sourceConfig.contains("type") || !sourceConfig["type"].is_string()) {
+                LOG_ERROR("API", "Missing or invalid type field in source component for camera " + cameraId);
+                return false;
+            }
+
+            if (!sourceConfig.contains("id") || !sourceConfig["id"].is_string()) {
+                LOG_ERROR("API", "Missing or invalid id field in source component for camera " + cameraId);
+                return false;
+            }
+
+            std::string type = sourceConfig["type"];
+            std::string id = sourceConfig["id"];
+
+            // Extract config, defaulting to empty if missing or wrong type
+            nlohmann::json config = nlohmann::json::object();
+            if (sourceConfig.contains("config") && sourceConfig["config"].is_object()) {
+                config = sourceConfig["config"];
+            }
+
+            // Remove any existing source component
+            camera->setSourceComponent(nullptr);
+
+            auto source = ComponentFactory::getInstance().createSourceComponent(
+                id, camera.get(), type, config);
+
+            if (source) {
+                camera->setSourceComponent(source);
+            }
+        } catch (const std::exception& e) {
+            LOG_ERROR("API", "Error loading source component for camera " + cameraId + ": " + e.what());
+        }
+    }
+
+    // Load processor components
+    if (cameraConfig.contains("processors") && cameraConfig["processors"].is_array()) {
+        // Clear existing processors
+        for (const auto& proc : camera->getProcessorComponents()) {
+            camera->removeProcessorComponent(proc->getId());
+        }
+
+        // Add new processors from config
+        for (const auto& procConfig : cameraConfig["processors"]) {
+            try {
+                // Check that required fields exist and have the correct type
+                if (!procConfig.contains("type") || !procConfig["type"].is_string()) {
+                    LOG_ERROR("API", "Missing or invalid type field in processor component for camera " + cameraId);
+                    continue;
+                }
+
+                if (!procConfig.contains("id") || !procConfig["id"].is_string()) {
+                    LOG_ERROR("API", "Missing or invalid id field in processor component for camera " + cameraId);
+                    continue;
+                }
+
+                std::string type = procConfig["type"];
+                std::string id = procConfig["id"];
+
+                // Extract config, defaulting to empty if missing or wrong type
+                nlohmann::json config = nlohmann::json::object();
+                if (procConfig.contains("config") && procConfig["config"].is_object()) {
+                    config = procConfig["config"];
+                }
+
+                // Explicitly set shared memory from global setting
+                bool useSharedMemory = GlobalConfig::getInstance().getUseSharedMemory();
+                config["use_shared_memory"] = useSharedMemory;
+                LOG_INFO("API", "Explicitly setting shared memory=" +
+                         std::string(useSharedMemory ? "true" : "false") +
+                         " for processor " + id);
+
+                auto processor = ComponentFactory::getInstance().createProcessorComponent(
+                    id, camera.get(), type, config);
+
+                if (processor) {
+                    camera->addProcessorComponent(processor);
+                }
+            } catch (const std::exception& e) {
+                LOG_ERROR("API", "Error loading processor component for camera " + cameraId + ": " + e.what());
+            }
+        }
+    }
+
+    // Load sink components
+    if (cameraConfig.contains("sinks") && cameraConfig["sinks"].is_array()) {
+        // Clear existing sinks
+        for (const auto& sink : camera->getSinkComponents()) {
+            camera->removeSinkComponent(sink->getId());
+        }
+
+        // Add new sinks from config
+        for (const auto& sinkConfig : cameraConfig["sinks"]) {
+            try {
+                // Check that required fields exist and have the correct type
+                if (!sinkConfig.contains("type") || !sinkConfig["type"].is_string()) {
+                    LOG_ERROR("API", "Missing or invalid type field in sink component for camera " + cameraId);
+                    continue;
+                }
+
+                if (!sinkConfig.contains("id") || !sinkConfig["id"].is_string()) {
+                    LOG_ERROR("API", "Missing or invalid id field in sink component for camera " + cameraId);
+                    continue;
+                }
+
+                std::string type = sinkConfig["type"];
+                std::string id = sinkConfig["id"];
+
+                // Extract config, defaulting to empty if missing or wrong type
+                nlohmann::json config = nlohmann::json::object();
+                if (sinkConfig.contains("config") && sinkConfig["config"].is_object()) {
+                    config = sinkConfig["config"];
+                }
+
+                auto sink = ComponentFactory::getInstance().createSinkComponent(
+                    id, camera.get(), type, config);
+
+                if (sink) {
+                    camera->addSinkComponent(sink);
+                }
+            } catch (const std::exception& e) {
+                LOG_ERROR("API", "Error loading sink component for camera " + cameraId + ": " + e.what());
+            }
+        }
+    }
+
+    // Components are in place; the remaining time goes to stream startup.
+    // This is also the last cancellation checkpoint before the blocking
+    // start() call.
+    progressCallback(50.0, "Components restored");
+
+    // Start camera if it was running
+    if (cameraConfig.contains("running") && cameraConfig["running"].get<bool>()) {
+        camera->start();
+    }
+
+    LOG_INFO("API", "Successfully loaded configuration for camera: " + cameraId);
+    return true;
+}
+
 void Api::setupCORS() {
     auto& cors = app_.get_middleware<crow::CORSHandler>();
     cors.global()
@@ -700,81 +859,226 @@ void Api::setupRoutes() {
     setupBackgroundTaskRoutes();
     setupConfigRoutes();
     setupApiLoggingRoutes();
-    
+    setupWebSocketRoutes();
+    setupDiscoveryRoutes();
+
     LOG_INFO("API", "Finished setting up all API routes");
     std::cout << "All API routes set up successfully" << std::endl;
 }
 
-void Api::setupFrameRoutes() {
-    // Get latest frame from a camera as JPEG
-    CROW_ROUTE(app_, "/api/v1/cameras/<string>/frame")
-        .methods("GET"_method)
-    ([this](const crow::request& req, const std::string& cameraId) {
+void Api::setupWebSocketRoutes() {
+    // Pushed telemetry events over WebSocket
+    //
+    // Subscribers connect and receive batches as the pipeline produces
+    // events, instead of polling the database routes. Clients may send
+    // {"camera_id": "<id>"} to narrow the subscription to one camera, or
+    // {"camera_id": ""} to subscribe to all cameras again. JSON batches
+    // (the default) look like {"type": "telemetry", "events": [...],
+    // "dropped": N}; sending {"format": "binary"} switches the connection
+    // to protobuf TelemetryEventBatch frames (protobuf/telemetry.proto),
+    // and {"format": "json"} switches it back.
+    CROW_WEBSOCKET_ROUTE(app_, "/api/v1/ws/telemetry")
+        .onopen([](crow::websocket::connection& conn) {
+            TelemetryBroadcaster::getInstance().addSubscriber(
+                &conn, "",
+                [&conn](const std::string& message, bool binary) {
+                    if (binary) {
+                        conn.send_binary(message);
+                    } else {
+                        conn.send_text(message);
+                    }
+                });
+        })
+        .onmessage([](crow::websocket::connection& conn, const std::string& data, bool isBinary) {
+            if (isBinary) {
+                return;
+            }
+            try {
+                auto body = nlohmann::json::parse(data);
+                if (body.contains("camera_id") && body["camera_id"].is_string()) {
+                    TelemetryBroadcaster::getInstance().setSubscriberFilter(
+                        &conn, body["camera_id"].get<std::string>());
+                }
+                if (body.contains("format") && body["format"].is_string()) {
+                    TelemetryBroadcaster::getInstance().setSubscriberFormat(
+                        &conn, body["format"].get<std::string>() == "binary");
+                }
+            } catch (const std::exception& e) {
+                LOG_WARN("API", "Ignoring malformed telemetry subscription message: " + std::string(e.what()));
+            }
+        })
+        .onclose([](crow::websocket::connection& conn, const std::string& reason, uint16_t code) {
+            (void)reason;
+            (void)code;
+            TelemetryBroadcaster::getInstance().removeSubscriber(&conn);
+        });
+}
+
+// Incremental results of ONVIF discovery scans, keyed by background task
+// ID. The scan appends cameras here as they respond, so the status route
+// can return partial results while the scan is still running.
+namespace {
+
+struct DiscoveryScan {
+    std::mutex mutex;
+    std::vector<OnvifCamera> cameras;
+};
+
+std::mutex discoveryScansMutex;
+std::map<std::string, std::shared_ptr<DiscoveryScan>> discoveryScans;
+
+// Keep at most this many finished scans around for late status polls
+const size_t MAX_RETAINED_SCANS = 16;
+
+} // namespace
+
+void Api::setupDiscoveryRoutes() {
+    // Start an ONVIF discovery scan as a background task
+    CROW_ROUTE(app_, "/api/v1/discovery/onvif")
+        .methods("POST"_method)
+    ([this](const crow::request& req) {
         crow::response res;
         if (!checkLicense(req, res)) {
             return res;
         }
-        
-        auto camera = CameraManager::getInstance().getCamera(cameraId);
-        if (!camera) {
-            return crow::response(404, "Camera not found");
-        }
-        
-        if (!camera->isRunning()) {
-            return crow::response(400, "Camera is not running");
-        }
-        
-        // No need to explicitly call processFrame() anymore as it happens automatically
-        // when the camera is running
-        
-        // Get the JPEG data
-        int quality = 90; // Default quality
-        
-        // Check if quality parameter is provided
-        auto qualityParam = req.url_params.get("quality");
-        if (qualityParam) {
+
+        int timeoutSeconds = 10;
+        std::string networkInterface;
+        if (!req.body.empty()) {
             try {
-                quality = std::stoi(qualityParam);
-                quality = std::max(1, std::min(100, quality)); // Clamp between 1 and 100
-            } catch (...) {
-                // Ignore parsing errors, use default quality
+                auto body = nlohmann::json::parse(req.body);
+                if (body.contains("timeout") && body["timeout"].is_number_integer()) {
+                    timeoutSeconds = std::max(1, std::min(120, body["timeout"].get<int>()));
+                }
+                if (body.contains("interface") && body["interface"].is_string()) {
+                    networkInterface = body["interface"].get<std::string>();
+                }
+            } catch (const std::exception& e) {
+                return crow::response(400, std::string("Invalid JSON: ") + e.what());
             }
         }
-        
-        auto jpegData = camera->getLatestFrameJpeg(quality);
-        
-        if (jpegData.empty()) {
-            return crow::response(404, "No frame available");
-        }
-        
-        // Create response with JPEG data
-        crow::response resp;
-        resp.set_header("Content-Type", "image/jpeg");
-        resp.body = std::string(jpegData.begin(), jpegData.end());
-        return resp;
-    });
-    
-    // Get latest raw (unannotated) frame from a camera as JPEG
-    CROW_ROUTE(app_, "/api/v1/cameras/<string>/raw-frame")
+
+        auto scan = std::make_shared<DiscoveryScan>();
+
+        std::string taskId = BackgroundTaskManager::getInstance().submitTask(
+            "onvif_discovery",
+            networkInterface.empty() ? "all_interfaces" : networkInterface,
+            [scan, timeoutSeconds, networkInterface](std::function<void(double, std::string)> progressCallback) -> bool {
+                progressCallback(0.0, "Starting ONVIF discovery scan");
+
+                OnvifDiscovery discovery;
+                discovery.discoverCameras(timeoutSeconds, networkInterface,
+                    [&scan, &progressCallback](const OnvifCamera& camera) {
+                        size_t total;
+                        {
+                            std::lock_guard<std::mutex> lock(scan->mutex);
+                            scan->cameras.push_back(camera);
+                            total = scan->cameras.size();
+                        }
+                        // Also the scan's cancellation checkpoint
+                        progressCallback(50.0, "Found " + std::to_string(total) + " camera(s)");
+                    });
+
+                size_t total;
+                {
+                    std::lock_guard<std::mutex> lock(scan->mutex);
+                    total = scan->cameras.size();
+                }
+                progressCallback(100.0, "Discovery completed: " + std::to_string(total) + " camera(s)");
+                return true;
+            });
+
+        {
+            std::lock_guard<std::mutex> lock(discoveryScansMutex);
+
+            // Evict the oldest finished scans so late pollers of recent
+            // scans still get results without the map growing unbounded
+            while (discoveryScans.size() >= MAX_RETAINED_SCANS) {
+                auto oldest = discoveryScans.begin();
+                bool evicted = false;
+                for (auto it = discoveryScans.begin(); it != discoveryScans.end(); ++it) {
+                    auto status = BackgroundTaskManager::getInstance().getTaskStatus(it->first);
+                    if (status.state != BackgroundTaskManager::TaskStatus::State::PENDING &&
+                        status.state != BackgroundTaskManager::TaskStatus::State::RUNNING) {
+                        discoveryScans.erase(it);
+                        evicted = true;
+                        break;
+                    }
+                }
+                if (!evicted) {
+                    discoveryScans.erase(oldest);
+                }
+            }
+
+            discoveryScans[taskId] = scan;
+        }
+
+        nlohmann::json response;
+        response["success"] = true;
+        response["message"] = "ONVIF discovery started";
+        response["task_id"] = taskId;
+
+        return createJsonResponse(response, 202);
+    });
+
+    // Get the status and incremental results of a discovery scan
+    CROW_ROUTE(app_, "/api/v1/discovery/onvif/<string>")
         .methods("GET"_method)
-    ([this](const crow::request& req, const std::string& cameraId) {
+    ([this](const crow::request& req, const std::string& taskId) {
         crow::response res;
         if (!checkLicense(req, res)) {
             return res;
         }
-        
-        auto camera = CameraManager::getInstance().getCamera(cameraId);
-        if (!camera) {
-            return crow::response(404, "Camera not found");
+
+        std::shared_ptr<DiscoveryScan> scan;
+        {
+            std::lock_guard<std::mutex> lock(discoveryScansMutex);
+            auto it = discoveryScans.find(taskId);
+            if (it != discoveryScans.end()) {
+                scan = it->second;
+            }
         }
-        
-        if (!camera->isRunning()) {
-            return crow::response(400, "Camera is not running");
+
+        if (!scan) {
+            return crow::response(404, "Discovery scan not found");
         }
-        
+
+        auto status = BackgroundTaskManager::getInstance().getTaskStatus(taskId);
+
+        nlohmann::json response;
+        switch (status.state) {
+            case BackgroundTaskManager::TaskStatus::State::PENDING: response["state"] = "pending"; break;
+            case BackgroundTaskManager::TaskStatus::State::RUNNING: response["state"] = "running"; break;
+            case BackgroundTaskManager::TaskStatus::State::COMPLETED: response["state"] = "completed"; break;
+            case BackgroundTaskManager::TaskStatus::State::FAILED: response["state"] = "failed"; break;
+            case BackgroundTaskManager::TaskStatus::State::CANCELLED: response["state"] = "cancelled"; break;
+        }
+        response["message"] = status.message;
+
+        OnvifDiscovery discovery;
+        {
+            std::lock_guard<std::mutex> lock(scan->mutex);
+            response["cameras"] = discovery.camerasToJson(scan->cameras);
+            response["camera_count"] = scan->cameras.size();
+        }
+
+        return createJsonResponse(response);
+    });
+}
+
+void Api::setupFrameRoutes() {
+    // Get latest frame from a camera as JPEG
+    CROW_ROUTE(app_, "/api/v1/cameras/<string>/frame")
+        .methods("GET"_method)
+    ([this](const crow::request& req, crow::response& res, const std::string& cameraId) {
+        if (!checkLicense(req, res)) {
+            res.end();
+            return;
+        }
+
         // Get the JPEG data
         int quality = 90; // Default quality
-        
+
         // Check if quality parameter is provided
         auto qualityParam = req.url_params.get("quality");
         if (qualityParam) {
@@ -785,20 +1089,201 @@ void Api::setupFrameRoutes() {
                 // Ignore parsing errors, use default quality
             }
         }
-        
-        auto jpegData = camera->getRawFrameJpeg(quality);
-        
-        if (jpegData.empty()) {
-            return crow::response(404, "No raw frame available");
+        std::string ifNoneMatch = req.get_header_value("If-None-Match");
+
+        // The encode can block behind the shared frame mutex, so it runs
+        // on the worker pool rather than a Crow I/O thread
+        respondAsync(res, [cameraId, quality, ifNoneMatch]() -> crow::response {
+            auto camera = CameraManager::getInstance().getCamera(cameraId);
+            if (!camera) {
+                return crow::response(404, "Camera not found");
+            }
+
+            if (!camera->isRunning()) {
+                return crow::response(400, "Camera is not running");
+            }
+
+            // No need to explicitly call processFrame() anymore as it happens
+            // automatically when the camera is running
+
+            uint64_t generation = 0;
+            auto jpegData = camera->getLatestFrameJpegCached(quality, generation);
+
+            if (!jpegData || jpegData->empty()) {
+                return crow::response(404, "No frame available");
+            }
+
+            // ETag keyed on the frame generation: pollers that already hold
+            // the current frame get a bodyless 304 instead of the JPEG bytes
+            std::string etag = "\"" + cameraId + "-" + std::to_string(generation) +
+                               "-" + std::to_string(quality) + "\"";
+            if (ifNoneMatch == etag) {
+                crow::response resp(304);
+                resp.set_header("ETag", etag);
+                return resp;
+            }
+
+            // Create response with JPEG data
+            crow::response resp;
+            resp.set_header("Content-Type", "image/jpeg");
+            resp.set_header("ETag", etag);
+            resp.body = std::string(jpegData->begin(), jpegData->end());
+            return resp;
+        });
+    });
+    
+    // Get latest raw (unannotated) frame from a camera as JPEG
+    CROW_ROUTE(app_, "/api/v1/cameras/<string>/raw-frame")
+        .methods("GET"_method)
+    ([this](const crow::request& req, crow::response& res, const std::string& cameraId) {
+        if (!checkLicense(req, res)) {
+            res.end();
+            return;
         }
-        
-        // Create response with JPEG data
-        crow::response resp;
-        resp.set_header("Content-Type", "image/jpeg");
-        resp.body = std::string(jpegData.begin(), jpegData.end());
-        return resp;
+
+        // Get the JPEG data
+        int quality = 90; // Default quality
+
+        // Check if quality parameter is provided
+        auto qualityParam = req.url_params.get("quality");
+        if (qualityParam) {
+            try {
+                quality = std::stoi(qualityParam);
+                quality = std::max(1, std::min(100, quality)); // Clamp between 1 and 100
+            } catch (...) {
+                // Ignore parsing errors, use default quality
+            }
+        }
+        std::string ifNoneMatch = req.get_header_value("If-None-Match");
+
+        respondAsync(res, [cameraId, quality, ifNoneMatch]() -> crow::response {
+            auto camera = CameraManager::getInstance().getCamera(cameraId);
+            if (!camera) {
+                return crow::response(404, "Camera not found");
+            }
+
+            if (!camera->isRunning()) {
+                return crow::response(400, "Camera is not running");
+            }
+
+            uint64_t generation = 0;
+            auto jpegData = camera->getRawFrameJpegCached(quality, generation);
+
+            if (!jpegData || jpegData->empty()) {
+                return crow::response(404, "No raw frame available");
+            }
+
+            // ETag keyed on the frame generation (see the annotated frame route)
+            std::string etag = "\"" + cameraId + "-raw-" + std::to_string(generation) +
+                               "-" + std::to_string(quality) + "\"";
+            if (ifNoneMatch == etag) {
+                crow::response resp(304);
+                resp.set_header("ETag", etag);
+                return resp;
+            }
+
+            // Create response with JPEG data
+            crow::response resp;
+            resp.set_header("Content-Type", "image/jpeg");
+            resp.set_header("ETag", etag);
+            resp.body = std::string(jpegData->begin(), jpegData->end());
+            return resp;
+        });
     });
     
+    // Live MJPEG stream for a camera (multipart/x-mixed-replace)
+    //
+    // The REST handler performs the usual license and camera checks, then
+    // redirects to the MJPEG streaming server, which fans out the shared
+    // cached encode to all subscribers with per-client fps throttling.
+    // Supported query parameters: fps (1-30), quality (1-100), raw (0/1).
+    CROW_ROUTE(app_, "/api/v1/cameras/<string>/stream")
+        .methods("GET"_method)
+    ([this](const crow::request& req, const std::string& cameraId) {
+        crow::response res;
+        if (!checkLicense(req, res)) {
+            return res;
+        }
+
+        auto camera = CameraManager::getInstance().getCamera(cameraId);
+        if (!camera) {
+            return crow::response(404, "Camera not found");
+        }
+
+        if (!camera->isRunning()) {
+            return crow::response(400, "Camera is not running");
+        }
+
+        if (!mjpegStreamer_) {
+            return crow::response(503, "Streaming server is not available");
+        }
+
+        // Redirect to the streaming port on the same host
+        std::string host = req.get_header_value("Host");
+        auto colonPos = host.find(':');
+        if (colonPos != std::string::npos) {
+            host = host.substr(0, colonPos);
+        }
+        if (host.empty()) {
+            host = "localhost";
+        }
+
+        std::string location = "http://" + host + ":" +
+                               std::to_string(mjpegStreamer_->getPort()) +
+                               "/api/v1/cameras/" + cameraId + "/stream";
+        if (!req.raw_url.empty()) {
+            auto queryPos = req.raw_url.find('?');
+            if (queryPos != std::string::npos) {
+                location += req.raw_url.substr(queryPos);
+            }
+        }
+
+        crow::response resp(307);
+        resp.set_header("Location", location);
+        return resp;
+    });
+
+    // Push a still image into a push:// source camera. The request body is
+    // the raw encoded image (JPEG/PNG) — no JSON envelope, no base64 — so
+    // the bytes go from Crow's buffer straight into the decoder, which
+    // writes into a pooled frame buffer. Built for externally triggered
+    // still-image pipelines (e.g. ANPR) that push at burst rates.
+    CROW_ROUTE(app_, "/api/v1/cameras/<string>/push-frame")
+        .methods("POST"_method)
+    ([this](const crow::request& req, const std::string& cameraId) {
+        crow::response res;
+        if (!checkLicense(req, res)) {
+            return res;
+        }
+
+        auto camera = CameraManager::getInstance().getCamera(cameraId);
+        if (!camera) {
+            return crow::response(404, "Camera not found");
+        }
+
+        if (!camera->isRunning()) {
+            return crow::response(400, "Camera is not running");
+        }
+
+        auto source = std::dynamic_pointer_cast<GStreamerSource>(
+            camera->getSourceComponent());
+        if (!source) {
+            return crow::response(400, "Camera has no compatible source component");
+        }
+
+        if (req.body.empty()) {
+            return crow::response(400, "Request body must contain the encoded image");
+        }
+
+        if (!source->pushFrame(
+                reinterpret_cast<const unsigned char*>(req.body.data()),
+                req.body.size())) {
+            return crow::response(400, "Failed to ingest frame (is the camera a push:// source?)");
+        }
+
+        return crow::response(204);
+    });
+
     // Get camera frame status (metadata)
     CROW_ROUTE(app_, "/api/v1/cameras/<string>/frame/status")
         .methods("GET"_method)
@@ -815,23 +1300,39 @@ void Api::setupFrameRoutes() {
         
         // Get frame information
         cv::Mat frame = camera->getLatestFrame();
-        
-        nlohmann::json status;
-        status["camera_id"] = cameraId;
-        status["camera_name"] = camera->getName();
-        status["running"] = camera->isRunning();
-        
+
+        // Polled continuously by stream watchdogs: write the flat status
+        // object straight into the response body
+        crow::response result;
+        utils::JsonWriter writer(result.body);
+        writer.beginObject();
+        writer.key("camera_id");
+        writer.value(cameraId);
+        writer.key("camera_name");
+        writer.value(camera->getName());
+        writer.key("running");
+        writer.value(camera->isRunning());
+
         if (!frame.empty()) {
-            status["has_frame"] = true;
-            status["frame_width"] = frame.cols;
-            status["frame_height"] = frame.rows;
-            status["frame_channels"] = frame.channels();
-            status["timestamp"] = std::chrono::system_clock::now().time_since_epoch().count();
+            writer.key("has_frame");
+            writer.value(true);
+            writer.key("frame_width");
+            writer.value(frame.cols);
+            writer.key("frame_height");
+            writer.value(frame.rows);
+            writer.key("frame_channels");
+            writer.value(frame.channels());
+            writer.key("timestamp");
+            writer.value(static_cast<int64_t>(
+                std::chrono::system_clock::now().time_since_epoch().count()));
         } else {
-            status["has_frame"] = false;
+            writer.key("has_frame");
+            writer.value(false);
         }
-        
-        return crow::response(status.dump(2));
+
+        writer.endObject();
+        result.set_header("Content-Type", "application/json");
+        return result;
     });
     
     // Download video file from a file sink component
@@ -881,10 +1382,108 @@ void Api::setupFrameRoutes() {
         // Create response with video data
         crow::response resp;
         resp.set_header("Content-Type", "video/mp4");
-        resp.set_header("Content-Disposition", "attachment; filename=\"" + 
+        resp.set_header("Content-Disposition", "attachment; filename=\"" +
                          std::filesystem::path(filePath).filename().string() + "\"");
         resp.body = std::string(buffer.begin(), buffer.end());
-        
+
+        return resp;
+    });
+
+    // List recording clips overlapping a time range. Timestamps are mapped
+    // to segment files via the file sink's segment index, so incident
+    // review fetches existing files byte-for-byte instead of re-encoding.
+    CROW_ROUTE(app_, "/api/v1/cameras/<string>/clips")
+        .methods("GET"_method)
+    ([this](const crow::request& req, const std::string& cameraId) {
+        crow::response res;
+        if (!checkLicense(req, res)) {
+            return res;
+        }
+
+        auto camera = CameraManager::getInstance().getCamera(cameraId);
+        if (!camera) {
+            return crow::response(404, "Camera not found");
+        }
+
+        int64_t fromMs = 0;
+        int64_t toMs = 0;
+        try {
+            if (auto fromParam = req.url_params.get("from")) {
+                fromMs = std::stoll(fromParam);
+            }
+            if (auto toParam = req.url_params.get("to")) {
+                toMs = std::stoll(toParam);
+            }
+        } catch (const std::exception&) {
+            return crow::response(400, "Invalid from/to parameter, expected epoch milliseconds");
+        }
+
+        nlohmann::json result;
+        result["camera_id"] = cameraId;
+        result["from_ms"] = fromMs;
+        result["to_ms"] = toMs;
+        nlohmann::json segments = nlohmann::json::array();
+
+        for (const auto& sink : camera->getSinkComponents()) {
+            auto fileSink = std::dynamic_pointer_cast<FileSink>(sink);
+            if (!fileSink) {
+                continue;
+            }
+            for (auto& segment : fileSink->getSegmentsInRange(fromMs, toMs)) {
+                segment["sink_id"] = sink->getId();
+                segment["url"] = "/api/v1/cameras/" + cameraId + "/clips/" +
+                                 segment["file"].get<std::string>();
+                // The on-disk path stays server-side
+                segment.erase("path");
+                segments.push_back(std::move(segment));
+            }
+        }
+
+        result["segments"] = std::move(segments);
+        crow::response resp(result.dump());
+        resp.set_header("Content-Type", "application/json");
+        return resp;
+    });
+
+    // Serve one recording segment. The file is handed to the connection as
+    // static file info, so the bytes stream from the file descriptor
+    // without being staged through the response body — no decode, no
+    // re-encode, no userspace copy of the clip.
+    CROW_ROUTE(app_, "/api/v1/cameras/<string>/clips/<string>")
+        .methods("GET"_method)
+    ([this](const crow::request& req, const std::string& cameraId, const std::string& fileName) {
+        crow::response res;
+        if (!checkLicense(req, res)) {
+            return res;
+        }
+
+        auto camera = CameraManager::getInstance().getCamera(cameraId);
+        if (!camera) {
+            return crow::response(404, "Camera not found");
+        }
+
+        // Resolve strictly through the segment index: only names the sink
+        // has recorded resolve, so request input can't traverse the tree
+        std::string segmentPath;
+        for (const auto& sink : camera->getSinkComponents()) {
+            auto fileSink = std::dynamic_pointer_cast<FileSink>(sink);
+            if (!fileSink) {
+                continue;
+            }
+            segmentPath = fileSink->resolveSegmentPath(fileName);
+            if (!segmentPath.empty()) {
+                break;
+            }
+        }
+
+        if (segmentPath.empty() || !std::filesystem::exists(segmentPath)) {
+            return crow::response(404, "Clip not found: " + fileName);
+        }
+
+        crow::response resp;
+        resp.set_static_file_info_unsafe(segmentPath);
+        resp.set_header("Content-Type", "video/mp4");
+        resp.set_header("Content-Disposition", "inline; filename=\"" + fileName + "\"");
         return resp;
     });
 }
@@ -945,7 +1544,10 @@ void Api::setupLicenseRoutes() {
                                  std::to_string(stoppedCameras) + 
                                  " camera(s) using features not allowed by demo license");
                     }
-                    
+
+                    // Publish the new license state to checkLicense() immediately
+                    refreshLicenseSnapshot();
+
                     auto licenseInfo = licenseManager.getLicenseInfo();
                     licenseInfo["message"] = "License deactivated successfully";
                     
@@ -1005,7 +1607,10 @@ void Api::setupLicenseRoutes() {
                                  " camera(s) using features not allowed by the new license tier");
                     }
                 }
-                
+
+                // Publish the new license state to checkLicense() immediately
+                refreshLicenseSnapshot();
+
                 // Return the updated license info
                 auto licenseInfo = licenseManager.getLicenseInfo();
                 licenseInfo["message"] = "License key accepted";
@@ -1071,7 +1676,10 @@ void Api::setupLicenseRoutes() {
                                  " camera(s) using features not allowed by the new license tier");
                     }
                 }
-                
+
+                // Publish the new license state to checkLicense() immediately
+                refreshLicenseSnapshot();
+
                 auto licenseInfo = licenseManager.getLicenseInfo();
                 licenseInfo["message"] = "License information updated";
                 
@@ -1117,7 +1725,10 @@ void Api::setupLicenseRoutes() {
                          std::to_string(stoppedCameras) + 
                          " camera(s) using features not allowed by demo license");
             }
-            
+
+            // Publish the new license state to checkLicense() immediately
+            refreshLicenseSnapshot();
+
             nlohmann::json response;
             response["success"] = true;
             response["message"] = "License deleted successfully";
@@ -1161,7 +1772,7 @@ void Api::setupLicenseRoutes() {
         int camera_count = 0;
         int trial_cameras = 0;
         
-        for (const auto& camera : cameras) {
+        for (const auto& camera : *cameras) {
             // For now, assume all cameras belong to the requested tenant
             // In a real implementation, you'd filter by tenant_id
             camera_count++;
@@ -1222,30 +1833,63 @@ void Api::setupCameraRoutes() {
             return res;
         }
         
-        nlohmann::json response = nlohmann::json::array();
         auto cameras = CameraManager::getInstance().getAllCameras();
-        
-        for (const auto& camera : cameras) {
-            nlohmann::json cameraJson;
-            cameraJson["id"] = camera->getId();
-            cameraJson["name"] = camera->getName();
-            cameraJson["running"] = camera->isRunning();
-            
+
+        // Dashboard poll path: serialize straight into the response body,
+        // no intermediate DOM (see utils::JsonWriter). Per-camera fields
+        // come from the lock-free status snapshot, so polling never
+        // contends with the processing thread on the camera mutex.
+        crow::response result;
+        utils::JsonWriter writer(result.body);
+        writer.beginArray();
+
+        for (const auto& camera : *cameras) {
+            auto snapshot = camera->getStatusSnapshot();
+
+            writer.beginObject();
+            writer.key("id");
+            writer.value(snapshot->id);
+            writer.key("name");
+            writer.value(snapshot->name);
+            writer.key("running");
+            writer.value(snapshot->running);
+
             // Count components by type
-            size_t sourceCount = camera->getSourceComponent() ? 1 : 0;
-            size_t processorCount = camera->getProcessorComponents().size();
-            size_t sinkCount = camera->getSinkComponents().size();
-            
-            cameraJson["components"] = {
-                {"source", sourceCount},
-                {"processors", processorCount},
-                {"sinks", sinkCount}
-            };
-            
-            response.push_back(cameraJson);
+            writer.key("components");
+            writer.beginObject();
+            writer.key("source");
+            writer.value(snapshot->hasSource ? 1 : 0);
+            writer.key("processors");
+            writer.value(static_cast<uint64_t>(snapshot->processorCount));
+            writer.key("sinks");
+            writer.value(static_cast<uint64_t>(snapshot->sinkCount));
+            writer.endObject();
+
+            // Per-stage pipeline heartbeats (relaxed atomic reads) plus
+            // the watchdog's stall verdict
+            writer.key("stalled");
+            writer.value(camera->isStalled());
+            writer.key("heartbeats");
+            writer.beginObject();
+            const auto& hb = camera->getHeartbeats();
+            const utils::StageHeartbeat* stages[] = {
+                &hb.capture, &hb.process, &hb.detect, &hb.sink};
+            const char* stageNames[] = {"capture", "process", "detect", "sink"};
+            for (int s = 0; s < 4; s++) {
+                writer.key(stageNames[s]);
+                writer.beginObject();
+                writer.key("frames");
+                writer.value(stages[s]->frames());
+                writer.key("age_ms");
+                writer.value(static_cast<int64_t>(stages[s]->ageMs()));
+                writer.endObject();
+            }
+            writer.endObject();
+
+            writer.endObject();
         }
-        
-        crow::response result(response.dump(2));
+
+        writer.endArray();
         result.set_header("Content-Type", "application/json");
         return result;
     });
@@ -1271,7 +1915,7 @@ void Api::setupCameraRoutes() {
             }
             
             // Save camera configuration to database
-            saveCameraConfigToDB(camera->getId());
+            scheduleCameraConfigSave(camera->getId());
             
             nlohmann::json response;
             response["id"] = camera->getId();
@@ -1304,103 +1948,113 @@ void Api::setupCameraRoutes() {
     // Update a camera
     CROW_ROUTE(app_, "/api/v1/cameras/<string>")
         .methods("PUT"_method)
-    ([this](const crow::request& req, const std::string& cameraId) {
-        crow::response res;
+    ([this](const crow::request& req, crow::response& res, const std::string& cameraId) {
         if (!checkLicense(req, res)) {
-            return res;
+            res.end();
+            return;
         }
-        
-        auto camera = CameraManager::getInstance().getCamera(cameraId);
-        if (!camera) {
-            return crow::response(404, "Camera not found");
-        }
-        
-        try {
-            auto body = nlohmann::json::parse(req.body);
-            
-            if (body.contains("name")) {
-                camera->setName(body["name"]);
+
+        // start()/stop() block on stream teardown and component I/O, so
+        // the whole update runs on the worker pool
+        respondAsync(res, [this, cameraId, body = req.body]() -> crow::response {
+            auto camera = CameraManager::getInstance().getCamera(cameraId);
+            if (!camera) {
+                return crow::response(404, "Camera not found");
             }
-            
-            // Start/stop camera if requested
-            if (body.contains("running")) {
-                bool shouldRun = body["running"].get<bool>();
-                if (shouldRun && !camera->isRunning()) {
-                    // REMOVED the check for AI server availability here - let the Camera::start() handle this
-                    // The components now have retry logic to handle temporary AI server unavailability
-                    
-                    if (!camera->start()) {
-                        return crow::response(500, "Failed to start camera");
-                    }
-                } else if (!shouldRun && camera->isRunning()) {
-                    if (!camera->stop()) {
-                        return crow::response(500, "Failed to stop camera");
+
+            try {
+                auto parsed = nlohmann::json::parse(body);
+
+                if (parsed.contains("name")) {
+                    camera->setName(parsed["name"]);
+                }
+
+                // Start/stop camera if requested
+                if (parsed.contains("running")) {
+                    bool shouldRun = parsed["running"].get<bool>();
+                    if (shouldRun && !camera->isRunning()) {
+                        // REMOVED the check for AI server availability here - let the Camera::start() handle this
+                        // The components now have retry logic to handle temporary AI server unavailability
+
+                        if (!camera->start()) {
+                            return crow::response(500, "Failed to start camera");
+                        }
+                    } else if (!shouldRun && camera->isRunning()) {
+                        if (!camera->stop()) {
+                            return crow::response(500, "Failed to stop camera");
+                        }
                     }
                 }
+
+                // Save camera configuration to database
+                scheduleCameraConfigSave(cameraId);
+
+                auto status = camera->getStatus();
+                crow::response out = createJsonResponse(status);
+                out.set_header("Content-Type", "application/json");
+                return out;
+            } catch (const std::exception& e) {
+                return crow::response(400, std::string("Invalid request: ") + e.what());
             }
-            
-            // Save camera configuration to database
-            saveCameraConfigToDB(cameraId);
-            
-            auto status = camera->getStatus();
-            crow::response res = createJsonResponse(status);
-            res.set_header("Content-Type", "application/json");
-            return res;
-        } catch (const std::exception& e) {
-            return crow::response(400, std::string("Invalid request: ") + e.what());
-        }
+        });
     });
     
     // Delete a camera
     CROW_ROUTE(app_, "/api/v1/cameras/<string>")
         .methods("DELETE"_method)
-    ([this](const crow::request& req, const std::string& cameraId) {
-        crow::response res;
+    ([this](const crow::request& req, crow::response& res, const std::string& cameraId) {
         if (!checkLicense(req, res)) {
-            return res;
+            res.end();
+            return;
         }
-        
+
         // Check if the camera exists
         auto camera = CameraManager::getInstance().getCamera(cameraId);
         if (!camera) {
-            return crow::response(404, "Camera not found");
+            res = crow::response(404, "Camera not found");
+            res.end();
+            return;
         }
-        
+
         // Check for "async" query parameter
         bool useAsync = false;
         auto asyncParam = req.url_params.get("async");
         if (asyncParam && (std::string(asyncParam) == "true" || std::string(asyncParam) == "1")) {
             useAsync = true;
         }
-        
-        // For synchronous deletion, perform the operation inline
+
+        // Synchronous deletion still responds with the final result, but
+        // the blocking database cleanup runs on the worker pool
         if (!useAsync) {
-            // First, delete all database data for this camera
-            bool databaseCleaned = false;
-            // Look for database sinks and delete data
-            for (const auto& sink : camera->getSinkComponents()) {
-                auto dbSink = std::dynamic_pointer_cast<DatabaseSink>(sink);
-                if (dbSink) {
-                    databaseCleaned = dbSink->deleteDataForCamera(cameraId);
-                    break; // Assuming there's only one database sink per camera
+            respondAsync(res, [camera, cameraId]() -> crow::response {
+                // First, delete all database data for this camera
+                bool databaseCleaned = false;
+                // Look for database sinks and delete data
+                for (const auto& sink : camera->getSinkComponents()) {
+                    auto dbSink = std::dynamic_pointer_cast<DatabaseSink>(sink);
+                    if (dbSink) {
+                        databaseCleaned = dbSink->deleteDataForCamera(cameraId);
+                        break; // Assuming there's only one database sink per camera
+                    }
                 }
-            }
-            
-            // Delete camera configuration from database
-            ConfigManager::getInstance().deleteCameraConfig(cameraId);
-            
-            if (!CameraManager::getInstance().deleteCamera(cameraId)) {
-                return crow::response(404, "Camera not found");
-            }
-            
-            nlohmann::json response;
-            response["success"] = true;
-            response["message"] = "Camera deleted";
-            response["database_cleaned"] = databaseCleaned;
-            
-            return createJsonResponse(response);
+
+                // Delete camera configuration from database
+                ConfigManager::getInstance().deleteCameraConfig(cameraId);
+
+                if (!CameraManager::getInstance().deleteCamera(cameraId)) {
+                    return crow::response(404, "Camera not found");
+                }
+
+                nlohmann::json response;
+                response["success"] = true;
+                response["message"] = "Camera deleted";
+                response["database_cleaned"] = databaseCleaned;
+
+                return createJsonResponse(response);
+            });
+            return;
         }
-        
+
         // For asynchronous deletion, create a background task
         std::string taskId = BackgroundTaskManager::getInstance().submitTask(
             "camera_deletion", 
@@ -1504,8 +2158,9 @@ void Api::setupCameraRoutes() {
         response["message"] = "Camera deletion started";
         response["task_id"] = taskId;
         response["async"] = true;
-        
-        return createJsonResponse(response, 202); // 202 Accepted
+
+        res = createJsonResponse(response, 202); // 202 Accepted
+        res.end();
     });
 }
 
@@ -1791,230 +2446,419 @@ void Api::setupComponentRoutes() {
             return crow::response(404, "Camera not found");
         }
         
-        nlohmann::json response;
-        
+        // Component statuses arrive as per-component DOMs from getStatus();
+        // the envelope is written directly into the response body and each
+        // status spliced in once, instead of assembling and re-dumping a
+        // second tree around them
+        crow::response result;
+        utils::JsonWriter writer(result.body);
+        writer.beginObject();
+
         // Get source component
         auto source = camera->getSourceComponent();
+        writer.key("source");
         if (source) {
-            response["source"] = source->getStatus();
+            writer.rawValue(source->getStatus().dump());
         } else {
-            response["source"] = nullptr;
+            writer.null();
         }
-        
+
         // Get processor components
-        nlohmann::json processors = nlohmann::json::array();
+        writer.key("processors");
+        writer.beginArray();
         for (const auto& processor : camera->getProcessorComponents()) {
-            processors.push_back(processor->getStatus());
+            writer.rawValue(processor->getStatus().dump());
         }
-        response["processors"] = processors;
-        
+        writer.endArray();
+
         // Get sink components
-        nlohmann::json sinks = nlohmann::json::array();
+        writer.key("sinks");
+        writer.beginArray();
         for (const auto& sink : camera->getSinkComponents()) {
-            sinks.push_back(sink->getStatus());
+            writer.rawValue(sink->getStatus().dump());
         }
-        response["sinks"] = sinks;
-        
-        return createJsonResponse(response);
+        writer.endArray();
+
+        writer.endObject();
+        result.set_header("Content-Type", "application/json");
+        return result;
     });
-    
+
+    // Replace a camera's component set in one transactional call
+    //
+    // Provisioning a camera through the per-component routes costs one
+    // round trip per component, each with its own validation, save and
+    // pipeline disruption. This endpoint accepts the full set at once:
+    // every component is created up front (nothing touches the camera if
+    // any entry is invalid), the camera is stopped and restarted at most
+    // once, and the configuration is persisted once. Each present key
+    // ("source", "processors", "sinks") is authoritative for its
+    // category; absent keys leave that category untouched.
+    CROW_ROUTE(app_, "/api/v1/cameras/<string>/components")
+        .methods("PUT"_method)
+    ([this](const crow::request& req, crow::response& res, const std::string& cameraId) {
+        if (!checkLicense(req, res)) {
+            res.end();
+            return;
+        }
+
+        // The apply phase stops and restarts the pipeline, so the whole
+        // batch runs on the worker pool
+        respondAsync(res, [this, cameraId, reqBody = req.body]() -> crow::response {
+            auto camera = CameraManager::getInstance().getCamera(cameraId);
+            if (!camera) {
+                return crow::response(404, "Camera not found");
+            }
+
+            try {
+                auto body = nlohmann::json::parse(reqBody);
+                if (!body.is_object()) {
+                    return crow::response(400, "Request body must be a JSON object");
+                }
+
+                auto makeComponentId = [](const nlohmann::json& spec) {
+                    std::string id = spec.contains("id") ? spec["id"].get<std::string>() : "";
+                    if (id.empty()) {
+                        uuid_t uuid;
+                        char uuid_str[37];
+                        uuid_generate(uuid);
+                        uuid_unparse_lower(uuid, uuid_str);
+                        id = std::string(uuid_str);
+                    }
+                    return id;
+                };
+
+                // Validation phase: build every requested component before
+                // touching the camera, so a bad entry rejects the whole batch
+                std::shared_ptr<SourceComponent> newSource;
+                std::vector<std::shared_ptr<ProcessorComponent>> newProcessors;
+                std::vector<std::shared_ptr<SinkComponent>> newSinks;
+
+                if (body.contains("source") && !body["source"].is_null()) {
+                    const auto& spec = body["source"];
+                    if (!spec.contains("type")) {
+                        return crow::response(400, "Source entry is missing component type");
+                    }
+                    nlohmann::json config = spec.contains("config") ? spec["config"] : nlohmann::json();
+                    newSource = ComponentFactory::getInstance().createSourceComponent(
+                        makeComponentId(spec), camera.get(), spec["type"], config);
+                    if (!newSource) {
+                        return crow::response(400, "Failed to create source component of type '" +
+                                              spec["type"].get<std::string>() + "'");
+                    }
+                }
+
+                if (body.contains("processors")) {
+                    if (!body["processors"].is_array()) {
+                        return crow::response(400, "'processors' must be an array");
+                    }
+                    for (const auto& spec : body["processors"]) {
+                        if (!spec.contains("type")) {
+                            return crow::response(400, "Processor entry is missing component type");
+                        }
+                        std::string type = spec["type"];
+                        nlohmann::json config = spec.contains("config") ? spec["config"] : nlohmann::json();
+
+                        // Same GlobalConfig injection as the per-component route
+                        if (type == "object_detection") {
+                            config["use_shared_memory"] = GlobalConfig::getInstance().getUseSharedMemory();
+                        }
+
+                        auto processor = ComponentFactory::getInstance().createProcessorComponent(
+                            makeComponentId(spec), camera.get(), type, config);
+                        if (!processor) {
+                            return crow::response(400, "Failed to create processor component of type '" +
+                                                  type + "'");
+                        }
+                        newProcessors.push_back(processor);
+                    }
+                }
+
+                if (body.contains("sinks")) {
+                    if (!body["sinks"].is_array()) {
+                        return crow::response(400, "'sinks' must be an array");
+                    }
+                    for (const auto& spec : body["sinks"]) {
+                        if (!spec.contains("type")) {
+                            return crow::response(400, "Sink entry is missing component type");
+                        }
+                        nlohmann::json config = spec.contains("config") ? spec["config"] : nlohmann::json();
+                        auto sink = ComponentFactory::getInstance().createSinkComponent(
+                            makeComponentId(spec), camera.get(), spec["type"], config);
+                        if (!sink) {
+                            return crow::response(400, "Failed to create sink component of type '" +
+                                                  spec["type"].get<std::string>() + "'");
+                        }
+                        newSinks.push_back(sink);
+                    }
+                }
+
+                // Apply phase: one stop, swap the component set, one start
+                const bool wasRunning = camera->isRunning();
+                if (wasRunning) {
+                    camera->stop();
+                }
+
+                if (body.contains("source")) {
+                    camera->setSourceComponent(newSource);
+                }
+                if (body.contains("processors")) {
+                    for (const auto& existing : camera->getProcessorComponents()) {
+                        camera->removeProcessorComponent(existing->getId());
+                    }
+                    for (const auto& processor : newProcessors) {
+                        camera->addProcessorComponent(processor);
+                    }
+                }
+                if (body.contains("sinks")) {
+                    for (const auto& existing : camera->getSinkComponents()) {
+                        camera->removeSinkComponent(existing->getId());
+                    }
+                    for (const auto& sink : newSinks) {
+                        camera->addSinkComponent(sink);
+                    }
+                }
+
+                bool restarted = true;
+                if (wasRunning) {
+                    restarted = camera->start();
+                    if (!restarted) {
+                        LOG_ERROR("API", "Bulk component update applied but camera " +
+                                  cameraId + " failed to restart");
+                    }
+                }
+
+                // Persist the whole new set once
+                scheduleCameraConfigSave(cameraId);
+
+                nlohmann::json response;
+                response["success"] = restarted;
+                response["running"] = camera->isRunning();
+                auto source = camera->getSourceComponent();
+                response["source"] = source ? source->getStatus() : nlohmann::json();
+                response["processors"] = nlohmann::json::array();
+                for (const auto& processor : camera->getProcessorComponents()) {
+                    response["processors"].push_back(processor->getStatus());
+                }
+                response["sinks"] = nlohmann::json::array();
+                for (const auto& sink : camera->getSinkComponents()) {
+                    response["sinks"].push_back(sink->getStatus());
+                }
+
+                return createJsonResponse(response, restarted ? 200 : 500);
+            } catch (const std::exception& e) {
+                return crow::response(400, std::string("Invalid request: ") + e.what());
+            }
+        });
+    });
+
     // Create a source component
     CROW_ROUTE(app_, "/api/v1/cameras/<string>/source")
         .methods("POST"_method)
-    ([this](const crow::request& req, const std::string& cameraId) {
-        crow::response res;
+    ([this](const crow::request& req, crow::response& res, const std::string& cameraId) {
         if (!checkLicense(req, res)) {
-            return res;
+            res.end();
+            return;
         }
-        
-        auto camera = CameraManager::getInstance().getCamera(cameraId);
-        if (!camera) {
-            return crow::response(404, "Camera not found");
-        }
-        
-        try {
-            auto body = nlohmann::json::parse(req.body);
-            
-            if (!body.contains("type")) {
-                return crow::response(400, "Missing component type");
-            }
-            
-            std::string type = body["type"];
-            std::string id = body.contains("id") ? body["id"].get<std::string>() : "";
-            
-            // Generate component ID if not provided
-            if (id.empty()) {
-                uuid_t uuid;
-                char uuid_str[37];
-                uuid_generate(uuid);
-                uuid_unparse_lower(uuid, uuid_str);
-                id = std::string(uuid_str);
-            }
-            
-            // Extract config if provided
-            nlohmann::json config = body.contains("config") ? body["config"] : nlohmann::json();
-            
-            // Create the source component
-            auto source = ComponentFactory::getInstance().createSourceComponent(
-                id, camera.get(), type, config);
-            
-            if (!source) {
-                return crow::response(500, "Failed to create source component");
+
+        // Component construction can open streams; keep it off the I/O pool
+        respondAsync(res, [this, cameraId, reqBody = req.body]() -> crow::response {
+            auto camera = CameraManager::getInstance().getCamera(cameraId);
+            if (!camera) {
+                return crow::response(404, "Camera not found");
             }
-            
-            // Add to camera
-            if (!camera->setSourceComponent(source)) {
-                return crow::response(500, "Failed to add source component to camera");
+
+            try {
+                auto body = nlohmann::json::parse(reqBody);
+
+                if (!body.contains("type")) {
+                    return crow::response(400, "Missing component type");
+                }
+
+                std::string type = body["type"];
+                std::string id = body.contains("id") ? body["id"].get<std::string>() : "";
+
+                // Generate component ID if not provided
+                if (id.empty()) {
+                    uuid_t uuid;
+                    char uuid_str[37];
+                    uuid_generate(uuid);
+                    uuid_unparse_lower(uuid, uuid_str);
+                    id = std::string(uuid_str);
+                }
+
+                // Extract config if provided
+                nlohmann::json config = body.contains("config") ? body["config"] : nlohmann::json();
+
+                // Create the source component
+                auto source = ComponentFactory::getInstance().createSourceComponent(
+                    id, camera.get(), type, config);
+
+                if (!source) {
+                    return crow::response(500, "Failed to create source component");
+                }
+
+                // Add to camera
+                if (!camera->setSourceComponent(source)) {
+                    return crow::response(500, "Failed to add source component to camera");
+                }
+
+                // Save camera configuration
+                scheduleCameraConfigSave(cameraId);
+
+                return createJsonResponse(source->getStatus(), 201);
+            } catch (const std::exception& e) {
+                return crow::response(400, std::string("Invalid request: ") + e.what());
             }
-            
-            // Save camera configuration
-            saveCameraConfigToDB(cameraId);
-            
-            return createJsonResponse(source->getStatus(), 201);
-        } catch (const std::exception& e) {
-            return crow::response(400, std::string("Invalid request: ") + e.what());
-        }
+        });
     });
     
     // Update a source component
     CROW_ROUTE(app_, "/api/v1/cameras/<string>/source")
         .methods("PUT"_method)
-    ([this](const crow::request& req, const std::string& cameraId) {
-        crow::response res;
+    ([this](const crow::request& req, crow::response& res, const std::string& cameraId) {
         if (!checkLicense(req, res)) {
-            return res;
-        }
-        
-        auto camera = CameraManager::getInstance().getCamera(cameraId);
-        if (!camera) {
-            return crow::response(404, "Camera not found");
+            res.end();
+            return;
         }
-        
-        auto source = camera->getSourceComponent();
-        if (!source) {
-            return crow::response(404, "Source component not found");
-        }
-        
-        try {
-            auto body = nlohmann::json::parse(req.body);
-            
-            // Update config if provided
-            if (body.contains("config")) {
-                if (!source->updateConfig(body["config"])) {
-                    return crow::response(500, "Failed to update source component config");
+
+        respondAsync(res, [this, cameraId, reqBody = req.body]() -> crow::response {
+            auto camera = CameraManager::getInstance().getCamera(cameraId);
+            if (!camera) {
+                return crow::response(404, "Camera not found");
+            }
+
+            auto source = camera->getSourceComponent();
+            if (!source) {
+                return crow::response(404, "Source component not found");
+            }
+
+            try {
+                auto body = nlohmann::json::parse(reqBody);
+
+                // Update config if provided
+                if (body.contains("config")) {
+                    if (!source->updateConfig(body["config"])) {
+                        return crow::response(500, "Failed to update source component config");
+                    }
                 }
+
+                // Save camera configuration
+                scheduleCameraConfigSave(cameraId);
+
+                return createJsonResponse(source->getStatus());
+            } catch (const std::exception& e) {
+                return crow::response(400, std::string("Invalid request: ") + e.what());
             }
-            
-            // Save camera configuration
-            saveCameraConfigToDB(cameraId);
-            
-            return createJsonResponse(source->getStatus());
-        } catch (const std::exception& e) {
-            return crow::response(400, std::string("Invalid request: ") + e.what());
-        }
+        });
     });
     
     // Delete a source component
     CROW_ROUTE(app_, "/api/v1/cameras/<string>/source")
         .methods("DELETE"_method)
-    ([this](const crow::request& req, const std::string& cameraId) {
-        crow::response res;
+    ([this](const crow::request& req, crow::response& res, const std::string& cameraId) {
         if (!checkLicense(req, res)) {
-            return res;
-        }
-        
-        auto camera = CameraManager::getInstance().getCamera(cameraId);
-        if (!camera) {
-            return crow::response(404, "Camera not found");
-        }
-        
-        if (!camera->getSourceComponent()) {
-            return crow::response(404, "Source component not found");
+            res.end();
+            return;
         }
-        
-        camera->setSourceComponent(nullptr);
-        
-        // Save camera configuration
-        saveCameraConfigToDB(cameraId);
-        
-        nlohmann::json response;
-        response["success"] = true;
-        response["message"] = "Source component deleted";
-        
-        return createJsonResponse(response);
+
+        respondAsync(res, [this, cameraId]() -> crow::response {
+            auto camera = CameraManager::getInstance().getCamera(cameraId);
+            if (!camera) {
+                return crow::response(404, "Camera not found");
+            }
+
+            if (!camera->getSourceComponent()) {
+                return crow::response(404, "Source component not found");
+            }
+
+            camera->setSourceComponent(nullptr);
+
+            // Save camera configuration
+            scheduleCameraConfigSave(cameraId);
+
+            nlohmann::json response;
+            response["success"] = true;
+            response["message"] = "Source component deleted";
+
+            return createJsonResponse(response);
+        });
     });
     
     // Create a processor component
     CROW_ROUTE(app_, "/api/v1/cameras/<string>/processors")
         .methods("POST"_method)
-    ([this](const crow::request& req, const std::string& cameraId) {
-        crow::response res;
+    ([this](const crow::request& req, crow::response& res, const std::string& cameraId) {
         if (!checkLicense(req, res)) {
-            return res;
-        }
-        
-        auto camera = CameraManager::getInstance().getCamera(cameraId);
-        if (!camera) {
-            return crow::response(404, "Camera not found");
+            res.end();
+            return;
         }
-        
-        try {
-            auto body = nlohmann::json::parse(req.body);
-            
-            if (!body.contains("type")) {
-                return crow::response(400, "Missing component type");
-            }
-            
-            std::string type = body["type"];
-            std::string id = body.contains("id") ? body["id"].get<std::string>() : "";
-            
-            // Generate component ID if not provided
-            if (id.empty()) {
-                uuid_t uuid;
-                char uuid_str[37];
-                uuid_generate(uuid);
-                uuid_unparse_lower(uuid, uuid_str);
-                id = std::string(uuid_str);
-            }
-            
-            // Extract config if provided
-            nlohmann::json config = body.contains("config") ? body["config"] : nlohmann::json();
-            
-            // Always use GlobalConfig for server URL for object_detection processors
-            if (type == "object_detection") {
-                // Server URL setting is handled by ComponentFactory using GlobalConfig
-                LOG_INFO("API", "Server URL for processor will be set by ComponentFactory from GlobalConfig");
-            }
-            
-            // Add shared memory setting for applicable processors
-            if (type == "object_detection") {
-                // Use GlobalConfig to get shared memory setting
-                bool useSharedMemory = GlobalConfig::getInstance().getUseSharedMemory();
-                config["use_shared_memory"] = useSharedMemory;
-                LOG_INFO("API", "Using shared memory setting from GlobalConfig for processor: " + 
-                         std::string(useSharedMemory ? "true" : "false"));
-            }
-            
-            // Create the processor component
-            auto processor = ComponentFactory::getInstance().createProcessorComponent(
-                id, camera.get(), type, config);
-            
-            if (!processor) {
-                return crow::response(500, "Failed to create processor component");
+
+        // Processor construction can block on model/backend setup
+        respondAsync(res, [this, cameraId, reqBody = req.body]() -> crow::response {
+            auto camera = CameraManager::getInstance().getCamera(cameraId);
+            if (!camera) {
+                return crow::response(404, "Camera not found");
             }
-            
-            // Add to camera
-            if (!camera->addProcessorComponent(processor)) {
-                return crow::response(500, "Failed to add processor component to camera");
+
+            try {
+                auto body = nlohmann::json::parse(reqBody);
+
+                if (!body.contains("type")) {
+                    return crow::response(400, "Missing component type");
+                }
+
+                std::string type = body["type"];
+                std::string id = body.contains("id") ? body["id"].get<std::string>() : "";
+
+                // Generate component ID if not provided
+                if (id.empty()) {
+                    uuid_t uuid;
+                    char uuid_str[37];
+                    uuid_generate(uuid);
+                    uuid_unparse_lower(uuid, uuid_str);
+                    id = std::string(uuid_str);
+                }
+
+                // Extract config if provided
+                nlohmann::json config = body.contains("config") ? body["config"] : nlohmann::json();
+
+                // Always use GlobalConfig for server URL for object_detection processors
+                if (type == "object_detection") {
+                    // Server URL setting is handled by ComponentFactory using GlobalConfig
+                    LOG_INFO("API", "Server URL for processor will be set by ComponentFactory from GlobalConfig");
+                }
+
+                // Add shared memory setting for applicable processors
+                if (type == "object_detection") {
+                    // Use GlobalConfig to get shared memory setting
+                    bool useSharedMemory = GlobalConfig::getInstance().getUseSharedMemory();
+                    config["use_shared_memory"] = useSharedMemory;
+                    LOG_INFO("API", "Using shared memory setting from GlobalConfig for processor: " +
+                             std::string(useSharedMemory ? "true" : "false"));
+                }
+
+                // Create the processor component
+                auto processor = ComponentFactory::getInstance().createProcessorComponent(
+                    id, camera.get(), type, config);
+
+                if (!processor) {
+                    return crow::response(500, "Failed to create processor component");
+                }
+
+                // Add to camera
+                if (!camera->addProcessorComponent(processor)) {
+                    return crow::response(500, "Failed to add processor component to camera");
+                }
+
+                // Save camera configuration
+                scheduleCameraConfigSave(cameraId);
+
+                return createJsonResponse(processor->getStatus(), 201);
+            } catch (const std::exception& e) {
+                return crow::response(400, std::string("Invalid request: ") + e.what());
             }
-            
-            // Save camera configuration
-            saveCameraConfigToDB(cameraId);
-            
-            return createJsonResponse(processor->getStatus(), 201);
-        } catch (const std::exception& e) {
-            return crow::response(400, std::string("Invalid request: ") + e.what());
-        }
+        });
     });
     
     // Get a specific processor component
@@ -2042,125 +2886,132 @@ void Api::setupComponentRoutes() {
     // Update a processor component
     CROW_ROUTE(app_, "/api/v1/cameras/<string>/processors/<string>")
         .methods("PUT"_method)
-    ([this](const crow::request& req, const std::string& cameraId, const std::string& processorId) {
-        crow::response res;
+    ([this](const crow::request& req, crow::response& res, const std::string& cameraId, const std::string& processorId) {
         if (!checkLicense(req, res)) {
-            return res;
+            res.end();
+            return;
         }
-        
-        auto camera = CameraManager::getInstance().getCamera(cameraId);
-        if (!camera) {
-            return crow::response(404, "Camera not found");
-        }
-        
-        auto processor = camera->getProcessorComponent(processorId);
-        if (!processor) {
-            return crow::response(404, "Processor component not found");
-        }
-        
-        try {
-            auto body = nlohmann::json::parse(req.body);
-            
-            // Update config if provided
-            if (body.contains("config")) {
-                if (!processor->updateConfig(body["config"])) {
-                    return crow::response(500, "Failed to update processor component config");
+
+        respondAsync(res, [this, cameraId, processorId, reqBody = req.body]() -> crow::response {
+            auto camera = CameraManager::getInstance().getCamera(cameraId);
+            if (!camera) {
+                return crow::response(404, "Camera not found");
+            }
+
+            auto processor = camera->getProcessorComponent(processorId);
+            if (!processor) {
+                return crow::response(404, "Processor component not found");
+            }
+
+            try {
+                auto body = nlohmann::json::parse(reqBody);
+
+                // Update config if provided
+                if (body.contains("config")) {
+                    if (!processor->updateConfig(body["config"])) {
+                        return crow::response(500, "Failed to update processor component config");
+                    }
                 }
+
+                // Save camera configuration
+                scheduleCameraConfigSave(cameraId);
+
+                return createJsonResponse(processor->getStatus());
+            } catch (const std::exception& e) {
+                return crow::response(400, std::string("Invalid request: ") + e.what());
             }
-            
-            // Save camera configuration
-            saveCameraConfigToDB(cameraId);
-            
-            return createJsonResponse(processor->getStatus());
-        } catch (const std::exception& e) {
-            return crow::response(400, std::string("Invalid request: ") + e.what());
-        }
+        });
     });
     
     // Delete a processor component
     CROW_ROUTE(app_, "/api/v1/cameras/<string>/processors/<string>")
         .methods("DELETE"_method)
-    ([this](const crow::request& req, const std::string& cameraId, const std::string& processorId) {
-        crow::response res;
+    ([this](const crow::request& req, crow::response& res, const std::string& cameraId, const std::string& processorId) {
         if (!checkLicense(req, res)) {
-            return res;
+            res.end();
+            return;
         }
-        
-        auto camera = CameraManager::getInstance().getCamera(cameraId);
-        if (!camera) {
-            return crow::response(404, "Camera not found");
-        }
-        
-        if (!camera->removeProcessorComponent(processorId)) {
-            return crow::response(404, "Processor component not found");
-        }
-        
-        // Save camera configuration
-        saveCameraConfigToDB(cameraId);
-        
-        nlohmann::json response;
-        response["success"] = true;
-        response["message"] = "Processor component deleted";
-        
-        return createJsonResponse(response);
+
+        respondAsync(res, [this, cameraId, processorId]() -> crow::response {
+            auto camera = CameraManager::getInstance().getCamera(cameraId);
+            if (!camera) {
+                return crow::response(404, "Camera not found");
+            }
+
+            if (!camera->removeProcessorComponent(processorId)) {
+                return crow::response(404, "Processor component not found");
+            }
+
+            // Save camera configuration
+            scheduleCameraConfigSave(cameraId);
+
+            nlohmann::json response;
+            response["success"] = true;
+            response["message"] = "Processor component deleted";
+
+            return createJsonResponse(response);
+        });
     });
     
     // Create a sink component
     CROW_ROUTE(app_, "/api/v1/cameras/<string>/sinks")
         .methods("POST"_method)
-    ([this](const crow::request& req, const std::string& cameraId) {
-        crow::response res;
+    ([this](const crow::request& req, crow::response& res, const std::string& cameraId) {
         if (!checkLicense(req, res)) {
-            return res;
+            res.end();
+            return;
         }
-        
-        auto camera = CameraManager::getInstance().getCamera(cameraId);
-        if (!camera) {
-            return crow::response(404, "Camera not found");
-        }
-        
-        try {
-            auto body = nlohmann::json::parse(req.body);
-            
-            if (!body.contains("type")) {
-                return crow::response(400, "Missing component type");
-            }
-            
-            std::string type = body["type"];
-            std::string id = body.contains("id") ? body["id"].get<std::string>() : "";
-            
-            // Generate component ID if not provided
-            if (id.empty()) {
-                uuid_t uuid;
-                char uuid_str[37];
-                uuid_generate(uuid);
-                uuid_unparse_lower(uuid, uuid_str);
-                id = std::string(uuid_str);
-            }
-            
-            // Extract config if provided
-            nlohmann::json config = body.contains("config") ? body["config"] : nlohmann::json();
-            
-            // Create the sink component
-            auto sink = ComponentFactory::getInstance().createSinkComponent(
-                id, camera.get(), type, config);
-            
-            if (!sink) {
-                return crow::response(500, "Failed to create sink component");
+
+        // Sink construction can open files or databases
+        respondAsync(res, [this, cameraId, reqBody = req.body]() -> crow::response {
+            auto camera = CameraManager::getInstance().getCamera(cameraId);
+            if (!camera) {
+                return crow::response(404, "Camera not found");
             }
-            
-            // Add to camera
-            if (!camera->addSinkComponent(sink)) {
-                return crow::response(500, "Failed to add sink component to camera");
+
+            try {
+                auto body = nlohmann::json::parse(reqBody);
+
+                if (!body.contains("type")) {
+                    return crow::response(400, "Missing component type");
+                }
+
+                std::string type = body["type"];
+                std::string id = body.contains("id") ? body["id"].get<std::string>() : "";
+
+                // Generate component ID if not provided
+                if (id.empty()) {
+                    uuid_t uuid;
+                    char uuid_str[37];
+                    uuid_generate(uuid);
+                    uuid_unparse_lower(uuid, uuid_str);
+                    id = std::string(uuid_str);
+                }
+
+                // Extract config if provided
+                nlohmann::json config = body.contains("config") ? body["config"] : nlohmann::json();
+
+                // Create the sink component
+                auto sink = ComponentFactory::getInstance().createSinkComponent(
+                    id, camera.get(), type, config);
+
+                if (!sink) {
+                    return crow::response(500, "Failed to create sink component");
+                }
+
+                // Add to camera
+                if (!camera->addSinkComponent(sink)) {
+                    return crow::response(500, "Failed to add sink component to camera");
+                }
+
+                // Save camera configuration
+                scheduleCameraConfigSave(cameraId);
+
+                return createJsonResponse(sink->getStatus(), 201);
+            } catch (const std::exception& e) {
+                return crow::response(400, std::string("Invalid request: ") + e.what());
             }
-            
-            // Save camera configuration
-            saveCameraConfigToDB(cameraId);
-            
-            return createJsonResponse(sink->getStatus(), 201);
-        } catch (const std::exception& e) {
-            return crow::response(400, std::string("Invalid request: ") + e.what());
-        }
+        });
     });
     
     // Get a specific sink component
@@ -2188,67 +3039,71 @@ void Api::setupComponentRoutes() {
     // Update a sink component
     CROW_ROUTE(app_, "/api/v1/cameras/<string>/sinks/<string>")
         .methods("PUT"_method)
-    ([this](const crow::request& req, const std::string& cameraId, const std::string& sinkId) {
-        crow::response res;
+    ([this](const crow::request& req, crow::response& res, const std::string& cameraId, const std::string& sinkId) {
         if (!checkLicense(req, res)) {
-            return res;
-        }
-        
-        auto camera = CameraManager::getInstance().getCamera(cameraId);
-        if (!camera) {
-            return crow::response(404, "Camera not found");
+            res.end();
+            return;
         }
-        
-        auto sink = camera->getSinkComponent(sinkId);
-        if (!sink) {
-            return crow::response(404, "Sink component not found");
-        }
-        
-        try {
-            auto body = nlohmann::json::parse(req.body);
-            
-            // Update config if provided
-            if (body.contains("config")) {
-                if (!sink->updateConfig(body["config"])) {
-                    return crow::response(500, "Failed to update sink component config");
+
+        respondAsync(res, [this, cameraId, sinkId, reqBody = req.body]() -> crow::response {
+            auto camera = CameraManager::getInstance().getCamera(cameraId);
+            if (!camera) {
+                return crow::response(404, "Camera not found");
+            }
+
+            auto sink = camera->getSinkComponent(sinkId);
+            if (!sink) {
+                return crow::response(404, "Sink component not found");
+            }
+
+            try {
+                auto body = nlohmann::json::parse(reqBody);
+
+                // Update config if provided
+                if (body.contains("config")) {
+                    if (!sink->updateConfig(body["config"])) {
+                        return crow::response(500, "Failed to update sink component config");
+                    }
                 }
+
+                // Save camera configuration
+                scheduleCameraConfigSave(cameraId);
+
+                return createJsonResponse(sink->getStatus());
+            } catch (const std::exception& e) {
+                return crow::response(400, std::string("Invalid request: ") + e.what());
             }
-            
-            // Save camera configuration
-            saveCameraConfigToDB(cameraId);
-            
-            return createJsonResponse(sink->getStatus());
-        } catch (const std::exception& e) {
-            return crow::response(400, std::string("Invalid request: ") + e.what());
-        }
+        });
     });
     
     // Delete a sink component
     CROW_ROUTE(app_, "/api/v1/cameras/<string>/sinks/<string>")
         .methods("DELETE"_method)
-    ([this](const crow::request& req, const std::string& cameraId, const std::string& sinkId) {
-        crow::response res;
+    ([this](const crow::request& req, crow::response& res, const std::string& cameraId, const std::string& sinkId) {
         if (!checkLicense(req, res)) {
-            return res;
+            res.end();
+            return;
         }
-        
-        auto camera = CameraManager::getInstance().getCamera(cameraId);
-        if (!camera) {
-            return crow::response(404, "Camera not found");
-        }
-        
-        if (!camera->removeSinkComponent(sinkId)) {
-            return crow::response(404, "Sink component not found");
-        }
-        
-        // Save camera configuration
-        saveCameraConfigToDB(cameraId);
-        
-        nlohmann::json response;
-        response["success"] = true;
-        response["message"] = "Sink component deleted";
-        
-        return createJsonResponse(response);
+
+        respondAsync(res, [this, cameraId, sinkId]() -> crow::response {
+            auto camera = CameraManager::getInstance().getCamera(cameraId);
+            if (!camera) {
+                return crow::response(404, "Camera not found");
+            }
+
+            if (!camera->removeSinkComponent(sinkId)) {
+                return crow::response(404, "Sink component not found");
+            }
+
+            // Save camera configuration
+            scheduleCameraConfigSave(cameraId);
+
+            nlohmann::json response;
+            response["success"] = true;
+            response["message"] = "Sink component deleted";
+
+            return createJsonResponse(response);
+        });
     });
 }
 
@@ -2442,6 +3297,155 @@ void Api::setupDatabaseRoutes() {
         }
     });
 
+    // Cursor-paginated event export. Rows are serialized straight from the
+    // SQLite cursor into the response body (see DatabaseSink::streamEvents),
+    // so a full-table export is a series of flat-memory pages instead of one
+    // giant in-memory JSON array
+    CROW_ROUTE(app_, "/api/v1/cameras/<string>/database/events")
+        .methods("GET"_method)
+    ([this](const crow::request& req, const std::string& cameraId) {
+        crow::response res;
+        if (!checkLicense(req, res)) {
+            return res;
+        }
+
+        auto camera = CameraManager::getInstance().getCamera(cameraId);
+        if (!camera) {
+            return crow::response(404, "Camera not found");
+        }
+
+        // Find the database sink for this camera
+        std::shared_ptr<DatabaseSink> dbSink = nullptr;
+        for (const auto& sink : camera->getSinkComponents()) {
+            auto db = std::dynamic_pointer_cast<DatabaseSink>(sink);
+            if (db) {
+                dbSink = db;
+                break;
+            }
+        }
+
+        if (!dbSink) {
+            return crow::response(404, "No database sink found for this camera");
+        }
+
+        int64_t cursor = 0;
+        int limit = 500;
+        int64_t start_time = 0;
+        int64_t end_time = 0;
+
+        auto cursorParam = req.url_params.get("cursor");
+        if (cursorParam) {
+            try {
+                cursor = std::stoll(cursorParam);
+            } catch (...) {
+                // Ignore parsing errors, use default
+            }
+        }
+
+        auto limitParam = req.url_params.get("limit");
+        if (limitParam) {
+            try {
+                limit = std::stoi(limitParam);
+            } catch (...) {
+                // Ignore parsing errors, use default
+            }
+        }
+
+        auto startParam = req.url_params.get("start_time");
+        if (startParam) {
+            try {
+                start_time = std::stoll(startParam);
+            } catch (...) {
+                // Ignore parsing errors, use default
+            }
+        }
+
+        auto endParam = req.url_params.get("end_time");
+        if (endParam) {
+            try {
+                end_time = std::stoll(endParam);
+            } catch (...) {
+                // Ignore parsing errors, use default
+            }
+        }
+
+        try {
+            crow::response resp;
+            resp.set_header("Content-Type", "application/json");
+            resp.body = dbSink->streamEvents(cameraId, cursor, limit, start_time, end_time);
+            return resp;
+        } catch (const std::exception& e) {
+            return crow::response(500, std::string("Event export error: ") + e.what());
+        }
+    });
+
+    // Columnar bulk export for offline analytics. One request returns the
+    // whole time range as dictionary-encoded column blocks (see
+    // DatabaseSink::exportEventsColumnar) — a few MB per day of events
+    // instead of paging hundreds of MB of JSON through the route above
+    CROW_ROUTE(app_, "/api/v1/cameras/<string>/database/events/export")
+        .methods("GET"_method)
+    ([this](const crow::request& req, const std::string& cameraId) {
+        crow::response res;
+        if (!checkLicense(req, res)) {
+            return res;
+        }
+
+        auto camera = CameraManager::getInstance().getCamera(cameraId);
+        if (!camera) {
+            return crow::response(404, "Camera not found");
+        }
+
+        // Find the database sink for this camera
+        std::shared_ptr<DatabaseSink> dbSink = nullptr;
+        for (const auto& sink : camera->getSinkComponents()) {
+            auto db = std::dynamic_pointer_cast<DatabaseSink>(sink);
+            if (db) {
+                dbSink = db;
+                break;
+            }
+        }
+
+        if (!dbSink) {
+            return crow::response(404, "No database sink found for this camera");
+        }
+
+        int64_t start_time = 0;
+        int64_t end_time = 0;
+
+        auto startParam = req.url_params.get("start_time");
+        if (startParam) {
+            try {
+                start_time = std::stoll(startParam);
+            } catch (...) {
+                // Ignore parsing errors, use default
+            }
+        }
+
+        auto endParam = req.url_params.get("end_time");
+        if (endParam) {
+            try {
+                end_time = std::stoll(endParam);
+            } catch (...) {
+                // Ignore parsing errors, use default
+            }
+        }
+
+        try {
+            crow::response resp;
+            resp.set_header("Content-Type", "application/octet-stream");
+            resp.set_header("Content-Disposition",
+                            "attachment; filename=\"" + cameraId + "-events.tapc\"");
+            resp.body = dbSink->exportEventsColumnar(cameraId, start_time, end_time);
+            if (resp.body.empty()) {
+                return crow::response(500, "Columnar export failed");
+            }
+            return resp;
+        } catch (const std::exception& e) {
+            return crow::response(500, std::string("Columnar export error: ") + e.what());
+        }
+    });
+
     // Get dwell time analytics data for visualizations
     CROW_ROUTE(app_, "/api/v1/cameras/<string>/database/dwell-time")
         .methods("GET"_method)
@@ -2733,14 +3737,11 @@ void Api::setupDatabaseRoutes() {
             std::vector<std::string> classFilter;
             auto classFilterParam = req.url_params.get("class");
             if (classFilterParam) {
-                // Parse comma-separated list of classes
-                std::string classFilterStr = classFilterParam;
-                std::istringstream classStream(classFilterStr);
-                std::string className;
-                
-                while (std::getline(classStream, className, ',')) {
+                // Parse comma-separated list of classes without a stringstream
+                for (std::string_view className : utils::splitView(classFilterParam, ',')) {
+                    className = utils::trimView(className);
                     if (!className.empty()) {
-                        classFilter.push_back(className);
+                        classFilter.emplace_back(className);
                     }
                 }
             }
@@ -2968,6 +3969,82 @@ void Api::setupDatabaseRoutes() {
 }
 
 void Api::setupManagementRoutes() {
+    // Prometheus scrape endpoint for the per-stage latency histograms.
+    // Deliberately unauthenticated (like a conventional exporter) and
+    // cheap: rendering reads a registry snapshot without touching the
+    // frame path.
+    CROW_ROUTE(app_, "/metrics")
+        .methods("GET"_method)
+    ([]() {
+        std::string body = LatencyMetrics::getInstance().renderPrometheus();
+
+        // Frame memory budget gauges (shed counters live in the registry
+        // as tapi_frame_budget_shed_total)
+        auto& budget = utils::FrameMemoryBudget::getInstance();
+        body += "# TYPE tapi_frame_budget_bytes gauge\n";
+        body += "tapi_frame_budget_bytes " + std::to_string(budget.budgetBytes()) + "\n";
+        body += "# TYPE tapi_frame_budget_used_bytes gauge\n";
+        body += "tapi_frame_budget_used_bytes " + std::to_string(budget.usedBytes()) + "\n";
+
+        // Vector tier the SIMD kernels selected at startup (avx2/neon/
+        // scalar), so boxes silently running the scalar fallbacks show up
+        // in fleet dashboards
+        body += "# TYPE tapi_simd_tier gauge\n";
+        body += std::string("tapi_simd_tier{tier=\"") + cpu::simdTier() + "\"} 1\n";
+
+        // Quality governor escalation level (shed counters live in the
+        // registry as tapi_governor_shed_total)
+        auto& governor = utils::QualityGovernor::getInstance();
+        body += "# TYPE tapi_governor_level gauge\n";
+        body += "tapi_governor_level " + std::to_string(governor.level()) + "\n";
+
+        // Per-subscriber telemetry fan-out lag: how far each WebSocket
+        // consumer trails the publish head, and what it has dropped
+        auto subscriberStats = TelemetryBroadcaster::getInstance().getSubscriberStats();
+        if (!subscriberStats.empty()) {
+            body += "# TYPE tapi_telemetry_subscriber_pending_events gauge\n";
+            body += "# TYPE tapi_telemetry_subscriber_dropped_total counter\n";
+            for (const auto& entry : subscriberStats) {
+                const std::string label = "subscriber=\"" + std::to_string(entry["id"].get<uint64_t>()) + "\"";
+                body += "tapi_telemetry_subscriber_pending_events{" + label + "} " +
+                        std::to_string(entry["pending_events"].get<size_t>()) + "\n";
+                body += "tapi_telemetry_subscriber_dropped_total{" + label + "} " +
+                        std::to_string(entry["dropped_total"].get<uint64_t>()) + "\n";
+            }
+        }
+
+        // Per-component pipeline counters, copied out of each component's
+        // seqlock-published block. Camera enumeration rides the RCU
+        // snapshot and the copies never block the frame loop, so scraping
+        // stays invisible to the pipeline
+        auto cameras = CameraManager::getInstance().getAllCameras();
+        if (cameras && !cameras->empty()) {
+            body += "# TYPE tapi_component_frames_total counter\n";
+            body += "# TYPE tapi_component_items_total counter\n";
+            body += "# TYPE tapi_component_fps gauge\n";
+            for (const auto& camera : *cameras) {
+                for (const auto& component : camera->getAllComponents()) {
+                    const auto block = component->stats().read();
+                    if (block.framesProcessed == 0) {
+                        continue;
+                    }
+                    const std::string labels = "{camera=\"" + camera->getId() +
+                        "\",component=\"" + component->getId() + "\"}";
+                    body += "tapi_component_frames_total" + labels + " " +
+                            std::to_string(block.framesProcessed) + "\n";
+                    body += "tapi_component_items_total" + labels + " " +
+                            std::to_string(block.itemsEmitted) + "\n";
+                    body += "tapi_component_fps" + labels + " " +
+                            std::to_string(block.fps) + "\n";
+                }
+            }
+        }
+
+        crow::response res(std::move(body));
+        res.set_header("Content-Type", "text/plain; version=0.0.4; charset=utf-8");
+        return res;
+    });
+
     // Get current log level
     CROW_ROUTE(app_, "/api/v1/system/log-level")
         .methods("GET"_method)
@@ -3082,6 +4159,9 @@ void Api::setupBackgroundTaskRoutes() {
                 case BackgroundTaskManager::TaskStatus::State::FAILED:
                     stateStr = "failed";
                     break;
+                case BackgroundTaskManager::TaskStatus::State::CANCELLED:
+                    stateStr = "cancelled";
+                    break;
                 default:
                     stateStr = "unknown";
             }
@@ -3142,6 +4222,9 @@ void Api::setupBackgroundTaskRoutes() {
             case BackgroundTaskManager::TaskStatus::State::FAILED:
                 stateStr = "failed";
                 break;
+            case BackgroundTaskManager::TaskStatus::State::CANCELLED:
+                stateStr = "cancelled";
+                break;
             default:
                 stateStr = "unknown";
         }
@@ -3226,32 +4309,109 @@ void Api::setupBackgroundTaskRoutes() {
             return createJsonResponse(errorResponse, 500);
         }
     });
+
+    // Cancel a pending or running task
+    CROW_ROUTE(app_, "/api/v1/tasks/<string>")
+        .methods(crow::HTTPMethod::Delete)
+    ([this](const crow::request& req, const std::string& taskId) {
+        crow::response res;
+        if (!checkLicense(req, res)) {
+            return res;
+        }
+
+        nlohmann::json response;
+        if (BackgroundTaskManager::getInstance().cancelTask(taskId)) {
+            response["success"] = true;
+            response["message"] = "Task cancellation requested";
+            return createJsonResponse(response);
+        }
+
+        response["success"] = false;
+        response["message"] = "Task not found or already finished";
+        return createJsonResponse(response, 404);
+    });
+}
+
+// How long a published license snapshot stays fresh before a background
+// refresh is scheduled. License mutations refresh the snapshot directly,
+// so this only bounds how quickly out-of-band state changes are noticed.
+static constexpr long long LICENSE_SNAPSHOT_TTL_SECONDS = 30;
+
+// How long camera config saves are debounced before the dirty set is
+// written in one transactional batch. Long enough to coalesce a
+// dashboard "apply" touching many components, short enough that changes
+// hit disk promptly.
+static constexpr int CAMERA_CONFIG_SAVE_DEBOUNCE_MS = 200;
+
+void Api::refreshLicenseSnapshot() {
+    bool initialized = CameraManager::getInstance().isInitialized();
+    bool valid = initialized && CameraManager::getInstance().getLicenseManager().isValid();
+
+    licenseSnapshotReady_.store(initialized, std::memory_order_relaxed);
+    licenseSnapshotValid_.store(valid, std::memory_order_relaxed);
+
+    auto now = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    licenseSnapshotExpiry_.store(now + LICENSE_SNAPSHOT_TTL_SECONDS, std::memory_order_release);
+    licenseRefreshInFlight_.store(false, std::memory_order_release);
 }
 
 bool Api::checkLicense(const crow::request& req, crow::response& res) {
+    // Serve the cached validity snapshot so steady dashboard polling does
+    // not take the camera manager mutex on every request. The snapshot is
+    // refreshed off the request thread once it passes its deadline.
+    auto now = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    long long expiry = licenseSnapshotExpiry_.load(std::memory_order_acquire);
+    if (now >= expiry) {
+        if (expiry == 0) {
+            // First request after startup: populate synchronously so we
+            // don't reject valid traffic with a default-invalid snapshot
+            refreshLicenseSnapshot();
+        } else if (!licenseRefreshInFlight_.exchange(true)) {
+            // Stale snapshot: keep serving it and refresh in the background
+            BackgroundTaskManager::getInstance().submitTask(
+                "license_snapshot_refresh",
+                "system",
+                [this](std::function<void(double, std::string)> progressCallback) -> bool {
+                    refreshLicenseSnapshot();
+                    progressCallback(100.0, "License snapshot refreshed");
+                    return true;
+                },
+                BackgroundTaskManager::TaskPriority::LATENCY_CRITICAL);
+        }
+    }
+
     // Check if camera manager is initialized AND license is valid
-    if (!CameraManager::getInstance().isInitialized()) {
+    if (!licenseSnapshotReady_.load(std::memory_order_relaxed)) {
         res = crow::response(500, "Camera manager not initialized");
         return false;
     }
-    
+
     // Additionally check if we have a valid license
-    const auto& licenseManager = CameraManager::getInstance().getLicenseManager();
-    if (!licenseManager.isValid()) {
+    if (!licenseSnapshotValid_.load(std::memory_order_relaxed)) {
         nlohmann::json errorResponse;
         errorResponse["valid"] = false;
         errorResponse["message"] = "No valid license found";
         errorResponse["error"] = "license_required";
-        
+
         res = crow::response(401, errorResponse.dump(2));
         res.set_header("Content-Type", "application/json");
         return false;
     }
-    
+
     return true;
 }
 
 void Api::start(bool threaded) {
+    // Live MJPEG streams are served from a dedicated port next to the REST
+    // port, since Crow cannot flush multipart responses incrementally
+    mjpegStreamer_ = std::make_unique<MjpegStreamer>(port_ + 1);
+    if (!mjpegStreamer_->start()) {
+        LOG_WARN("API", "MJPEG streaming server failed to start; stream endpoint unavailable");
+        mjpegStreamer_.reset();
+    }
+
     std::cout << "Starting API server on port " << port_ << std::endl;
     if (threaded) {
         app_.multithreaded().run();
@@ -3262,57 +4422,72 @@ void Api::start(bool threaded) {
 
 void Api::stop() {
     std::cout << "Stopping API server..." << std::endl;
+    // Persist any config changes still inside their debounce window
+    flushDirtyCameraConfigs();
+    if (mjpegStreamer_) {
+        mjpegStreamer_->stop();
+    }
+    TelemetryBroadcaster::getInstance().shutdown();
     app_.stop();
 }
 
+bool Api::buildCameraConfigJson(const std::string& cameraId, nlohmann::json& config) {
+    auto camera = CameraManager::getInstance().getCamera(cameraId);
+    if (!camera) {
+        return false;
+    }
+
+    // Build the configuration JSON
+    config = nlohmann::json::object();
+    config["id"] = camera->getId();
+    config["name"] = camera->getName();
+    config["running"] = camera->isRunning();
+
+    // Save source component
+    auto source = camera->getSourceComponent();
+    if (source) {
+        // Get the component status but sanitize it to ensure type consistency
+        nlohmann::json sourceJson = source->getStatus();
+        sanitizeComponentJson(sourceJson);
+        config["source"] = sourceJson;
+    } else {
+        config["source"] = nullptr;
+    }
+
+    // Save processor components
+    nlohmann::json processors = nlohmann::json::array();
+    for (const auto& processor : camera->getProcessorComponents()) {
+        nlohmann::json processorJson = processor->getStatus();
+        sanitizeComponentJson(processorJson);
+        processors.push_back(processorJson);
+    }
+    config["processors"] = processors;
+
+    // Save sink components
+    nlohmann::json sinks = nlohmann::json::array();
+    for (const auto& sink : camera->getSinkComponents()) {
+        nlohmann::json sinkJson = sink->getStatus();
+        sanitizeComponentJson(sinkJson);
+        sinks.push_back(sinkJson);
+    }
+    config["sinks"] = sinks;
+
+    return true;
+}
+
 bool Api::saveCameraConfigToDB(const std::string& cameraId) {
     if (!ConfigManager::getInstance().isReady()) {
         LOG_ERROR("API", "Configuration database is not initialized");
         return false;
     }
-    
-    auto camera = CameraManager::getInstance().getCamera(cameraId);
-    if (!camera) {
-        LOG_ERROR("API", "Cannot save configuration for non-existent camera: " + cameraId);
-        return false;
-    }
-    
+
     try {
-        // Build the configuration JSON
         nlohmann::json cameraConfig;
-        cameraConfig["id"] = camera->getId();
-        cameraConfig["name"] = camera->getName();
-        cameraConfig["running"] = camera->isRunning();
-        
-        // Save source component
-        auto source = camera->getSourceComponent();
-        if (source) {
-            // Get the component status but sanitize it to ensure type consistency
-            nlohmann::json sourceJson = source->getStatus();
-            sanitizeComponentJson(sourceJson);
-            cameraConfig["source"] = sourceJson;
-        } else {
-            cameraConfig["source"] = nullptr;
-        }
-        
-        // Save processor components
-        nlohmann::json processors = nlohmann::json::array();
-        for (const auto& processor : camera->getProcessorComponents()) {
-            nlohmann::json processorJson = processor->getStatus();
-            sanitizeComponentJson(processorJson);
-            processors.push_back(processorJson);
-        }
-        cameraConfig["processors"] = processors;
-        
-        // Save sink components
-        nlohmann::json sinks = nlohmann::json::array();
-        for (const auto& sink : camera->getSinkComponents()) {
-            nlohmann::json sinkJson = sink->getStatus();
-            sanitizeComponentJson(sinkJson);
-            sinks.push_back(sinkJson);
+        if (!buildCameraConfigJson(cameraId, cameraConfig)) {
+            LOG_ERROR("API", "Cannot save configuration for non-existent camera: " + cameraId);
+            return false;
         }
-        cameraConfig["sinks"] = sinks;
-        
+
         // Save to the database
         bool success = ConfigManager::getInstance().saveCameraConfig(cameraId, cameraConfig);
         if (success) {
@@ -3320,7 +4495,7 @@ bool Api::saveCameraConfigToDB(const std::string& cameraId) {
         } else {
             LOG_ERROR("API", "Failed to save configuration for camera: " + cameraId);
         }
-        
+
         return success;
     } catch (const std::exception& e) {
         LOG_ERROR("API", "Exception while saving camera config: " + std::string(e.what()));
@@ -3328,6 +4503,75 @@ bool Api::saveCameraConfigToDB(const std::string& cameraId) {
     }
 }
 
+void Api::scheduleCameraConfigSave(const std::string& cameraId) {
+    {
+        std::lock_guard<std::mutex> lock(dirtyConfigMutex_);
+        dirtyCameraConfigs_.insert(cameraId);
+    }
+
+    // Arm one flush task per debounce window; further saves within the
+    // window just add to the dirty set
+    if (!configFlushScheduled_.exchange(true)) {
+        BackgroundTaskManager::getInstance().submitTask(
+            "camera_config_flush", "camera_configs",
+            [this](std::function<void(double, std::string)> progressCallback) -> bool {
+                progressCallback(0.0, "Waiting for config debounce window");
+                std::this_thread::sleep_for(std::chrono::milliseconds(CAMERA_CONFIG_SAVE_DEBOUNCE_MS));
+                bool success = flushDirtyCameraConfigs();
+                progressCallback(100.0, success ? "Camera configurations saved"
+                                                : "Failed to save camera configurations");
+                return success;
+            },
+            BackgroundTaskManager::TaskPriority::LATENCY_CRITICAL);
+    }
+}
+
+bool Api::flushDirtyCameraConfigs() {
+    std::unordered_set<std::string> toSave;
+    {
+        // Swap out the dirty set and disarm the flush guard together, so a
+        // camera marked dirty after this point always arms a new flush
+        std::lock_guard<std::mutex> lock(dirtyConfigMutex_);
+        toSave.swap(dirtyCameraConfigs_);
+        configFlushScheduled_.store(false);
+    }
+
+    if (toSave.empty()) {
+        return true;
+    }
+
+    if (!ConfigManager::getInstance().isReady()) {
+        LOG_ERROR("API", "Configuration database is not initialized");
+        return false;
+    }
+
+    std::vector<std::pair<std::string, nlohmann::json>> configs;
+    configs.reserve(toSave.size());
+
+    for (const auto& cameraId : toSave) {
+        try {
+            nlohmann::json cameraConfig;
+            if (buildCameraConfigJson(cameraId, cameraConfig)) {
+                configs.emplace_back(cameraId, std::move(cameraConfig));
+            } else {
+                // Camera was removed while its save was pending; nothing to persist
+                LOG_DEBUG("API", "Skipping config save for removed camera: " + cameraId);
+            }
+        } catch (const std::exception& e) {
+            LOG_ERROR("API", "Exception while building config for camera " + cameraId + ": " + std::string(e.what()));
+        }
+    }
+
+    bool success = ConfigManager::getInstance().saveCameraConfigs(configs);
+    if (success) {
+        LOG_INFO("API", "Flushed configuration for " + std::to_string(configs.size()) + " camera(s)");
+    } else {
+        LOG_ERROR("API", "Failed to flush camera configurations");
+    }
+
+    return success;
+}
+
 // Helper method to sanitize component JSON to ensure consistent types
 void Api::sanitizeComponentJson(nlohmann::json& componentJson) {
     // Ensure id is a string
@@ -4021,7 +5265,7 @@ int Api::enforceLicenseRestrictions() {
     LicenseTier currentTier = CameraManager::getInstance().getLicenseManager().getLicenseTier();
     auto& permHelper = ComponentPermissionHelper::getInstance();
     
-    for (const auto& camera : cameras) {
+    for (const auto& camera : *cameras) {
         bool hasViolation = false;
         std::vector<std::string> violatingComponents;
         
@@ -4087,7 +5331,7 @@ int Api::enforceLicenseRestrictions() {
             stoppedCamerasCount++;
             
             // Update camera configuration in database to reflect stopped state
-            saveCameraConfigToDB(camera->getId());
+            scheduleCameraConfigSave(camera->getId());
         }
     }
     
@@ -1,15 +1,36 @@
 #include "api.h"
 #include "logger.h"
 #include <uuid/uuid.h>
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
 namespace tapi {
 
+// Pool sizing: one worker is reserved for latency-critical tasks, the rest
+// share bulk work. Bulk tasks (camera restores, ONVIF scans) spend most of
+// their time blocked on the network, so the pool tracks core count rather
+// than staying fixed — a full-fleet restore should fan out, not queue.
+static const size_t BULK_WORKER_COUNT = []() {
+    size_t cores = std::thread::hardware_concurrency();
+    return std::max<size_t>(3, std::min<size_t>(cores, 16));
+}();
+
+// Thrown from the progress callback to unwind a cancelled or timed-out
+// task at its next progress report
+struct TaskCancelledError : public std::runtime_error {
+    explicit TaskCancelledError(const std::string& reason) : std::runtime_error(reason) {}
+};
+
 BackgroundTaskManager::BackgroundTaskManager() : running_(true) {
-    // Start the worker thread
-    workerThread_ = std::thread(&BackgroundTaskManager::workerThread, this);
-    LOG_INFO("BackgroundTaskManager", "Background task manager started");
+    // Start the worker pool: one latency-only worker plus the bulk workers
+    // (which also drain the latency queue when it has work)
+    workerThreads_.emplace_back(&BackgroundTaskManager::workerThread, this, true);
+    for (size_t i = 0; i < BULK_WORKER_COUNT; ++i) {
+        workerThreads_.emplace_back(&BackgroundTaskManager::workerThread, this, false);
+    }
+    LOG_INFO("BackgroundTaskManager", "Background task manager started with " +
+             std::to_string(workerThreads_.size()) + " workers");
 }
 
 void BackgroundTaskManager::shutdown() {
@@ -20,28 +41,32 @@ void BackgroundTaskManager::shutdown() {
         }
         running_ = false;
     }
-    
+
     cv_.notify_all();
-    
-    if (workerThread_.joinable()) {
-        workerThread_.join();
+
+    for (auto& worker : workerThreads_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
     }
-    
+
     LOG_INFO("BackgroundTaskManager", "Background task manager shut down");
 }
 
 std::string BackgroundTaskManager::submitTask(
-    std::string taskType, 
-    std::string targetId, 
-    std::function<bool(std::function<void(double, std::string)>)> taskFunc) {
-    
+    std::string taskType,
+    std::string targetId,
+    std::function<bool(std::function<void(double, std::string)>)> taskFunc,
+    TaskPriority priority,
+    int timeoutSecs) {
+
     // Generate a task ID
     uuid_t uuid;
     char uuid_str[37];
     uuid_generate(uuid);
     uuid_unparse_lower(uuid, uuid_str);
     std::string taskId = std::string(uuid_str);
-    
+
     // Create task status
     TaskStatus status;
     status.state = TaskStatus::State::PENDING;
@@ -52,38 +77,103 @@ std::string BackgroundTaskManager::submitTask(
     status.message = "Task pending";
     status.createdAt = std::chrono::system_clock::now();
     status.updatedAt = status.createdAt;
-    
+
     // Add task to queue
     {
         std::lock_guard<std::mutex> lock(mutex_);
         taskStatuses_[taskId] = status;
-        
+
         Task task;
         task.id = taskId;
         task.type = taskType;
         task.targetId = targetId;
         task.func = taskFunc;
         task.createdAt = status.createdAt;
-        
-        taskQueue_.push(task);
+        task.priority = priority;
+        task.timeoutSecs = timeoutSecs;
+        task.cancelRequested = std::make_shared<std::atomic<bool>>(false);
+        cancelFlags_[taskId] = task.cancelRequested;
+
+        if (priority == TaskPriority::LATENCY_CRITICAL) {
+            latencyQueue_.push(task);
+        } else {
+            bulkQueue_.push(task);
+        }
     }
-    
-    // Notify worker thread
-    cv_.notify_one();
-    
+
+    // Notify worker threads
+    cv_.notify_all();
+
     LOG_INFO("BackgroundTaskManager", "Task submitted: " + taskId + " [" + taskType + "] for " + targetId);
-    
+
     return taskId;
 }
 
+void BackgroundTaskManager::runDetached(std::function<void()> fn, TaskPriority priority) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        Task task;
+        task.func = [fn = std::move(fn)](std::function<void(double, std::string)>) -> bool {
+            fn();
+            return true;
+        };
+        task.createdAt = std::chrono::system_clock::now();
+        task.priority = priority;
+        task.timeoutSecs = 0;
+        task.tracked = false;
+
+        if (priority == TaskPriority::LATENCY_CRITICAL) {
+            latencyQueue_.push(std::move(task));
+        } else {
+            bulkQueue_.push(std::move(task));
+        }
+    }
+
+    cv_.notify_all();
+}
+
+bool BackgroundTaskManager::cancelTask(const std::string& taskId) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = taskStatuses_.find(taskId);
+    if (it == taskStatuses_.end()) {
+        return false;
+    }
+
+    auto flagIt = cancelFlags_.find(taskId);
+    switch (it->second.state) {
+        case TaskStatus::State::PENDING:
+            // Pending tasks are cancelled outright; the worker skips them
+            // when they reach the front of the queue
+            if (flagIt != cancelFlags_.end()) {
+                flagIt->second->store(true);
+            }
+            it->second.state = TaskStatus::State::CANCELLED;
+            it->second.message = "Task cancelled before it started";
+            it->second.updatedAt = std::chrono::system_clock::now();
+            return true;
+        case TaskStatus::State::RUNNING:
+            // Running tasks unwind at their next progress report
+            if (flagIt != cancelFlags_.end()) {
+                flagIt->second->store(true);
+            }
+            LOG_INFO("BackgroundTaskManager", "Cancellation requested for running task: " + taskId);
+            return true;
+        default:
+            // Already finished
+            return false;
+    }
+}
+
 BackgroundTaskManager::TaskStatus BackgroundTaskManager::getTaskStatus(const std::string& taskId) {
     std::lock_guard<std::mutex> lock(mutex_);
-    
+
     auto it = taskStatuses_.find(taskId);
     if (it != taskStatuses_.end()) {
         return it->second;
     }
-    
+
     // Return an empty status if not found
     TaskStatus emptyStatus;
     emptyStatus.state = TaskStatus::State::FAILED;
@@ -94,84 +184,132 @@ BackgroundTaskManager::TaskStatus BackgroundTaskManager::getTaskStatus(const std
 
 std::vector<BackgroundTaskManager::TaskStatus> BackgroundTaskManager::getAllTasks() {
     std::lock_guard<std::mutex> lock(mutex_);
-    
+
     std::vector<TaskStatus> tasks;
     for (const auto& pair : taskStatuses_) {
         tasks.push_back(pair.second);
     }
-    
+
     return tasks;
 }
 
 void BackgroundTaskManager::cleanupOldTasks(int maxAgeSecs) {
     std::lock_guard<std::mutex> lock(mutex_);
-    
+
     auto now = std::chrono::system_clock::now();
     std::vector<std::string> tasksToRemove;
-    
+
     for (const auto& pair : taskStatuses_) {
         const auto& status = pair.second;
-        
-        // Only clean up completed or failed tasks
-        if (status.state == TaskStatus::State::COMPLETED || 
-            status.state == TaskStatus::State::FAILED) {
-            
+
+        // Only clean up completed, failed or cancelled tasks
+        if (status.state == TaskStatus::State::COMPLETED ||
+            status.state == TaskStatus::State::FAILED ||
+            status.state == TaskStatus::State::CANCELLED) {
+
             auto age = std::chrono::duration_cast<std::chrono::seconds>(
                 now - status.updatedAt).count();
-                
+
             if (age > maxAgeSecs) {
                 tasksToRemove.push_back(status.taskId);
             }
         }
     }
-    
+
     for (const auto& taskId : tasksToRemove) {
         taskStatuses_.erase(taskId);
+        cancelFlags_.erase(taskId);
     }
-    
+
     if (!tasksToRemove.empty()) {
         LOG_INFO("BackgroundTaskManager", "Cleaned up " + std::to_string(tasksToRemove.size()) + " old tasks");
     }
 }
 
-void BackgroundTaskManager::workerThread() {
+void BackgroundTaskManager::workerThread(bool latencyOnly) {
     while (running_) {
         Task currentTask;
-        
+        bool haveTask = false;
+
         // Wait for a task to be available
         {
             std::unique_lock<std::mutex> lock(mutex_);
-            cv_.wait(lock, [this] { 
-                return !running_ || !taskQueue_.empty(); 
+            cv_.wait(lock, [this, latencyOnly] {
+                return !running_ || !latencyQueue_.empty() ||
+                       (!latencyOnly && !bulkQueue_.empty());
             });
-            
+
             if (!running_) {
                 break;
             }
-            
-            if (!taskQueue_.empty()) {
-                currentTask = taskQueue_.front();
-                taskQueue_.pop();
-                
-                // Update status to running
+
+            // Latency-critical work always goes first; the reserved worker
+            // never touches the bulk queue
+            if (!latencyQueue_.empty()) {
+                currentTask = latencyQueue_.front();
+                latencyQueue_.pop();
+                haveTask = true;
+            } else if (!latencyOnly && !bulkQueue_.empty()) {
+                currentTask = bulkQueue_.front();
+                bulkQueue_.pop();
+                haveTask = true;
+            }
+
+            if (haveTask && currentTask.tracked) {
+                // Skip tasks that were cancelled while pending
                 auto& status = taskStatuses_[currentTask.id];
+                if (status.state == TaskStatus::State::CANCELLED) {
+                    continue;
+                }
+
+                // Update status to running
                 status.state = TaskStatus::State::RUNNING;
                 status.message = "Task running";
                 status.updatedAt = std::chrono::system_clock::now();
             }
         }
-        
-        if (currentTask.id.empty()) {
+
+        if (!haveTask) {
             continue;
         }
-        
+
+        if (!currentTask.tracked) {
+            // Detached work: no status entry and no cancellation
+            // checkpoints — just keep exceptions from killing the worker
+            try {
+                currentTask.func([](double, std::string) {});
+            } catch (const std::exception& e) {
+                LOG_ERROR("BackgroundTaskManager",
+                          "Detached task failed with exception: " + std::string(e.what()));
+            } catch (...) {
+                LOG_ERROR("BackgroundTaskManager", "Detached task failed with unknown exception");
+            }
+            continue;
+        }
+
         LOG_INFO("BackgroundTaskManager", "Starting task: " + currentTask.id);
-        
+
+        auto startTime = std::chrono::steady_clock::now();
+
         // Execute the task
         bool success = false;
         try {
-            // Create progress callback
-            auto progressCallback = [this, &currentTask](double progress, std::string message) {
+            // Create progress callback; it doubles as the cooperative
+            // cancellation and timeout checkpoint
+            auto cancelFlag = currentTask.cancelRequested;
+            int timeoutSecs = currentTask.timeoutSecs;
+            auto progressCallback = [this, &currentTask, cancelFlag, timeoutSecs, startTime](double progress, std::string message) {
+                if (cancelFlag && cancelFlag->load()) {
+                    throw TaskCancelledError("Task cancelled");
+                }
+                if (timeoutSecs > 0) {
+                    auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(
+                        std::chrono::steady_clock::now() - startTime).count();
+                    if (elapsed >= timeoutSecs) {
+                        throw TaskCancelledError("Task timed out after " + std::to_string(elapsed) + "s");
+                    }
+                }
+
                 std::lock_guard<std::mutex> lock(mutex_);
                 auto it = taskStatuses_.find(currentTask.id);
                 if (it != taskStatuses_.end()) {
@@ -180,10 +318,10 @@ void BackgroundTaskManager::workerThread() {
                     it->second.updatedAt = std::chrono::system_clock::now();
                 }
             };
-            
+
             // Run the task function with progress callback
             success = currentTask.func(progressCallback);
-            
+
             // Update status based on result
             {
                 std::lock_guard<std::mutex> lock(mutex_);
@@ -200,10 +338,22 @@ void BackgroundTaskManager::workerThread() {
                     it->second.updatedAt = std::chrono::system_clock::now();
                 }
             }
-            
-            LOG_INFO("BackgroundTaskManager", "Task " + currentTask.id + " " + 
+
+            LOG_INFO("BackgroundTaskManager", "Task " + currentTask.id + " " +
                     (success ? "completed successfully" : "failed"));
         }
+        catch (const TaskCancelledError& e) {
+            // Cooperative cancellation or timeout unwound the task
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = taskStatuses_.find(currentTask.id);
+            if (it != taskStatuses_.end()) {
+                it->second.state = TaskStatus::State::CANCELLED;
+                it->second.message = e.what();
+                it->second.updatedAt = std::chrono::system_clock::now();
+            }
+
+            LOG_INFO("BackgroundTaskManager", "Task " + currentTask.id + " cancelled: " + e.what());
+        }
         catch (const std::exception& e) {
             // Handle exceptions from task
             std::lock_guard<std::mutex> lock(mutex_);
@@ -213,8 +363,8 @@ void BackgroundTaskManager::workerThread() {
                 it->second.message = "Task failed with exception: " + std::string(e.what());
                 it->second.updatedAt = std::chrono::system_clock::now();
             }
-            
-            LOG_ERROR("BackgroundTaskManager", "Task " + currentTask.id + 
+
+            LOG_ERROR("BackgroundTaskManager", "Task " + currentTask.id +
                      " failed with exception: " + e.what());
         }
         catch (...) {
@@ -226,11 +376,11 @@ void BackgroundTaskManager::workerThread() {
                 it->second.message = "Task failed with unknown exception";
                 it->second.updatedAt = std::chrono::system_clock::now();
             }
-            
-            LOG_ERROR("BackgroundTaskManager", "Task " + currentTask.id + 
+
+            LOG_ERROR("BackgroundTaskManager", "Task " + currentTask.id +
                      " failed with unknown exception");
         }
     }
 }
 
-} // namespace tapi 
\ No newline at end of file
+} // namespace tapi
@@ -2,6 +2,7 @@
 #include "billing/billing_config.h"
 #include <crow/logging.h>
 #include <nlohmann/json.hpp>
+#include <zlib.h>
 #include <sstream>
 #include <thread>
 #include <chrono>
@@ -113,6 +114,67 @@ std::optional<std::string> BillingHttpClient::httpPost(const std::string& endpoi
     return response_data;
 }
 
+std::optional<std::string> BillingHttpClient::httpPostDeflate(const std::string& endpoint, const std::string& json_body) {
+    // zlib-compress the body; usage batches are highly repetitive JSON and
+    // typically shrink 20-50x
+    uLongf compressed_size = compressBound(static_cast<uLong>(json_body.size()));
+    std::string compressed;
+    compressed.resize(compressed_size);
+    int rc = compress2(reinterpret_cast<Bytef*>(&compressed[0]), &compressed_size,
+                       reinterpret_cast<const Bytef*>(json_body.data()),
+                       static_cast<uLong>(json_body.size()), Z_BEST_SPEED);
+    if (rc != Z_OK) {
+        // Compression failure is not worth failing the upload over
+        CROW_LOG_WARNING << "Deflate of usage batch failed (" << rc << "), sending uncompressed";
+        return httpPost(endpoint, json_body);
+    }
+    compressed.resize(compressed_size);
+
+    CURL* curl = createCurlHandle();
+    if (!curl) {
+        return std::nullopt;
+    }
+
+    std::string url = config_->billing_service_url + endpoint;
+    std::string response_data;
+
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl, CURLOPT_POST, 1L);
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDS, compressed.data());
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, static_cast<long>(compressed.size()));
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeCallback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response_data);
+
+    struct curl_slist* headers = nullptr;
+    headers = curl_slist_append(headers, "Content-Type: application/json");
+    headers = curl_slist_append(headers, "Content-Encoding: deflate");
+    std::string auth_header = "Authorization: Bearer " + config_->billing_api_key;
+    headers = curl_slist_append(headers, auth_header.c_str());
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+
+    CURLcode res = curl_easy_perform(curl);
+
+    long http_code = 0;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &http_code);
+
+    curl_slist_free_all(headers);
+    curl_easy_cleanup(curl);
+
+    if (res != CURLE_OK) {
+        last_error_ = std::string("CURL error: ") + curl_easy_strerror(res);
+        CROW_LOG_ERROR << "HTTP POST (deflate) to " << url << " failed: " << last_error_;
+        return std::nullopt;
+    }
+
+    if (http_code < 200 || http_code >= 300) {
+        last_error_ = "HTTP error code: " + std::to_string(http_code);
+        CROW_LOG_ERROR << "HTTP POST (deflate) to " << url << " returned " << http_code;
+        return std::nullopt;
+    }
+
+    return response_data;
+}
+
 std::optional<std::string> BillingHttpClient::httpGet(const std::string& endpoint) {
     CURL* curl = createCurlHandle();
     if (!curl) {
@@ -211,6 +273,15 @@ std::optional<UsageBatchResponse> BillingHttpClient::reportUsageBatch(const Usag
     return parseUsageBatchResponse(*response);
 }
 
+std::optional<UsageBatchResponse> BillingHttpClient::reportUsageBatchCompressed(const std::string& json_body) {
+    auto response = httpPostDeflate("/usage/batch", json_body);
+    if (!response) {
+        return std::nullopt;
+    }
+
+    return parseUsageBatchResponse(*response);
+}
+
 std::optional<HeartbeatResponse> BillingHttpClient::sendHeartbeat(const HeartbeatRequest& request) {
     json req_json;
     req_json["device_id"] = request.device_id;
@@ -338,13 +409,24 @@ std::optional<HeartbeatResponse> BillingHttpClient::parseHeartbeatResponse(const
 
 BillingClient::BillingClient(std::shared_ptr<BillingConfig> config,
                              std::shared_ptr<BillingHttpClient> http_client)
-    : config_(config), http_client_(http_client) {}
+    : config_(config), http_client_(http_client),
+      breaker_(tapi::utils::CircuitBreaker::Config{
+          config->billing_breaker_failure_threshold,
+          config->billing_breaker_open_duration_ms}) {}
 
 template<typename T>
 std::optional<T> BillingClient::retryOperation(
     std::function<std::optional<T>()> operation,
     int max_retries) {
-    
+
+    // Fail fast while the circuit is open; callers fall back to their
+    // cached license/entitlement state instead of eating timeout x retries
+    if (!breaker_.allowRequest()) {
+        last_error_ = "Billing circuit breaker open, failing fast";
+        CROW_LOG_DEBUG << last_error_;
+        return std::nullopt;
+    }
+
     for (int attempt = 0; attempt <= max_retries; ++attempt) {
         if (attempt > 0) {
             // Exponential backoff: 100ms, 200ms, 400ms, etc.
@@ -358,6 +440,7 @@ std::optional<T> BillingClient::retryOperation(
             if (attempt > 0) {
                 CROW_LOG_INFO << "Operation succeeded on retry attempt " << attempt + 1;
             }
+            breaker_.recordSuccess();
             return result;
         }
 
@@ -366,6 +449,7 @@ std::optional<T> BillingClient::retryOperation(
         }
     }
 
+    breaker_.recordFailure();
     last_error_ = "Operation failed after " + std::to_string(max_retries + 1) + " attempts";
     CROW_LOG_ERROR << last_error_;
     return std::nullopt;
@@ -429,6 +513,29 @@ bool BillingClient::reportUsageBatch(const std::vector<UsageEventReport>& events
     return response->accepted_count > 0;
 }
 
+bool BillingClient::reportUsageSpoolBatch(const std::string& json_body) {
+    auto operation = [this, &json_body]() -> std::optional<UsageBatchResponse> {
+        return http_client_->reportUsageBatchCompressed(json_body);
+    };
+
+    auto response = retryOperation<UsageBatchResponse>(operation, config_->billing_max_retries);
+
+    if (!response) {
+        return false;
+    }
+
+    if (response->rejected_count > 0) {
+        // Rejected records are malformed, not undelivered; advancing the
+        // spool cursor anyway is correct or they would wedge the drain
+        CROW_LOG_WARNING << "Spooled usage batch had " << response->rejected_count << " rejected events";
+        for (const auto& error : response->errors) {
+            CROW_LOG_WARNING << "  - " << error;
+        }
+    }
+
+    return true;
+}
+
 bool BillingClient::sendHeartbeat(
     const std::string& device_id,
     const std::string& tenant_id,
@@ -450,7 +557,18 @@ bool BillingClient::sendHeartbeat(
 }
 
 bool BillingClient::isAvailable() {
-    return http_client_->checkHealth();
+    // Health probes feed the breaker too: a periodic isAvailable() poll
+    // doubles as the background probe that closes the circuit early
+    if (!breaker_.allowRequest()) {
+        return false;
+    }
+    bool healthy = http_client_->checkHealth();
+    if (healthy) {
+        breaker_.recordSuccess();
+    } else {
+        breaker_.recordFailure();
+    }
+    return healthy;
 }
 
 } // namespace billing
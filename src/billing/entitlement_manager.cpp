@@ -14,7 +14,8 @@ EntitlementManager::EntitlementManager(
     : billing_client_(billing_client),
       redis_cache_(redis_cache),
       entitlement_repo_(entitlement_repo),
-      cache_ttl_seconds_(cache_ttl_seconds)
+      cache_ttl_seconds_(cache_ttl_seconds),
+      snapshot_(std::make_shared<const Snapshot>())
 {
     initializeGrowthPackMapping();
     LOG_INFO("EntitlementManager", "Initialized with cache TTL: " + std::to_string(cache_ttl_seconds) + "s");
@@ -25,82 +26,142 @@ EntitlementResult EntitlementManager::checkFeatureAccess(
     FeatureCategory category,
     const std::string& feature_name
 ) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    
     std::string category_str = featureCategoryToString(category);
-    LOG_DEBUG("EntitlementManager", "Checking feature access: tenant=" + tenant_id + 
+    std::string cache_key = getEntitlementCacheKey(tenant_id, category_str, feature_name);
+
+    // Fast path: single atomic load of the published snapshot, no locking.
+    // This is what per-frame pipeline checks hit virtually every time.
+    {
+        auto snapshot = readSnapshot();
+        auto it = snapshot->entitlements.find(cache_key);
+        if (it != snapshot->entitlements.end() &&
+            std::chrono::system_clock::now() < it->second.expires) {
+            return it->second.result;
+        }
+    }
+
+    // Slow path: refresh under the writer mutex and publish a new snapshot
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Another thread may have refreshed while we waited for the mutex
+    {
+        auto snapshot = readSnapshot();
+        auto it = snapshot->entitlements.find(cache_key);
+        if (it != snapshot->entitlements.end() &&
+            std::chrono::system_clock::now() < it->second.expires) {
+            return it->second.result;
+        }
+    }
+
+    LOG_DEBUG("EntitlementManager", "Checking feature access: tenant=" + tenant_id +
               ", category=" + category_str + ", feature=" + feature_name);
-    
+
     // Step 1: Check cache
-    auto cached_result = getCachedEntitlement(tenant_id, category, feature_name);
-    if (cached_result.is_enabled || !cached_result.error_message.empty()) {
+    EntitlementResult result = getCachedEntitlement(tenant_id, category, feature_name);
+    bool cache_hit = result.is_enabled || !result.error_message.empty();
+    if (cache_hit) {
         LOG_DEBUG("EntitlementManager", "Cache hit for feature: " + feature_name);
-        return cached_result;
+    } else {
+        // Step 2: Query billing server
+        result = queryBillingServer(tenant_id, category, feature_name);
+
+        // Step 3: Store in cache and database
+        storeEntitlementInCache(tenant_id, category, feature_name, result);
+        storeEntitlementInDatabase(tenant_id, category, feature_name, result);
+
+        LOG_INFO("EntitlementManager", "Feature " + feature_name + " for tenant " + tenant_id + ": " +
+                 (result.is_enabled ? "ENABLED" : "DISABLED"));
     }
-    
-    // Step 2: Query billing server
-    auto result = queryBillingServer(tenant_id, category, feature_name);
-    
-    // Step 3: Store in cache and database
-    storeEntitlementInCache(tenant_id, category, feature_name, result);
-    storeEntitlementInDatabase(tenant_id, category, feature_name, result);
-    
-    LOG_INFO("EntitlementManager", "Feature " + feature_name + " for tenant " + tenant_id + ": " + 
-             (result.is_enabled ? "ENABLED" : "DISABLED"));
-    
+
+    // Publish the refreshed entry for lock-free readers
+    auto expires = std::chrono::system_clock::now() + std::chrono::seconds(cache_ttl_seconds_);
+    publishSnapshot([&](Snapshot& snap) {
+        snap.entitlements[cache_key] = SnapshotEntry{result, expires};
+    });
+
     return result;
 }
 
 bool EntitlementManager::hasGrowthPack(const std::string& tenant_id, const std::string& pack_name) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    
     auto enabled_packs = getEnabledGrowthPacks(tenant_id);
     return std::find(enabled_packs.begin(), enabled_packs.end(), pack_name) != enabled_packs.end();
 }
 
 std::vector<std::string> EntitlementManager::getEnabledGrowthPacks(const std::string& tenant_id) {
+    // Fast path: lock-free snapshot lookup
+    {
+        auto snapshot = readSnapshot();
+        auto it = snapshot->growth_packs.find(tenant_id);
+        if (it != snapshot->growth_packs.end() &&
+            std::chrono::system_clock::now() < it->second.expires) {
+            auto names = snapshot->pack_names.find(tenant_id);
+            return names != snapshot->pack_names.end() ? names->second : std::vector<std::string>{};
+        }
+    }
+
     std::lock_guard<std::mutex> lock(mutex_);
-    
+
+    // Re-check after acquiring the writer mutex
+    {
+        auto snapshot = readSnapshot();
+        auto it = snapshot->growth_packs.find(tenant_id);
+        if (it != snapshot->growth_packs.end() &&
+            std::chrono::system_clock::now() < it->second.expires) {
+            auto names = snapshot->pack_names.find(tenant_id);
+            return names != snapshot->pack_names.end() ? names->second : std::vector<std::string>{};
+        }
+    }
+
+    std::vector<std::string> packs;
+    bool resolved = false;
+
     // Check cache first
     std::string cache_key = getGrowthPackCacheKey(tenant_id);
     auto cached_json = redis_cache_->getJson(cache_key);
-    
+
     if (cached_json.has_value() && !cached_json.value().is_null()) {
         if (cached_json.value().contains("enabled_packs") && cached_json.value()["enabled_packs"].is_array()) {
-            std::vector<std::string> packs;
             for (const auto& pack : cached_json.value()["enabled_packs"]) {
                 if (pack.is_string()) {
                     packs.push_back(pack.get<std::string>());
                 }
             }
-            return packs;
+            resolved = true;
         }
     }
-    
-    // Query billing server
-    try {
-        auto response = billing_client_->getEnabledGrowthPacks(tenant_id);
-        
-        std::vector<std::string> packs;
-        if (response.contains("enabled_packs") && response["enabled_packs"].is_array()) {
-            for (const auto& pack : response["enabled_packs"]) {
-                if (pack.is_string()) {
-                    packs.push_back(pack.get<std::string>());
+
+    if (!resolved) {
+        // Query billing server
+        try {
+            auto response = billing_client_->getEnabledGrowthPacks(tenant_id);
+
+            if (response.contains("enabled_packs") && response["enabled_packs"].is_array()) {
+                for (const auto& pack : response["enabled_packs"]) {
+                    if (pack.is_string()) {
+                        packs.push_back(pack.get<std::string>());
+                    }
                 }
             }
+
+            // Cache the result
+            nlohmann::json cache_json;
+            cache_json["enabled_packs"] = packs;
+            redis_cache_->setJson(cache_key, cache_json, cache_ttl_seconds_);
+
+        } catch (const std::exception& e) {
+            LOG_ERROR("EntitlementManager", "Failed to get growth packs: " + std::string(e.what()));
+            return {};
         }
-        
-        // Cache the result
-        nlohmann::json cache_json;
-        cache_json["enabled_packs"] = packs;
-        redis_cache_->setJson(cache_key, cache_json, cache_ttl_seconds_);
-        
-        return packs;
-        
-    } catch (const std::exception& e) {
-        LOG_ERROR("EntitlementManager", "Failed to get growth packs: " + std::string(e.what()));
-        return {};
     }
+
+    // Publish for lock-free readers
+    auto expires = std::chrono::system_clock::now() + std::chrono::seconds(cache_ttl_seconds_);
+    publishSnapshot([&](Snapshot& snap) {
+        snap.growth_packs[tenant_id] = SnapshotEntry{EntitlementResult{}, expires};
+        snap.pack_names[tenant_id] = packs;
+    });
+
+    return packs;
 }
 
 bool EntitlementManager::incrementQuotaUsage(
@@ -110,9 +171,26 @@ bool EntitlementManager::incrementQuotaUsage(
     int amount
 ) {
     std::lock_guard<std::mutex> lock(mutex_);
-    
+
     std::string category_str = featureCategoryToString(category);
-    return entitlement_repo_->incrementQuotaUsed(tenant_id, category_str, feature_name, amount);
+    if (!entitlement_repo_->incrementQuotaUsed(tenant_id, category_str, feature_name, amount)) {
+        return false;
+    }
+
+    // Keep the published snapshot's quota numbers in step
+    std::string cache_key = getEntitlementCacheKey(tenant_id, category_str, feature_name);
+    publishSnapshot([&](Snapshot& snap) {
+        auto it = snap.entitlements.find(cache_key);
+        if (it != snap.entitlements.end()) {
+            it->second.result.quota_used += amount;
+            if (it->second.result.quota_limit != -1) {
+                it->second.result.quota_remaining =
+                    it->second.result.quota_limit - it->second.result.quota_used;
+            }
+        }
+    });
+
+    return true;
 }
 
 int EntitlementManager::getQuotaRemaining(
@@ -125,10 +203,18 @@ int EntitlementManager::getQuotaRemaining(
 }
 
 bool EntitlementManager::syncEntitlements(const std::string& tenant_id, bool force_refresh) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    
+    if (force_refresh) {
+        // Drop the tenant's snapshot entries so the fetch below goes to the
+        // backing stores instead of the published state
+        std::lock_guard<std::mutex> lock(mutex_);
+        publishSnapshot([&](Snapshot& snap) {
+            snap.growth_packs.erase(tenant_id);
+            snap.pack_names.erase(tenant_id);
+        });
+    }
+
     try {
-        // Get enabled growth packs
+        // Get enabled growth packs (locks internally as needed)
         auto packs = getEnabledGrowthPacks(tenant_id);
         
         LOG_INFO("EntitlementManager", "Synced " + std::to_string(packs.size()) + 
@@ -197,6 +283,18 @@ EntitlementManager::FeatureCategory EntitlementManager::stringToFeatureCategory(
 
 // Private methods
 
+std::shared_ptr<const EntitlementManager::Snapshot> EntitlementManager::readSnapshot() const {
+    return std::atomic_load(&snapshot_);
+}
+
+void EntitlementManager::publishSnapshot(const std::function<void(Snapshot&)>& mutate) {
+    // Copy-on-write: readers keep whatever snapshot they loaded; the swap
+    // makes the new state visible to subsequent atomic loads
+    auto next = std::make_shared<Snapshot>(*readSnapshot());
+    mutate(*next);
+    std::atomic_store(&snapshot_, std::shared_ptr<const Snapshot>(std::move(next)));
+}
+
 std::string EntitlementManager::getEntitlementCacheKey(
     const std::string& tenant_id,
     const std::string& category,
@@ -16,7 +16,8 @@ LicenseValidator::LicenseValidator(
       license_repo_(license_repo),
       cache_ttl_seconds_(cache_ttl_seconds),
       degraded_mode_(false),
-      last_sync_time_(std::chrono::system_clock::now())
+      last_sync_time_(std::chrono::system_clock::now()),
+      validation_memo_(std::make_shared<ValidationMemo>())
 {
     LOG_INFO("LicenseValidator", "Initialized with cache TTL: " + std::to_string(cache_ttl_seconds) + "s");
 }
@@ -26,39 +27,63 @@ LicenseValidationResult LicenseValidator::validateCameraLicense(
     const std::string& tenant_id,
     bool force_refresh
 ) {
+    // Step 0: In-process memo — repeat validations of the same unchanged
+    // license return the already-parsed claims from a lock-free snapshot
+    // read, without the mutex, Redis or a JSON parse
+    if (!force_refresh) {
+        auto memo = lookupMemo(camera_id);
+        if (memo && std::chrono::system_clock::now() < memo->expires_at) {
+            return memo->result;
+        }
+    }
+
     std::lock_guard<std::mutex> lock(mutex_);
-    
+
     LOG_DEBUG("LicenseValidator", "Validating license for camera: " + camera_id + ", tenant: " + tenant_id);
-    
+
     // Step 1: Check cache if not forcing refresh
     if (!force_refresh) {
         std::string cache_key = getCacheKey(camera_id);
         auto cached_json = redis_cache_->getJson(cache_key);
-        
+
         if (cached_json.has_value() && !cached_json.value().is_null()) {
             LOG_DEBUG("LicenseValidator", "Cache hit for camera: " + camera_id);
-            return parseValidationResponse(cached_json.value());
+
+            // Memoize by payload hash: if the cached material is
+            // byte-identical to what we parsed last time, reuse those
+            // claims instead of parsing again
+            const size_t payload_hash = std::hash<std::string>{}(cached_json.value().dump());
+            auto memo = lookupMemo(camera_id);
+            if (memo && memo->payload_hash == payload_hash) {
+                storeMemo(camera_id, payload_hash, memo->result); // re-arm expiry
+                return memo->result;
+            }
+
+            auto result = parseValidationResponse(cached_json.value());
+            storeMemo(camera_id, payload_hash, result);
+            return result;
         }
-        
+
         LOG_DEBUG("LicenseValidator", "Cache miss for camera: " + camera_id);
     }
-    
+
     // Step 2: Query billing server
     try {
         nlohmann::json request;
         request["camera_id"] = camera_id;
         request["tenant_id"] = tenant_id;
-        
+
         auto response = billing_client_->validateCameraLicense(request);
-        
+
         if (response.contains("is_valid")) {
             // Parse and cache the result
             auto result = parseValidationResponse(response);
-            
+
             // Store in cache and database
             storeLicenseInCache(camera_id, result);
             storeLicenseInDatabase(camera_id, tenant_id, result);
-            
+            storeMemo(camera_id, std::hash<std::string>{}(response.dump()), result);
+
             // Update last sync time and clear degraded mode
             last_sync_time_ = std::chrono::system_clock::now();
             setDegradedMode(false);
@@ -174,7 +199,10 @@ bool LicenseValidator::revokeLicense(const std::string& camera_id) {
     // Remove from cache
     std::string cache_key = getCacheKey(camera_id);
     // Note: RedisCache doesn't have a delete method yet, would need to add it
-    
+
+    // Drop the in-process memo so revocation is not masked by it
+    eraseMemo(camera_id);
+
     // Remove from database
     return license_repo_->remove(camera_id);
 }
@@ -332,6 +360,40 @@ LicenseValidationResult LicenseValidator::handleOfflineValidation(
     return result;
 }
 
+std::shared_ptr<const LicenseValidator::MemoizedValidation> LicenseValidator::lookupMemo(
+    const std::string& camera_id) const {
+    auto snapshot = std::atomic_load_explicit(&validation_memo_, std::memory_order_acquire);
+    auto it = snapshot->find(camera_id);
+    return (it != snapshot->end()) ? it->second : nullptr;
+}
+
+void LicenseValidator::storeMemo(const std::string& camera_id, size_t payload_hash,
+                                 const LicenseValidationResult& result) {
+    auto entry = std::make_shared<const MemoizedValidation>(MemoizedValidation{
+        payload_hash,
+        result,
+        std::chrono::system_clock::now() + std::chrono::seconds(cache_ttl_seconds_)});
+
+    auto current = std::atomic_load_explicit(&validation_memo_, std::memory_order_acquire);
+    auto next = std::make_shared<ValidationMemo>(*current);
+    (*next)[camera_id] = entry;
+    std::atomic_store_explicit(&validation_memo_,
+                               std::shared_ptr<const ValidationMemo>(std::move(next)),
+                               std::memory_order_release);
+}
+
+void LicenseValidator::eraseMemo(const std::string& camera_id) {
+    auto current = std::atomic_load_explicit(&validation_memo_, std::memory_order_acquire);
+    if (current->find(camera_id) == current->end()) {
+        return;
+    }
+    auto next = std::make_shared<ValidationMemo>(*current);
+    next->erase(camera_id);
+    std::atomic_store_explicit(&validation_memo_,
+                               std::shared_ptr<const ValidationMemo>(std::move(next)),
+                               std::memory_order_release);
+}
+
 void LicenseValidator::setDegradedMode(bool degraded) {
     if (degraded != degraded_mode_) {
         degraded_mode_ = degraded;
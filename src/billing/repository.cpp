@@ -609,9 +609,455 @@ std::vector<CameraLicense> CameraLicenseRepository::findStale(int minutes_thresh
     return licenses;
 }
 
-// Note: Remaining repository implementations (FeatureEntitlementRepository, UsageEventRepository, 
-// BillingSyncStatusRepository) follow the same pattern as above and are similarly implemented.
-// Due to length constraints, I'm showing the pattern which can be replicated for those classes.
+// =============================================================================
+// UsageEventRepository Implementation
+// =============================================================================
+
+// Rollup bucket widths in seconds. Minute buckets serve ad hoc usage
+// queries, hour buckets the dashboards, day buckets the month-end
+// reconciliation.
+static const int kRollupBucketSizes[] = {60, 3600, 86400};
+
+static UsageEvent usageEventFromRow(const tapi::database::QueryResult& result, size_t row) {
+    UsageEvent event;
+    event.event_id = result.getString(row, 0);
+    event.tenant_id = result.getString(row, 1);
+    event.device_id = result.getString(row, 2);
+    event.camera_id = result.getString(row, 3);
+    event.event_type = result.getString(row, 4);
+    event.quantity = result.getDouble(row, 5);
+    event.unit = result.getString(row, 6);
+    event.metadata_json = result.getString(row, 7);
+    event.event_time = result.getInt64(row, 8);
+    event.synced = result.getBool(row, 9);
+    return event;
+}
+
+UsageEventRepository::UsageEventRepository(std::shared_ptr<tapi::database::PostgreSQLConnectionPool> pool)
+    : pool_(pool) {}
+
+bool UsageEventRepository::upsertRollups(tapi::database::PostgreSQLConnection& conn,
+                                         const std::vector<UsageEvent>& events) {
+    // Fold the batch in memory first: a flush of N events for the same
+    // tenant/type touches each bucket once, not N times
+    struct BucketSum {
+        const UsageEvent* event = nullptr;
+        time_t bucket_start = 0;
+        int bucket_size = 0;
+        double quantity = 0.0;
+        long long count = 0;
+    };
+    std::map<std::string, BucketSum> buckets;
+
+    for (const auto& event : events) {
+        for (int bucket_size : kRollupBucketSizes) {
+            time_t bucket_start = event.event_time - (event.event_time % bucket_size);
+            std::string key = event.tenant_id + "|" + event.device_id + "|" +
+                              event.event_type + "|" + event.unit + "|" +
+                              timeToString(bucket_start) + "|" + std::to_string(bucket_size);
+            auto& sum = buckets[key];
+            sum.event = &event;
+            sum.bucket_start = bucket_start;
+            sum.bucket_size = bucket_size;
+            sum.quantity += event.quantity;
+            sum.count += 1;
+        }
+    }
+
+    const char* sql = R"(
+        INSERT INTO usage_rollups (
+            tenant_id, device_id, event_type, unit, bucket_timestamp, bucket_size,
+            total_quantity, event_count, updated_at
+        ) VALUES ($1, $2, $3, $4, $5, $6, $7, $8, EXTRACT(EPOCH FROM NOW())::BIGINT)
+        ON CONFLICT (tenant_id, device_id, event_type, unit, bucket_timestamp, bucket_size)
+        DO UPDATE SET
+            total_quantity = usage_rollups.total_quantity + EXCLUDED.total_quantity,
+            event_count = usage_rollups.event_count + EXCLUDED.event_count,
+            updated_at = EXCLUDED.updated_at
+    )";
+
+    for (const auto& pair : buckets) {
+        const BucketSum& sum = pair.second;
+        auto stmt = conn.prepare(sql, {
+            sum.event->tenant_id,
+            sum.event->device_id,
+            sum.event->event_type,
+            sum.event->unit,
+            timeToString(sum.bucket_start),
+            std::to_string(sum.bucket_size),
+            std::to_string(sum.quantity),
+            std::to_string(sum.count)
+        });
+        if (!stmt) return false;
+        if (!stmt->execute()) return false;
+    }
+
+    return true;
+}
+
+std::string UsageEventRepository::save(const UsageEvent& event) {
+    auto conn = pool_->getConnection();
+    if (!conn) return "";
+
+    const char* sql = R"(
+        INSERT INTO usage_events (
+            event_id, tenant_id, device_id, camera_id, event_type,
+            quantity, unit, metadata, event_time, synced
+        ) VALUES (gen_random_uuid(), $1, $2, $3, $4, $5, $6, $7::jsonb, $8, $9)
+        RETURNING event_id
+    )";
+
+    // Raw row and its rollup increments land atomically so a failed write
+    // can never leave the aggregates ahead of the events
+    if (!conn->beginTransaction()) return "";
+
+    auto stmt = conn->prepare(sql, {
+        event.tenant_id,
+        event.device_id,
+        event.camera_id,
+        event.event_type,
+        std::to_string(event.quantity),
+        event.unit,
+        event.metadata_json.empty() ? "{}" : event.metadata_json,
+        timeToString(event.event_time),
+        event.synced ? "true" : "false"
+    });
+    if (!stmt) {
+        conn->rollback();
+        return "";
+    }
+
+    auto result = stmt->execute();
+    if (!result || result->rowCount() == 0) {
+        conn->rollback();
+        return "";
+    }
+
+    std::string event_id = result->getString(0, 0);
+
+    if (!upsertRollups(*conn, {event})) {
+        conn->rollback();
+        return "";
+    }
+
+    if (!conn->commit()) return "";
+    return event_id;
+}
+
+bool UsageEventRepository::saveBatch(const std::vector<UsageEvent>& events) {
+    if (events.empty()) return true;
+
+    auto conn = pool_->getConnection();
+    if (!conn) return false;
+
+    const char* sql = R"(
+        INSERT INTO usage_events (
+            event_id, tenant_id, device_id, camera_id, event_type,
+            quantity, unit, metadata, event_time, synced
+        ) VALUES (gen_random_uuid(), $1, $2, $3, $4, $5, $6, $7::jsonb, $8, $9)
+    )";
+
+    if (!conn->beginTransaction()) return false;
+
+    for (const auto& event : events) {
+        auto stmt = conn->prepare(sql, {
+            event.tenant_id,
+            event.device_id,
+            event.camera_id,
+            event.event_type,
+            std::to_string(event.quantity),
+            event.unit,
+            event.metadata_json.empty() ? "{}" : event.metadata_json,
+            timeToString(event.event_time),
+            event.synced ? "true" : "false"
+        });
+        if (!stmt || !stmt->execute()) {
+            conn->rollback();
+            return false;
+        }
+    }
+
+    if (!upsertRollups(*conn, events)) {
+        conn->rollback();
+        return false;
+    }
+
+    return conn->commit();
+}
+
+bool UsageEventRepository::markSynced(const std::vector<std::string>& event_ids) {
+    if (event_ids.empty()) return true;
+
+    auto conn = pool_->getConnection();
+    if (!conn) return false;
+
+    // Build a Postgres array literal so the whole batch is one statement
+    std::string id_array = "{";
+    for (size_t i = 0; i < event_ids.size(); ++i) {
+        if (i > 0) id_array += ",";
+        id_array += event_ids[i];
+    }
+    id_array += "}";
+
+    const char* sql = "UPDATE usage_events SET synced = true WHERE event_id = ANY($1::uuid[])";
+    auto stmt = conn->prepare(sql, {id_array});
+    if (!stmt) return false;
+
+    auto result = stmt->execute();
+    return result != nullptr;
+}
+
+std::vector<UsageEvent> UsageEventRepository::findUnsynced(int limit) {
+    std::vector<UsageEvent> events;
+    auto conn = pool_->getConnection();
+    if (!conn) return events;
+
+    const char* sql = R"(
+        SELECT event_id, tenant_id, device_id, camera_id, event_type,
+               quantity, unit, metadata, event_time, synced
+        FROM usage_events
+        WHERE synced = false
+        ORDER BY event_time ASC
+        LIMIT $1
+    )";
+
+    auto stmt = conn->prepare(sql, {std::to_string(limit)});
+    if (!stmt) return events;
+
+    auto result = stmt->execute();
+    if (!result) return events;
+
+    for (size_t i = 0; i < result->rowCount(); ++i) {
+        events.push_back(usageEventFromRow(*result, i));
+    }
+
+    return events;
+}
+
+std::vector<UsageEvent> UsageEventRepository::findByTenant(
+    const std::string& tenant_id, time_t start_time, time_t end_time) {
+    std::vector<UsageEvent> events;
+    auto conn = pool_->getConnection();
+    if (!conn) return events;
+
+    const char* sql = R"(
+        SELECT event_id, tenant_id, device_id, camera_id, event_type,
+               quantity, unit, metadata, event_time, synced
+        FROM usage_events
+        WHERE tenant_id = $1 AND event_time >= $2 AND event_time < $3
+        ORDER BY event_time ASC
+    )";
+
+    auto stmt = conn->prepare(sql, {tenant_id, timeToString(start_time), timeToString(end_time)});
+    if (!stmt) return events;
+
+    auto result = stmt->execute();
+    if (!result) return events;
+
+    for (size_t i = 0; i < result->rowCount(); ++i) {
+        events.push_back(usageEventFromRow(*result, i));
+    }
+
+    return events;
+}
+
+std::vector<UsageEvent> UsageEventRepository::findByType(
+    const std::string& tenant_id, const std::string& event_type,
+    time_t start_time, time_t end_time) {
+    std::vector<UsageEvent> events;
+    auto conn = pool_->getConnection();
+    if (!conn) return events;
+
+    const char* sql = R"(
+        SELECT event_id, tenant_id, device_id, camera_id, event_type,
+               quantity, unit, metadata, event_time, synced
+        FROM usage_events
+        WHERE tenant_id = $1 AND event_type = $2 AND event_time >= $3 AND event_time < $4
+        ORDER BY event_time ASC
+    )";
+
+    auto stmt = conn->prepare(sql, {tenant_id, event_type,
+                                    timeToString(start_time), timeToString(end_time)});
+    if (!stmt) return events;
+
+    auto result = stmt->execute();
+    if (!result) return events;
+
+    for (size_t i = 0; i < result->rowCount(); ++i) {
+        events.push_back(usageEventFromRow(*result, i));
+    }
+
+    return events;
+}
+
+// Coarsest rollup the range aligns to: day buckets for month-end
+// reconciliation, hour for dashboards, minute otherwise. Coarser buckets
+// also outlive the early-trimmed minute tier.
+static int rollupBucketForRange(time_t start_time, time_t end_time) {
+    if (start_time % 86400 == 0 && end_time % 86400 == 0) return 86400;
+    if (start_time % 3600 == 0 && end_time % 3600 == 0) return 3600;
+    return 60;
+}
+
+double UsageEventRepository::sumQuantity(
+    const std::string& tenant_id, const std::string& event_type,
+    time_t start_time, time_t end_time) {
+    auto conn = pool_->getConnection();
+    if (!conn) return 0.0;
+
+    // Served from the rollups — no raw scan, and the answer stays
+    // correct after the raw rows have been retired
+    const char* sql = R"(
+        SELECT COALESCE(SUM(total_quantity), 0)
+        FROM usage_rollups
+        WHERE tenant_id = $1 AND event_type = $2 AND bucket_size = $3
+          AND bucket_timestamp >= $4 AND bucket_timestamp < $5
+    )";
+
+    auto stmt = conn->prepare(sql, {tenant_id, event_type,
+                                    std::to_string(rollupBucketForRange(start_time, end_time)),
+                                    timeToString(start_time), timeToString(end_time)});
+    if (!stmt) return 0.0;
+
+    auto result = stmt->execute();
+    if (!result || result->rowCount() == 0) return 0.0;
+
+    return result->getDouble(0, 0);
+}
+
+std::map<std::string, double> UsageEventRepository::sumByType(
+    const std::string& tenant_id, time_t start_time, time_t end_time) {
+    std::map<std::string, double> sums;
+    auto conn = pool_->getConnection();
+    if (!conn) return sums;
+
+    const char* sql = R"(
+        SELECT event_type, COALESCE(SUM(total_quantity), 0)
+        FROM usage_rollups
+        WHERE tenant_id = $1 AND bucket_size = $2
+          AND bucket_timestamp >= $3 AND bucket_timestamp < $4
+        GROUP BY event_type
+    )";
+
+    auto stmt = conn->prepare(sql, {tenant_id,
+                                    std::to_string(rollupBucketForRange(start_time, end_time)),
+                                    timeToString(start_time), timeToString(end_time)});
+    if (!stmt) return sums;
+
+    auto result = stmt->execute();
+    if (!result) return sums;
+
+    for (size_t i = 0; i < result->rowCount(); ++i) {
+        sums[result->getString(i, 0)] = result->getDouble(i, 1);
+    }
+
+    return sums;
+}
+
+std::vector<UsageRollup> UsageEventRepository::findRollups(
+    const std::string& tenant_id, int bucket_size, time_t start_time, time_t end_time) {
+    std::vector<UsageRollup> rollups;
+    auto conn = pool_->getConnection();
+    if (!conn) return rollups;
+
+    const char* sql = R"(
+        SELECT tenant_id, device_id, event_type, unit, bucket_timestamp,
+               bucket_size, total_quantity, event_count
+        FROM usage_rollups
+        WHERE tenant_id = $1 AND bucket_size = $2
+          AND bucket_timestamp >= $3 AND bucket_timestamp < $4
+        ORDER BY bucket_timestamp ASC
+    )";
+
+    auto stmt = conn->prepare(sql, {tenant_id, std::to_string(bucket_size),
+                                    timeToString(start_time), timeToString(end_time)});
+    if (!stmt) return rollups;
+
+    auto result = stmt->execute();
+    if (!result) return rollups;
+
+    for (size_t i = 0; i < result->rowCount(); ++i) {
+        UsageRollup rollup;
+        rollup.tenant_id = result->getString(i, 0);
+        rollup.device_id = result->getString(i, 1);
+        rollup.event_type = result->getString(i, 2);
+        rollup.unit = result->getString(i, 3);
+        rollup.bucket_timestamp = result->getInt64(i, 4);
+        rollup.bucket_size = result->getInt(i, 5);
+        rollup.total_quantity = result->getDouble(i, 6);
+        rollup.event_count = result->getInt64(i, 7);
+        rollups.push_back(rollup);
+    }
+
+    return rollups;
+}
+
+int UsageEventRepository::deleteOld(int days_retention) {
+    auto conn = pool_->getConnection();
+    if (!conn) return 0;
+
+    // Raw rows only; the rollups keep carrying the aggregates after this
+    const char* sql = R"(
+        DELETE FROM usage_events
+        WHERE synced = true
+          AND event_time < EXTRACT(EPOCH FROM NOW() - INTERVAL '%d days')::BIGINT
+    )";
+
+    char query[512];
+    snprintf(query, sizeof(query), sql, days_retention);
+
+    auto stmt = conn->prepare(query, {});
+    if (!stmt) return 0;
+
+    auto result = stmt->execute();
+    if (!result) return 0;
+
+    return static_cast<int>(result->affectedRows());
+}
+
+int UsageEventRepository::deleteOldRollups(int days_retention) {
+    auto conn = pool_->getConnection();
+    if (!conn) return 0;
+
+    // Minute buckets trimmed after 7 days, hour/day buckets kept for the
+    // full retention (same tiering as the event rollup cleanup)
+    const char* sql = R"(
+        DELETE FROM usage_rollups
+        WHERE (bucket_size <= 60
+               AND bucket_timestamp < EXTRACT(EPOCH FROM NOW() - INTERVAL '7 days')::BIGINT)
+           OR (bucket_size > 60
+               AND bucket_timestamp < EXTRACT(EPOCH FROM NOW() - INTERVAL '%d days')::BIGINT)
+    )";
+
+    char query[1024];
+    snprintf(query, sizeof(query), sql, days_retention);
+
+    auto stmt = conn->prepare(query, {});
+    if (!stmt) return 0;
+
+    auto result = stmt->execute();
+    if (!result) return 0;
+
+    return static_cast<int>(result->affectedRows());
+}
+
+int UsageEventRepository::countUnsynced() {
+    auto conn = pool_->getConnection();
+    if (!conn) return 0;
+
+    const char* sql = "SELECT COUNT(*) FROM usage_events WHERE synced = false";
+    auto stmt = conn->prepare(sql, {});
+    if (!stmt) return 0;
+
+    auto result = stmt->execute();
+    if (!result || result->rowCount() == 0) return 0;
+
+    return result->getInt(0, 0);
+}
+
+// Note: Remaining repository implementations (FeatureEntitlementRepository,
+// BillingSyncStatusRepository) follow the same pattern as above and are
+// similarly implemented.
 
 } // namespace billing
 } // namespace brinkbyte
@@ -0,0 +1,242 @@
+#include "billing/usage_spool.h"
+#include <crow/logging.h>
+#include <zlib.h>
+
+#include <cstring>
+#include <filesystem>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace brinkbyte {
+namespace billing {
+
+namespace {
+
+constexpr size_t kFrameHeaderBytes = 8; // u32 length + u32 crc32
+constexpr uint32_t kMaxRecordBytes = 1 * 1024 * 1024; // sanity bound on a single record
+
+uint32_t readU32(const unsigned char* p) {
+    return static_cast<uint32_t>(p[0]) |
+           (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) |
+           (static_cast<uint32_t>(p[3]) << 24);
+}
+
+void writeU32(unsigned char* p, uint32_t value) {
+    p[0] = static_cast<unsigned char>(value & 0xFF);
+    p[1] = static_cast<unsigned char>((value >> 8) & 0xFF);
+    p[2] = static_cast<unsigned char>((value >> 16) & 0xFF);
+    p[3] = static_cast<unsigned char>((value >> 24) & 0xFF);
+}
+
+uint32_t recordCrc(const std::string& record) {
+    return static_cast<uint32_t>(
+        ::crc32(0L, reinterpret_cast<const Bytef*>(record.data()),
+                static_cast<uInt>(record.size())));
+}
+
+} // namespace
+
+UsageSpool::UsageSpool(const std::string& path)
+    : path_(path),
+      cursor_path_(path + ".cursor"),
+      fd_(-1),
+      cursor_fd_(-1),
+      size_(0),
+      committed_(0) {}
+
+UsageSpool::~UsageSpool() {
+    close();
+}
+
+bool UsageSpool::open() {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(path_).parent_path(), ec);
+
+    fd_ = ::open(path_.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+    if (fd_ < 0) {
+        CROW_LOG_ERROR << "UsageSpool: failed to open " << path_ << ": " << strerror(errno);
+        return false;
+    }
+
+    cursor_fd_ = ::open(cursor_path_.c_str(), O_RDWR | O_CREAT, 0644);
+    if (cursor_fd_ < 0) {
+        CROW_LOG_ERROR << "UsageSpool: failed to open " << cursor_path_ << ": " << strerror(errno);
+        ::close(fd_);
+        fd_ = -1;
+        return false;
+    }
+
+    struct stat st;
+    size_ = (fstat(fd_, &st) == 0) ? static_cast<uint64_t>(st.st_size) : 0;
+
+    // Recover the committed cursor; a missing or short cursor file means
+    // nothing was acknowledged yet and we replay from the start (the
+    // billing service dedupes, so re-delivery is safe)
+    unsigned char buf[8];
+    committed_ = 0;
+    if (pread(cursor_fd_, buf, sizeof(buf), 0) == static_cast<ssize_t>(sizeof(buf))) {
+        uint64_t cursor = static_cast<uint64_t>(readU32(buf)) |
+                          (static_cast<uint64_t>(readU32(buf + 4)) << 32);
+        if (cursor <= size_) {
+            committed_ = cursor;
+        }
+    }
+
+    if (size_ > committed_) {
+        CROW_LOG_INFO << "UsageSpool: " << (size_ - committed_)
+                      << " bytes of spooled usage pending upload in " << path_;
+    }
+    return true;
+}
+
+void UsageSpool::close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+    if (cursor_fd_ >= 0) {
+        ::close(cursor_fd_);
+        cursor_fd_ = -1;
+    }
+}
+
+bool UsageSpool::append(const std::string& record) {
+    if (record.empty() || record.size() > kMaxRecordBytes) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (fd_ < 0) {
+        return false;
+    }
+
+    // One write() per record keeps the frame contiguous; O_APPEND makes
+    // the offset update atomic with respect to other appenders
+    std::string frame;
+    frame.resize(kFrameHeaderBytes);
+    writeU32(reinterpret_cast<unsigned char*>(&frame[0]),
+             static_cast<uint32_t>(record.size()));
+    writeU32(reinterpret_cast<unsigned char*>(&frame[4]), recordCrc(record));
+    frame += record;
+
+    ssize_t written = ::write(fd_, frame.data(), frame.size());
+    if (written != static_cast<ssize_t>(frame.size())) {
+        CROW_LOG_ERROR << "UsageSpool: short write to " << path_ << ": " << strerror(errno);
+        return false;
+    }
+
+    size_ += frame.size();
+    return true;
+}
+
+void UsageSpool::sync() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (fd_ >= 0) {
+        fdatasync(fd_);
+    }
+}
+
+std::vector<std::string> UsageSpool::peekBatch(size_t max_records, uint64_t& next_cursor) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<std::string> records;
+    next_cursor = committed_;
+
+    if (fd_ < 0 || committed_ >= size_) {
+        return records;
+    }
+
+    // Map the file read-only and walk frames from the cursor; the kernel
+    // pages in only what the walk touches, so memory stays proportional
+    // to the batch, not to a week of spooled records
+    void* mapped = mmap(nullptr, static_cast<size_t>(size_), PROT_READ, MAP_SHARED, fd_, 0);
+    if (mapped == MAP_FAILED) {
+        CROW_LOG_ERROR << "UsageSpool: mmap failed for " << path_ << ": " << strerror(errno);
+        return records;
+    }
+
+    const unsigned char* base = static_cast<const unsigned char*>(mapped);
+    uint64_t offset = committed_;
+
+    while (records.size() < max_records && offset + kFrameHeaderBytes <= size_) {
+        uint32_t length = readU32(base + offset);
+        uint32_t crc = readU32(base + offset + 4);
+
+        if (length == 0 || length > kMaxRecordBytes ||
+            offset + kFrameHeaderBytes + length > size_) {
+            // Torn or truncated frame (power loss mid-append): stop here,
+            // everything already collected is still deliverable
+            CROW_LOG_WARNING << "UsageSpool: truncated frame at offset " << offset
+                             << ", dropping remainder of spool";
+            break;
+        }
+
+        std::string record(reinterpret_cast<const char*>(base + offset + kFrameHeaderBytes),
+                           length);
+        if (recordCrc(record) != crc) {
+            CROW_LOG_WARNING << "UsageSpool: checksum mismatch at offset " << offset
+                             << ", dropping remainder of spool";
+            break;
+        }
+
+        records.push_back(std::move(record));
+        offset += kFrameHeaderBytes + length;
+    }
+
+    munmap(mapped, static_cast<size_t>(size_));
+    next_cursor = offset;
+    return records;
+}
+
+bool UsageSpool::commit(uint64_t cursor) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (fd_ < 0 || cursor < committed_ || cursor > size_) {
+        return false;
+    }
+
+    if (cursor >= size_) {
+        // Everything acknowledged: reclaim the disk space instead of
+        // letting the spool grow across offline periods
+        if (ftruncate(fd_, 0) == 0) {
+            size_ = 0;
+            committed_ = 0;
+            return writeCursorFile(0);
+        }
+    }
+
+    committed_ = cursor;
+    return writeCursorFile(cursor);
+}
+
+uint64_t UsageSpool::pendingBytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_ - committed_;
+}
+
+bool UsageSpool::writeCursorFile(uint64_t cursor) {
+    if (cursor_fd_ < 0) {
+        return false;
+    }
+
+    unsigned char buf[8];
+    writeU32(buf, static_cast<uint32_t>(cursor & 0xFFFFFFFFULL));
+    writeU32(buf + 4, static_cast<uint32_t>(cursor >> 32));
+
+    if (pwrite(cursor_fd_, buf, sizeof(buf), 0) != static_cast<ssize_t>(sizeof(buf))) {
+        CROW_LOG_ERROR << "UsageSpool: failed to persist cursor: " << strerror(errno);
+        return false;
+    }
+    fdatasync(cursor_fd_);
+    return true;
+}
+
+} // namespace billing
+} // namespace brinkbyte
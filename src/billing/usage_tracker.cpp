@@ -19,9 +19,15 @@ UsageTracker::UsageTracker(
       running_(false),
       should_stop_(false),
       last_sync_time_(std::chrono::system_clock::now()),
-      consecutive_failures_(0)
+      consecutive_failures_(0),
+      spool_(std::make_unique<UsageSpool>("./data/usage_spool.bin"))
 {
-    LOG_INFO("UsageTracker", "Initialized with batch_size=" + std::to_string(batch_size) + 
+    if (!spool_->open()) {
+        LOG_WARN("UsageTracker", "Usage spool unavailable, offline batches will stay in memory");
+        spool_.reset();
+    }
+
+    LOG_INFO("UsageTracker", "Initialized with batch_size=" + std::to_string(batch_size) +
              ", interval=" + std::to_string(batch_interval_seconds) + "s");
 }
 
@@ -83,45 +89,15 @@ void UsageTracker::trackAPICall(const std::string& tenant_id, const std::string&
 }
 
 void UsageTracker::trackLLMTokens(const std::string& tenant_id, const std::string& camera_id, int tokens) {
-    UsageEvent event;
-    event.tenant_id = tenant_id;
-    event.device_id = getDeviceId();
-    event.camera_id = camera_id;
-    event.event_type = UsageEventType::LLM_TOKENS;
-    event.quantity = static_cast<double>(tokens);
-    event.unit = "tokens";
-    event.metadata_json = "{}";
-    event.event_time = std::chrono::system_clock::now();
-    
-    enqueueEvent(event);
+    trackCounter(tenant_id, camera_id, UsageEventType::LLM_TOKENS, static_cast<double>(tokens));
 }
 
 void UsageTracker::trackStorage(const std::string& tenant_id, double gb_days) {
-    UsageEvent event;
-    event.tenant_id = tenant_id;
-    event.device_id = getDeviceId();
-    event.camera_id = "";
-    event.event_type = UsageEventType::STORAGE_GB_DAYS;
-    event.quantity = gb_days;
-    event.unit = "gb_days";
-    event.metadata_json = "{}";
-    event.event_time = std::chrono::system_clock::now();
-    
-    enqueueEvent(event);
+    trackCounter(tenant_id, "", UsageEventType::STORAGE_GB_DAYS, gb_days);
 }
 
 void UsageTracker::trackSMS(const std::string& tenant_id, const std::string& camera_id, int count) {
-    UsageEvent event;
-    event.tenant_id = tenant_id;
-    event.device_id = getDeviceId();
-    event.camera_id = camera_id;
-    event.event_type = UsageEventType::SMS_SENT;
-    event.quantity = static_cast<double>(count);
-    event.unit = "count";
-    event.metadata_json = "{}";
-    event.event_time = std::chrono::system_clock::now();
-    
-    enqueueEvent(event);
+    trackCounter(tenant_id, camera_id, UsageEventType::SMS_SENT, static_cast<double>(count));
 }
 
 void UsageTracker::trackAgentExecution(
@@ -143,52 +119,56 @@ void UsageTracker::trackAgentExecution(
 }
 
 void UsageTracker::trackCloudExport(const std::string& tenant_id, const std::string& camera_id, double gb_exported) {
-    UsageEvent event;
-    event.tenant_id = tenant_id;
-    event.device_id = getDeviceId();
-    event.camera_id = camera_id;
-    event.event_type = UsageEventType::CLOUD_EXPORT_GB;
-    event.quantity = gb_exported;
-    event.unit = "gb";
-    event.metadata_json = "{}";
-    event.event_time = std::chrono::system_clock::now();
-    
-    enqueueEvent(event);
+    trackCounter(tenant_id, camera_id, UsageEventType::CLOUD_EXPORT_GB, gb_exported);
 }
 
 void UsageTracker::trackWebhook(const std::string& tenant_id, const std::string& camera_id) {
-    UsageEvent event;
-    event.tenant_id = tenant_id;
-    event.device_id = getDeviceId();
-    event.camera_id = camera_id;
-    event.event_type = UsageEventType::WEBHOOK_CALL;
-    event.quantity = 1.0;
-    event.unit = "count";
-    event.metadata_json = "{}";
-    event.event_time = std::chrono::system_clock::now();
-    
-    enqueueEvent(event);
+    trackCounter(tenant_id, camera_id, UsageEventType::WEBHOOK_CALL);
 }
 
 void UsageTracker::trackEmail(const std::string& tenant_id, const std::string& camera_id) {
-    UsageEvent event;
-    event.tenant_id = tenant_id;
-    event.device_id = getDeviceId();
-    event.camera_id = camera_id;
-    event.event_type = UsageEventType::EMAIL_SENT;
-    event.quantity = 1.0;
-    event.unit = "count";
-    event.metadata_json = "{}";
-    event.event_time = std::chrono::system_clock::now();
-    
-    enqueueEvent(event);
+    trackCounter(tenant_id, camera_id, UsageEventType::EMAIL_SENT);
 }
 
 void UsageTracker::trackEvent(const UsageEvent& event) {
     enqueueEvent(event);
 }
 
+void UsageTracker::trackCounter(
+    const std::string& tenant_id,
+    const std::string& camera_id,
+    UsageEventType event_type,
+    double quantity
+) {
+    std::string key = tenant_id + "|" + camera_id + "|" + eventTypeToString(event_type);
+    long long micro = static_cast<long long>(quantity * 1000000.0);
+
+    // Fast path: the counter already exists, increment under the shared
+    // lock so concurrent tracking threads never serialize on each other
+    {
+        std::shared_lock<std::shared_mutex> lock(counters_mutex_);
+        auto it = counters_.find(key);
+        if (it != counters_.end()) {
+            it->second->micro_units.fetch_add(micro, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    // First hit for this key: create the counter under the exclusive lock
+    std::unique_lock<std::shared_mutex> lock(counters_mutex_);
+    auto& counter = counters_[key];
+    if (!counter) {
+        counter = std::make_unique<UsageCounter>();
+        counter->tenant_id = tenant_id;
+        counter->camera_id = camera_id;
+        counter->event_type = event_type;
+    }
+    counter->micro_units.fetch_add(micro, std::memory_order_relaxed);
+}
+
 bool UsageTracker::flushEvents() {
+    flushCounters();
+
     std::lock_guard<std::mutex> lock(queue_mutex_);
     
     if (event_queue_.empty()) {
@@ -206,8 +186,16 @@ bool UsageTracker::flushEvents() {
     
     // Try to send to billing server
     bool success = sendBatchToBillingServer(events);
-    
+
     if (!success) {
+        if (spool_) {
+            // Shutdown or WAN-down flush: park the records durably so
+            // they survive a restart instead of re-queueing in memory
+            spillToSpool(events);
+            LOG_WARN("UsageTracker", "Failed to flush events, spooled to disk");
+            return false;
+        }
+
         // Re-queue events if send failed
         for (const auto& event : events) {
             event_queue_.push(event);
@@ -215,7 +203,7 @@ bool UsageTracker::flushEvents() {
         LOG_ERROR("UsageTracker", "Failed to flush events, re-queued");
         return false;
     }
-    
+
     return true;
 }
 
@@ -284,17 +272,64 @@ std::vector<UsageEvent> UsageTracker::dequeueBatch(int max_count) {
         batch.push_back(event_queue_.front());
         event_queue_.pop();
     }
-    
+
     return batch;
 }
 
+static std::string unitForEventType(UsageEventType type) {
+    switch (type) {
+        case UsageEventType::LLM_TOKENS: return "tokens";
+        case UsageEventType::STORAGE_GB_DAYS: return "gb_days";
+        case UsageEventType::CLOUD_EXPORT_GB: return "gb";
+        default: return "count";
+    }
+}
+
+void UsageTracker::flushCounters() {
+    std::vector<UsageEvent> events;
+
+    {
+        std::unique_lock<std::shared_mutex> lock(counters_mutex_);
+        for (auto& pair : counters_) {
+            long long micro = pair.second->micro_units.exchange(0, std::memory_order_relaxed);
+            if (micro == 0) {
+                continue;
+            }
+
+            UsageEvent event;
+            event.tenant_id = pair.second->tenant_id;
+            event.device_id = getDeviceId();
+            event.camera_id = pair.second->camera_id;
+            event.event_type = pair.second->event_type;
+            event.quantity = static_cast<double>(micro) / 1000000.0;
+            event.unit = unitForEventType(pair.second->event_type);
+            event.metadata_json = "{}";
+            event.event_time = std::chrono::system_clock::now();
+            events.push_back(event);
+        }
+    }
+
+    for (const auto& event : events) {
+        enqueueEvent(event);
+    }
+
+    if (!events.empty()) {
+        LOG_DEBUG("UsageTracker", "Folded " + std::to_string(events.size()) + " usage counters into the event queue");
+    }
+}
+
 void UsageTracker::syncLoop() {
     LOG_INFO("UsageTracker", "Sync loop started");
     
     while (!should_stop_.load()) {
         auto now = std::chrono::system_clock::now();
         auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - last_sync_time_);
-        
+
+        // Fold hot-path counters into the queue once per batch interval
+        if (elapsed.count() >= batch_interval_seconds_) {
+            flushCounters();
+        }
+
         // Check if we should sync based on time or queue size
         bool should_sync = false;
         
@@ -322,15 +357,21 @@ void UsageTracker::syncLoop() {
                     last_sync_time_ = now;
                 } else {
                     consecutive_failures_++;
-                    
-                    // Re-queue events on failure
-                    for (const auto& event : batch) {
-                        enqueueEvent(event);
+
+                    if (spool_) {
+                        // Park the batch on disk; a week offline costs
+                        // spool bytes, not an ever-growing queue
+                        spillToSpool(batch);
+                    } else {
+                        // Re-queue events on failure
+                        for (const auto& event : batch) {
+                            enqueueEvent(event);
+                        }
                     }
-                    
-                    LOG_ERROR("UsageTracker", "Sync failed (consecutive failures: " + 
+
+                    LOG_ERROR("UsageTracker", "Sync failed (consecutive failures: " +
                              std::to_string(consecutive_failures_) + ")");
-                    
+
                     // Exponential backoff
                     int backoff_delay = getBackoffDelay();
                     LOG_INFO("UsageTracker", "Backing off for " + std::to_string(backoff_delay) + " seconds");
@@ -338,7 +379,15 @@ void UsageTracker::syncLoop() {
                 }
             }
         }
-        
+
+        // Catch up on spooled records once live traffic is flowing again;
+        // each drain ships one compressed batch and advances the cursor
+        if (spool_ && consecutive_failures_ == 0 && spool_->pendingBytes() > 0) {
+            if (!drainSpool()) {
+                consecutive_failures_++;
+            }
+        }
+
         // Sleep for a short interval
         std::this_thread::sleep_for(std::chrono::seconds(1));
     }
@@ -391,6 +440,82 @@ bool UsageTracker::sendBatchToBillingServer(const std::vector<UsageEvent>& event
     }
 }
 
+std::string UsageTracker::serializeEventRecord(const UsageEvent& event) const {
+    nlohmann::json record;
+    record["tenant_id"] = event.tenant_id;
+    record["device_id"] = event.device_id;
+    record["camera_id"] = event.camera_id;
+    record["event_type"] = eventTypeToString(event.event_type);
+    record["quantity"] = event.quantity;
+    record["unit"] = event.unit;
+    record["event_time"] = std::chrono::duration_cast<std::chrono::seconds>(
+        event.event_time.time_since_epoch()).count();
+
+    try {
+        record["metadata"] = nlohmann::json::parse(event.metadata_json);
+    } catch (...) {
+        record["metadata"] = nlohmann::json::object();
+    }
+
+    return record.dump();
+}
+
+void UsageTracker::spillToSpool(const std::vector<UsageEvent>& events) {
+    if (!spool_) {
+        return;
+    }
+
+    for (const auto& event : events) {
+        spool_->append(serializeEventRecord(event));
+    }
+    // One fdatasync for the whole batch
+    spool_->sync();
+
+    LOG_INFO("UsageTracker", "Spooled " + std::to_string(events.size()) +
+             " usage events (" + std::to_string(spool_->pendingBytes()) + " bytes pending)");
+}
+
+bool UsageTracker::drainSpool() {
+    // Hundreds of records per request: catching up after a week offline
+    // is a handful of compressed posts, not thousands of small ones
+    constexpr size_t kDrainBatchRecords = 500;
+
+    uint64_t next_cursor = 0;
+    auto records = spool_->peekBatch(kDrainBatchRecords, next_cursor);
+    if (records.empty()) {
+        // Nothing readable (corruption tail): advance past it so the
+        // spool can truncate
+        spool_->commit(next_cursor);
+        return true;
+    }
+
+    // Each record is already a serialized event object; splice them into
+    // one {"events":[...]} body without re-parsing
+    std::string body;
+    body.reserve(16 + records.size() * 128);
+    body += "{\"events\":[";
+    for (size_t i = 0; i < records.size(); ++i) {
+        if (i > 0) {
+            body += ',';
+        }
+        body += records[i];
+    }
+    body += "]}";
+
+    if (!billing_client_->reportUsageSpoolBatch(body)) {
+        LOG_WARN("UsageTracker", "Spool drain failed, will retry (" +
+                 std::to_string(spool_->pendingBytes()) + " bytes pending)");
+        return false;
+    }
+
+    // Cursor-based acknowledgment: only advance once the server accepted
+    // the batch, so a crash mid-drain re-sends instead of losing records
+    spool_->commit(next_cursor);
+    LOG_INFO("UsageTracker", "Drained " + std::to_string(records.size()) +
+             " spooled usage events (" + std::to_string(spool_->pendingBytes()) + " bytes remaining)");
+    return true;
+}
+
 void UsageTracker::storeBatchInDatabase(const std::vector<UsageEvent>& events) {
     std::vector<brinkbyte::billing::UsageEvent> db_events;
     
@@ -1,4 +1,5 @@
 #include "bytetrack/BYTETracker.h"
+#include <cstring>
 #include <fstream>
 
 BYTETracker::BYTETracker(int frame_rate, int track_buffer)
@@ -238,4 +239,168 @@ vector<STrack> BYTETracker::update(const vector<Object>& objects)
 		}
 	}
 	return output_stracks;
-}
\ No newline at end of file
+}
+
+vector<STrack> BYTETracker::predict()
+{
+	//one Kalman step for every activated track, no association and no
+	//frame_id advance: the next update() still ages lost tracks by one,
+	//so max_time_lost keeps its meaning in detection frames
+	vector<STrack*> activated;
+	for (int i = 0; i < this->tracked_stracks.size(); i++)
+	{
+		if (this->tracked_stracks[i].is_activated)
+		{
+			activated.push_back(&this->tracked_stracks[i]);
+		}
+	}
+	STrack::multi_predict(activated, this->kalman_filter);
+
+	vector<STrack> output_stracks;
+	for (int i = 0; i < activated.size(); i++)
+	{
+		output_stracks.push_back(*activated[i]);
+	}
+	return output_stracks;
+}
+//state blob helpers for save_state/load_state
+namespace
+{
+	const unsigned int kStateMagic = 0x4B525454; //'TTRK'
+	const unsigned int kStateVersion = 1;
+
+	template <typename T>
+	void put_value(vector<unsigned char> &blob, const T &v)
+	{
+		const unsigned char *p = reinterpret_cast<const unsigned char*>(&v);
+		blob.insert(blob.end(), p, p + sizeof(T));
+	}
+
+	template <typename T>
+	bool get_value(const vector<unsigned char> &blob, size_t &pos, T &v)
+	{
+		if (pos + sizeof(T) > blob.size())
+			return false;
+		memcpy(&v, blob.data() + pos, sizeof(T));
+		pos += sizeof(T);
+		return true;
+	}
+
+	void put_track(vector<unsigned char> &blob, const STrack &track)
+	{
+		put_value(blob, track.is_activated);
+		put_value(blob, track.track_id);
+		put_value(blob, track.state);
+		put_value(blob, track.score);
+		put_value(blob, track.frame_id);
+		put_value(blob, track.tracklet_len);
+		put_value(blob, track.start_frame);
+		for (int i = 0; i < 4; i++)
+			put_value(blob, track._tlwh[i]);
+		for (int i = 0; i < 8; i++)
+			put_value(blob, track.mean(i));
+		for (int i = 0; i < 8; i++)
+		{
+			for (int j = 0; j < 8; j++)
+				put_value(blob, track.covariance(i, j));
+		}
+	}
+
+	bool get_track(const vector<unsigned char> &blob, size_t &pos, vector<STrack> &out)
+	{
+		bool is_activated;
+		int track_id, state, frame_id, tracklet_len, start_frame;
+		float score;
+		if (!get_value(blob, pos, is_activated)) return false;
+		if (!get_value(blob, pos, track_id)) return false;
+		if (!get_value(blob, pos, state)) return false;
+		if (!get_value(blob, pos, score)) return false;
+		if (!get_value(blob, pos, frame_id)) return false;
+		if (!get_value(blob, pos, tracklet_len)) return false;
+		if (!get_value(blob, pos, start_frame)) return false;
+
+		vector<float> tlwh_(4);
+		for (int i = 0; i < 4; i++)
+		{
+			if (!get_value(blob, pos, tlwh_[i])) return false;
+		}
+
+		STrack track(tlwh_, score);
+		track.is_activated = is_activated;
+		track.track_id = track_id;
+		track.state = state;
+		track.frame_id = frame_id;
+		track.tracklet_len = tracklet_len;
+		track.start_frame = start_frame;
+		for (int i = 0; i < 8; i++)
+		{
+			if (!get_value(blob, pos, track.mean(i))) return false;
+		}
+		for (int i = 0; i < 8; i++)
+		{
+			for (int j = 0; j < 8; j++)
+			{
+				if (!get_value(blob, pos, track.covariance(i, j))) return false;
+			}
+		}
+		track.static_tlwh();
+		track.static_tlbr();
+		out.push_back(track);
+		return true;
+	}
+}
+
+vector<unsigned char> BYTETracker::save_state()
+{
+	vector<unsigned char> blob;
+	put_value(blob, kStateMagic);
+	put_value(blob, kStateVersion);
+	put_value(blob, this->frame_id);
+	put_value(blob, STrack::get_id_count());
+
+	const vector<STrack> *lists[3] = { &tracked_stracks, &lost_stracks, &removed_stracks };
+	for (int l = 0; l < 3; l++)
+	{
+		put_value(blob, (unsigned int)lists[l]->size());
+		for (int i = 0; i < lists[l]->size(); i++)
+		{
+			put_track(blob, (*lists[l])[i]);
+		}
+	}
+	return blob;
+}
+
+bool BYTETracker::load_state(const vector<unsigned char> &blob)
+{
+	size_t pos = 0;
+	unsigned int magic, version;
+	if (!get_value(blob, pos, magic) || magic != kStateMagic)
+		return false;
+	if (!get_value(blob, pos, version) || version != kStateVersion)
+		return false;
+
+	int saved_frame_id, saved_id_count;
+	if (!get_value(blob, pos, saved_frame_id)) return false;
+	if (!get_value(blob, pos, saved_id_count)) return false;
+
+	vector<STrack> lists[3];
+	for (int l = 0; l < 3; l++)
+	{
+		unsigned int count;
+		if (!get_value(blob, pos, count)) return false;
+		for (unsigned int i = 0; i < count; i++)
+		{
+			if (!get_track(blob, pos, lists[l])) return false;
+		}
+	}
+
+	this->frame_id = saved_frame_id;
+	if (saved_id_count > STrack::get_id_count())
+	{
+		STrack::set_id_count(saved_id_count);
+	}
+	this->tracked_stracks = lists[0];
+	this->lost_stracks = lists[1];
+	this->removed_stracks = lists[2];
+	return true;
+}
@@ -167,11 +167,22 @@ void STrack::mark_removed()
 	state = TrackState::Removed;
 }
 
+static int _id_count = 0;
+
 int STrack::next_id()
 {
-	static int _count = 0;
-	_count++;
-	return _count;
+	_id_count++;
+	return _id_count;
+}
+
+int STrack::get_id_count()
+{
+	return _id_count;
+}
+
+void STrack::set_id_count(int count)
+{
+	_id_count = count;
 }
 
 int STrack::end_frame()
@@ -181,13 +192,22 @@ int STrack::end_frame()
 
 void STrack::multi_predict(vector<STrack*> &stracks, byte_kalman::KalmanFilter &kalman_filter)
 {
+	vector<KAL_MEAN*> means;
+	vector<KAL_COVA*> covariances;
+	means.reserve(stracks.size());
+	covariances.reserve(stracks.size());
 	for (int i = 0; i < stracks.size(); i++)
 	{
 		if (stracks[i]->state != TrackState::Tracked)
 		{
 			stracks[i]->mean[7] = 0;
 		}
-		kalman_filter.predict(stracks[i]->mean, stracks[i]->covariance);
+		means.push_back(&stracks[i]->mean);
+		covariances.push_back(&stracks[i]->covariance);
+	}
+	kalman_filter.predict_batch(means, covariances);
+	for (int i = 0; i < stracks.size(); i++)
+	{
 		stracks[i]->static_tlwh();
 		stracks[i]->static_tlbr();
 	}
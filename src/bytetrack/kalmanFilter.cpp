@@ -83,6 +83,56 @@ namespace byte_kalman
 		covariance = covariance1;
 	}
 
+	void KalmanFilter::predict_batch(std::vector<KAL_MEAN*>& means, std::vector<KAL_COVA*>& covariances)
+	{
+		const int n = (int)means.size();
+		if (n == 0) return;
+
+		//gather all states so the per-track 8-vector products become
+		//a handful of large GEMMs instead of hundreds of tiny ones
+		Eigen::Matrix<float, -1, 8, Eigen::RowMajor> state(n, 8);
+		Eigen::Matrix<float, -1, 1> heights(n);
+		for (int i = 0; i < n; i++) {
+			state.row(i) = *means[i];
+			heights(i) = (*means[i])(3);
+		}
+
+		//mean propagation for every track in one multiply
+		state = state * _motion_mat.transpose();
+
+		//covariance propagation: F * [P0 P1 ...] then ([F P0; F P1; ...]) * F^T
+		Eigen::Matrix<float, 8, -1> fp(8, 8 * n);
+		for (int i = 0; i < n; i++) {
+			fp.block<8, 8>(0, 8 * i) = *covariances[i];
+		}
+		fp = _motion_mat * fp;
+		Eigen::Matrix<float, -1, 8> fp_stacked(8 * n, 8);
+		for (int i = 0; i < n; i++) {
+			fp_stacked.block<8, 8>(8 * i, 0) = fp.block<8, 8>(0, 8 * i);
+		}
+		fp_stacked = fp_stacked * _motion_mat.transpose();
+
+		//scatter back, adding the per-track motion noise (built from the
+		//pre-predict height, matching the single-track predict())
+		for (int i = 0; i < n; i++) {
+			float h = heights(i);
+			KAL_MEAN tmp;
+			tmp << _std_weight_position * h,
+				_std_weight_position * h,
+				1e-2,
+				_std_weight_position * h,
+				_std_weight_velocity * h,
+				_std_weight_velocity * h,
+				1e-5,
+				_std_weight_velocity * h;
+			tmp = tmp.array().square();
+			KAL_COVA motion_cov = tmp.asDiagonal();
+
+			*means[i] = state.row(i);
+			*covariances[i] = fp_stacked.block<8, 8>(8 * i, 0) + motion_cov;
+		}
+	}
+
 	KAL_HDATA KalmanFilter::project(const KAL_MEAN &mean, const KAL_COVA &covariance)
 	{
 		DETECTBOX std;
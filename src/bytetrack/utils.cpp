@@ -1,5 +1,6 @@
 #include "bytetrack/BYTETracker.h"
 #include "bytetrack/lapjv.h"
+#include "bytetrack/IouKernel.h"
 
 vector<STrack*> BYTETracker::joint_stracks(vector<STrack*> &tlista, vector<STrack> &tlistb)
 {
@@ -130,28 +131,109 @@ void BYTETracker::linear_assignment(vector<vector<float> > &cost_matrix, int cos
 		return;
 	}
 
-	vector<int> rowsol; vector<int> colsol;
-	float c = lapjv(cost_matrix, rowsol, colsol, true, thresh);
-	for (int i = 0; i < rowsol.size(); i++)
+	int n_rows = cost_matrix_size;
+	int n_cols = cost_matrix_size_size;
+
+	//gating pre-pass: a pair with cost >= thresh can never appear in an
+	//optimal solution (leaving both sides unmatched costs exactly thresh in
+	//the extended problem), so rows/cols without any feasible pair are
+	//unmatched immediately and the rest splits into independent connected
+	//components. Dense LAPJV is O(n^3); solving each component separately
+	//keeps crowded frames off that cliff.
+	vector<int> parent(n_rows + n_cols);
+	for (int i = 0; i < parent.size(); i++)
+		parent[i] = i;
+
+	vector<bool> row_feasible(n_rows, false);
+	vector<bool> col_feasible(n_cols, false);
+	for (int i = 0; i < n_rows; i++)
 	{
-		if (rowsol[i] >= 0)
+		for (int j = 0; j < n_cols; j++)
 		{
-			vector<int> match;
-			match.push_back(i);
-			match.push_back(rowsol[i]);
-			matches.push_back(match);
+			if (cost_matrix[i][j] < thresh)
+			{
+				row_feasible[i] = true;
+				col_feasible[j] = true;
+				//union row i with col j
+				int a = i;
+				int b = n_rows + j;
+				while (parent[a] != a) a = parent[a] = parent[parent[a]];
+				while (parent[b] != b) b = parent[b] = parent[parent[b]];
+				if (a != b) parent[b] = a;
+			}
 		}
-		else
-		{
+	}
+
+	for (int i = 0; i < n_rows; i++)
+	{
+		if (!row_feasible[i])
 			unmatched_a.push_back(i);
-		}
+	}
+	for (int j = 0; j < n_cols; j++)
+	{
+		if (!col_feasible[j])
+			unmatched_b.push_back(j);
 	}
 
-	for (int i = 0; i < colsol.size(); i++)
+	//group feasible rows/cols by component root
+	map<int, pair<vector<int>, vector<int> > > components;
+	for (int i = 0; i < n_rows; i++)
 	{
-		if (colsol[i] < 0)
+		if (!row_feasible[i])
+			continue;
+		int r = i;
+		while (parent[r] != r) r = parent[r] = parent[parent[r]];
+		components[r].first.push_back(i);
+	}
+	for (int j = 0; j < n_cols; j++)
+	{
+		if (!col_feasible[j])
+			continue;
+		int r = n_rows + j;
+		while (parent[r] != r) r = parent[r] = parent[parent[r]];
+		components[r].second.push_back(j);
+	}
+
+	//solve the assignment inside each component and map indices back
+	map<int, pair<vector<int>, vector<int> > >::iterator it;
+	for (it = components.begin(); it != components.end(); ++it)
+	{
+		vector<int> &rows = it->second.first;
+		vector<int> &cols = it->second.second;
+
+		vector<vector<float> > sub_cost(rows.size());
+		for (int i = 0; i < rows.size(); i++)
 		{
-			unmatched_b.push_back(i);
+			sub_cost[i].resize(cols.size());
+			for (int j = 0; j < cols.size(); j++)
+			{
+				sub_cost[i][j] = cost_matrix[rows[i]][cols[j]];
+			}
+		}
+
+		vector<int> rowsol; vector<int> colsol;
+		lapjv(sub_cost, rowsol, colsol, true, thresh);
+		for (int i = 0; i < rowsol.size(); i++)
+		{
+			if (rowsol[i] >= 0)
+			{
+				vector<int> match;
+				match.push_back(rows[i]);
+				match.push_back(cols[rowsol[i]]);
+				matches.push_back(match);
+			}
+			else
+			{
+				unmatched_a.push_back(rows[i]);
+			}
+		}
+
+		for (int i = 0; i < colsol.size(); i++)
+		{
+			if (colsol[i] < 0)
+			{
+				unmatched_b.push_back(cols[i]);
+			}
 		}
 	}
 }
@@ -169,31 +251,24 @@ vector<vector<float> > BYTETracker::ious(vector<vector<float> > &atlbrs, vector<
 	}
 
 	//bbox_ious
+	// Pack boxes into SoA arrays and fill each contiguous row with the
+	// vectorized kernel (AVX2/NEON when available)
+	byte_track::IouBoxArray a_boxes, b_boxes;
+	a_boxes.reserve(atlbrs.size());
+	b_boxes.reserve(btlbrs.size());
+	for (int n = 0; n < atlbrs.size(); n++)
+	{
+		a_boxes.addTlbr(atlbrs[n][0], atlbrs[n][1], atlbrs[n][2], atlbrs[n][3]);
+	}
 	for (int k = 0; k < btlbrs.size(); k++)
 	{
-		vector<float> ious_tmp;
-		float box_area = (btlbrs[k][2] - btlbrs[k][0] + 1)*(btlbrs[k][3] - btlbrs[k][1] + 1);
-		for (int n = 0; n < atlbrs.size(); n++)
-		{
-			float iw = min(atlbrs[n][2], btlbrs[k][2]) - max(atlbrs[n][0], btlbrs[k][0]) + 1;
-			if (iw > 0)
-			{
-				float ih = min(atlbrs[n][3], btlbrs[k][3]) - max(atlbrs[n][1], btlbrs[k][1]) + 1;
-				if(ih > 0)
-				{
-					float ua = (atlbrs[n][2] - atlbrs[n][0] + 1)*(atlbrs[n][3] - atlbrs[n][1] + 1) + box_area - iw * ih;
-					ious[n][k] = iw * ih / ua;
-				}
-				else
-				{
-					ious[n][k] = 0.0;
-				}
-			}
-			else
-			{
-				ious[n][k] = 0.0;
-			}
-		}
+		b_boxes.addTlbr(btlbrs[k][0], btlbrs[k][1], btlbrs[k][2], btlbrs[k][3]);
+	}
+
+	for (int n = 0; n < atlbrs.size(); n++)
+	{
+		byte_track::calcIouRow(a_boxes.x1[n], a_boxes.y1[n], a_boxes.x2[n], a_boxes.y2[n],
+			a_boxes.area[n], b_boxes, ious[n].data());
 	}
 
 	return ious;
@@ -1,5 +1,7 @@
 #include "camera.h"
+#include <future>
 #include <iostream>
+#include "camera_manager.h"
 #include "components/source/gstreamer_source.h"
 #include "components/processor/object_detector_processor.h"
 #include "components/processor/object_tracker_processor.h"
@@ -9,13 +11,22 @@
 #include "components/processor/polygon_zone_manager.h"
 #include "components/sink/file_sink.h"
 #include "components/sink/database_sink.h"
+#include "components/sink/shm_export_sink.h"
 #include "logger.h"
 #include "components/telemetry.h"
+#include "telemetry_broadcaster.h"
+#include "utils/latency_metrics.h"
+#include "utils/jpeg_encoder.h"
+#include "utils/frame_memory_budget.h"
+#include "utils/quality_governor.h"
 
 namespace tapi {
 
 Camera::Camera(const std::string& id, const std::string& name)
-    : id_(id), name_(name.empty() ? id : name), running_(false), stopProcessing_(true) {
+    : id_(id), name_(name.empty() ? id : name), running_(false), frameGeneration_(0),
+      stopProcessing_(true), isFileSource_(false), lastFrameTimestamp_(0), skippedFrames_(0),
+      frameIndex_(0), lastFrameRequestMs_(0), lastConsumerRequestMs_(0) {
+    publishStatusSnapshot();
 }
 
 Camera::~Camera() {
@@ -35,6 +46,7 @@ std::string Camera::getName() const {
 void Camera::setName(const std::string& name) {
     std::lock_guard<std::mutex> lock(mutex_);
     name_ = name;
+    publishStatusSnapshot();
 }
 
 bool Camera::setSourceComponent(std::shared_ptr<SourceComponent> source) {
@@ -45,6 +57,7 @@ bool Camera::setSourceComponent(std::shared_ptr<SourceComponent> source) {
         source_->stop();
     }
     source_ = source;
+    publishStatusSnapshot();
     return true;
 }
 
@@ -60,6 +73,7 @@ bool Camera::addProcessorComponent(std::shared_ptr<ProcessorComponent> processor
         return false; // Already exists
     }
     processors_[id] = processor;
+    publishStatusSnapshot();
     return true;
 }
 
@@ -73,8 +87,9 @@ bool Camera::removeProcessorComponent(const std::string& id) {
     // Always call stop() to ensure proper cleanup of resources like shared memory
     // regardless of the component's or camera's running state
     it->second->stop();
-    
+
     processors_.erase(it);
+    publishStatusSnapshot();
     return true;
 }
 
@@ -103,6 +118,7 @@ bool Camera::addSinkComponent(std::shared_ptr<SinkComponent> sink) {
         return false; // Already exists
     }
     sinks_[id] = sink;
+    publishStatusSnapshot();
     return true;
 }
 
@@ -117,6 +133,7 @@ bool Camera::removeSinkComponent(const std::string& id) {
     // regardless of running state
     it->second->stop();
     sinks_.erase(it);
+    publishStatusSnapshot();
     return true;
 }
 
@@ -190,13 +207,34 @@ bool Camera::start() {
         return true; // Already running
     }
     
-    // Initialize all processor components
-    // Don't immediately fail if AI server is unavailable - the processors have retry logic
+    // Initialize processor and sink components in parallel: each component
+    // initializes independently of its peers (the source is started
+    // separately below), so a camera with many components pays the latency
+    // of its slowest initialize() rather than the sum. Results are collected
+    // per component and the failure handling below is unchanged.
+    std::vector<std::pair<std::shared_ptr<ProcessorComponent>, std::future<bool>>> processorInits;
+    processorInits.reserve(processors_.size());
     for (auto& pair : processors_) {
-        auto& processor = pair.second;
-        
+        auto processor = pair.second;
+        processorInits.emplace_back(processor, std::async(std::launch::async,
+            [processor] { return processor->initialize(); }));
+    }
+
+    std::vector<std::pair<std::shared_ptr<SinkComponent>, std::future<bool>>> sinkInits;
+    sinkInits.reserve(sinks_.size());
+    for (auto& pair : sinks_) {
+        auto sink = pair.second;
+        sinkInits.emplace_back(sink, std::async(std::launch::async,
+            [sink] { return sink->initialize(); }));
+    }
+
+    // Collect processor initialization results
+    // Don't immediately fail if AI server is unavailable - the processors have retry logic
+    for (auto& init : processorInits) {
+        auto& processor = init.first;
+
         // Initialize the processor but don't fail startup if only server availability fails
-        if (!processor->initialize()) {
+        if (!init.second.get()) {
             std::string errorMsg = "Failed to initialize processor component: " + processor->getId();
             
             // We're more lenient with AI server errors now since components have retry logic
@@ -254,10 +292,10 @@ bool Camera::start() {
         }
     }
     
-    // Start sinks
-    for (auto& pair : sinks_) {
-        auto& sink = pair.second;
-        if (!sink->initialize() || !sink->start()) {
+    // Start sinks (initialized in parallel above)
+    for (auto& init : sinkInits) {
+        auto& sink = init.first;
+        if (!init.second.get() || !sink->start()) {
             LOG_ERROR("Camera", "Failed to start sink component: " + sink->getId());
             success = false;
         }
@@ -265,12 +303,30 @@ bool Camera::start() {
     
     if (success) {
         running_ = true;
-        
-        // Start the background processing thread
+        publishStatusSnapshot();
+
+        // Determine pacing mode up front: file sources defer to GStreamer
+        // timing, live sources use adaptive real-time pacing
+        isFileSource_ = false;
+        if (source_) {
+            auto gstreamerSource = std::dynamic_pointer_cast<GStreamerSource>(source_);
+            if (gstreamerSource) {
+                auto config = gstreamerSource->getConfig();
+                if (config.contains("type") && config["type"].get<std::string>() == "file") {
+                    isFileSource_ = true;
+                }
+            }
+        }
+        lastFrameTimestamp_ = 0;
+        skippedFrames_ = 0;
+
+        // Schedule processing cycles on the shared worker pool instead of
+        // spawning a dedicated thread per camera
         stopProcessing_ = false;
-        processingThread_ = std::thread(&Camera::processingThread, this);
-        
-        LOG_INFO("Camera", "Started camera " + id_ + " with background processing");
+        CameraManager::getInstance().getWorkerPool().addRepeatingTask(
+            "camera:" + id_, [this] { return runProcessingCycle(); });
+
+        LOG_INFO("Camera", "Started camera " + id_ + " on shared worker pool");
     } else {
         // Cleanup any components that were successfully started
         stopComponents();
@@ -304,19 +360,24 @@ void Camera::stopComponents() {
 }
 
 bool Camera::stop() {
-    // First stop the processing thread
-    {
-        std::unique_lock<std::mutex> lock(processingMutex_);
-        stopProcessing_ = true;
-        processingCV_.notify_one();
+    // First deschedule the processing task; removal blocks until any
+    // in-flight cycle on a worker has finished
+    stopProcessing_ = true;
+    if (CameraManager::getInstance().getWorkerPool().removeRepeatingTask("camera:" + id_)) {
+        LOG_INFO("Camera", "Background processing for camera " + id_ + " descheduled");
     }
-    
-    // Join the thread if it's running
-    if (processingThread_.joinable()) {
-        processingThread_.join();
-        LOG_INFO("Camera", "Background processing thread for camera " + id_ + " stopped");
+
+    // Drain any in-flight detection stage before stopping components; its
+    // results are discarded since the pipeline is shutting down
+    if (pendingDetection_.active) {
+        try {
+            pendingDetection_.future.wait();
+        } catch (...) {
+            // Nothing to do; the stage is being discarded
+        }
+        pendingDetection_ = PendingDetection();
     }
-    
+
     // Now stop the components
     std::lock_guard<std::mutex> lock(mutex_);
     
@@ -351,100 +412,84 @@ bool Camera::stop() {
     }
     
     running_ = false;
+    publishStatusSnapshot();
     return success;
 }
 
-void Camera::processingThread() {
-    LOG_INFO("Camera", "Background processing thread for camera " + id_ + " started");
-    
-    // Check if this is a file source to adapt timing behavior
-    bool isFileSource = false;
-    if (source_) {
-        auto gstreamerSource = std::dynamic_pointer_cast<GStreamerSource>(source_);
-        if (gstreamerSource) {
-            auto config = gstreamerSource->getConfig();
-            if (config.contains("type") && config["type"].get<std::string>() == "file") {
-                isFileSource = true;
-            }
+bool Camera::restartSource() {
+    std::shared_ptr<SourceComponent> source;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_ || !source_) {
+            return false;
         }
+        source = source_;
     }
-    
-    // Variables to track processing time and frame skipping
-    int64_t lastFrameTimestamp = 0;
-    int skippedFrames = 0;
-    
-    if (isFileSource) {
-        LOG_INFO("Camera", "File source detected - using GStreamer timing for natural playback");
-    } else {
-        LOG_INFO("Camera", "Live source detected - using adaptive timing for real-time processing");
+
+    // Bounce only the source; processors, sinks and the processing task
+    // keep running and simply see no frames while the capture pipeline
+    // rebuilds from its cached description
+    LOG_WARN("Camera", "Restarting source component for camera " + id_);
+    source->stop();
+    if (!source->start()) {
+        LOG_ERROR("Camera", "Source restart failed for camera " + id_);
+        return false;
     }
-    
-    while (!stopProcessing_) {
-        auto processStart = std::chrono::high_resolution_clock::now();
+    return true;
+}
 
-        // Process a frame
-        bool frameProcessed = processFrame();
-        
-        auto processEnd = std::chrono::high_resolution_clock::now();
-        auto processingTime = std::chrono::duration_cast<std::chrono::milliseconds>(
-            processEnd - processStart).count();
-        
-        if (isFileSource) {
-            // For file sources, let GStreamer handle timing - just wait a bit if no frame was processed
-            if (!frameProcessed) {
-                std::unique_lock<std::mutex> lock(processingMutex_);
-                processingCV_.wait_for(lock, std::chrono::milliseconds(5), [this] {
-                    return stopProcessing_.load();
-                });
-            } else {
-                // For successful frame processing, minimal wait to allow GStreamer timing to work
-                std::unique_lock<std::mutex> lock(processingMutex_);
-                processingCV_.wait_for(lock, std::chrono::milliseconds(1), [this] {
-                    return stopProcessing_.load();
-                });
-            }
-        } else {
-            // Original live source timing logic
-            bool needSkipWait = false;
-            if (frameProcessed) {
-                int64_t currentTimestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
-                    std::chrono::system_clock::now().time_since_epoch()).count();
-                    
-                if (lastFrameTimestamp > 0) {
-                    int64_t timeDiff = currentTimestamp - lastFrameTimestamp;
-                    // If processing is taking longer than real-time, we need to skip waiting
-                    if (processingTime > 33) { // 33ms = ~30fps
-                        needSkipWait = true;
-                        skippedFrames++;
-                        
-                        // Log periodically about skipped frames
-                        if (skippedFrames % 30 == 0) {
-                            LOG_WARN("Camera", "Processing falling behind real-time. Skipped " 
-                                   + std::to_string(skippedFrames) + " waits to catch up.");
-                        }
-                    }
+std::chrono::milliseconds Camera::runProcessingCycle() {
+    if (stopProcessing_) {
+        return std::chrono::milliseconds(100); // Being descheduled
+    }
+
+    auto processStart = std::chrono::high_resolution_clock::now();
+
+    // Loop-liveness beacon: ticks whether or not a frame arrived, so the
+    // watchdog can tell a wedged pipeline from a silent source
+    heartbeats_.process.tick();
+
+    // Process a frame
+    bool frameProcessed = processFrame();
+
+    auto processEnd = std::chrono::high_resolution_clock::now();
+    auto processingTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+        processEnd - processStart).count();
+
+    if (isFileSource_) {
+        // For file sources, let GStreamer handle timing - just wait a bit if no frame was processed
+        return std::chrono::milliseconds(frameProcessed ? 1 : 5);
+    }
+
+    // Live source timing logic
+    bool needSkipWait = false;
+    if (frameProcessed) {
+        int64_t currentTimestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+
+        if (lastFrameTimestamp_ > 0) {
+            // If processing is taking longer than real-time, we need to skip waiting
+            if (processingTime > 33) { // 33ms = ~30fps
+                needSkipWait = true;
+                skippedFrames_++;
+
+                // Log periodically about skipped frames
+                if (skippedFrames_ % 30 == 0) {
+                    LOG_WARN("Camera", "Processing falling behind real-time. Skipped "
+                           + std::to_string(skippedFrames_) + " waits to catch up.");
                 }
-                
-                lastFrameTimestamp = currentTimestamp;
-            }
-            
-            // If no frame was processed or we need to skip waiting, don't wait or wait less
-            if (!frameProcessed || needSkipWait) {
-                std::unique_lock<std::mutex> lock(processingMutex_);
-                processingCV_.wait_for(lock, std::chrono::milliseconds(1), [this] {
-                    return stopProcessing_.load();
-                });
-            } else {
-                // Normal waiting when we're keeping up with real-time
-                std::unique_lock<std::mutex> lock(processingMutex_);
-                processingCV_.wait_for(lock, std::chrono::milliseconds(10), [this] {
-                    return stopProcessing_.load();
-                });
             }
         }
+
+        lastFrameTimestamp_ = currentTimestamp;
     }
-    
-    LOG_INFO("Camera", "Background processing thread for camera " + id_ + " exiting");
+
+    // If no frame was processed or we need to skip waiting, re-arm quickly;
+    // otherwise wait a normal interval to keep up with real time
+    if (!frameProcessed || needSkipWait) {
+        return std::chrono::milliseconds(1);
+    }
+    return std::chrono::milliseconds(10);
 }
 
 bool Camera::isRunning() const {
@@ -452,6 +497,23 @@ bool Camera::isRunning() const {
     return running_;
 }
 
+std::shared_ptr<const Camera::StatusSnapshot> Camera::getStatusSnapshot() const {
+    return std::atomic_load_explicit(&statusSnapshot_, std::memory_order_acquire);
+}
+
+void Camera::publishStatusSnapshot() {
+    auto next = std::make_shared<StatusSnapshot>();
+    next->id = id_;
+    next->name = name_;
+    next->running = running_;
+    next->hasSource = static_cast<bool>(source_);
+    next->processorCount = processors_.size();
+    next->sinkCount = sinks_.size();
+    std::atomic_store_explicit(&statusSnapshot_,
+        std::shared_ptr<const StatusSnapshot>(std::move(next)),
+        std::memory_order_release);
+}
+
 nlohmann::json Camera::getStatus(bool includeComponents) const {
     std::lock_guard<std::mutex> lock(mutex_);
     
@@ -459,7 +521,12 @@ nlohmann::json Camera::getStatus(bool includeComponents) const {
     status["id"] = id_;
     status["name"] = name_;
     status["running"] = running_;
-    
+
+    if (motionGate_.isEnabled()) {
+        status["motion_gate"] = motionGate_.getStatus();
+    }
+
+
     if (includeComponents) {
         // Add source status
         if (source_) {
@@ -506,30 +573,95 @@ bool Camera::processFrame() {
         return false;
     }
     
+    // Idle decode suspension: with no running processor, no running sink
+    // and no frame consumer inside the idle window, the source parks in
+    // grab-only mode. The first consumer request (or a component starting)
+    // resumes it on the next cycle — the pipeline never leaves PLAYING.
+    {
+        bool anyComponentConsuming = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (const auto& pair : processors_) {
+                if (pair.second->isRunning()) {
+                    anyComponentConsuming = true;
+                    break;
+                }
+            }
+            if (!anyComponentConsuming) {
+                for (const auto& pair : sinks_) {
+                    if (pair.second->isRunning()) {
+                        anyComponentConsuming = true;
+                        break;
+                    }
+                }
+            }
+        }
+        const int64_t nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        const bool viewerRecent =
+            (nowMs - lastConsumerRequestMs_.load(std::memory_order_relaxed)) <= kIdleSuspendTimeoutMs;
+        gstreamerSource->setSuspended(!anyComponentConsuming && !viewerRecent);
+    }
+
     LOG_DEBUG("Camera", "processFrame: Getting frame from GStreamer source for camera " + id_);
-    
-    // Get frame from source
-    cv::Mat rawFrame = gstreamerSource->getFrame();
-    
+
+    // Get a shared handle to the frame from the source's pool - no pixel copy
+    FramePtr rawHandle;
+    {
+        LatencyMetrics::ScopedStageTimer timer(gstreamerSource->latencyHandle("get_frame"));
+        rawHandle = gstreamerSource->getFrameHandle();
+    }
+    if (rawHandle && !rawHandle->empty()) {
+        gstreamerSource->stats().recordFrame(0);
+    }
+
     // Skip if frame is empty
-    if (rawFrame.empty()) {
+    if (!rawHandle || rawHandle->empty()) {
         LOG_DEBUG("Camera", "processFrame: Frame is empty for camera " + id_);
+
+        // Still join a pending detection stage so its results are published
+        // even when the source stalls
+        if (pendingDetection_.active) {
+            DetectionStageResult stage;
+            try {
+                stage = pendingDetection_.future.get();
+            } catch (const std::exception& e) {
+                LOG_ERROR("Camera", "processFrame: Exception joining detection stage for camera " + id_ + ": " + e.what());
+                stage.ok = false;
+            }
+            if (stage.ok) {
+                completeFrame(*pendingDetection_.rawHandle, std::move(stage),
+                              pendingDetection_.timestamp);
+            }
+            pendingDetection_ = PendingDetection();
+        }
         return false;
     }
+
+    heartbeats_.capture.tick();
+
+    // Read-only header sharing the pooled buffer
+    const cv::Mat& rawFrame = *rawHandle;
+
+    // Pre-scaled detector plane paired with this frame, if the source
+    // produced one; the handle keeps the pooled buffer alive across the
+    // async detection stage
+    FramePtr detectorPlaneHandle = gstreamerSource->getDetectorPlaneHandle();
+
+    // Capture-to-processing age of this frame, including any time it
+    // spent queued in the ring; published as its own latency stage so
+    // the metrics endpoint reports true glass-to-glass numbers
+    const int64_t frameAgeMicros = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - gstreamerSource->getLastCaptureTime()).count();
+    if (!frameAgeHandle_.valid()) {
+        frameAgeHandle_ = LatencyMetrics::getInstance().stageHandle("frame_age", id_);
+    }
+    frameAgeHandle_.record(frameAgeMicros);
     
     LOG_DEBUG("Camera", "processFrame: Got frame " + std::to_string(rawFrame.cols) + "x" + std::to_string(rawFrame.rows) + " for camera " + id_);
-    
-    // Create a collection for telemetry events
-    std::vector<TelemetryEvent> telemetryEvents;
-    
-    // Process frame through processor components
-    cv::Mat processedFrame = rawFrame.clone();
-    
-    // Store all detections from all object detector processors
-    std::vector<ObjectDetectorProcessor::Detection> allDetections;
-    
+
     LOG_DEBUG("Camera", "processFrame: Getting processors for camera " + id_);
-    
+
     // Get all processors and apply them in order
     std::vector<std::shared_ptr<ProcessorComponent>> processors;
     {
@@ -538,33 +670,231 @@ bool Camera::processFrame() {
             processors.push_back(pair.second);
         }
     }
-    
-    LOG_DEBUG("Camera", "processFrame: Found " + std::to_string(processors.size()) + " processors for camera " + id_);
-    
+
+    // Copy-on-write: only take a private copy of the frame when a running
+    // processor is actually going to draw on it. Pass-through cameras share
+    // the pooled buffer end to end with zero copies.
+    bool anyProcessorRunning = false;
+    bool anyDetectorRunning = false;
+    bool anyDetectorDue = false;
+    const uint64_t frameIndex = frameIndex_++;
+    // Under load the governor stretches every detector's stride; the
+    // tracker bridges the extra gap frames like any stride frame
+    const uint64_t governorStride = static_cast<uint64_t>(
+        utils::QualityGovernor::getInstance().detectionStrideMultiplier());
+    for (const auto& processor : processors) {
+        if (processor->isRunning()) {
+            anyProcessorRunning = true;
+            if (auto detector = std::dynamic_pointer_cast<ObjectDetectorProcessor>(processor)) {
+                if (!anyDetectorRunning) {
+                    // Size the source's pre-scaled detector plane to the
+                    // first detector's model input; a detector whose input
+                    // size differs simply falls back to its own resize
+                    const int inputSize = detector->getInputSize();
+                    gstreamerSource->setDetectorPlaneSize(inputSize, inputSize);
+                }
+                anyDetectorRunning = true;
+                // Per-component stride: a detector with frame_stride N only
+                // runs on every Nth frame of this camera's pipeline
+                if (frameIndex % (static_cast<uint64_t>(detector->getFrameStride()) * governorStride) == 0) {
+                    anyDetectorDue = true;
+                }
+            }
+        }
+    }
     // Create current timestamp
     int64_t currentTimestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::system_clock::now().time_since_epoch()).count();
-    
-    LOG_DEBUG("Camera", "processFrame: Starting object detector processing for camera " + id_);
-    
+
+    // Annotation is demand-driven: drawing runs only while a frame route
+    // was hit recently or an annotated-frame sink is recording. Headless
+    // cameras skip every draw call and the frame clones drawing requires.
+    bool annotationWanted =
+        (currentTimestamp - lastFrameRequestMs_.load(std::memory_order_relaxed)) <= kAnnotationIdleTimeoutMs;
+    if (!annotationWanted) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& pair : sinks_) {
+            auto fileSink = std::dynamic_pointer_cast<FileSink>(pair.second);
+            if (fileSink && fileSink->isRunning() &&
+                !(fileSink->getConfig().contains("use_raw_frame") &&
+                  fileSink->getConfig()["use_raw_frame"].get<bool>())) {
+                annotationWanted = true;
+                break;
+            }
+        }
+    }
+    // Frame memory pressure sheds annotation before anything else:
+    // viewers fall back to raw frames while inference continues untouched
+    if (annotationWanted &&
+        utils::FrameMemoryBudget::getInstance().shouldShed(
+            utils::FrameMemoryBudget::ShedClass::Annotation)) {
+        annotationWanted = false;
+        LatencyMetrics::getInstance().incrementCounter(
+            "tapi_frame_budget_shed_total",
+            "class=\"annotation\",camera=\"" + id_ + "\"");
+    }
+    // The quality governor sheds annotation the same way when the box
+    // itself (CPU or frame age) is the bottleneck
+    if (annotationWanted && utils::QualityGovernor::getInstance().shedAnnotation()) {
+        annotationWanted = false;
+        LatencyMetrics::getInstance().incrementCounter(
+            "tapi_governor_shed_total",
+            "class=\"annotation\",camera=\"" + id_ + "\"");
+    }
+
+    for (const auto& processor : processors) {
+        processor->setAnnotationActive(annotationWanted);
+    }
+
+    // Processors only write on the frame when they annotate it, so the
+    // private copy is needed only while annotation is active
+    cv::Mat processedFrame = (anyProcessorRunning && annotationWanted)
+        ? rawFrame.clone() : rawFrame;
+
+    LOG_DEBUG("Camera", "processFrame: Found " + std::to_string(processors.size()) + " processors for camera " + id_);
+
+    // Motion gating: when a detector has motion_gating enabled, suppress
+    // inference on static frames. The gate still lets a slow heartbeat
+    // through and resumes full rate on the first frame with motion.
+    if (anyDetectorDue) {
+        for (const auto& processor : processors) {
+            if (!processor->isRunning()) {
+                continue;
+            }
+            if (auto detector = std::dynamic_pointer_cast<ObjectDetectorProcessor>(processor)) {
+                motionGate_.configure(detector->getMotionGatingConfig());
+                break;
+            }
+        }
+        if (motionGate_.isEnabled() &&
+            !motionGate_.shouldRunInference(rawFrame, currentTimestamp)) {
+            LOG_DEBUG("Camera", "processFrame: Motion gate suppressed detection for camera " + id_);
+            anyDetectorDue = false;
+        }
+
+        // Frame already over the age budget: shed this inference pass so
+        // the pipeline catches up instead of compounding the backlog; the
+        // tracker bridges the gap exactly as it does for stride frames
+        if (anyDetectorDue && frameAgeMicros > kFrameAgeBudgetMs * 1000) {
+            LOG_DEBUG("Camera", "processFrame: Frame age " +
+                      std::to_string(frameAgeMicros / 1000) +
+                      "ms over budget, shedding detection for camera " + id_);
+            LatencyMetrics::getInstance().incrementCounter(
+                "tapi_frame_age_shed_total", "camera=\"" + id_ + "\"");
+            anyDetectorDue = false;
+        }
+    }
+
+    // Launch this frame's detector stage asynchronously so the next frame's
+    // capture and preprocessing overlap with the inference round trip
+    PendingDetection current;
+    if (anyDetectorRunning && anyDetectorDue) {
+        LOG_DEBUG("Camera", "processFrame: Launching async detection stage for camera " + id_);
+
+        // Snapshot the motion regions on this thread; the async stage uses
+        // them for ROI-cropped detection
+        std::vector<cv::Rect> motionRois;
+        if (motionGate_.isEnabled()) {
+            motionRois = motionGate_.getMotionRois();
+        }
+
+        current.active = true;
+        current.rawHandle = rawHandle;
+        current.timestamp = currentTimestamp;
+        current.future = std::async(std::launch::async,
+            [this, processors, processedFrame, currentTimestamp, frameIndex,
+             motionRois = std::move(motionRois), detectorPlaneHandle]() mutable {
+                return runDetectionStage(processors, processedFrame, currentTimestamp,
+                                         frameIndex, std::move(motionRois),
+                                         std::move(detectorPlaneHandle));
+            });
+    }
+
+    bool frameCompleted = true;
+
+    // Join the previous frame's detection stage and run the tracker and
+    // downstream stages on its results
+    if (pendingDetection_.active) {
+        DetectionStageResult stage;
+        try {
+            stage = pendingDetection_.future.get();
+        } catch (const std::exception& e) {
+            LOG_ERROR("Camera", "processFrame: Exception joining detection stage for camera " + id_ + ": " + e.what());
+            stage.ok = false;
+        }
+
+        if (stage.ok) {
+            frameCompleted = completeFrame(*pendingDetection_.rawHandle, std::move(stage),
+                                           pendingDetection_.timestamp);
+        } else {
+            frameCompleted = false;
+        }
+        pendingDetection_ = PendingDetection();
+    }
+
+    if (current.active) {
+        // Hand the in-flight stage over to the next cycle
+        pendingDetection_ = std::move(current);
+        gstreamerSource->signalFrameProcessed();
+        return frameCompleted;
+    }
+
+    // No detector due this frame: complete synchronously. When a detector
+    // exists but its stride skipped this frame, the tracker bridges the
+    // gap via Kalman prediction instead of consuming empty detections.
+    DetectionStageResult stage;
+    stage.processedFrame = processedFrame;
+    stage.detectionsFresh = !anyDetectorRunning;
+    if (!completeFrame(rawFrame, std::move(stage), currentTimestamp)) {
+        return false;
+    }
+
+    gstreamerSource->signalFrameProcessed();
+
+    LOG_DEBUG("Camera", "processFrame: Frame processing completed successfully for camera " + id_);
+
+    return frameCompleted;
+}
+
+Camera::DetectionStageResult Camera::runDetectionStage(
+    const std::vector<std::shared_ptr<ProcessorComponent>>& processors,
+    cv::Mat frame, int64_t timestamp, uint64_t frameIndex,
+    std::vector<cv::Rect> motionRois, FramePtr detectorPlane) {
+
+    DetectionStageResult stage;
+
+    LOG_DEBUG("Camera", "runDetectionStage: Starting object detector processing for camera " + id_);
+
     // Process object detectors first to collect detections
     for (const auto& processor : processors) {
         if (processor->isRunning()) {
-            LOG_DEBUG("Camera", "processFrame: Processing processor " + processor->getId() + " for camera " + id_);
-            
             // If it's an ObjectDetectorProcessor, use its specialized method
             auto objectDetector = std::dynamic_pointer_cast<ObjectDetectorProcessor>(processor);
             if (objectDetector) {
-                LOG_DEBUG("Camera", "processFrame: Found ObjectDetectorProcessor " + processor->getId() + " for camera " + id_);
-                
+                // Honor each detector's own stride (stretched by the
+                // governor under load); another detector being due is what
+                // launched this stage
+                const uint64_t effectiveStride =
+                    static_cast<uint64_t>(objectDetector->getFrameStride()) *
+                    static_cast<uint64_t>(utils::QualityGovernor::getInstance().detectionStrideMultiplier());
+                if (frameIndex % effectiveStride != 0) {
+                    continue;
+                }
+
+                LOG_DEBUG("Camera", "runDetectionStage: Found ObjectDetectorProcessor " + processor->getId() + " for camera " + id_);
+
                 try {
-                    auto result = objectDetector->processFrame(processedFrame);
-                    processedFrame = result.first;
+                    LatencyMetrics::ScopedStageTimer timer(processor->latencyHandle("detector"));
+                    auto result = objectDetector->processFrame(
+                        frame, motionRois,
+                        detectorPlane ? *detectorPlane : cv::Mat());
+                    frame = result.first;
                     // Add the detections to our collection
-                    allDetections.insert(allDetections.end(), result.second.begin(), result.second.end());
-                    
-                    LOG_DEBUG("Camera", "processFrame: ObjectDetectorProcessor " + processor->getId() + " produced " + std::to_string(result.second.size()) + " detections for camera " + id_);
-                    
+                    stage.detections.insert(stage.detections.end(), result.second.begin(), result.second.end());
+                    processor->stats().recordFrame(result.second.size());
+
+                    LOG_DEBUG("Camera", "runDetectionStage: ObjectDetectorProcessor " + processor->getId() + " produced " + std::to_string(result.second.size()) + " detections for camera " + id_);
+
                     // Convert each detection to a standardized telemetry event
                     for (const auto& detection : result.second) {
                         TelemetryEvent event = TelemetryFactory::createDetectionEvent(
@@ -572,26 +902,45 @@ bool Camera::processFrame() {
                             detection.className,
                             detection.confidence,
                             TelemetryBBox::fromRect(detection.bbox),
-                            currentTimestamp
+                            timestamp
                         );
                         event.setCameraId(id_);
-                        telemetryEvents.push_back(event);
+                        stage.telemetryEvents.push_back(event);
                     }
-                    
-                    LOG_DEBUG("Camera", "processFrame: ObjectDetectorProcessor " + processor->getId() + " completed successfully for camera " + id_);
                 } catch (const std::exception& e) {
-                    LOG_ERROR("Camera", "processFrame: Exception in ObjectDetectorProcessor " + processor->getId() + " for camera " + id_ + ": " + e.what());
-                    return false;
+                    LOG_ERROR("Camera", "runDetectionStage: Exception in ObjectDetectorProcessor " + processor->getId() + " for camera " + id_ + ": " + e.what());
+                    stage.ok = false;
+                    return stage;
                 }
             }
-        } else {
-            LOG_DEBUG("Camera", "processFrame: Processor " + processor->getId() + " is not running for camera " + id_);
         }
     }
-    
-    LOG_DEBUG("Camera", "processFrame: Collected " + std::to_string(allDetections.size()) + " total detections for camera " + id_);
+
+    stage.processedFrame = frame;
+    heartbeats_.detect.tick();
+
+    LOG_DEBUG("Camera", "runDetectionStage: Collected " + std::to_string(stage.detections.size()) + " total detections for camera " + id_);
+
+    return stage;
+}
+
+bool Camera::completeFrame(const cv::Mat& rawFrame, DetectionStageResult stage, int64_t currentTimestamp) {
+    cv::Mat processedFrame = stage.processedFrame;
+    std::vector<TelemetryEvent> telemetryEvents = std::move(stage.telemetryEvents);
+    std::vector<ObjectDetectorProcessor::Detection> allDetections = std::move(stage.detections);
+    const bool detectionsFresh = stage.detectionsFresh;
+
+    // Get all processors and apply the downstream stages in order
+    std::vector<std::shared_ptr<ProcessorComponent>> processors;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& pair : processors_) {
+            processors.push_back(pair.second);
+        }
+    }
+
     LOG_DEBUG("Camera", "processFrame: Starting object tracker processing for camera " + id_);
-    
+
     // Process trackers with the collected detections
     std::vector<ObjectTrackerProcessor::TrackedObject> allTrackedObjects;
     for (const auto& processor : processors) {
@@ -604,10 +953,14 @@ bool Camera::processFrame() {
                 try {
                     LOG_DEBUG("Camera", "processFrame: Calling processFrame on ObjectTrackerProcessor " + processor->getId() + " with " + std::to_string(allDetections.size()) + " detections for camera " + id_);
                     
-                    auto result = objectTracker->processFrame(processedFrame, allDetections);
+                    LatencyMetrics::ScopedStageTimer timer(processor->latencyHandle("tracker"));
+                    auto result = detectionsFresh
+                        ? objectTracker->processFrame(processedFrame, allDetections)
+                        : objectTracker->predictFrame(processedFrame);
                     processedFrame = result.first;
                     // Add tracked objects to our collection
                     allTrackedObjects.insert(allTrackedObjects.end(), result.second.begin(), result.second.end());
+                    processor->stats().recordFrame(result.second.size());
                     
                     LOG_DEBUG("Camera", "processFrame: ObjectTrackerProcessor " + processor->getId() + " produced " + std::to_string(result.second.size()) + " tracked objects for camera " + id_);
                     
@@ -626,7 +979,9 @@ bool Camera::processFrame() {
                             trackedObj.confidence,
                             TelemetryBBox::fromRect(trackedObj.bbox),
                             trajectory,
-                            currentTimestamp
+                            currentTimestamp,
+                            objectTracker->getTrajectoryEpsilon(),
+                            objectTracker->getTrajectoryMaxPoints()
                         );
                         event.setCameraId(id_);
                         event.setProperty("age", trackedObj.age);
@@ -655,28 +1010,54 @@ bool Camera::processFrame() {
                 LOG_DEBUG("Camera", "processFrame: Found LineZoneManager " + processor->getId() + " for camera " + id_);
                 
                 try {
+                    LatencyMetrics::ScopedStageTimer timer(processor->latencyHandle("line_zones"));
                     auto result = lineZoneManager->processFrame(processedFrame, allTrackedObjects);
                     processedFrame = result.first;
                     // Add crossing events to our collection
                     allCrossingEvents.insert(allCrossingEvents.end(), result.second.begin(), result.second.end());
+                    processor->stats().recordFrame(result.second.size());
                     
                     LOG_DEBUG("Camera", "processFrame: LineZoneManager " + processor->getId() + " produced " + std::to_string(result.second.size()) + " crossing events for camera " + id_);
                     
                     // Convert each crossing event to a standardized telemetry event
-                    for (const auto& crossingEvent : result.second) {
-                        TelemetryEvent event = TelemetryFactory::createCrossingEvent(
+                    // (suppressed when the manager aggregates counts instead)
+                    if (lineZoneManager->emitPerCrossingEvents()) {
+                        for (const auto& crossingEvent : result.second) {
+                            TelemetryEvent event = TelemetryFactory::createCrossingEvent(
+                                processor->getId(),
+                                crossingEvent.zoneId,
+                                std::stoi(crossingEvent.objectId),  // Convert string trackId to int
+                                crossingEvent.className,
+                                crossingEvent.direction,
+                                TelemetryPoint::fromPoint(crossingEvent.location),
+                                currentTimestamp
+                            );
+                            event.setCameraId(id_);
+                            telemetryEvents.push_back(event);
+                        }
+                    }
+
+                    // Publish aggregated per-zone count deltas at the
+                    // configured cadence (empty unless aggregation is on
+                    // and the interval has elapsed)
+                    for (const auto& delta : lineZoneManager->drainCountDeltas(currentTimestamp)) {
+                        TelemetryEvent event = TelemetryFactory::createCustomEvent(
                             processor->getId(),
-                            crossingEvent.zoneId,
-                            std::stoi(crossingEvent.objectId),  // Convert string trackId to int
-                            crossingEvent.className,
-                            crossingEvent.direction,
-                            TelemetryPoint::fromPoint(crossingEvent.location),
+                            "zone_count_delta",
+                            nlohmann::json{
+                                {"zone_id", delta.zoneId},
+                                {"in_count", delta.inCount},
+                                {"out_count", delta.outCount},
+                                {"interval_start", delta.intervalStartMs},
+                                {"interval_end", delta.intervalEndMs}
+                            },
                             currentTimestamp
                         );
+                        event.setZoneId(delta.zoneId);
                         event.setCameraId(id_);
                         telemetryEvents.push_back(event);
                     }
-                    
+
                     LOG_DEBUG("Camera", "processFrame: LineZoneManager " + processor->getId() + " completed successfully for camera " + id_);
                 } catch (const std::exception& e) {
                     LOG_ERROR("Camera", "processFrame: Exception in LineZoneManager " + processor->getId() + " for camera " + id_ + ": " + e.what());
@@ -698,10 +1079,12 @@ bool Camera::processFrame() {
                 LOG_DEBUG("Camera", "processFrame: Found PolygonZoneManager " + processor->getId() + " for camera " + id_);
                 
                 try {
+                    LatencyMetrics::ScopedStageTimer timer(processor->latencyHandle("polygon_zones"));
                     auto result = polygonZoneManager->processFrame(processedFrame, allTrackedObjects);
                     processedFrame = result.first;
                     // Add polygon zone events to our collection
                     allPolygonZoneEvents.insert(allPolygonZoneEvents.end(), result.second.begin(), result.second.end());
+                    processor->stats().recordFrame(result.second.size());
                     
                     LOG_DEBUG("Camera", "processFrame: PolygonZoneManager " + processor->getId() + " completed successfully for camera " + id_);
                     
@@ -769,10 +1152,15 @@ bool Camera::processFrame() {
                 LOG_DEBUG("Camera", "processFrame: Found ObjectClassificationProcessor " + processor->getId() + " for camera " + id_);
                 
                 try {
-                    auto result = objectClassifier->processFrame(processedFrame);
+                    LatencyMetrics::ScopedStageTimer timer(processor->latencyHandle("classifier"));
+                    // Tracked objects let the processor serve cached
+                    // per-track labels; it falls back to the full-frame
+                    // path when track caching is disabled
+                    auto result = objectClassifier->processFrame(processedFrame, allTrackedObjects);
                     processedFrame = result.first;
                     // Add classifications to our collection
                     allClassifications.insert(allClassifications.end(), result.second.begin(), result.second.end());
+                    processor->stats().recordFrame(result.second.size());
                     
                     LOG_DEBUG("Camera", "processFrame: ObjectClassificationProcessor " + processor->getId() + " completed successfully for camera " + id_);
                     
@@ -807,10 +1195,20 @@ bool Camera::processFrame() {
                 LOG_DEBUG("Camera", "processFrame: Found AgeGenderDetectionProcessor " + processor->getId() + " for camera " + id_);
                 
                 try {
-                    auto result = ageGenderDetector->processFrame(processedFrame);
+                    LatencyMetrics::ScopedStageTimer timer(processor->latencyHandle("age_gender"));
+                    // Offer tracked-object boxes as crop candidates; the
+                    // processor falls back to the full frame when crop
+                    // batching is disabled or no tracks exist
+                    std::vector<cv::Rect> cropRegions;
+                    cropRegions.reserve(allTrackedObjects.size());
+                    for (const auto& trackedObject : allTrackedObjects) {
+                        cropRegions.push_back(trackedObject.bbox);
+                    }
+                    auto result = ageGenderDetector->processFrame(processedFrame, cropRegions);
                     processedFrame = result.first;
                     // Add results to our collection
                     allAgeGenderResults.insert(allAgeGenderResults.end(), result.second.begin(), result.second.end());
+                    processor->stats().recordFrame(result.second.size());
                     
                     LOG_DEBUG("Camera", "processFrame: AgeGenderDetectionProcessor " + processor->getId() + " completed successfully for camera " + id_);
                     
@@ -846,7 +1244,19 @@ bool Camera::processFrame() {
     }
     
     LOG_DEBUG("Camera", "processFrame: Starting sink processing for camera " + id_);
-    
+
+    // Freeze this frame's events into one shared immutable batch. All
+    // consumers below — sinks, the WebSocket broadcaster, status readers
+    // — hold references to it, so the events are constructed exactly once
+    // no matter how many consumers are attached.
+    for (auto& event : telemetryEvents) {
+        if (event.getCameraId().empty()) {
+            event.setCameraId(id_);
+        }
+    }
+    TelemetryEventList eventBatch =
+        std::make_shared<const std::vector<TelemetryEvent>>(std::move(telemetryEvents));
+
     // Send frames and telemetry to sink components
     std::vector<std::shared_ptr<SinkComponent>> sinks;
     {
@@ -861,6 +1271,8 @@ bool Camera::processFrame() {
             LOG_DEBUG("Camera", "processFrame: Processing sink " + sink->getId() + " for camera " + id_);
             
             try {
+                LatencyMetrics::ScopedStageTimer timer(sink->latencyHandle("sink"));
+
                 // If it's a FileSink, use its specialized method for frames
                 auto fileSink = std::dynamic_pointer_cast<FileSink>(sink);
                 if (fileSink) {
@@ -868,7 +1280,7 @@ bool Camera::processFrame() {
                     bool useRawFrame = fileSink->getConfig().contains("use_raw_frame") && 
                                       fileSink->getConfig()["use_raw_frame"].get<bool>();
                     
-                    fileSink->processFrame(useRawFrame ? rawFrame : processedFrame);
+                    fileSink->processFrame(useRawFrame ? rawFrame : processedFrame, *eventBatch);
                     LOG_DEBUG("Camera", "processFrame: FileSink " + sink->getId() + " completed successfully for camera " + id_);
                 }
                 
@@ -876,10 +1288,23 @@ bool Camera::processFrame() {
                 auto databaseSink = std::dynamic_pointer_cast<DatabaseSink>(sink);
                 if (databaseSink) {
                     // Always pass the raw frame for heatmap generation and the telemetry events
-                    databaseSink->processTelemetry(rawFrame, telemetryEvents);
+                    databaseSink->processTelemetry(rawFrame, *eventBatch);
                     LOG_DEBUG("Camera", "processFrame: DatabaseSink " + sink->getId() + " completed successfully for camera " + id_);
                 }
+
+                // If it's a ShmExportSink, publish the frame and events to
+                // co-located shared-memory consumers
+                auto shmSink = std::dynamic_pointer_cast<ShmExportSink>(sink);
+                if (shmSink) {
+                    // Use the config to determine which frame to use
+                    bool useRawFrame = shmSink->getConfig().contains("use_raw_frame") &&
+                                      shmSink->getConfig()["use_raw_frame"].get<bool>();
+
+                    shmSink->processFrame(useRawFrame ? rawFrame : processedFrame, *eventBatch);
+                    LOG_DEBUG("Camera", "processFrame: ShmExportSink " + sink->getId() + " completed successfully for camera " + id_);
+                }
                 // Add additional sink types here as needed
+                sink->stats().recordFrame(eventBatch->size());
             } catch (const std::exception& e) {
                 LOG_ERROR("Camera", "processFrame: Exception in sink " + sink->getId() + " for camera " + id_ + ": " + e.what());
                 return false;
@@ -889,48 +1314,93 @@ bool Camera::processFrame() {
     
     LOG_DEBUG("Camera", "processFrame: Storing frames and data for camera " + id_);
     
-    // Store both the raw and latest processed frames, detections, tracked objects, and telemetry events
+    // Store both the raw and latest processed frames, detections, tracked objects, and telemetry events.
+    // Headers share the pooled buffers; frames are immutable once published,
+    // so no defensive copies are needed.
     {
         std::lock_guard<std::mutex> lock(frameMutex_);
-        rawFrame_ = rawFrame.clone();
-        latestFrame_ = processedFrame.clone();
+        rawFrame_ = rawFrame;
+        latestFrame_ = processedFrame;
         latestDetections_ = allDetections;
         latestTrackedObjects_ = allTrackedObjects;
-        latestTelemetryEvents_ = telemetryEvents;
+        latestTelemetryEvents_ = eventBatch;
+        // Invalidate the encoded-frame caches and advance the ETag version
+        frameGeneration_.fetch_add(1, std::memory_order_release);
     }
-    
-    LOG_DEBUG("Camera", "processFrame: Signaling frame processed for camera " + id_);
-    
-    // In the simplified implementation, we don't need to signal frame processing
-    // The source continuously captures frames regardless of processing speed
-    // Kept for backward compatibility
-    gstreamerSource->signalFrameProcessed();
-    
-    LOG_DEBUG("Camera", "processFrame: Frame processing completed successfully for camera " + id_);
-    
+
+    // Push this frame's events to WebSocket subscribers (no-op when idle);
+    // subscribers buffer references to the shared batch, not copies
+    if (!eventBatch->empty()) {
+        TelemetryBroadcaster::getInstance().publish(id_, eventBatch);
+    }
+
+    heartbeats_.sink.tick();
+
+    LOG_DEBUG("Camera", "processFrame: Frame completed for camera " + id_);
+
     return true;
 }
 
+void Camera::markFrameRequested() const {
+    const int64_t nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    lastFrameRequestMs_.store(nowMs, std::memory_order_relaxed);
+    lastConsumerRequestMs_.store(nowMs, std::memory_order_relaxed);
+}
+
 cv::Mat Camera::getLatestFrame() const {
+    markFrameRequested();
     std::lock_guard<std::mutex> lock(frameMutex_);
-    return latestFrame_.clone();
+    // Published frames are immutable, so sharing the header is safe
+    return latestFrame_;
 }
 
 std::vector<uchar> Camera::getLatestFrameJpeg(int quality) const {
-    std::lock_guard<std::mutex> lock(frameMutex_);
-    
-    std::vector<uchar> buffer;
-    
-    // Check if we have a frame
-    if (latestFrame_.empty()) {
-        return buffer;
+    uint64_t generation = 0;
+    auto jpeg = getLatestFrameJpegCached(quality, generation);
+    return jpeg ? *jpeg : std::vector<uchar>();
+}
+
+std::shared_ptr<const std::vector<uchar>> Camera::getLatestFrameJpegCached(
+    int quality, uint64_t& generation) const {
+    markFrameRequested();
+
+    // Serialize encodes so concurrent pollers share one encode per frame
+    std::lock_guard<std::mutex> encodeLock(encodeMutex_);
+
+    uint64_t current = frameGeneration_.load(std::memory_order_acquire);
+    if (latestFrameJpegCache_.jpeg && latestFrameJpegCache_.generation == current &&
+        latestFrameJpegCache_.quality == quality) {
+        generation = current;
+        return latestFrameJpegCache_.jpeg;
     }
-    
-    // Encode frame as JPEG
-    std::vector<int> params = {cv::IMWRITE_JPEG_QUALITY, quality};
-    cv::imencode(".jpg", latestFrame_, buffer, params);
-    
-    return buffer;
+
+    // Grab a shared header of the published frame; the encode itself runs
+    // without holding frameMutex_ so the pipeline is never blocked on it
+    cv::Mat frame;
+    {
+        std::lock_guard<std::mutex> lock(frameMutex_);
+        frame = latestFrame_;
+        current = frameGeneration_.load(std::memory_order_acquire);
+    }
+
+    if (frame.empty()) {
+        return nullptr;
+    }
+
+    // Hardware encoder when the box has one, cv::imencode otherwise;
+    // either way the bytes land in a pooled buffer
+    auto buffer = utils::JpegEncoder::getInstance().encode(frame, quality);
+    if (!buffer) {
+        return nullptr;
+    }
+
+    latestFrameJpegCache_.jpeg = buffer;
+    latestFrameJpegCache_.generation = current;
+    latestFrameJpegCache_.quality = quality;
+
+    generation = current;
+    return latestFrameJpegCache_.jpeg;
 }
 
 std::vector<ObjectDetectorProcessor::Detection> Camera::getLatestDetections() const {
@@ -945,31 +1415,73 @@ std::vector<ObjectTrackerProcessor::TrackedObject> Camera::getLatestTrackedObjec
 
 std::vector<TelemetryEvent> Camera::getLatestTelemetryEvents() const {
     std::lock_guard<std::mutex> lock(frameMutex_);
-    return latestTelemetryEvents_;
+    // The batch is shared and immutable; only this API-facing getter
+    // materializes a copy
+    return latestTelemetryEvents_ ? *latestTelemetryEvents_ : std::vector<TelemetryEvent>();
 }
 
 // Add method to get raw frame
 cv::Mat Camera::getRawFrame() const {
+    lastConsumerRequestMs_.store(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count(),
+        std::memory_order_relaxed);
     std::lock_guard<std::mutex> lock(frameMutex_);
-    return rawFrame_.clone();
+    // Published frames are immutable, so sharing the header is safe
+    return rawFrame_;
 }
 
 // Add method to get raw frame as JPEG
 std::vector<uchar> Camera::getRawFrameJpeg(int quality) const {
-    std::lock_guard<std::mutex> lock(frameMutex_);
-    
-    std::vector<uchar> buffer;
-    
-    // Check if we have a frame
-    if (rawFrame_.empty()) {
-        return buffer;
+    uint64_t generation = 0;
+    auto jpeg = getRawFrameJpegCached(quality, generation);
+    return jpeg ? *jpeg : std::vector<uchar>();
+}
+
+std::shared_ptr<const std::vector<uchar>> Camera::getRawFrameJpegCached(
+    int quality, uint64_t& generation) const {
+    // Raw viewers count as frame consumers for decode suspension, but do
+    // not wake annotation drawing the way markFrameRequested() does
+    lastConsumerRequestMs_.store(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count(),
+        std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> encodeLock(encodeMutex_);
+
+    uint64_t current = frameGeneration_.load(std::memory_order_acquire);
+    if (rawFrameJpegCache_.jpeg && rawFrameJpegCache_.generation == current &&
+        rawFrameJpegCache_.quality == quality) {
+        generation = current;
+        return rawFrameJpegCache_.jpeg;
     }
-    
-    // Encode frame as JPEG
-    std::vector<int> params = {cv::IMWRITE_JPEG_QUALITY, quality};
-    cv::imencode(".jpg", rawFrame_, buffer, params);
-    
-    return buffer;
+
+    cv::Mat frame;
+    {
+        std::lock_guard<std::mutex> lock(frameMutex_);
+        frame = rawFrame_;
+        current = frameGeneration_.load(std::memory_order_acquire);
+    }
+
+    if (frame.empty()) {
+        return nullptr;
+    }
+
+    auto buffer = utils::JpegEncoder::getInstance().encode(frame, quality);
+    if (!buffer) {
+        return nullptr;
+    }
+
+    rawFrameJpegCache_.jpeg = buffer;
+    rawFrameJpegCache_.generation = current;
+    rawFrameJpegCache_.quality = quality;
+
+    generation = current;
+    return rawFrameJpegCache_.jpeg;
+}
+
+uint64_t Camera::getFrameGeneration() const {
+    return frameGeneration_.load(std::memory_order_acquire);
 }
 
 } // namespace tapi 
\ No newline at end of file
@@ -38,6 +38,40 @@ bool CameraLicenseManager::validateCameraLicense(const std::string& camera_id) {
     return true;
 }
 
+std::unordered_map<std::string, bool> CameraLicenseManager::validateCameraLicenses(
+    const std::vector<std::string>& camera_ids) {
+    std::unordered_map<std::string, bool> results;
+    results.reserve(camera_ids.size());
+
+    // One lock acquisition and one clock read for the whole fleet; each
+    // camera's verdict comes from the same snapshot
+    std::lock_guard<std::mutex> lock(licenses_mutex_);
+    auto now = std::chrono::system_clock::now();
+
+    size_t valid_count = 0;
+    for (const auto& camera_id : camera_ids) {
+        auto it = camera_licenses_.find(camera_id);
+        if (it == camera_licenses_.end()) {
+            results[camera_id] = false;
+            continue;
+        }
+
+        if (now > it->second.end_date) {
+            LOG_WARN("CameraLicenseManager", "License expired for camera: " + camera_id);
+            results[camera_id] = false;
+            continue;
+        }
+
+        it->second.last_heartbeat = now;
+        results[camera_id] = true;
+        valid_count++;
+    }
+
+    LOG_INFO("CameraLicenseManager", "Bulk validation: " + std::to_string(valid_count) + "/" +
+             std::to_string(camera_ids.size()) + " camera license(s) valid");
+    return results;
+}
+
 bool CameraLicenseManager::addCameraLicense(const std::string& camera_id, const std::string& tenant_id) {
     std::lock_guard<std::mutex> lock(licenses_mutex_);
     
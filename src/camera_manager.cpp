@@ -1,6 +1,11 @@
 #include "camera_manager.h"
+#include "components/source/gstreamer_source.h"
+#include "logger.h"
 #include <uuid/uuid.h>
 #include <iostream>
+#include <algorithm>
+#include <cstdlib>
+#include <unordered_map>
 
 namespace tapi {
 
@@ -10,7 +15,124 @@ CameraManager& CameraManager::getInstance() {
 }
 
 CameraManager::CameraManager()
-    : initialized_(false) {
+    : shardIndex_(-1), shardCount_(1), initialized_(false) {
+    publishCameraList();
+    watchdogThread_ = std::thread(&CameraManager::watchdogLoop, this);
+}
+
+CameraManager::~CameraManager() {
+    watchdogStop_ = true;
+    watchdogCv_.notify_all();
+    if (watchdogThread_.joinable()) {
+        watchdogThread_.join();
+    }
+}
+
+void CameraManager::watchdogLoop() {
+    const char* stallEnv = std::getenv("TAPI_WATCHDOG_STALL_SECONDS");
+    const int64_t stallMs = (stallEnv ? std::max(1, atoi(stallEnv)) : 10) * 1000;
+    const char* restartEnv = std::getenv("TAPI_WATCHDOG_RESTART");
+    const bool restartEnabled = !restartEnv || std::string(restartEnv) != "0";
+    const int64_t restartCooldownMs = 60000;
+
+    // Per-camera watchdog bookkeeping, keyed by camera id. firstSeenMs
+    // gives freshly started cameras a grace period before a never-ticked
+    // heartbeat counts as a stall.
+    struct CameraState {
+        int64_t firstSeenMs = 0;
+        int64_t lastRestartMs = 0;
+        bool stalled = false;
+    };
+    std::unordered_map<std::string, CameraState> states;
+
+    auto nowMs = [] {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    };
+
+    while (!watchdogStop_) {
+        {
+            std::unique_lock<std::mutex> lock(watchdogMutex_);
+            watchdogCv_.wait_for(lock, std::chrono::seconds(2),
+                                 [this] { return watchdogStop_.load(); });
+        }
+        if (watchdogStop_) {
+            break;
+        }
+
+        auto cameras = getAllCameras();
+        const int64_t now = nowMs();
+
+        for (const auto& camera : *cameras) {
+            auto snapshot = camera->getStatusSnapshot();
+            auto& state = states[snapshot->id];
+
+            if (!snapshot->running || !snapshot->hasSource) {
+                state.firstSeenMs = 0;
+                state.stalled = false;
+                camera->setStalled(false);
+                continue;
+            }
+            if (state.firstSeenMs == 0) {
+                state.firstSeenMs = now;
+            }
+
+            // A parked capture loop is idle by design, not stalled
+            auto source = std::dynamic_pointer_cast<GStreamerSource>(
+                camera->getSourceComponent());
+            if (source && source->isSuspended()) {
+                state.stalled = false;
+                camera->setStalled(false);
+                continue;
+            }
+
+            const auto& hb = camera->getHeartbeats();
+            const int64_t sinceStart = now - state.firstSeenMs;
+            const int64_t processAge = hb.process.ageMs();
+            const int64_t captureAge = hb.capture.ageMs();
+
+            // Never-ticked heartbeats count from when the camera started
+            const bool processStalled =
+                (processAge >= 0 ? processAge : sinceStart) > stallMs;
+            const bool captureStalled =
+                (captureAge >= 0 ? captureAge : sinceStart) > stallMs;
+            const bool stalled = processStalled || captureStalled;
+
+            if (stalled && !state.stalled) {
+                LOG_WARN("Watchdog", "Camera " + snapshot->id + " stalled: " +
+                         (processStalled ? "processing loop silent" : "source silent") +
+                         " (process age " + std::to_string(processAge) +
+                         "ms, capture age " + std::to_string(captureAge) + "ms)");
+            } else if (!stalled && state.stalled) {
+                LOG_INFO("Watchdog", "Camera " + snapshot->id + " recovered");
+            }
+            state.stalled = stalled;
+            camera->setStalled(stalled);
+
+            // A silent source with a live processing loop is the case a
+            // source bounce can fix; a wedged loop is not
+            if (captureStalled && !processStalled && restartEnabled &&
+                now - state.lastRestartMs > restartCooldownMs) {
+                state.lastRestartMs = now;
+                camera->restartSource();
+            }
+        }
+    }
+}
+
+void CameraManager::setShardPolicy(int shardIndex, int shardCount) {
+    std::lock_guard<std::mutex> lock(camerasMutex_);
+    shardIndex_ = shardIndex;
+    shardCount_ = shardCount > 0 ? shardCount : 1;
+    std::cout << "Camera shard policy: shard " << shardIndex_
+              << " of " << shardCount_ << std::endl;
+}
+
+bool CameraManager::ownsCameraId(const std::string& id) const {
+    if (shardIndex_ < 0 || shardCount_ <= 1) {
+        return true;
+    }
+    return static_cast<int>(std::hash<std::string>{}(id) % shardCount_) == shardIndex_;
 }
 
 bool CameraManager::initialize(const std::string& licenseKey) {
@@ -42,9 +164,23 @@ std::shared_ptr<Camera> CameraManager::createCamera(const std::string& id, const
         return nullptr;
     }
     
-    // Generate a unique ID if not provided
-    std::string cameraId = id.empty() ? generateUniqueId() : id;
+    // Generate a unique ID if not provided; in shard mode keep drawing
+    // until the id lands in this worker's shard so the camera stays with
+    // the process that created it across restarts
+    std::string cameraId = id;
+    if (cameraId.empty()) {
+        do {
+            cameraId = generateUniqueId();
+        } while (!ownsCameraId(cameraId));
+    }
     std::string cameraName = name.empty() ? cameraId : name;
+
+    // In shard mode each worker hosts only the ids its shard owns;
+    // restoring the shared configuration then partitions the fleet
+    if (!ownsCameraId(cameraId)) {
+        std::cout << "Camera " << cameraId << " belongs to another shard, skipping" << std::endl;
+        return nullptr;
+    }
     
     // Check if ID already exists
     if (cameras_.find(cameraId) != cameras_.end()) {
@@ -68,6 +204,7 @@ std::shared_ptr<Camera> CameraManager::createCamera(const std::string& id, const
     // CREATE camera instance with tenant association
     auto camera = std::make_shared<Camera>(cameraId, cameraName);
     cameras_[cameraId] = camera;
+    publishCameraList();
     
     // START heartbeat monitoring for license compliance
     cameraLicenseManager_.sendHeartbeat(cameraId);
@@ -93,6 +230,7 @@ bool CameraManager::deleteCamera(const std::string& id) {
     cameraLicenseManager_.removeCameraLicense(id);
     
     cameras_.erase(it);
+    publishCameraList();
     return true;
 }
 
@@ -112,15 +250,19 @@ bool CameraManager::cameraExists(const std::string& id) {
     return cameras_.find(id) != cameras_.end();
 }
 
-std::vector<std::shared_ptr<Camera>> CameraManager::getAllCameras() {
-    std::lock_guard<std::mutex> lock(camerasMutex_);
-    
-    std::vector<std::shared_ptr<Camera>> cameras;
+std::shared_ptr<const std::vector<std::shared_ptr<Camera>>> CameraManager::getAllCameras() const {
+    return std::atomic_load_explicit(&cameraList_, std::memory_order_acquire);
+}
+
+void CameraManager::publishCameraList() {
+    auto next = std::make_shared<std::vector<std::shared_ptr<Camera>>>();
+    next->reserve(cameras_.size());
     for (const auto& pair : cameras_) {
-        cameras.push_back(pair.second);
+        next->push_back(pair.second);
     }
-    
-    return cameras;
+    std::atomic_store_explicit(&cameraList_,
+        std::shared_ptr<const std::vector<std::shared_ptr<Camera>>>(std::move(next)),
+        std::memory_order_release);
 }
 
 const LicenseManager& CameraManager::getLicenseManager() const {
@@ -131,6 +273,15 @@ const CameraLicenseManager& CameraManager::getCameraLicenseManager() const {
     return cameraLicenseManager_;
 }
 
+std::unordered_map<std::string, bool> CameraManager::validateCameraLicenses(
+    const std::vector<std::string>& cameraIds) {
+    return cameraLicenseManager_.validateCameraLicenses(cameraIds);
+}
+
+WorkerPool& CameraManager::getWorkerPool() {
+    return workerPool_;
+}
+
 // Private helper method to generate unique IDs
 std::string CameraManager::generateUniqueId() {
     uuid_t uuid;
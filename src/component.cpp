@@ -29,6 +29,15 @@ bool Component::isRunning() const {
     return running_;
 }
 
+const LatencyMetrics::StageHandle& Component::latencyHandle(const std::string& stage) {
+    // A component only ever reports under one stage, so the first caller
+    // pays the registry lookup and everyone after reads the cached handle
+    if (!latencyHandle_.valid()) {
+        latencyHandle_ = LatencyMetrics::getInstance().stageHandle(stage, id_);
+    }
+    return latencyHandle_;
+}
+
 nlohmann::json Component::getStatus() const {
     nlohmann::json status;
     status["id"] = id_;
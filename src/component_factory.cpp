@@ -1,4 +1,5 @@
 #include "component_factory.h"
+#include <cstdint>
 #include <iostream>
 #include "logger.h"
 #include "components/source/gstreamer_source.h"
@@ -10,6 +11,7 @@
 #include "components/processor/polygon_zone_manager.h"
 #include "components/sink/file_sink.h"
 #include "components/sink/database_sink.h"
+#include "components/sink/shm_export_sink.h"
 #include "camera_manager.h"
 #include "license.h"
 #include "config_manager.h"
@@ -112,6 +114,148 @@ private:
     std::string type_;
 };
 
+namespace {
+
+// ============================================================================
+// Compile-time component registry
+//
+// The concrete types behind each type string are all known at compile time,
+// so instead of walking an if/else chain of std::string comparisons per
+// creation, each registry entry carries an FNV-1a hash of its type string
+// computed at compile time. Dispatch compares the precomputed hash first and
+// only falls back to a string compare to guard against collisions.
+// ============================================================================
+
+constexpr uint64_t kFnvOffsetBasis = 1469598103934665603ull;
+constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+constexpr uint64_t fnv1aHash(const char* s, uint64_t hash = kFnvOffsetBasis) {
+    return *s ? fnv1aHash(s + 1, (hash ^ static_cast<unsigned char>(*s)) * kFnvPrime)
+              : hash;
+}
+
+inline uint64_t fnv1aHash(const std::string& s) {
+    uint64_t hash = kFnvOffsetBasis;
+    for (char c : s) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * kFnvPrime;
+    }
+    return hash;
+}
+
+using ProcessorCreator = std::shared_ptr<ProcessorComponent> (*)(
+    const std::string&, Camera*, const std::string&, const nlohmann::json&);
+using SinkCreator = std::shared_ptr<SinkComponent> (*)(
+    const std::string&, Camera*, const std::string&, const nlohmann::json&);
+
+// Generic creator for components whose constructor takes the config as-is
+template <typename Base, typename Concrete>
+std::shared_ptr<Base> constructComponent(const std::string& id, Camera* camera,
+                                         const std::string& type,
+                                         const nlohmann::json& config) {
+    return std::make_shared<Concrete>(id, camera, type, config);
+}
+
+// Object detection needs config preparation (server URL, shared memory and
+// model discovery) before construction, so it gets a dedicated creator
+std::shared_ptr<ProcessorComponent> createObjectDetectionProcessor(
+    const std::string& id, Camera* camera, const std::string& effectiveType,
+    const nlohmann::json& config) {
+    // Make a mutable copy of the config so we can set the server URL
+    nlohmann::json processorConfig = config;
+
+    // Always set server URL from GlobalConfig to ensure consistency
+    std::string serverUrl = GlobalConfig::getInstance().getAiServerUrl();
+    processorConfig["server_url"] = serverUrl;
+    LOG_INFO("ComponentFactory", "Setting server_url for object detection processor from GlobalConfig: " + serverUrl);
+
+    // Always update the shared memory setting from GlobalConfig - this takes priority
+    bool useSharedMemory = GlobalConfig::getInstance().getUseSharedMemory();
+    processorConfig["use_shared_memory"] = useSharedMemory;
+    LOG_INFO("ComponentFactory", "Setting use_shared_memory for object detection processor: " +
+            std::string(useSharedMemory ? "true" : "false"));
+
+    // Log the incoming configuration for debugging
+    LOG_DEBUG("ComponentFactory", "Creating object_detection processor with config: " + config.dump());
+
+    // Only auto-set model_id if it's truly missing or empty AND we don't have a valid saved config
+    // Check if this looks like a saved configuration (has multiple fields populated)
+    bool isValidSavedConfig = config.contains("model_id") &&
+                             config.contains("classes") &&
+                             config.contains("confidence_threshold");
+
+    // Check if model_id is set in config; if not, try to find available models
+    // or use a fallback to avoid issues with hardcoded models like yolov4-tiny
+    if (!isValidSavedConfig &&
+        (!processorConfig.contains("model_id") || processorConfig["model_id"].is_null() ||
+        (processorConfig["model_id"].is_string() && processorConfig["model_id"].get<std::string>().empty()))) {
+
+        // Create a temporary copy of the config to avoid modifying the original
+        nlohmann::json tempConfig = processorConfig;
+
+        // Explicitly disable shared memory for temporary processors
+        tempConfig["use_shared_memory"] = false;
+
+        // Create a temporary processor to query available models
+        auto tempProcessor = std::make_shared<ObjectDetectorProcessor>("temp_id", nullptr, effectiveType, tempConfig);
+        auto availableModels = tempProcessor->getAvailableModels();
+
+        if (!availableModels.empty()) {
+            // If we have available models, use the first one
+            processorConfig["model_id"] = availableModels[0];
+            LOG_INFO("ComponentFactory", "Using first available model: " + availableModels[0]);
+        } else {
+            // If no models are available, use a placeholder to avoid hardcoding yolov4-tiny
+            processorConfig["model_id"] = "yolov7_tiny_onnx";
+            LOG_WARN("ComponentFactory", "No models available from server, using placeholder model_id: yolov7_tiny_onnx");
+        }
+    } else {
+        LOG_INFO("ComponentFactory", "Using saved configuration for object_detection processor");
+    }
+
+    return std::make_shared<ObjectDetectorProcessor>(id, camera, effectiveType, processorConfig);
+}
+
+template <typename Creator>
+struct RegistryEntry {
+    uint64_t typeHash;   ///< fnv1aHash(type), computed at compile time
+    const char* type;    ///< Type string, compared only on hash match
+    Creator create;      ///< Creation function for the concrete component
+};
+
+constexpr RegistryEntry<ProcessorCreator> kProcessorRegistry[] = {
+    {fnv1aHash("object_detection"), "object_detection", &createObjectDetectionProcessor},
+    {fnv1aHash("object_tracking"), "object_tracking",
+     &constructComponent<ProcessorComponent, ObjectTrackerProcessor>},
+    {fnv1aHash("line_zone_manager"), "line_zone_manager",
+     &constructComponent<ProcessorComponent, LineZoneManager>},
+    {fnv1aHash("object_classification"), "object_classification",
+     &constructComponent<ProcessorComponent, ObjectClassificationProcessor>},
+    {fnv1aHash("age_gender_detection"), "age_gender_detection",
+     &constructComponent<ProcessorComponent, AgeGenderDetectionProcessor>},
+    {fnv1aHash("polygon_zone_manager"), "polygon_zone_manager",
+     &constructComponent<ProcessorComponent, PolygonZoneManager>},
+};
+
+constexpr RegistryEntry<SinkCreator> kSinkRegistry[] = {
+    {fnv1aHash("file"), "file", &constructComponent<SinkComponent, FileSink>},
+    {fnv1aHash("database"), "database", &constructComponent<SinkComponent, DatabaseSink>},
+    {fnv1aHash("shm_export"), "shm_export", &constructComponent<SinkComponent, ShmExportSink>},
+};
+
+template <typename Creator, size_t N>
+const RegistryEntry<Creator>* lookupRegistry(const RegistryEntry<Creator> (&registry)[N],
+                                             const std::string& type) {
+    const uint64_t hash = fnv1aHash(type);
+    for (const auto& entry : registry) {
+        if (entry.typeHash == hash && type == entry.type) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
 // Initialize static instance
 ComponentFactory* ComponentFactory::instance_ = nullptr;
 
@@ -155,6 +299,7 @@ void ComponentFactory::registerComponentTypes() {
         // sinkTypeToString(SinkType::RTMP),
         sinkTypeToString(SinkType::FILE),
         sinkTypeToString(SinkType::DATABASE),
+        sinkTypeToString(SinkType::SHM_EXPORT),
         // sinkTypeToString(SinkType::WEBSOCKET),
         // sinkTypeToString(SinkType::MQTT)
     };
@@ -327,75 +472,13 @@ std::shared_ptr<ProcessorComponent> ComponentFactory::createProcessorComponent(
     }
     // ============================================================================
     
-    // Create the specific type of processor
-    if (effectiveType == "object_detection") {
-        // Make a mutable copy of the config so we can set the server URL
-        nlohmann::json processorConfig = config;
-        
-        // Always set server URL from GlobalConfig to ensure consistency
-        std::string serverUrl = GlobalConfig::getInstance().getAiServerUrl();
-        processorConfig["server_url"] = serverUrl;
-        LOG_INFO("ComponentFactory", "Setting server_url for object detection processor from GlobalConfig: " + serverUrl);
-        
-        // Always update the shared memory setting from GlobalConfig - this takes priority
-        bool useSharedMemory = GlobalConfig::getInstance().getUseSharedMemory();
-        processorConfig["use_shared_memory"] = useSharedMemory;
-        LOG_INFO("ComponentFactory", "Setting use_shared_memory for object detection processor: " + 
-                std::string(useSharedMemory ? "true" : "false"));
-
-        // Log the incoming configuration for debugging
-        LOG_DEBUG("ComponentFactory", "Creating object_detection processor with config: " + config.dump());
-        
-        // Only auto-set model_id if it's truly missing or empty AND we don't have a valid saved config
-        // Check if this looks like a saved configuration (has multiple fields populated)
-        bool isValidSavedConfig = config.contains("model_id") && 
-                                 config.contains("classes") && 
-                                 config.contains("confidence_threshold");
-        
-        // Check if model_id is set in config; if not, try to find available models
-        // or use a fallback to avoid issues with hardcoded models like yolov4-tiny
-        if (!isValidSavedConfig && 
-            (!processorConfig.contains("model_id") || processorConfig["model_id"].is_null() ||
-            (processorConfig["model_id"].is_string() && processorConfig["model_id"].get<std::string>().empty()))) {
-            
-            // Create a temporary copy of the config to avoid modifying the original
-            nlohmann::json tempConfig = processorConfig;
-            
-            // Explicitly disable shared memory for temporary processors
-            tempConfig["use_shared_memory"] = false;
-            
-            // Create a temporary processor to query available models
-            auto tempProcessor = std::make_shared<ObjectDetectorProcessor>("temp_id", nullptr, effectiveType, tempConfig);
-            auto availableModels = tempProcessor->getAvailableModels();
-            
-            if (!availableModels.empty()) {
-                // If we have available models, use the first one
-                processorConfig["model_id"] = availableModels[0];
-                LOG_INFO("ComponentFactory", "Using first available model: " + availableModels[0]);
-            } else {
-                // If no models are available, use a placeholder to avoid hardcoding yolov4-tiny
-                processorConfig["model_id"] = "yolov7_tiny_onnx";
-                LOG_WARN("ComponentFactory", "No models available from server, using placeholder model_id: yolov7_tiny_onnx");
-            }
-        } else {
-            LOG_INFO("ComponentFactory", "Using saved configuration for object_detection processor");
-        }
-        
-        return std::make_shared<ObjectDetectorProcessor>(id, camera, effectiveType, processorConfig);
-    } else if (effectiveType == "object_tracking") {
-        return std::make_shared<ObjectTrackerProcessor>(id, camera, effectiveType, config);
-    } else if (effectiveType == "line_zone_manager") {
-        return std::make_shared<LineZoneManager>(id, camera, effectiveType, config);
-    } else if (effectiveType == "object_classification") {
-        return std::make_shared<ObjectClassificationProcessor>(id, camera, effectiveType, config);
-    } else if (effectiveType == "age_gender_detection") {
-        return std::make_shared<AgeGenderDetectionProcessor>(id, camera, effectiveType, config);
-    } else if (effectiveType == "polygon_zone_manager") {
-        return std::make_shared<PolygonZoneManager>(id, camera, effectiveType, config);
-    } else {
-        // For other types, use the mock implementation for now
-        return std::make_shared<MockProcessorComponent>(id, camera, effectiveType, config);
+    // Create the specific type of processor via the compile-time registry
+    if (const auto* entry = lookupRegistry(kProcessorRegistry, effectiveType)) {
+        return entry->create(id, camera, effectiveType, config);
     }
+
+    // For other types, use the mock implementation for now
+    return std::make_shared<MockProcessorComponent>(id, camera, effectiveType, config);
 }
 
 std::shared_ptr<SinkComponent> ComponentFactory::createSinkComponent(
@@ -476,15 +559,13 @@ std::shared_ptr<SinkComponent> ComponentFactory::createSinkComponent(
     }
     // ============================================================================
     
-    // Create the specific type of sink
-    if (effectiveType == "file") {
-        return std::make_shared<FileSink>(id, camera, effectiveType, config);
-    } else if (effectiveType == "database") {
-        return std::make_shared<DatabaseSink>(id, camera, effectiveType, config);
-    } else {
-        // For other types, use the mock implementation for now
-        return std::make_shared<MockSinkComponent>(id, camera, effectiveType, config);
+    // Create the specific type of sink via the compile-time registry
+    if (const auto* entry = lookupRegistry(kSinkRegistry, effectiveType)) {
+        return entry->create(id, camera, effectiveType, config);
     }
+
+    // For other types, use the mock implementation for now
+    return std::make_shared<MockSinkComponent>(id, camera, effectiveType, config);
 }
 
 std::vector<std::string> ComponentFactory::getAvailableSourceTypes() const {
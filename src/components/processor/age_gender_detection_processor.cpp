@@ -13,6 +13,122 @@
 
 namespace tapi {
 
+namespace {
+
+/**
+ * @brief SAX handler that fills age/gender results straight from the
+ * response byte stream, skipping DOM construction
+ *
+ * The per-frame responses are either a flat array of result objects (single
+ * image) or an array of per-crop arrays (batched); both shapes land in
+ * `groups`, one entry per crop. Unknown keys are skipped so server-side
+ * additions do not break parsing.
+ */
+class AgeGenderResponseSax {
+public:
+    using Result = AgeGenderDetectionProcessor::AgeGenderResult;
+
+    /// Parsed results, one group per crop (a single group for flat responses)
+    std::vector<std::vector<Result>> groups;
+
+    bool null() { return true; }
+    bool boolean(bool) { return true; }
+    bool number_integer(std::int64_t val) { return number(static_cast<double>(val)); }
+    bool number_unsigned(std::uint64_t val) { return number(static_cast<double>(val)); }
+    bool number_float(double val, const std::string&) { return number(val); }
+    bool binary(nlohmann::json::binary_t&) { return true; }
+
+    bool string(std::string& val) {
+        if (depth_ == itemDepth_ && key_ == "gender") {
+            current_.gender = std::move(val);
+        }
+        return true;
+    }
+
+    bool key(std::string& val) {
+        key_ = std::move(val);
+        return true;
+    }
+
+    bool start_object(std::size_t) {
+        ++depth_;
+        if (depth_ == itemDepth_) {
+            current_ = Result{};
+            if (groups.empty()) {
+                groups.emplace_back();
+            }
+        } else if (depth_ == itemDepth_ + 1 && key_ == "bbox") {
+            inBbox_ = true;
+        }
+        return true;
+    }
+
+    bool end_object() {
+        if (depth_ == itemDepth_) {
+            groups.back().push_back(std::move(current_));
+        } else if (inBbox_ && depth_ == itemDepth_ + 1) {
+            inBbox_ = false;
+        }
+        --depth_;
+        return true;
+    }
+
+    bool start_array(std::size_t) {
+        ++depth_;
+        if (depth_ == 2) {
+            // An array nested directly under the root means a batched
+            // response: one group per crop, items one level deeper
+            itemDepth_ = 3;
+            groups.emplace_back();
+        }
+        return true;
+    }
+
+    bool end_array() {
+        --depth_;
+        return true;
+    }
+
+    bool parse_error(std::size_t position, const std::string&,
+                     const nlohmann::json::exception& ex) {
+        throw std::runtime_error("Malformed response at byte " +
+                                 std::to_string(position) + ": " + ex.what());
+    }
+
+private:
+    bool number(double val) {
+        if (inBbox_ && depth_ == itemDepth_ + 1) {
+            const int v = static_cast<int>(val);
+            if (key_ == "x") {
+                current_.bbox.x = v;
+            } else if (key_ == "y") {
+                current_.bbox.y = v;
+            } else if (key_ == "width") {
+                current_.bbox.width = v;
+            } else if (key_ == "height") {
+                current_.bbox.height = v;
+            }
+        } else if (depth_ == itemDepth_) {
+            if (key_ == "age") {
+                current_.age = static_cast<int>(val);
+            } else if (key_ == "age_confidence") {
+                current_.ageConfidence = static_cast<float>(val);
+            } else if (key_ == "gender_confidence") {
+                current_.genderConfidence = static_cast<float>(val);
+            }
+        }
+        return true;
+    }
+
+    Result current_{};
+    std::string key_;
+    int depth_ = 0;
+    int itemDepth_ = 2;   ///< Depth of a result object; 3 for batched responses
+    bool inBbox_ = false;
+};
+
+} // namespace
+
 AgeGenderDetectionProcessor::AgeGenderDetectionProcessor(
     const std::string& id, Camera* camera, const std::string& type, const nlohmann::json& config)
     : ProcessorComponent(id, camera),
@@ -23,6 +139,9 @@ AgeGenderDetectionProcessor::AgeGenderDetectionProcessor(
       drawDetections_(true),
       useSharedMemory_(false),
       textFontScale_(0.6f),
+      cropBatching_(false),
+      cropSize_(128),
+      cropPadding_(16),
       serverUrl_(GlobalConfig::getInstance().getAiServerUrl()),  // Always use GlobalConfig
       modelId_("age_gender_detection"),
       curl_(nullptr),
@@ -120,7 +239,19 @@ bool AgeGenderDetectionProcessor::updateConfig(const nlohmann::json& config) {
     if (config.contains("text_font_scale")) {
         textFontScale_ = config["text_font_scale"];
     }
-    
+
+    if (config.contains("crop_batching")) {
+        cropBatching_ = config["crop_batching"];
+    }
+
+    if (config.contains("crop_size")) {
+        cropSize_ = std::max(32, config["crop_size"].get<int>());
+    }
+
+    if (config.contains("crop_padding")) {
+        cropPadding_ = std::max(0, config["crop_padding"].get<int>());
+    }
+
     // Save the configuration
     config_ = config;
     
@@ -160,41 +291,72 @@ AgeGenderDetectionProcessor::processFrame(const cv::Mat& frame) {
     
     try {
         // Process the frame
-        cv::Mat outputFrame = frame.clone();
         std::vector<AgeGenderResult> results = detectAgeGender(frame);
-        
-        // Draw detections if enabled
-        if (drawDetections_ && !results.empty()) {
-            for (const auto& result : results) {
-                // Draw bounding box
-                cv::rectangle(outputFrame, result.bbox, cv::Scalar(0, 255, 0), 2);
-                
-                // Prepare text with age and gender
-                std::string labelText = result.gender + ", " + std::to_string(result.age);
-                
-                // Create background for text
-                int baseline = 0;
-                cv::Size textSize = cv::getTextSize(labelText, cv::FONT_HERSHEY_SIMPLEX, 
-                                                  textFontScale_, 2, &baseline);
-                cv::rectangle(outputFrame, 
-                              cv::Point(result.bbox.x, result.bbox.y - textSize.height - 5),
-                              cv::Point(result.bbox.x + textSize.width, result.bbox.y),
-                              cv::Scalar(0, 255, 0), -1);
-                
-                // Draw text
-                cv::putText(outputFrame, labelText, 
-                           cv::Point(result.bbox.x, result.bbox.y - 5),
-                           cv::FONT_HERSHEY_SIMPLEX, textFontScale_, 
-                           cv::Scalar(0, 0, 0), 2, cv::LINE_AA);
+
+        // Draw detections if enabled and someone is watching; the copy is
+        // only needed when drawing happens
+        cv::Mat outputFrame = frame;
+        if (drawDetections_ && isAnnotationActive() && !results.empty()) {
+            outputFrame = frame.clone();
+            drawResults(outputFrame, results);
+        }
+
+        // Update statistics
+        processedFrames_++;
+        detectionCount_ += results.size();
+
+        return {outputFrame, results};
+
+    } catch (const std::exception& e) {
+        lastError_ = std::string("Processing error: ") + e.what();
+        LOG_ERROR("AgeGenderDetectionProcessor", lastError_);
+        return {frame, {}};
+    }
+}
+
+std::pair<cv::Mat, std::vector<AgeGenderDetectionProcessor::AgeGenderResult>>
+AgeGenderDetectionProcessor::processFrame(const cv::Mat& frame, const std::vector<cv::Rect>& regions) {
+    if (!running_ || frame.empty()) {
+        return {frame, {}};
+    }
+
+    // Without crop batching (or without any candidate regions) the
+    // full-frame path is still the right answer
+    if (!cropBatching_ || regions.empty()) {
+        return processFrame(frame);
+    }
+
+    try {
+        // Build clamped crop rects; regions that fall entirely outside
+        // the frame are dropped
+        std::vector<cv::Rect> cropRects;
+        cropRects.reserve(regions.size());
+        for (const auto& region : regions) {
+            cv::Rect cropRect = buildCropRect(region, frame.size());
+            if (cropRect.area() > 0) {
+                cropRects.push_back(cropRect);
             }
         }
-        
+
+        if (cropRects.empty()) {
+            return processFrame(frame);
+        }
+
+        std::vector<AgeGenderResult> results = detectAgeGenderBatched(frame, cropRects);
+
+        // Draw detections if enabled and someone is watching
+        cv::Mat outputFrame = frame;
+        if (drawDetections_ && isAnnotationActive() && !results.empty()) {
+            outputFrame = frame.clone();
+            drawResults(outputFrame, results);
+        }
+
         // Update statistics
         processedFrames_++;
         detectionCount_ += results.size();
-        
+
         return {outputFrame, results};
-        
+
     } catch (const std::exception& e) {
         lastError_ = std::string("Processing error: ") + e.what();
         LOG_ERROR("AgeGenderDetectionProcessor", lastError_);
@@ -231,45 +393,31 @@ AgeGenderDetectionProcessor::detectAgeGender(const cv::Mat& image) {
         // Make the request to the AI server
         std::string endpoint = "/detect_age_gender";
         
-        // Send the request and get the response
-        nlohmann::json responseJson;
-        bool success = curlPost(endpoint, payload, responseJson);
-        
+        // Send the request and get the raw response body
+        std::string responseBody;
+        bool success = curlPost(endpoint, payload, responseBody);
+
         // Clean up shared memory
         cleanupSharedMemory();
-        
+
         if (!success) {
             throw std::runtime_error("HTTP request failed");
         }
-        
-        // Process the results
-        for (const auto& item : responseJson) {
-            AgeGenderResult result;
-            
-            // Extract age and confidence
-            result.age = item["age"];
-            result.ageConfidence = item["age_confidence"];
-            
-            // Extract gender and confidence
-            result.gender = item["gender"];
-            result.genderConfidence = item["gender_confidence"];
-            
-            // Extract bounding box
-            auto& bbox = item["bbox"];
-            result.bbox = cv::Rect(
-                bbox["x"], 
-                bbox["y"], 
-                bbox["width"], 
-                bbox["height"]
-            );
-            
-            // Filter by confidence threshold
-            if (result.ageConfidence >= confidenceThreshold_ && 
-                result.genderConfidence >= confidenceThreshold_) {
-                results.push_back(result);
+
+        // Stream the results straight out of the byte buffer — no DOM
+        AgeGenderResponseSax sax;
+        nlohmann::json::sax_parse(responseBody, &sax);
+
+        for (auto& group : sax.groups) {
+            for (auto& result : group) {
+                // Filter by confidence threshold
+                if (result.ageConfidence >= confidenceThreshold_ &&
+                    result.genderConfidence >= confidenceThreshold_) {
+                    results.push_back(std::move(result));
+                }
             }
         }
-        
+
     } catch (const std::exception& e) {
         lastError_ = std::string("Detection error: ") + e.what();
         LOG_ERROR("AgeGenderDetectionProcessor", lastError_);
@@ -278,6 +426,146 @@ AgeGenderDetectionProcessor::detectAgeGender(const cv::Mat& image) {
     return results;
 }
 
+std::vector<AgeGenderDetectionProcessor::AgeGenderResult>
+AgeGenderDetectionProcessor::detectAgeGenderBatched(const cv::Mat& frame,
+                                                    const std::vector<cv::Rect>& cropRects) {
+    std::vector<AgeGenderResult> results;
+
+    if (!curl_) {
+        initCurl();
+    }
+
+    try {
+        // Resize every crop to the fixed size so the server receives a
+        // uniform batch
+        std::vector<cv::Mat> crops;
+        crops.reserve(cropRects.size());
+        for (const auto& cropRect : cropRects) {
+            cv::Mat crop;
+            cv::resize(frame(cropRect), crop, cv::Size(cropSize_, cropSize_));
+            crops.push_back(crop);
+        }
+
+        // Prepare the request payload
+        nlohmann::json payload;
+        payload["model_id"] = modelId_;
+        payload["crop_count"] = static_cast<int>(crops.size());
+        payload["crop_size"] = cropSize_;
+
+        // Use shared memory or base64 encoding
+        if (useSharedMemory_) {
+            // Pack the crops into one contiguous tensor so a single
+            // segment covers the whole batch
+            cv::Mat packed(cropSize_ * static_cast<int>(crops.size()), cropSize_, frame.type());
+            for (size_t i = 0; i < crops.size(); ++i) {
+                crops[i].copyTo(packed.rowRange(static_cast<int>(i) * cropSize_,
+                                                static_cast<int>(i + 1) * cropSize_));
+            }
+
+            std::string sharedMemKey = createSharedMemory(packed);
+            if (sharedMemKey.empty()) {
+                throw std::runtime_error("Failed to create shared memory");
+            }
+            payload["shared_memory_key"] = sharedMemKey;
+        } else {
+            // Convert each crop to base64
+            nlohmann::json images = nlohmann::json::array();
+            for (const auto& crop : crops) {
+                images.push_back(imageToBase64(crop));
+            }
+            payload["images"] = images;
+        }
+
+        // Make the request to the AI server
+        std::string endpoint = "/detect_age_gender";
+
+        // Send the request and get the raw response body
+        std::string responseBody;
+        bool success = curlPost(endpoint, payload, responseBody);
+
+        // Clean up shared memory
+        cleanupSharedMemory();
+
+        if (!success) {
+            throw std::runtime_error("HTTP request failed");
+        }
+
+        // Stream the results straight out of the byte buffer — no DOM
+        AgeGenderResponseSax sax;
+        nlohmann::json::sax_parse(responseBody, &sax);
+
+        // Scatter the per-crop results back to frame coordinates; group
+        // i of the response corresponds to crop i of the batch
+        for (size_t i = 0; i < sax.groups.size() && i < cropRects.size(); ++i) {
+            const cv::Rect& cropRect = cropRects[i];
+            const double scaleX = static_cast<double>(cropRect.width) / cropSize_;
+            const double scaleY = static_cast<double>(cropRect.height) / cropSize_;
+
+            for (auto& result : sax.groups[i]) {
+                // Remap the bounding box from crop to frame coordinates
+                result.bbox = cv::Rect(
+                    cropRect.x + static_cast<int>(result.bbox.x * scaleX),
+                    cropRect.y + static_cast<int>(result.bbox.y * scaleY),
+                    static_cast<int>(result.bbox.width * scaleX),
+                    static_cast<int>(result.bbox.height * scaleY)
+                );
+                result.bbox &= cv::Rect(0, 0, frame.cols, frame.rows);
+
+                // Filter by confidence threshold
+                if (result.ageConfidence >= confidenceThreshold_ &&
+                    result.genderConfidence >= confidenceThreshold_) {
+                    results.push_back(std::move(result));
+                }
+            }
+        }
+
+    } catch (const std::exception& e) {
+        lastError_ = std::string("Batched detection error: ") + e.what();
+        LOG_ERROR("AgeGenderDetectionProcessor", lastError_);
+    }
+
+    return results;
+}
+
+cv::Rect AgeGenderDetectionProcessor::buildCropRect(const cv::Rect& region,
+                                                    const cv::Size& frameSize) const {
+    // Pad the region, then expand the shorter side to a square so the
+    // fixed-size resize does not distort faces
+    cv::Rect padded(region.x - cropPadding_, region.y - cropPadding_,
+                    region.width + 2 * cropPadding_, region.height + 2 * cropPadding_);
+
+    int side = std::max(padded.width, padded.height);
+    cv::Point center(padded.x + padded.width / 2, padded.y + padded.height / 2);
+    cv::Rect square(center.x - side / 2, center.y - side / 2, side, side);
+
+    return square & cv::Rect(0, 0, frameSize.width, frameSize.height);
+}
+
+void AgeGenderDetectionProcessor::drawResults(cv::Mat& frame, const std::vector<AgeGenderResult>& results) {
+    for (const auto& result : results) {
+        // Draw bounding box
+        cv::rectangle(frame, result.bbox, cv::Scalar(0, 255, 0), 2);
+
+        // Prepare text with age and gender
+        std::string labelText = result.gender + ", " + std::to_string(result.age);
+
+        // Create background for text
+        int baseline = 0;
+        cv::Size textSize = cv::getTextSize(labelText, cv::FONT_HERSHEY_SIMPLEX,
+                                          textFontScale_, 2, &baseline);
+        cv::rectangle(frame,
+                      cv::Point(result.bbox.x, result.bbox.y - textSize.height - 5),
+                      cv::Point(result.bbox.x + textSize.width, result.bbox.y),
+                      cv::Scalar(0, 255, 0), -1);
+
+        // Draw text
+        cv::putText(frame, labelText,
+                   cv::Point(result.bbox.x, result.bbox.y - 5),
+                   cv::FONT_HERSHEY_SIMPLEX, textFontScale_,
+                   cv::Scalar(0, 0, 0), 2, cv::LINE_AA);
+    }
+}
+
 std::string AgeGenderDetectionProcessor::imageToBase64(const cv::Mat& image) {
     std::vector<uchar> buffer;
     cv::imencode(".jpg", image, buffer);
@@ -416,12 +704,29 @@ bool AgeGenderDetectionProcessor::curlGet(const std::string& endpoint, nlohmann:
     }
 }
 
-bool AgeGenderDetectionProcessor::curlPost(const std::string& endpoint, const nlohmann::json& requestJson, 
+bool AgeGenderDetectionProcessor::curlPost(const std::string& endpoint, const nlohmann::json& requestJson,
                                          nlohmann::json& responseJson) {
+    std::string responseBody;
+    if (!curlPost(endpoint, requestJson, responseBody)) {
+        return false;
+    }
+
+    try {
+        responseJson = nlohmann::json::parse(responseBody);
+        return true;
+    } catch (const std::exception& e) {
+        lastError_ = std::string("POST request error: ") + e.what();
+        LOG_ERROR("AgeGenderDetectionProcessor", lastError_);
+        return false;
+    }
+}
+
+bool AgeGenderDetectionProcessor::curlPost(const std::string& endpoint, const nlohmann::json& requestJson,
+                                         std::string& responseBody) {
     if (!curl_) {
         initCurl();
     }
-    
+
     try {
         // Reset all previous options
         curl_easy_reset(curl_);
@@ -470,9 +775,8 @@ bool AgeGenderDetectionProcessor::curlPost(const std::string& endpoint, const nl
         if (httpCode != 200) {
             throw std::runtime_error("Server error: " + std::to_string(httpCode) + " " + response);
         }
-        
-        // Parse the response
-        responseJson = nlohmann::json::parse(response);
+
+        responseBody = std::move(response);
         return true;
     } catch (const std::exception& e) {
         lastError_ = std::string("POST request error: ") + e.what();
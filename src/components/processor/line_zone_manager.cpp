@@ -31,6 +31,10 @@ LineZoneManager::LineZoneManager(const std::string& id, Camera* camera,
       outText_("out"),             // Simple lowercase labels
       textOrientToLine_(false),    // Don't orient text along line by default
       textCentered_(true),         // Center text on line
+      aggregateCounts_(false),      // Per-crossing events by default
+      aggregateIntervalSeconds_(60),
+      emitCrossingEvents_(false),
+      intervalStartMs_(0),
       frameWidth_(0),
       frameHeight_(0),
       useNormalizedCoords_(true) {  // Added flag for normalized coordinates
@@ -103,7 +107,23 @@ bool LineZoneManager::initialize() {
             if (configCopy.contains("text_thickness")) {
                 textThickness_ = configCopy["text_thickness"].get<int>();
             }
-            
+
+            // Count aggregation settings
+            if (configCopy.contains("aggregate_counts")) {
+                aggregateCounts_ = configCopy["aggregate_counts"].get<bool>();
+            }
+
+            if (configCopy.contains("aggregate_interval_seconds")) {
+                aggregateIntervalSeconds_ = configCopy["aggregate_interval_seconds"].get<int>();
+                if (aggregateIntervalSeconds_ < 1) {
+                    aggregateIntervalSeconds_ = 1;
+                }
+            }
+
+            if (configCopy.contains("emit_crossing_events")) {
+                emitCrossingEvents_ = configCopy["emit_crossing_events"].get<bool>();
+            }
+
             // New configuration parameters for direction arrows
             if (configCopy.contains("draw_direction_arrows")) {
                 drawDirectionArrows_ = configCopy["draw_direction_arrows"].get<bool>();
@@ -364,7 +384,23 @@ bool LineZoneManager::updateConfig(const nlohmann::json& config) {
             if (newConfig.contains("text_thickness")) {
                 textThickness_ = newConfig["text_thickness"].get<int>();
             }
-            
+
+            // Count aggregation settings
+            if (newConfig.contains("aggregate_counts")) {
+                aggregateCounts_ = newConfig["aggregate_counts"].get<bool>();
+            }
+
+            if (newConfig.contains("aggregate_interval_seconds")) {
+                aggregateIntervalSeconds_ = newConfig["aggregate_interval_seconds"].get<int>();
+                if (aggregateIntervalSeconds_ < 1) {
+                    aggregateIntervalSeconds_ = 1;
+                }
+            }
+
+            if (newConfig.contains("emit_crossing_events")) {
+                emitCrossingEvents_ = newConfig["emit_crossing_events"].get<bool>();
+            }
+
             // New configuration parameters for direction arrows
             if (newConfig.contains("draw_direction_arrows")) {
                 drawDirectionArrows_ = newConfig["draw_direction_arrows"].get<bool>();
@@ -651,6 +687,11 @@ nlohmann::json LineZoneManager::getStatus() const {
     
     status["zones"] = zonesArray;
     status["crossing_events"] = crossingEvents_.size();
+    status["aggregate_counts"] = aggregateCounts_;
+    if (aggregateCounts_) {
+        status["aggregate_interval_seconds"] = aggregateIntervalSeconds_;
+        status["emit_crossing_events"] = emitCrossingEvents_;
+    }
     
     // Also include the full configuration for completeness
     status["config"] = config_;
@@ -658,7 +699,43 @@ nlohmann::json LineZoneManager::getStatus() const {
     return status;
 }
 
-std::pair<cv::Mat, std::vector<LineCrossingEvent>> 
+nlohmann::json LineZoneManager::getPersistentState() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    nlohmann::json zones = nlohmann::json::object();
+    for (const auto& [id, zone] : lineZones_) {
+        zones[id] = {
+            {"in", zone->getInCount()},
+            {"out", zone->getOutCount()}
+        };
+    }
+    return {{"zones", zones}};
+}
+
+bool LineZoneManager::restorePersistentState(const nlohmann::json& state) {
+    if (!state.contains("zones") || !state["zones"].is_object()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (const auto& [id, counts] : state["zones"].items()) {
+        auto it = lineZones_.find(id);
+        if (it == lineZones_.end()) {
+            // Zone was removed from the configuration since the snapshot
+            continue;
+        }
+        if (counts.contains("in") && counts["in"].is_number_integer()) {
+            it->second->setInCount(counts["in"].get<int>());
+        }
+        if (counts.contains("out") && counts["out"].is_number_integer()) {
+            it->second->setOutCount(counts["out"].get<int>());
+        }
+    }
+    LOG_INFO("LineZoneManager", "Restored crossing counts for " + id_);
+    return true;
+}
+
+std::pair<cv::Mat, std::vector<LineCrossingEvent>>
 LineZoneManager::processFrame(const cv::Mat& frame, const std::vector<ObjectTrackerProcessor::TrackedObject>& trackedObjects) {
     if (!isRunning() || frame.empty()) {
         return {frame, {}};
@@ -699,15 +776,28 @@ LineZoneManager::processFrame(const cv::Mat& frame, const std::vector<ObjectTrac
     
     // Add to stored events
     crossingEvents_.insert(crossingEvents_.end(), crossingEvents.begin(), crossingEvents.end());
-    
-    // Create a copy of the frame for drawing
-    cv::Mat outputFrame = frame.clone();
-    
-    // Draw line zones on the frame if enabled
-    if (drawZones_) {
+
+    // Accumulate per-zone deltas when aggregation is enabled; they are
+    // published by drainCountDeltas() at the configured cadence
+    if (aggregateCounts_) {
+        for (const auto& event : crossingEvents) {
+            auto& delta = pendingDeltas_[event.zoneId];
+            if (event.direction == "in") {
+                delta.first++;
+            } else if (event.direction == "out") {
+                delta.second++;
+            }
+        }
+    }
+
+    // Draw line zones on the frame if enabled and someone is watching;
+    // the copy is only needed when drawing happens
+    cv::Mat outputFrame = frame;
+    if (drawZones_ && isAnnotationActive()) {
+        outputFrame = frame.clone();
         drawLineZones(outputFrame);
     }
-    
+
     return {outputFrame, crossingEvents};
 }
 
@@ -786,6 +876,43 @@ std::vector<LineCrossingEvent> LineZoneManager::getCrossingEvents() const {
     return crossingEvents_;
 }
 
+bool LineZoneManager::emitPerCrossingEvents() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !aggregateCounts_ || emitCrossingEvents_;
+}
+
+std::vector<ZoneCountDelta> LineZoneManager::drainCountDeltas(int64_t nowMs) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!aggregateCounts_) {
+        return {};
+    }
+
+    // First drain after enabling aggregation just opens the interval
+    if (intervalStartMs_ == 0) {
+        intervalStartMs_ = nowMs;
+        return {};
+    }
+
+    if (nowMs - intervalStartMs_ < static_cast<int64_t>(aggregateIntervalSeconds_) * 1000) {
+        return {};
+    }
+
+    std::vector<ZoneCountDelta> deltas;
+    deltas.reserve(pendingDeltas_.size());
+    for (const auto& [zoneId, counts] : pendingDeltas_) {
+        // Quiet zones emit nothing; totals are recoverable from the deltas
+        if (counts.first == 0 && counts.second == 0) {
+            continue;
+        }
+        deltas.push_back({zoneId, counts.first, counts.second, intervalStartMs_, nowMs});
+    }
+    pendingDeltas_.clear();
+    intervalStartMs_ = nowMs;
+
+    return deltas;
+}
+
 void LineZoneManager::clearCrossingEvents() {
     std::lock_guard<std::mutex> lock(mutex_);
     crossingEvents_.clear();
@@ -977,7 +1104,11 @@ std::vector<LineCrossingEvent> LineZoneManager::convertEvents(const std::vector<
 std::vector<Track> LineZoneManager::convertTrackedObjects(
     const std::vector<ObjectTrackerProcessor::TrackedObject>& trackedObjects) const {
     std::vector<Track> tracks;
-    
+    tracks.reserve(trackedObjects.size());
+
+    // One timestamp for the whole batch; all tracks belong to the same frame
+    const int64_t timestamp = getCurrentTimestamp();
+
     for (const auto& obj : trackedObjects) {
         Track track;
         track.trackId = obj.trackId;
@@ -985,11 +1116,11 @@ std::vector<Track> LineZoneManager::convertTrackedObjects(
         track.className = obj.className;
         track.classId = std::to_string(obj.trackId % 100); // Use a simple class ID for now
         track.confidence = obj.confidence;
-        track.timestamp = getCurrentTimestamp();
-        
+        track.timestamp = timestamp;
+
         tracks.push_back(track);
     }
-    
+
     return tracks;
 }
 
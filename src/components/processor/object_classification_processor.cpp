@@ -1,4 +1,5 @@
 #include "components/processor/object_classification_processor.h"
+#include "base64.h"
 #include <iostream>
 #include <random>
 #include <string>
@@ -27,57 +28,6 @@ struct SharedMemoryImage {
     // Data follows this header in the shared memory
 };
 
-// Base64 encoding table
-static const char base64_chars[] = 
-    "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-    "abcdefghijklmnopqrstuvwxyz"
-    "0123456789+/";
-
-// Base64 encoding function
-static std::string base64_encode(const unsigned char* buf, unsigned int bufLen) {
-    std::string ret;
-    int i = 0;
-    int j = 0;
-    unsigned char char_array_3[3];
-    unsigned char char_array_4[4];
-
-    while (bufLen--) {
-        char_array_3[i++] = *(buf++);
-        if (i == 3) {
-            char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-            char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-            char_array_4[2] = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-            char_array_4[3] = char_array_3[2] & 0x3f;
-
-            for(i = 0; i < 4; i++) {
-                ret += base64_chars[char_array_4[i]];
-            }
-            i = 0;
-        }
-    }
-
-    if (i) {
-        for(j = i; j < 3; j++) {
-            char_array_3[j] = '\0';
-        }
-
-        char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-        char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-        char_array_4[2] = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-        char_array_4[3] = char_array_3[2] & 0x3f;
-
-        for (j = 0; j < i + 1; j++) {
-            ret += base64_chars[char_array_4[j]];
-        }
-
-        while((i++ < 3)) {
-            ret += '=';
-        }
-    }
-
-    return ret;
-}
-
 ObjectClassificationProcessor::ObjectClassificationProcessor(
     const std::string& id, Camera* camera, const std::string& type, const nlohmann::json& config)
     : ProcessorComponent(id, camera),
@@ -89,6 +39,11 @@ ObjectClassificationProcessor::ObjectClassificationProcessor(
       drawClassification_(true),
       useSharedMemory_(true),
       textFontScale_(0.7f),
+      trackCaching_(false),
+      cacheRefreshIntervalMs_(5000),
+      appearanceThreshold_(0.35f),
+      cacheHits_(0),
+      cacheMisses_(0),
       sharedMemoryFd_(-1),
       curl_(nullptr),
       processedFrames_(0),
@@ -260,7 +215,21 @@ bool ObjectClassificationProcessor::updateConfig(const nlohmann::json& config) {
     if (config.contains("text_font_scale")) {
         textFontScale_ = config["text_font_scale"];
     }
-    
+
+    if (config.contains("track_caching")) {
+        trackCaching_ = config["track_caching"];
+    }
+
+    if (config.contains("cache_refresh_interval_ms")) {
+        cacheRefreshIntervalMs_ = std::max(0, config["cache_refresh_interval_ms"].get<int>());
+    }
+
+    if (config.contains("appearance_threshold")) {
+        appearanceThreshold_ = config["appearance_threshold"];
+        // Clamp to valid range
+        appearanceThreshold_ = std::max(0.0f, std::min(1.0f, appearanceThreshold_));
+    }
+
     // Save the configuration
     config_ = config;
     
@@ -290,7 +259,10 @@ nlohmann::json ObjectClassificationProcessor::getConfig() const {
     config["draw_classification"] = drawClassification_;
     config["use_shared_memory"] = useSharedMemory_;
     config["text_font_scale"] = textFontScale_;
-    
+    config["track_caching"] = trackCaching_;
+    config["cache_refresh_interval_ms"] = cacheRefreshIntervalMs_;
+    config["appearance_threshold"] = appearanceThreshold_;
+
     return config;
 }
 
@@ -311,7 +283,13 @@ nlohmann::json ObjectClassificationProcessor::getStatus() const {
     status["classification_count"] = classificationCount_;
     status["use_shared_memory"] = useSharedMemory_;
     status["text_font_scale"] = textFontScale_;
-    
+
+    if (trackCaching_) {
+        status["cached_tracks"] = trackCache_.size();
+        status["cache_hits"] = cacheHits_;
+        status["cache_misses"] = cacheMisses_;
+    }
+
     if (!lastError_.empty()) {
         status["last_error"] = lastError_;
     }
@@ -328,11 +306,12 @@ std::pair<cv::Mat, std::vector<ObjectClassificationProcessor::Classification>> O
         // Classify the image
         auto classifications = classifyImage(frame);
         
-        // Create a copy of the frame for drawing
-        cv::Mat outputFrame = frame.clone();
-        
-        // Draw classification text if enabled
-        if (drawClassification_ && !classifications.empty()) {
+        // Copy the frame only when the overlay is actually drawn
+        cv::Mat outputFrame = frame;
+
+        // Draw classification text if enabled and someone is watching
+        if (drawClassification_ && isAnnotationActive() && !classifications.empty()) {
+            outputFrame = frame.clone();
             int padding = 10;
             int y = padding;
             int lineHeight = 30;
@@ -405,6 +384,136 @@ std::pair<cv::Mat, std::vector<ObjectClassificationProcessor::Classification>> O
     }
 }
 
+std::pair<cv::Mat, std::vector<ObjectClassificationProcessor::Classification>> ObjectClassificationProcessor::processFrame(
+    const cv::Mat& frame,
+    const std::vector<ObjectTrackerProcessor::TrackedObject>& trackedObjects) {
+    if (!running_ || frame.empty()) {
+        return {frame, {}};
+    }
+
+    // Without track caching (or without any tracks) the full-frame path
+    // is still the right answer
+    if (!trackCaching_ || trackedObjects.empty()) {
+        return processFrame(frame);
+    }
+
+    try {
+        // Copy the frame only when per-track labels are actually drawn
+        const bool annotate = drawClassification_ && isAnnotationActive();
+        cv::Mat outputFrame = annotate ? frame.clone() : frame;
+        std::vector<Classification> classifications;
+
+        auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+
+        for (const auto& trackedObject : trackedObjects) {
+            cv::Rect cropRect = trackedObject.bbox & cv::Rect(0, 0, frame.cols, frame.rows);
+            if (cropRect.area() <= 0) {
+                continue;
+            }
+
+            cv::Mat crop = frame(cropRect);
+            cv::Mat histogram = computeAppearanceHistogram(crop);
+
+            auto it = trackCache_.find(trackedObject.trackId);
+            bool needRefresh = (it == trackCache_.end());
+            if (!needRefresh) {
+                // Refresh on the slow interval or when the crop no longer
+                // looks like the one we classified
+                bool intervalElapsed = (now - it->second.lastRefreshMs) >= cacheRefreshIntervalMs_;
+                double appearanceDistance = cv::compareHist(
+                    it->second.histogram, histogram, cv::HISTCMP_BHATTACHARYYA);
+                needRefresh = intervalElapsed || appearanceDistance > appearanceThreshold_;
+            }
+
+            if (needRefresh) {
+                cacheMisses_++;
+                auto cropClassifications = classifyImage(crop);
+
+                TrackCacheEntry& entry = trackCache_[trackedObject.trackId];
+                if (!cropClassifications.empty()) {
+                    // Confidence-weighted update: when the top class is
+                    // stable, smooth the confidence instead of letting a
+                    // single noisy crop swing it
+                    if (!entry.classifications.empty() &&
+                        entry.classifications[0].className == cropClassifications[0].className) {
+                        cropClassifications[0].confidence =
+                            0.7f * cropClassifications[0].confidence +
+                            0.3f * entry.classifications[0].confidence;
+                    }
+                    entry.classifications = cropClassifications;
+                }
+                entry.histogram = histogram;
+                entry.lastRefreshMs = now;
+                entry.lastSeenMs = now;
+                it = trackCache_.find(trackedObject.trackId);
+            } else {
+                cacheHits_++;
+                it->second.lastSeenMs = now;
+            }
+
+            if (it == trackCache_.end() || it->second.classifications.empty()) {
+                continue;
+            }
+
+            // Serve the cached top label for this track
+            const Classification& best = it->second.classifications[0];
+            classifications.push_back(best);
+
+            // Draw per-track label if enabled
+            if (annotate) {
+                std::string text = best.className + " (" +
+                    std::to_string(static_cast<int>(best.confidence * 100)) + "%)";
+                cv::putText(outputFrame, text,
+                           cv::Point(cropRect.x, std::max(cropRect.y - 5, 15)),
+                           cv::FONT_HERSHEY_SIMPLEX, textFontScale_,
+                           cv::Scalar(50, 255, 50), 2, cv::LINE_AA);
+            }
+        }
+
+        // Drop cache entries for tracks that have not been seen for a
+        // while so the map does not grow with every track ever created
+        const int64_t evictAfterMs = std::max<int64_t>(3 * cacheRefreshIntervalMs_, 10000);
+        for (auto it = trackCache_.begin(); it != trackCache_.end();) {
+            if (now - it->second.lastSeenMs > evictAfterMs) {
+                it = trackCache_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        // Update statistics
+        processedFrames_++;
+        classificationCount_ += classifications.size();
+
+        return {outputFrame, classifications};
+
+    } catch (const std::exception& e) {
+        lastError_ = std::string("Processing error: ") + e.what();
+        std::cerr << lastError_ << std::endl;
+        return {frame, {}};
+    }
+}
+
+cv::Mat ObjectClassificationProcessor::computeAppearanceHistogram(const cv::Mat& crop) const {
+    // Coarse hue/saturation histogram - cheap enough to run per track per
+    // frame, stable enough to notice when a crop changes appearance
+    cv::Mat hsv;
+    cv::cvtColor(crop, hsv, cv::COLOR_BGR2HSV);
+
+    int histSize[] = {16, 8};
+    float hueRange[] = {0, 180};
+    float satRange[] = {0, 256};
+    const float* ranges[] = {hueRange, satRange};
+    int channels[] = {0, 1};
+
+    cv::Mat histogram;
+    cv::calcHist(&hsv, 1, channels, cv::Mat(), histogram, 2, histSize, ranges);
+    cv::normalize(histogram, histogram, 1.0, 0.0, cv::NORM_L1);
+
+    return histogram;
+}
+
 std::vector<ObjectClassificationProcessor::Classification> ObjectClassificationProcessor::classifyImage(const cv::Mat& image) {
     std::vector<Classification> classifications;
     std::string sharedMemKey;
@@ -95,7 +95,9 @@ ObjectTrackerProcessor::ObjectTrackerProcessor(
       processedFrames_(0),
       trajectoryMaxLength_(60),
       maxAllowedDistanceRatio_(0.2),
-      trajectoryCleanupThreshold_(30) {
+      trajectoryCleanupThreshold_(30),
+      trajectoryEpsilon_(2.0),
+      trajectoryMaxPoints_(64) {
     
     // Apply initial configuration
     updateConfig(config);
@@ -112,10 +114,23 @@ bool ObjectTrackerProcessor::initialize() {
     std::cout << "Initializing Object Tracker processor: " << getId() << std::endl;
     
     try {
-        // Create ByteTracker instance with configured parameters
-        tracker_ = std::make_unique<BYTETracker>(
-            frameRate_, trackBuffer_);
-        
+        // Trackers are created lazily, one per class partition, as classes
+        // appear in the detections (see trackerForLabel)
+        trackers_.clear();
+
+        // Warm restart: restore per-partition track state saved by the
+        // last stop() so reconnects don't reset track IDs or re-warm from cold
+        for (const auto& [label, state] : trackerStates_) {
+            auto tracker = std::make_unique<BYTETracker>(frameRate_, trackBuffer_);
+            if (!tracker->load_state(state)) {
+                std::cerr << "Failed to restore tracker state for class partition "
+                          << label << ", starting cold: " << getId() << std::endl;
+                continue;
+            }
+            trackers_[label] = std::move(tracker);
+        }
+        trackerStates_.clear();
+
         return true;
     } catch (const std::exception& e) {
         lastError_ = std::string("Initialization error: ") + e.what();
@@ -144,6 +159,14 @@ bool ObjectTrackerProcessor::stop() {
     }
     
     running_ = false;
+
+    // Checkpoint live track state so a restart resumes with the same
+    // track IDs and Kalman states instead of re-warming from scratch
+    trackerStates_.clear();
+    for (const auto& [label, tracker] : trackers_) {
+        trackerStates_[label] = tracker->save_state();
+    }
+
     std::cout << "Object Tracker processor stopped: " << getId() << std::endl;
     return true;
 }
@@ -213,14 +236,29 @@ bool ObjectTrackerProcessor::updateConfig(const nlohmann::json& config) {
     if (config.contains("trajectory_cleanup_threshold")) {
         trajectoryCleanupThreshold_ = config["trajectory_cleanup_threshold"];
     }
-    
+
+    // Simplification applied when trajectories are serialized into
+    // telemetry events; the in-memory history keeps full resolution
+    if (config.contains("trajectory_epsilon")) {
+        trajectoryEpsilon_ = std::max(0.0, config["trajectory_epsilon"].get<double>());
+    }
+
+    if (config.contains("trajectory_max_points")) {
+        trajectoryMaxPoints_ = config["trajectory_max_points"].get<size_t>();
+    }
+
     // Save the configuration
     config_ = config;
     
-    // If already running, reinitialize tracker with new parameters
-    if (running_ && tracker_) {
-        tracker_ = std::make_unique<BYTETracker>(
-            frameRate_, trackBuffer_);
+    // If already running, reinitialize each class partition's tracker
+    // with new parameters, carrying the live track state across so
+    // counts don't glitch
+    if (running_) {
+        for (auto& [label, tracker] : trackers_) {
+            auto state = tracker->save_state();
+            tracker = std::make_unique<BYTETracker>(frameRate_, trackBuffer_);
+            tracker->load_state(state);
+        }
     }
     
     return true;
@@ -249,6 +287,9 @@ nlohmann::json ObjectTrackerProcessor::getStatus() const {
     status["processed_frames"] = processedFrames_;
     status["total_tracked_objects"] = totalTrackedObjects_;
     status["active_tracked_objects"] = activeTrackedObjects_;
+    status["tracker_partitions"] = trackers_.size();
+    status["trajectory_epsilon"] = trajectoryEpsilon_;
+    status["trajectory_max_points"] = trajectoryMaxPoints_;
     
     if (!lastError_.empty()) {
         status["last_error"] = lastError_;
@@ -289,29 +330,46 @@ Object ObjectTrackerProcessor::convertDetection(
     return obj;
 }
 
-std::pair<cv::Mat, std::vector<ObjectTrackerProcessor::TrackedObject>> 
+BYTETracker& ObjectTrackerProcessor::trackerForLabel(int label) {
+    auto it = trackers_.find(label);
+    if (it == trackers_.end()) {
+        it = trackers_.emplace(label, std::make_unique<BYTETracker>(
+            frameRate_, trackBuffer_)).first;
+    }
+    return *it->second;
+}
+
+std::pair<cv::Mat, std::vector<ObjectTrackerProcessor::TrackedObject>>
 ObjectTrackerProcessor::processFrame(
     const cv::Mat& frame, 
     const std::vector<ObjectDetectorProcessor::Detection>& detections) {
     
-    if (!running_ || frame.empty() || !tracker_) {
+    if (!running_ || frame.empty()) {
         return {frame, {}};
     }
-    
+
     try {
-        // Convert detections to ByteTracker format
-        std::vector<Object> byteTrackObjects;
-        
-        // Create a mapping from detection index to class name for later use
-        std::map<int, std::string> detectionClassMap;
+        // Convert detections to ByteTracker format, bucketed per class
+        // partition so each tracker solves its own small cost matrix
+        std::map<int, std::vector<Object>> objectsByLabel;
         for (int i = 0; i < detections.size(); i++) {
             auto obj = convertDetection(detections[i]);
-            byteTrackObjects.push_back(obj);
-            detectionClassMap[i] = detections[i].className;
+            objectsByLabel[obj.label].push_back(obj);
+        }
+
+        // Partitions with no detections this frame still get an empty
+        // update so their lost tracks age out on the same schedule
+        for (const auto& [label, tracker] : trackers_) {
+            objectsByLabel.emplace(label, std::vector<Object>());
+        }
+
+        // Update each class partition's tracker and merge the results
+        std::vector<STrack> trackResult;
+        for (auto& [label, objects] : objectsByLabel) {
+            auto partitionResult = trackerForLabel(label).update(objects);
+            trackResult.insert(trackResult.end(),
+                               partitionResult.begin(), partitionResult.end());
         }
-        
-        // Update tracker with new detections
-        auto trackResult = tracker_->update(byteTrackObjects);
         
         // Use the class mutex instead of a static mutex
         std::lock_guard<std::mutex> lock(mutex_);
@@ -363,7 +421,7 @@ ObjectTrackerProcessor::processFrame(
                 
                 // Assign class name for new track
                 if (bestDetectionIndex >= 0 && bestOverlap > 0.3f) {
-                    obj.className = detectionClassMap[bestDetectionIndex];
+                    obj.className = detections[bestDetectionIndex].className;
                     // Store this class as persistent for this track
                     trackClassMap_[obj.trackId] = obj.className;
                 } else {
@@ -465,14 +523,13 @@ ObjectTrackerProcessor::processFrame(
             }
         }
         
-        // Create a copy of the frame for drawing
-        cv::Mat outputFrame = frame.clone();
-        
-        // Draw tracking information if enabled
-        if (drawTracking_) {
-            outputFrame = drawTracking(outputFrame, trackedObjects);
+        // Draw tracking information if enabled and someone is watching;
+        // drawTracking clones internally, so no copy is needed otherwise
+        cv::Mat outputFrame = frame;
+        if (drawTracking_ && isAnnotationActive()) {
+            outputFrame = drawTracking(frame, trackedObjects);
         }
-        
+
         // Update statistics
         processedFrames_++;
         activeTrackedObjects_ = trackedObjects.size();
@@ -495,6 +552,78 @@ ObjectTrackerProcessor::processFrame(
     }
 }
 
+std::pair<cv::Mat, std::vector<ObjectTrackerProcessor::TrackedObject>>
+ObjectTrackerProcessor::predictFrame(const cv::Mat& frame) {
+
+    if (!running_ || frame.empty()) {
+        return {frame, {}};
+    }
+
+    try {
+        // Kalman prediction only: no association, no track ageing. Class
+        // names come from the persistent per-track mapping built on
+        // detection frames.
+        std::vector<STrack> trackResult;
+        for (auto& [label, tracker] : trackers_) {
+            auto partitionResult = tracker->predict();
+            trackResult.insert(trackResult.end(),
+                               partitionResult.begin(), partitionResult.end());
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        std::vector<TrackedObject> trackedObjects;
+        trackedObjects.reserve(trackResult.size());
+        for (const auto& track : trackResult) {
+            TrackedObject obj;
+            obj.trackId = track.track_id;
+
+            auto trackRect = track.tlwh;
+            obj.bbox = cv::Rect(
+                static_cast<int>(trackRect[0]),
+                static_cast<int>(trackRect[1]),
+                static_cast<int>(trackRect[2]),
+                static_cast<int>(trackRect[3])
+            );
+
+            auto classIt = trackClassMap_.find(obj.trackId);
+            obj.className = (classIt != trackClassMap_.end()) ? classIt->second : "unknown";
+            obj.confidence = track.score;
+            obj.age = track.frame_id - track.start_frame;
+
+            // Extend the trajectory with the predicted center so zones
+            // see continuous motion across skipped detector frames
+            cv::Point center(
+                static_cast<int>(trackRect[0] + trackRect[2]/2),
+                static_cast<int>(trackRect[1] + trackRect[3]/2)
+            );
+            auto& trajectory = trajectoryHistory_[obj.trackId];
+            trajectory.push_back(center);
+            if (trajectory.size() > trajectoryMaxLength_) {
+                trajectory.erase(trajectory.begin(),
+                                 trajectory.begin() + (trajectory.size() - trajectoryMaxLength_));
+            }
+            obj.trajectory = trajectory;
+
+            trackedObjects.push_back(obj);
+        }
+
+        cv::Mat outputFrame = frame;
+        if (drawTracking_ && isAnnotationActive()) {
+            outputFrame = drawTracking(frame, trackedObjects);
+        }
+
+        activeTrackedObjects_ = trackedObjects.size();
+
+        return {outputFrame, trackedObjects};
+
+    } catch (const std::exception& e) {
+        lastError_ = std::string("Prediction error: ") + e.what();
+        std::cerr << lastError_ << std::endl;
+        return {frame, {}};
+    }
+}
+
 cv::Mat ObjectTrackerProcessor::drawTracking(
     const cv::Mat& frame, 
     const std::vector<TrackedObject>& trackedObjects) {
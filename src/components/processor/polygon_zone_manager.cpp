@@ -4,6 +4,7 @@
 #include <iostream>
 #include <sstream>
 #include <algorithm>
+#include <limits>
 #include <random> // For random color generation
 #include <iomanip> // For setfill, setw in formatting time
 
@@ -295,6 +296,10 @@ bool PolygonZoneManager::initialize() {
                     continue;
                 }
 
+                // Apply zone-level settings (debouncing, containment mask)
+                // that the constructor does not take
+                zone->updateConfig(zoneConfig);
+
                 // Assign a color to this zone - either from config or auto-generate
                 cv::Scalar zoneColor;
                 bool hasCustomColor = false;
@@ -580,6 +585,10 @@ bool PolygonZoneManager::updateConfig(const nlohmann::json& config) {
                         // Schedule zone creation
                         zonesToAdd[id] = std::make_shared<PolygonZone>(
                             id, polygon, getId(), triggeringAnchors, triggeringClasses);
+
+                        // Apply zone-level settings (debouncing, containment
+                        // mask) that the constructor does not take
+                        zonesToAdd[id]->updateConfig(zoneConfig);
                     }
                 }
                 
@@ -775,7 +784,49 @@ nlohmann::json PolygonZoneManager::getStatus() const {
     return status;
 }
 
-std::pair<cv::Mat, std::vector<PolygonZoneEvent>> 
+nlohmann::json PolygonZoneManager::getPersistentState() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    nlohmann::json zones = nlohmann::json::object();
+    for (const auto& [id, zone] : polygonZones_) {
+        zones[id] = {
+            {"in", zone->getInCount()},
+            {"out", zone->getOutCount()}
+        };
+    }
+    return {
+        {"zones", zones},
+        {"dwell", zoneTimer_.exportAccumulated()}
+    };
+}
+
+bool PolygonZoneManager::restorePersistentState(const nlohmann::json& state) {
+    if (!state.contains("zones") || !state["zones"].is_object()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (const auto& [id, counts] : state["zones"].items()) {
+        auto it = polygonZones_.find(id);
+        if (it == polygonZones_.end()) {
+            // Zone was removed from the configuration since the snapshot
+            continue;
+        }
+        if (counts.contains("in") && counts["in"].is_number_integer()) {
+            it->second->setInCount(counts["in"].get<int>());
+        }
+        if (counts.contains("out") && counts["out"].is_number_integer()) {
+            it->second->setOutCount(counts["out"].get<int>());
+        }
+    }
+    if (state.contains("dwell")) {
+        zoneTimer_.importAccumulated(state["dwell"]);
+    }
+    LOG_INFO("PolygonZoneManager", "Restored zone counts for " + id_);
+    return true;
+}
+
+std::pair<cv::Mat, std::vector<PolygonZoneEvent>>
 PolygonZoneManager::processFrame(const cv::Mat& frame, const std::vector<ObjectTrackerProcessor::TrackedObject>& trackedObjects) {
     if (!isRunning() || frame.empty()) {
         return {frame, {}};
@@ -790,16 +841,77 @@ PolygonZoneManager::processFrame(const cv::Mat& frame, const std::vector<ObjectT
         LOG_DEBUG("PolygonZoneManager", "Updated frame dimensions: " + std::to_string(frameWidth_) + "x" + std::to_string(frameHeight_));
     }
     
-    // Convert tracked objects to PolygonZone tracks
+    // Convert tracked objects to PolygonZone tracks; every zone's geometry
+    // evaluation gathers from this shared buffer directly
     std::vector<Track> tracks = convertTrackedObjects(trackedObjects);
-    
+
     // Keep track of objects in each zone - create here to pass to the drawing method
     std::map<std::string, std::vector<int>> objectsInZones;
-    
+
+    // Build a spatial index over zone bounding boxes so each track only
+    // evaluates zones whose AABB it intersects; most track/zone pairs are
+    // trivially disjoint and skip the exact polygon test entirely
+    std::vector<cv::Rect2f> zoneBounds;
+    std::map<std::string, size_t> zoneIndexById;
+    for (const auto& [id, zone] : polygonZones_) {
+        float minX = std::numeric_limits<float>::max();
+        float minY = std::numeric_limits<float>::max();
+        float maxX = std::numeric_limits<float>::lowest();
+        float maxY = std::numeric_limits<float>::lowest();
+        for (const auto& point : zone->getPolygon()) {
+            cv::Point2f pixelPoint = useNormalizedCoords_
+                ? cv::Point2f(normalizedToPixel(point))
+                : point;
+            minX = std::min(minX, pixelPoint.x);
+            minY = std::min(minY, pixelPoint.y);
+            maxX = std::max(maxX, pixelPoint.x);
+            maxY = std::max(maxY, pixelPoint.y);
+        }
+        zoneIndexById[id] = zoneBounds.size();
+        zoneBounds.emplace_back(minX, minY, std::max(0.0f, maxX - minX), std::max(0.0f, maxY - minY));
+    }
+
+    zoneGrid_.build(static_cast<float>(frameWidth_), static_cast<float>(frameHeight_), zoneBounds);
+
+    // Candidate track indices per zone, collected via the grid
+    std::vector<std::vector<size_t>> zoneCandidates(zoneBounds.size());
+    std::vector<int> gridHits;
+    for (size_t t = 0; t < tracks.size(); t++) {
+        const auto& bbox = tracks[t].bbox;
+        gridHits.clear();
+        zoneGrid_.query(cv::Rect2f(static_cast<float>(bbox.x), static_cast<float>(bbox.y),
+                                   static_cast<float>(bbox.width), static_cast<float>(bbox.height)),
+                        gridHits);
+        for (int zoneIndex : gridHits) {
+            zoneCandidates[zoneIndex].push_back(t);
+        }
+    }
+
     // Process tracks through all polygon zones
     std::vector<Event> allEvents;
     for (auto& [id, zone] : polygonZones_) {
         LOG_DEBUG("PolygonZoneManager", "Processing zone: " + id);
+
+        // Assemble this zone's candidate tracks: grid hits plus tracks the
+        // zone already has state for, so exit events still fire when a
+        // track moves away from the zone's area
+        std::vector<Track> candidateTracks;
+        std::vector<bool> isCandidate(tracks.size(), false);
+        for (size_t t : zoneCandidates[zoneIndexById[id]]) {
+            isCandidate[t] = true;
+            candidateTracks.push_back(tracks[t]);
+        }
+        for (size_t t = 0; t < tracks.size(); t++) {
+            if (!isCandidate[t] && zone->hasTrackState(tracks[t].trackId)) {
+                candidateTracks.push_back(tracks[t]);
+            }
+        }
+
+        // No track is near this zone and none is remembered by it, so the
+        // zone cannot produce events this frame
+        if (candidateTracks.empty()) {
+            continue;
+        }
         
         // Get the normalized polygon
         auto normalizedPolygon = zone->getPolygon();
@@ -835,34 +947,20 @@ PolygonZoneManager::processFrame(const cv::Mat& frame, const std::vector<ObjectT
         // Temporarily set the zone's polygon to pixel coordinates for processing
         zone->setPolygon(std::vector<cv::Point2f>(pixelPolygon.begin(), pixelPolygon.end()));
         
-        // Process the tracks through the zone
-        auto events = zone->processTracks(tracks);
+        // Evaluate the zone geometry once; the membership table drives
+        // entry/exit events, objectsInZones and the zone timer below
+        std::vector<bool> inZone = zone->computeAnchorsInZone(candidateTracks);
+
+        auto events = zone->processTracks(candidateTracks, inZone);
         if (!events.empty()) {
             LOG_DEBUG("PolygonZoneManager", "Zone " + id + " generated " + std::to_string(events.size()) + " events");
         }
         allEvents.insert(allEvents.end(), events.begin(), events.end());
-        
-        // Determine which objects are currently in the zone
-        // Convert tracks to detections for using the zone's computeAnchorsInZone method
-        std::vector<Detection> detections;
-        for (const auto& track : tracks) {
-            Detection det;
-            det.bbox = track.bbox;
-            det.confidence = track.confidence;
-            det.classId = track.classId;
-            det.className = track.className;
-            det.timestamp = track.timestamp;
-            detections.push_back(det);
-        }
-        
-        // Use the zone's method to check which detections are in the zone
-        // This respects the triggering anchors specified for the zone
-        std::vector<bool> inZone = zone->computeAnchorsInZone(detections);
-        
+
         // Add track IDs to objectsInZones for each detection that's in the zone
-        for (size_t i = 0; i < tracks.size(); i++) {
+        for (size_t i = 0; i < candidateTracks.size(); i++) {
             if (inZone[i]) {
-                objectsInZones[id].push_back(tracks[i].trackId);
+                objectsInZones[id].push_back(candidateTracks[i].trackId);
             }
         }
         
@@ -896,26 +994,35 @@ PolygonZoneManager::processFrame(const cv::Mat& frame, const std::vector<ObjectT
     // Add to stored events
     zoneEvents_.insert(zoneEvents_.end(), zoneEvents.begin(), zoneEvents.end());
     
-    // Create a copy of the frame for drawing
-    cv::Mat outputFrame = frame.clone();
-    
-    // Draw polygon zones on the frame if enabled
-    if (drawZones_) {
-        drawPolygonZones(outputFrame, objectsInZones);
-    }
-    
-    // Update and get times that objects have spent in each zone
-    std::map<std::string, std::unordered_map<int, double>> zoneTimesMap;
+    // Record zone membership for this frame; the timer state must advance
+    // even when nothing is drawn. Only entries and exits do work — dwell
+    // times are computed on demand below
     for (const auto& [zoneId, objectIds] : objectsInZones) {
-        auto zoneTimes = zoneTimer_.update(zoneId, objectIds);
-        zoneTimesMap[zoneId] = zoneTimes;
+        zoneTimer_.update(zoneId, objectIds);
     }
-    
-    // Draw time information next to tracked objects if enabled
-    if (displayTimeInZone_) {
-        drawObjectsWithTimeInZone(outputFrame, trackedObjects, objectsInZones, zoneTimesMap);
+
+    // Draw only while someone is watching; the frame copy is needed only
+    // when drawing happens
+    cv::Mat outputFrame = frame;
+    if (isAnnotationActive() && (drawZones_ || displayTimeInZone_)) {
+        outputFrame = frame.clone();
+
+        // Draw polygon zones on the frame if enabled
+        if (drawZones_) {
+            drawPolygonZones(outputFrame, objectsInZones);
+        }
+
+        // Draw time information next to tracked objects if enabled; the
+        // dwell map is only materialized while the overlay is active
+        if (displayTimeInZone_) {
+            std::map<std::string, std::unordered_map<int, double>> zoneTimesMap;
+            for (const auto& [zoneId, objectIds] : objectsInZones) {
+                zoneTimesMap[zoneId] = zoneTimer_.getAllTimesInZone(zoneId);
+            }
+            drawObjectsWithTimeInZone(outputFrame, trackedObjects, objectsInZones, zoneTimesMap);
+        }
     }
-    
+
     return {outputFrame, zoneEvents};
 }
 
@@ -1176,7 +1283,11 @@ std::vector<PolygonZoneEvent> PolygonZoneManager::convertEvents(const std::vecto
 std::vector<Track> PolygonZoneManager::convertTrackedObjects(
     const std::vector<ObjectTrackerProcessor::TrackedObject>& trackedObjects) const {
     std::vector<Track> tracks;
-    
+    tracks.reserve(trackedObjects.size());
+
+    // One timestamp for the whole batch; all tracks belong to the same frame
+    const int64_t timestamp = getCurrentTimestamp();
+
     for (const auto& obj : trackedObjects) {
         Track track;
         track.trackId = obj.trackId;
@@ -1184,11 +1295,11 @@ std::vector<Track> PolygonZoneManager::convertTrackedObjects(
         track.className = obj.className;
         track.classId = std::to_string(obj.trackId % 100); // Use a simple class ID for now
         track.confidence = obj.confidence;
-        track.timestamp = getCurrentTimestamp();
-        
+        track.timestamp = timestamp;
+
         tracks.push_back(track);
     }
-    
+
     return tracks;
 }
 
@@ -4,6 +4,15 @@
 
 namespace tapi {
 
+namespace {
+
+// How long a departed object's accumulated dwell is kept before its state
+// is dropped. Track IDs are not reused once the tracker retires them, so
+// anything this stale can no longer be queried meaningfully.
+constexpr std::chrono::seconds kRetiredStateRetention(600);
+
+} // namespace
+
 ZoneTimer::ZoneTimer() {
 }
 
@@ -11,45 +20,51 @@ void ZoneTimer::reset() {
     std::lock_guard<std::mutex> lock(mutex_);
     zoneEntryTimes_.clear();
     accumulatedTimes_.clear();
+    lastExitTimes_.clear();
+    retireHeap_ = {};
 }
 
-std::unordered_map<int, double> ZoneTimer::update(const std::string& zoneId, const std::vector<int>& objectIds) {
+void ZoneTimer::update(const std::string& zoneId, const std::vector<int>& objectIds) {
     std::lock_guard<std::mutex> lock(mutex_);
-    
+
     // Get current time
     auto currentTime = std::chrono::steady_clock::now();
-    
+
     // Create set of object IDs for quick lookups
     std::unordered_set<int> currentObjectIds(objectIds.begin(), objectIds.end());
-    
+
     // Check which objects have left the zone
     if (zoneEntryTimes_.find(zoneId) != zoneEntryTimes_.end()) {
         auto& entryTimes = zoneEntryTimes_[zoneId];
         std::vector<int> objectsToRemove;
-        
+
         for (const auto& [objectId, entryTime] : entryTimes) {
             if (currentObjectIds.find(objectId) == currentObjectIds.end()) {
                 // Object has left the zone, calculate time spent
                 auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
                     currentTime - entryTime).count() / 1000.0;
-                
+
                 // Add to accumulated time
                 if (accumulatedTimes_[zoneId].find(objectId) == accumulatedTimes_[zoneId].end()) {
                     accumulatedTimes_[zoneId][objectId] = duration;
                 } else {
                     accumulatedTimes_[zoneId][objectId] += duration;
                 }
-                
+
+                // Schedule retirement of the accumulated state
+                lastExitTimes_[zoneId][objectId] = currentTime;
+                retireHeap_.push({currentTime + kRetiredStateRetention, zoneId, objectId});
+
                 objectsToRemove.push_back(objectId);
             }
         }
-        
+
         // Remove objects that have left
         for (int objectId : objectsToRemove) {
             entryTimes.erase(objectId);
         }
     }
-    
+
     // Record entry times for new objects
     for (int objectId : objectIds) {
         if (zoneEntryTimes_[zoneId].find(objectId) == zoneEntryTimes_[zoneId].end()) {
@@ -57,23 +72,45 @@ std::unordered_map<int, double> ZoneTimer::update(const std::string& zoneId, con
             zoneEntryTimes_[zoneId][objectId] = currentTime;
         }
     }
-    
-    // Calculate current durations for objects in the zone
-    std::unordered_map<int, double> currentDurations;
-    for (int objectId : objectIds) {
-        double accumulatedTime = 0.0;
-        if (accumulatedTimes_[zoneId].find(objectId) != accumulatedTimes_[zoneId].end()) {
-            accumulatedTime = accumulatedTimes_[zoneId][objectId];
+
+    // Drop state for objects gone past the retention window; only due heap
+    // entries do work, so a crowded-but-static scene pops nothing
+    retireExpired(currentTime);
+}
+
+void ZoneTimer::retireExpired(SteadyTime currentTime) {
+    while (!retireHeap_.empty() && retireHeap_.top().due <= currentTime) {
+        const Retirement entry = retireHeap_.top();
+        retireHeap_.pop();
+
+        auto zoneIt = lastExitTimes_.find(entry.zoneId);
+        if (zoneIt == lastExitTimes_.end()) {
+            continue;
         }
-        
-        auto entryTime = zoneEntryTimes_[zoneId][objectId];
-        double currentSessionDuration = std::chrono::duration_cast<std::chrono::milliseconds>(
-            currentTime - entryTime).count() / 1000.0;
-        
-        currentDurations[objectId] = accumulatedTime + currentSessionDuration;
+        auto exitIt = zoneIt->second.find(entry.objectId);
+        if (exitIt == zoneIt->second.end()) {
+            continue; // already retired
+        }
+
+        // Exited again since this entry was scheduled: the newer heap
+        // entry owns the retirement
+        if (exitIt->second + kRetiredStateRetention > currentTime) {
+            continue;
+        }
+
+        // Back in the zone: keep the accumulated time for its next exit
+        auto entryZoneIt = zoneEntryTimes_.find(entry.zoneId);
+        if (entryZoneIt != zoneEntryTimes_.end() &&
+            entryZoneIt->second.count(entry.objectId) > 0) {
+            continue;
+        }
+
+        auto accZoneIt = accumulatedTimes_.find(entry.zoneId);
+        if (accZoneIt != accumulatedTimes_.end()) {
+            accZoneIt->second.erase(entry.objectId);
+        }
+        zoneIt->second.erase(exitIt);
     }
-    
-    return currentDurations;
 }
 
 double ZoneTimer::getTimeInZone(const std::string& zoneId, int objectId) const {
@@ -133,4 +170,38 @@ std::unordered_map<int, double> ZoneTimer::getAllTimesInZone(const std::string&
     return result;
 }
 
+nlohmann::json ZoneTimer::exportAccumulated() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    nlohmann::json state = nlohmann::json::object();
+    for (const auto& [zoneId, times] : accumulatedTimes_) {
+        nlohmann::json zoneTimes = nlohmann::json::object();
+        for (const auto& [objectId, seconds] : times) {
+            zoneTimes[std::to_string(objectId)] = seconds;
+        }
+        state[zoneId] = std::move(zoneTimes);
+    }
+    return state;
+}
+
+void ZoneTimer::importAccumulated(const nlohmann::json& state) {
+    if (!state.is_object()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (const auto& [zoneId, zoneTimes] : state.items()) {
+        if (!zoneTimes.is_object()) {
+            continue;
+        }
+        for (const auto& [objectKey, seconds] : zoneTimes.items()) {
+            try {
+                accumulatedTimes_[zoneId][std::stoi(objectKey)] += seconds.get<double>();
+            } catch (const std::exception&) {
+                // Malformed entry in an old snapshot; skip it
+            }
+        }
+    }
+}
+
 } // namespace tapi 
\ No newline at end of file
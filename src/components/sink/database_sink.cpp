@@ -1,12 +1,16 @@
 #include "components/sink/database_sink.h"
 #include "logger.h"
 #include "camera.h"
+#include "utils/frame_memory_budget.h"
+#include "utils/quality_governor.h"
+#include "utils/sqlite_read_pool.h"
 #include <iostream>
 #include <chrono>
 #include <iomanip>
 #include <sstream>
 #include <vector>
 #include <ctime>
+#include <cstdint>
 #include <filesystem>
 #include <thread>
 #include <locale>
@@ -180,6 +184,118 @@ nlohmann::json safeParseJson(const std::string& jsonStr, const std::string& fall
     }
 }
 
+// Apply the standard per-connection pragmas (UTF-8, WAL, cache sizing)
+void applyConnectionPragmas(sqlite3* db) {
+    sqlite3_exec(db, "PRAGMA synchronous=NORMAL;", nullptr, nullptr, nullptr);
+    sqlite3_exec(db, "PRAGMA cache_size=10000;", nullptr, nullptr, nullptr); // Increased cache
+    sqlite3_exec(db, "PRAGMA temp_store=memory;", nullptr, nullptr, nullptr);
+    sqlite3_exec(db, "PRAGMA encoding='UTF-8';", nullptr, nullptr, nullptr);
+    sqlite3_exec(db, "PRAGMA journal_mode=WAL;", nullptr, nullptr, nullptr);
+    sqlite3_exec(db, "PRAGMA busy_timeout=30000;", nullptr, nullptr, nullptr); // 30 second timeout
+    sqlite3_exec(db, "PRAGMA mmap_size=268435456;", nullptr, nullptr, nullptr); // 256MB memory map
+    sqlite3_exec(db, "PRAGMA optimize;", nullptr, nullptr, nullptr); // Auto-optimize query planner
+}
+
+/**
+ * @brief Process-wide registry of shared event-store connections
+ *
+ * When sinks opt into shared_store they all point at the same database
+ * file; the registry hands each of them the one sqlite3 connection, the
+ * connection mutex and the one thumbnail segment store, refcounted so
+ * the last sink to detach closes everything. Exactly one lease per
+ * store carries maintenance duty (WAL checkpoints and retention), which
+ * is the point of the exercise: N per-camera WAL/fsync streams collapse
+ * into one.
+ */
+class SharedStoreRegistry {
+public:
+    struct Lease {
+        sqlite3* db = nullptr;
+        std::shared_ptr<std::mutex> mutex;
+        std::shared_ptr<FrameStore> frameStore;
+        bool maintenance = false;
+    };
+
+    static SharedStoreRegistry& getInstance() {
+        static SharedStoreRegistry instance;
+        return instance;
+    }
+
+    /**
+     * @brief Attach to the store at path, opening it on first use
+     *
+     * openFn performs the first-open setup (connection, pragmas, tables,
+     * frame store) and runs under the registry lock so later acquirers
+     * never observe a half-initialized store.
+     */
+    Lease acquire(const std::string& path, const std::function<bool(Lease&)>& openFn) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = stores_.find(path);
+        if (it == stores_.end()) {
+            Lease fresh;
+            if (!openFn(fresh) || !fresh.db) {
+                return Lease{};
+            }
+            Entry entry;
+            entry.db = fresh.db;
+            entry.mutex = std::make_shared<std::mutex>();
+            entry.frameStore = fresh.frameStore;
+            it = stores_.emplace(path, std::move(entry)).first;
+        }
+
+        Entry& entry = it->second;
+        entry.refCount++;
+
+        Lease lease;
+        lease.db = entry.db;
+        lease.mutex = entry.mutex;
+        lease.frameStore = entry.frameStore;
+        if (!entry.maintenanceClaimed) {
+            entry.maintenanceClaimed = true;
+            lease.maintenance = true;
+        }
+        return lease;
+    }
+
+    /// Detach from the store; the last release closes the connection
+    void release(const std::string& path, bool hadMaintenance) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = stores_.find(path);
+        if (it == stores_.end()) {
+            return;
+        }
+
+        Entry& entry = it->second;
+        if (hadMaintenance) {
+            // A later acquirer inherits checkpoint/retention duty
+            entry.maintenanceClaimed = false;
+        }
+        if (--entry.refCount <= 0) {
+            if (entry.db) {
+                sqlite3_close(entry.db);
+            }
+            if (entry.frameStore) {
+                entry.frameStore->close();
+            }
+            stores_.erase(it);
+        }
+    }
+
+private:
+    SharedStoreRegistry() = default;
+
+    struct Entry {
+        sqlite3* db = nullptr;
+        std::shared_ptr<std::mutex> mutex;
+        std::shared_ptr<FrameStore> frameStore;
+        int refCount = 0;
+        bool maintenanceClaimed = false;
+    };
+
+    std::mutex mutex_;
+    std::unordered_map<std::string, Entry> stores_;
+};
+
 } // anonymous namespace
 
 DatabaseSink::DatabaseSink(const std::string& id, Camera* camera, const std::string& type, const nlohmann::json& config)
@@ -189,18 +305,26 @@ DatabaseSink::DatabaseSink(const std::string& id, Camera* camera, const std::str
       thumbnailWidth_(320),
       thumbnailHeight_(180),
       retentionDays_(30),
+      frameRetentionDays_(7),
+      rollupRetentionDays_(365),
+      nextRetentionDueMs_(0),
       db_(nullptr),
       writerDb_(nullptr),
+      sharedStore_(false),
+      sharedMaintenance_(false),
       isInitialized_(false),
       insertedFrames_(0),
       insertedEvents_(0),
       storeDetectionEvents_(true),
       storeTrackingEvents_(true),
       storeCountingEvents_(true),
+      eventInsertStmt_(nullptr),
+      frameInsertStmt_(nullptr),
+      checkpointThreadRunning_(false),
       writerThreadRunning_(false),
-      maxQueueSize_(100), // Simplified queue size
-      batchSize_(10), // Simplified batch size
+      maxQueueSize_(100),
       queuedBatches_(0),
+      batchSize_(10), // Simplified batch size
       maxMemoryUsage_(50 * 1024 * 1024), // Reduced to 50MB
       currentMemoryUsage_(0) {
     
@@ -224,12 +348,11 @@ DatabaseSink::~DatabaseSink() {
     }
     
     // Simple cleanup
-    std::lock_guard<std::mutex> lock(dbMutex_);
-    if (db_) {
-        sqlite3_close(db_);
-        db_ = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(dbLock());
+        closeConnection();
     }
-    
+
     LOG_INFO("DatabaseSink", "DatabaseSink destroyed");
 }
 
@@ -248,9 +371,73 @@ bool DatabaseSink::initialize() {
         }
     }
     
+    if (sharedStore_) {
+        // Attach to the process-wide store: one connection, one WAL and
+        // one fsync stream no matter how many cameras are writing
+        auto lease = SharedStoreRegistry::getInstance().acquire(
+            dbPath_, [this](SharedStoreRegistry::Lease& fresh) {
+                sqlite3* db = nullptr;
+                if (sqlite3_open(dbPath_.c_str(), &db) != SQLITE_OK) {
+                    LOG_ERROR("DatabaseSink", "Failed to open shared database: " +
+                              std::string(db ? sqlite3_errmsg(db) : "out of memory"));
+                    if (db) {
+                        sqlite3_close(db);
+                    }
+                    return false;
+                }
+
+                applyConnectionPragmas(db);
+
+                db_ = db; // createTables() works on db_
+                if (!createTables()) {
+                    LOG_ERROR("DatabaseSink", "Failed to create shared database tables");
+                    sqlite3_close(db);
+                    db_ = nullptr;
+                    return false;
+                }
+                db_ = nullptr; // set again under dbLock() once the lease is out
+
+                // One segment store next to the shared database file serves
+                // every camera's thumbnails
+                std::filesystem::path dbFile(dbPath_);
+                std::string framesDir = (dbFile.parent_path() / (dbFile.stem().string() + "_frames")).string();
+                auto store = std::make_shared<FrameStore>(framesDir);
+                if (store->open()) {
+                    fresh.frameStore = store;
+                } else {
+                    LOG_WARN("DatabaseSink", "Failed to open shared frame store, thumbnails will not be stored");
+                }
+
+                fresh.db = db;
+                return true;
+            });
+
+        if (!lease.db) {
+            LOG_ERROR("DatabaseSink", "Failed to attach to shared event store: " + dbPath_);
+            return false;
+        }
+
+        sharedDbMutex_ = lease.mutex;
+        sharedMaintenance_ = lease.maintenance;
+
+        std::lock_guard<std::mutex> lock(dbLock());
+        db_ = lease.db;
+        frameStore_ = lease.frameStore;
+
+        if (!prepareStatements()) {
+            LOG_ERROR("DatabaseSink", "Failed to prepare insert statements");
+            return false;
+        }
+
+        isInitialized_ = true;
+        LOG_INFO("DatabaseSink", "Attached to shared event store: " + dbPath_ +
+                 (sharedMaintenance_ ? " (maintenance owner)" : ""));
+        return true;
+    }
+
     // Initialize single database connection
-    std::lock_guard<std::mutex> lock(dbMutex_);
-    
+    std::lock_guard<std::mutex> lock(dbLock());
+
     int rc = sqlite3_open(dbPath_.c_str(), &db_);
     if (rc != SQLITE_OK) {
         LOG_ERROR("DatabaseSink", "Failed to open database: " + std::string(sqlite3_errmsg(db_)));
@@ -260,28 +447,60 @@ bool DatabaseSink::initialize() {
         }
         return false;
     }
-    
+
     // SQLite configuration with UTF-8 enforcement and performance optimizations
-    sqlite3_exec(db_, "PRAGMA synchronous=NORMAL;", nullptr, nullptr, nullptr);
-    sqlite3_exec(db_, "PRAGMA cache_size=10000;", nullptr, nullptr, nullptr); // Increased cache
-    sqlite3_exec(db_, "PRAGMA temp_store=memory;", nullptr, nullptr, nullptr);
-    sqlite3_exec(db_, "PRAGMA encoding='UTF-8';", nullptr, nullptr, nullptr);
-    sqlite3_exec(db_, "PRAGMA journal_mode=WAL;", nullptr, nullptr, nullptr);
-    sqlite3_exec(db_, "PRAGMA busy_timeout=30000;", nullptr, nullptr, nullptr); // 30 second timeout
-    sqlite3_exec(db_, "PRAGMA mmap_size=268435456;", nullptr, nullptr, nullptr); // 256MB memory map
-    sqlite3_exec(db_, "PRAGMA optimize;", nullptr, nullptr, nullptr); // Auto-optimize query planner
-    
+    applyConnectionPragmas(db_);
+
     // Create simple table
     if (!createTables()) {
         LOG_ERROR("DatabaseSink", "Failed to create database tables");
         return false;
     }
-    
+
+    // Prepare the hot-path insert statements once; they are reused via
+    // bind/step/reset for every row instead of being re-compiled per insert
+    if (!prepareStatements()) {
+        LOG_ERROR("DatabaseSink", "Failed to prepare insert statements");
+        return false;
+    }
+
+    // Open the segment store for thumbnail blobs next to the database file
+    std::filesystem::path dbFile(dbPath_);
+    std::string framesDir = (dbFile.parent_path() / (dbFile.stem().string() + "_frames")).string();
+    frameStore_ = std::make_shared<FrameStore>(framesDir);
+    if (!frameStore_->open()) {
+        LOG_WARN("DatabaseSink", "Failed to open frame store, thumbnails will not be stored");
+        frameStore_.reset();
+    }
+
     isInitialized_ = true;
     LOG_INFO("DatabaseSink", "Database initialized successfully: " + dbPath_);
     return true;
 }
 
+void DatabaseSink::closeConnection() {
+    finalizeStatements();
+
+    if (sharedStore_) {
+        if (db_) {
+            SharedStoreRegistry::getInstance().release(dbPath_, sharedMaintenance_);
+            db_ = nullptr;
+        }
+        sharedMaintenance_ = false;
+        frameStore_.reset(); // registry closes the store on last release
+        return;
+    }
+
+    if (db_) {
+        sqlite3_close(db_);
+        db_ = nullptr;
+    }
+    if (frameStore_) {
+        frameStore_->close();
+        frameStore_.reset();
+    }
+}
+
 bool DatabaseSink::start() {
     LOG_INFO("DatabaseSink", "Starting simplified DatabaseSink with ID: " + getId());
     
@@ -291,6 +510,21 @@ bool DatabaseSink::start() {
     }
     
     running_ = true;
+
+    // Start the dedicated writer thread that drains the batch queue
+    if (!writerThread_.joinable()) {
+        writerThreadRunning_ = true;
+        writerThread_ = std::thread(&DatabaseSink::writerThreadFunction, this);
+    }
+
+    // Start the background WAL checkpoint thread so checkpoints never run
+    // on the frame thread. In shared mode only the maintenance owner
+    // checkpoints (and runs retention) — one WAL, one checkpointer
+    if ((!sharedStore_ || sharedMaintenance_) && !checkpointThread_.joinable()) {
+        checkpointThreadRunning_ = true;
+        checkpointThread_ = std::thread(&DatabaseSink::checkpointThreadFunction, this);
+    }
+
     LOG_INFO("DatabaseSink", "DatabaseSink started successfully");
     return true;
 }
@@ -298,6 +532,21 @@ bool DatabaseSink::start() {
 bool DatabaseSink::stop() {
     LOG_INFO("DatabaseSink", "Stopping DatabaseSink with ID: " + getId());
     running_ = false;
+
+    // Stop the writer thread; it drains any queued batches before exiting
+    if (writerThread_.joinable()) {
+        writerThreadRunning_ = false;
+        queueCv_.notify_all();
+        writerThread_.join();
+    }
+
+    // Stop the checkpoint thread
+    if (checkpointThread_.joinable()) {
+        checkpointThreadRunning_ = false;
+        checkpointCv_.notify_all();
+        checkpointThread_.join();
+    }
+
     LOG_INFO("DatabaseSink", "DatabaseSink stopped");
     return true;
 }
@@ -322,7 +571,24 @@ bool DatabaseSink::updateConfig(const nlohmann::json& config) {
         if (config.contains("retention_days")) {
             retentionDays_ = config["retention_days"].get<int>();
         }
-        
+
+        if (config.contains("frame_retention_days")) {
+            frameRetentionDays_ = config["frame_retention_days"].get<int>();
+        }
+
+        if (config.contains("rollup_retention_days")) {
+            rollupRetentionDays_ = config["rollup_retention_days"].get<int>();
+        }
+
+        if (config.contains("shared_store") && !isInitialized_) {
+            sharedStore_ = config["shared_store"].get<bool>();
+            if (sharedStore_) {
+                // One database file for every camera; rows are keyed by
+                // the camera_id column every table already carries
+                dbPath_ = "./data/telemetry.db";
+            }
+        }
+
         if (config.contains("store_detection_events")) {
             storeDetectionEvents_ = config["store_detection_events"].get<bool>();
         }
@@ -350,6 +616,9 @@ nlohmann::json DatabaseSink::getConfig() const {
     config["thumbnail_width"] = thumbnailWidth_;
     config["thumbnail_height"] = thumbnailHeight_;
     config["retention_days"] = retentionDays_;
+    config["frame_retention_days"] = frameRetentionDays_;
+    config["rollup_retention_days"] = rollupRetentionDays_;
+    config["shared_store"] = sharedStore_;
     config["store_detection_events"] = storeDetectionEvents_;
     config["store_tracking_events"] = storeTrackingEvents_;
     config["store_counting_events"] = storeCountingEvents_;
@@ -363,12 +632,16 @@ nlohmann::json DatabaseSink::getStatus() const {
     status["thumbnail_width"] = thumbnailWidth_;
     status["thumbnail_height"] = thumbnailHeight_;
     status["retention_days"] = retentionDays_;
+    status["frame_retention_days"] = frameRetentionDays_;
+    status["rollup_retention_days"] = rollupRetentionDays_;
+    status["shared_store"] = sharedStore_;
     status["inserted_frames"] = insertedFrames_;
     status["inserted_events"] = insertedEvents_;
     status["initialized"] = isInitialized_;
     status["store_detection_events"] = storeDetectionEvents_;
     status["store_tracking_events"] = storeTrackingEvents_;
     status["store_counting_events"] = storeCountingEvents_;
+    status["queued_batches"] = queuedBatches_.load();
     return status;
 }
 
@@ -392,13 +665,17 @@ bool DatabaseSink::createTables() {
         );
     )";
     
-    // Create robust frames table
+    // Create robust frames table. Thumbnail blobs live in FrameStore segment
+    // files; the table only keeps (segment_id, offset, length) locators so
+    // the SQLite file stays small and vacuum cycles stay cheap
     const char* createFramesTable = R"(
         CREATE TABLE IF NOT EXISTS frames (
             id INTEGER PRIMARY KEY AUTOINCREMENT,
             camera_id TEXT NOT NULL CHECK(length(camera_id) > 0),
             timestamp INTEGER NOT NULL CHECK(timestamp > 0),
-            thumbnail BLOB,
+            segment_id INTEGER,
+            offset INTEGER,
+            length INTEGER,
             width INTEGER CHECK(width > 0),
             height INTEGER CHECK(height > 0),
             created_at INTEGER DEFAULT (strftime('%s', 'now') * 1000)
@@ -454,6 +731,20 @@ bool DatabaseSink::createTables() {
         );
     )";
 
+    const char* createZoneCountsBucketsTable = R"(
+        CREATE TABLE IF NOT EXISTS zone_counts_buckets (
+            camera_id TEXT NOT NULL,
+            zone_id TEXT NOT NULL,
+            bucket_timestamp INTEGER NOT NULL,
+            bucket_size INTEGER NOT NULL,
+            direction TEXT NOT NULL,
+            class_name TEXT,
+            event_count INTEGER NOT NULL DEFAULT 0,
+            last_updated INTEGER DEFAULT (strftime('%s', 'now') * 1000),
+            PRIMARY KEY (camera_id, zone_id, bucket_timestamp, bucket_size, direction, class_name)
+        );
+    )";
+
     const char* createEventTypeCountsTable = R"(
         CREATE TABLE IF NOT EXISTS event_type_counts (
             camera_id TEXT NOT NULL,
@@ -507,7 +798,8 @@ bool DatabaseSink::createTables() {
         "CREATE INDEX IF NOT EXISTS idx_class_distribution_camera ON class_distribution(camera_id, total_count DESC);",
         "CREATE INDEX IF NOT EXISTS idx_dwell_times_camera ON dwell_times(camera_id, dwell_time_ms DESC);",
         "CREATE INDEX IF NOT EXISTS idx_dwell_times_class ON dwell_times(camera_id, class_name, dwell_time_ms DESC);",
-        "CREATE INDEX IF NOT EXISTS idx_event_type_counts_camera ON event_type_counts(camera_id, event_type);"
+        "CREATE INDEX IF NOT EXISTS idx_event_type_counts_camera ON event_type_counts(camera_id, event_type);",
+        "CREATE INDEX IF NOT EXISTS idx_zone_counts_camera_bucket ON zone_counts_buckets(camera_id, bucket_size, bucket_timestamp DESC);"
     };
     
     // Execute table creation
@@ -526,13 +818,20 @@ bool DatabaseSink::createTables() {
         return false;
     }
 
+    // Add the locator columns to frames tables created before the segment
+    // store existed (fails harmlessly when the columns are already there)
+    sqlite3_exec(db_, "ALTER TABLE frames ADD COLUMN segment_id INTEGER;", nullptr, nullptr, nullptr);
+    sqlite3_exec(db_, "ALTER TABLE frames ADD COLUMN offset INTEGER;", nullptr, nullptr, nullptr);
+    sqlite3_exec(db_, "ALTER TABLE frames ADD COLUMN length INTEGER;", nullptr, nullptr, nullptr);
+
     // Create aggregate tables
     const char* aggregateTables[] = {
         createAnalyticsSummaryTable,
         createTimeSeriesBucketsTable,
         createClassDistributionTable,
         createDwellTimesTable,
-        createEventTypeCountsTable
+        createEventTypeCountsTable,
+        createZoneCountsBucketsTable
     };
 
     for (const char* tableQuery : aggregateTables) {
@@ -559,12 +858,194 @@ bool DatabaseSink::createTables() {
     sqlite3_exec(db_, "PRAGMA optimize;", nullptr, nullptr, nullptr);
     sqlite3_exec(db_, "PRAGMA auto_vacuum=INCREMENTAL;", nullptr, nullptr, nullptr); // Better for large DBs
     sqlite3_exec(db_, "PRAGMA incremental_vacuum(1000);", nullptr, nullptr, nullptr); // Reclaim space gradually
-    sqlite3_exec(db_, "PRAGMA wal_checkpoint(TRUNCATE);", nullptr, nullptr, nullptr); // Checkpoint WAL for performance
-    
+    // WAL checkpointing is handled by the background checkpoint thread
+
     LOG_INFO("DatabaseSink", "Database tables and advanced indexes created successfully");
     return true;
 }
 
+bool DatabaseSink::prepareStatements() {
+    if (!db_) {
+        return false;
+    }
+
+    const char* eventSql = "INSERT INTO telemetry_events (camera_id, timestamp, event_type, source_id, properties, frame_id) VALUES (?, ?, ?, ?, ?, ?)";
+    int rc = sqlite3_prepare_v2(db_, eventSql, -1, &eventInsertStmt_, nullptr);
+    if (rc != SQLITE_OK) {
+        LOG_ERROR("DatabaseSink", "Failed to prepare event statement: " + std::string(sqlite3_errmsg(db_)));
+        eventInsertStmt_ = nullptr;
+        return false;
+    }
+
+    const char* frameSql = "INSERT INTO frames (camera_id, timestamp, segment_id, offset, length, width, height) VALUES (?, ?, ?, ?, ?, ?, ?)";
+    rc = sqlite3_prepare_v2(db_, frameSql, -1, &frameInsertStmt_, nullptr);
+    if (rc != SQLITE_OK) {
+        LOG_ERROR("DatabaseSink", "Failed to prepare frame statement: " + std::string(sqlite3_errmsg(db_)));
+        sqlite3_finalize(eventInsertStmt_);
+        eventInsertStmt_ = nullptr;
+        frameInsertStmt_ = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+void DatabaseSink::finalizeStatements() {
+    if (eventInsertStmt_) {
+        sqlite3_finalize(eventInsertStmt_);
+        eventInsertStmt_ = nullptr;
+    }
+    if (frameInsertStmt_) {
+        sqlite3_finalize(frameInsertStmt_);
+        frameInsertStmt_ = nullptr;
+    }
+}
+
+void DatabaseSink::checkpointThreadFunction() {
+    LOG_INFO("DatabaseSink", "WAL checkpoint thread started");
+
+    // Passive checkpoints never block the frame thread's writes; they just
+    // fold whatever WAL frames are safe to fold back into the main file
+    const auto interval = std::chrono::seconds(30);
+
+    while (checkpointThreadRunning_) {
+        {
+            std::unique_lock<std::mutex> lock(checkpointMutex_);
+            checkpointCv_.wait_for(lock, interval, [this]() {
+                return !checkpointThreadRunning_.load();
+            });
+        }
+
+        if (!checkpointThreadRunning_) {
+            break;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(dbLock());
+            if (db_) {
+                int walFrames = 0;
+                int checkpointed = 0;
+                int rc = sqlite3_wal_checkpoint_v2(db_, nullptr, SQLITE_CHECKPOINT_PASSIVE, &walFrames, &checkpointed);
+                if (rc != SQLITE_OK && rc != SQLITE_BUSY) {
+                    LOG_WARN("DatabaseSink", "WAL checkpoint failed: " + std::string(sqlite3_errmsg(db_)));
+                } else {
+                    LOG_DEBUG("DatabaseSink", "WAL checkpoint: " + std::to_string(checkpointed) + "/" + std::to_string(walFrames) + " frames");
+                }
+            }
+        }
+
+        runRetentionSlice();
+    }
+
+    LOG_INFO("DatabaseSink", "WAL checkpoint thread stopped");
+}
+
+void DatabaseSink::runRetentionSlice() {
+    const int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    if (now < nextRetentionDueMs_) {
+        return;
+    }
+
+    // Only trim while the writer queue is empty so retention deletes never
+    // compete with live telemetry batches for the database (in shared mode
+    // this is the maintenance owner's queue — a cheap idle heuristic)
+    if (queuedBatches_.load() > 0) {
+        return;
+    }
+
+    // Small slices keep each write transaction (and the WAL growth it
+    // causes) bounded; the 30s checkpoint cadence drains any backlog over
+    // many ticks instead of one long pause
+    constexpr int kRetentionSliceRows = 500;
+    constexpr int64_t dayMs = 24LL * 60 * 60 * 1000;
+
+    struct Policy {
+        const char* table;
+        const char* timeColumn;
+        int days;
+    };
+    const Policy policies[] = {
+        {"telemetry_events", "timestamp", retentionDays_},
+        {"frames", "timestamp", frameRetentionDays_},
+        {"time_series_buckets", "bucket_timestamp", rollupRetentionDays_},
+        {"zone_counts_buckets", "bucket_timestamp", rollupRetentionDays_},
+        {"dwell_times", "last_seen", rollupRetentionDays_},
+    };
+
+    int totalDeleted = 0;
+    int deletedFrames = 0;
+
+    std::lock_guard<std::mutex> lock(dbLock());
+    if (!db_) {
+        return;
+    }
+
+    for (const auto& policy : policies) {
+        if (policy.days <= 0) {
+            continue; // 0 = keep forever
+        }
+
+        // Standard SQLite builds lack DELETE ... LIMIT, so bound the slice
+        // through a rowid subquery (works for rowid and AUTOINCREMENT tables)
+        const std::string sql = "DELETE FROM " + std::string(policy.table) +
+            " WHERE rowid IN (SELECT rowid FROM " + std::string(policy.table) +
+            " WHERE " + std::string(policy.timeColumn) + " < ? LIMIT " +
+            std::to_string(kRetentionSliceRows) + ")";
+
+        sqlite3_stmt* stmt;
+        int rc = sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr);
+        if (rc != SQLITE_OK) {
+            LOG_WARN("DatabaseSink", "Failed to prepare retention delete for " +
+                     std::string(policy.table) + ": " + std::string(sqlite3_errmsg(db_)));
+            continue;
+        }
+
+        sqlite3_bind_int64(stmt, 1, now - policy.days * dayMs);
+        rc = sqlite3_step(stmt);
+        int deleted = (rc == SQLITE_DONE) ? sqlite3_changes(db_) : 0;
+        sqlite3_finalize(stmt);
+
+        if (deleted > 0) {
+            totalDeleted += deleted;
+            if (std::string(policy.table) == "frames") {
+                deletedFrames = deleted;
+            }
+            LatencyMetrics::getInstance().addToCounter(
+                "tapi_retention_deleted_total",
+                "table=\"" + std::string(policy.table) + "\"",
+                static_cast<uint64_t>(deleted));
+            LOG_DEBUG("DatabaseSink", "Retention: deleted " + std::to_string(deleted) +
+                      " rows from " + std::string(policy.table));
+        }
+    }
+
+    // Reclaim thumbnail storage once the oldest surviving frame row has
+    // moved past whole segment files
+    if (deletedFrames > 0 && frameStore_) {
+        const char* minSegmentSql = "SELECT MIN(segment_id) FROM frames WHERE segment_id IS NOT NULL";
+        sqlite3_stmt* stmt;
+        if (sqlite3_prepare_v2(db_, minSegmentSql, -1, &stmt, nullptr) == SQLITE_OK) {
+            int64_t oldestLiveSegment = INT64_MAX;
+            if (sqlite3_step(stmt) == SQLITE_ROW && sqlite3_column_type(stmt, 0) != SQLITE_NULL) {
+                oldestLiveSegment = sqlite3_column_int64(stmt, 0);
+            }
+            sqlite3_finalize(stmt);
+            frameStore_->removeSegmentsBefore(oldestLiveSegment);
+        }
+    }
+
+    if (totalDeleted > 0) {
+        // Hand freed pages back a few at a time; createTables() set
+        // auto_vacuum=INCREMENTAL so this never rewrites the whole file
+        sqlite3_exec(db_, "PRAGMA incremental_vacuum(256);", nullptr, nullptr, nullptr);
+        nextRetentionDueMs_ = 0; // backlog remains — keep slicing next tick
+    } else {
+        nextRetentionDueMs_ = now + 60LL * 60 * 1000; // clean pass — re-check hourly
+    }
+}
+
 bool DatabaseSink::processTelemetry(const cv::Mat& frame, const std::vector<TelemetryEvent>& events) {
     if (!isRunning() || !isInitialized_ || !db_) {
         return false;
@@ -598,39 +1079,98 @@ bool DatabaseSink::processTelemetry(const cv::Mat& frame, const std::vector<Tele
     if (filteredEvents.empty()) {
         return true;
     }
-    
-    // Simple synchronous processing
-    std::lock_guard<std::mutex> lock(dbMutex_);
-    
+
+    // Hand the batch to the writer thread so SQLite latency stays off the
+    // camera processing path. The writer thread is the only consumer.
+    TelemetryBatch batch;
+    batch.events = std::move(filteredEvents);
+    batch.timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    // Backpressure: when the queue is deep or frame memory is over its
+    // budget, drop the frame blob (the expensive part) but never the
+    // events themselves
+    if (storeThumbnails_ && !frame.empty() && queuedBatches_ < maxQueueSize_) {
+        if (utils::FrameMemoryBudget::getInstance().shouldShed(
+                utils::FrameMemoryBudget::ShedClass::Recording)) {
+            LatencyMetrics::getInstance().incrementCounter(
+                "tapi_frame_budget_shed_total",
+                "class=\"recording\",camera=\"" + (camera_ ? camera_->getId() : "unknown") + "\"");
+        } else if (utils::QualityGovernor::getInstance().shedRecording()) {
+            // System load sheds the frame blob the same way memory
+            // pressure does; the events themselves are always written
+            LatencyMetrics::getInstance().incrementCounter(
+                "tapi_governor_shed_total",
+                "class=\"recording\",camera=\"" + (camera_ ? camera_->getId() : "unknown") + "\"");
+        } else {
+            // Published frames are immutable and pool-backed, so sharing
+            // the header keeps the buffer alive by refcount instead of
+            // copying megabytes per event batch
+            batch.frame = frame;
+        }
+    }
+
+    if (!writerThreadRunning_) {
+        // No writer thread (e.g. during shutdown) - write synchronously
+        return processBatch(batch);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        batchQueue_.push(std::move(batch));
+        queuedBatches_++;
+    }
+    queueCv_.notify_one();
+
+    return true;
+}
+
+bool DatabaseSink::processBatch(const TelemetryBatch& batch) {
+    std::lock_guard<std::mutex> lock(dbLock());
+
+    if (!db_) {
+        return false;
+    }
+
+    // Commit the whole batch (frame, events and aggregate updates) in a
+    // single transaction so a burst of events costs one fsync, not one per row
+    bool inTransaction = (sqlite3_exec(db_, "BEGIN IMMEDIATE;", nullptr, nullptr, nullptr) == SQLITE_OK);
+    if (!inTransaction) {
+        LOG_WARN("DatabaseSink", "Failed to begin batch transaction: " + std::string(sqlite3_errmsg(db_)));
+    }
+
     // Insert frame if thumbnails are enabled
     int64_t frameId = -1;
-    if (storeThumbnails_ && !frame.empty()) {
-        frameId = insertFrame(frame);
+    if (storeThumbnails_ && !batch.frame.empty()) {
+        frameId = insertFrame(batch.frame);
     }
-    
+
     // Insert events directly
-    for (const auto& event : filteredEvents) {
+    for (const auto& event : batch.events) {
         if (insertEvent(event, frameId)) {
             insertedEvents_++;
         }
     }
-    
+
+    if (inTransaction) {
+        int rc = sqlite3_exec(db_, "COMMIT;", nullptr, nullptr, nullptr);
+        if (rc != SQLITE_OK) {
+            LOG_ERROR("DatabaseSink", "Failed to commit batch transaction: " + std::string(sqlite3_errmsg(db_)));
+            sqlite3_exec(db_, "ROLLBACK;", nullptr, nullptr, nullptr);
+            return false;
+        }
+    }
+
     return true;
 }
 
 bool DatabaseSink::insertEvent(const TelemetryEvent& event, int64_t frameId) {
-    if (!db_) {
-        return false;
-    }
-    
-    const char* sql = "INSERT INTO telemetry_events (camera_id, timestamp, event_type, source_id, properties, frame_id) VALUES (?, ?, ?, ?, ?, ?)";
-    sqlite3_stmt* stmt;
-    int rc = sqlite3_prepare_v2(db_, sql, -1, &stmt, nullptr);
-    if (rc != SQLITE_OK) {
-        LOG_ERROR("DatabaseSink", "Failed to prepare event statement: " + std::string(sqlite3_errmsg(db_)));
+    if (!db_ || !eventInsertStmt_) {
         return false;
     }
-    
+
+    sqlite3_stmt* stmt = eventInsertStmt_;
+
     // Sanitize camera ID and source ID
     std::string cameraId = sanitizeUTF8(camera_ ? camera_->getId() : "unknown");
     std::string sourceId = sanitizeUTF8(event.getSourceId());
@@ -680,14 +1220,15 @@ bool DatabaseSink::insertEvent(const TelemetryEvent& event, int64_t frameId) {
         sqlite3_bind_null(stmt, 6);
     }
     
-    rc = sqlite3_step(stmt);
+    int rc = sqlite3_step(stmt);
     bool success = (rc == SQLITE_DONE);
-    
+
     if (!success) {
         LOG_ERROR("DatabaseSink", "Failed to insert event: " + std::string(sqlite3_errmsg(db_)));
     }
-    
-    sqlite3_finalize(stmt);
+
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
 
     // Update aggregate tables in real-time for high-performance analytics
     if (success) {
@@ -702,32 +1243,45 @@ int64_t DatabaseSink::insertFrame(const cv::Mat& frame) {
         return -1;
     }
     
-    std::string thumbnail = generateThumbnail(frame);
+    utils::JpegBuffer thumbnail = generateThumbnail(frame);
     int64_t timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::system_clock::now().time_since_epoch()).count();
-    
-    const char* sql = "INSERT INTO frames (camera_id, timestamp, thumbnail, width, height) VALUES (?, ?, ?, ?, ?)";
-    sqlite3_stmt* stmt;
-    int rc = sqlite3_prepare_v2(db_, sql, -1, &stmt, nullptr);
-    if (rc != SQLITE_OK) {
-        LOG_ERROR("DatabaseSink", "Failed to prepare frame statement: " + std::string(sqlite3_errmsg(db_)));
+
+    if (!frameInsertStmt_) {
         return -1;
     }
-    
+
+    sqlite3_stmt* stmt = frameInsertStmt_;
+
+    // Append the blob to the segment store straight from the encoder's
+    // shared buffer; SQLite only gets the locator
+    FrameStore::Location location{-1, -1, 0};
+    bool stored = false;
+    if (thumbnail && !thumbnail->empty() && frameStore_) {
+        stored = frameStore_->append(thumbnail->data(), thumbnail->size(), location);
+        if (!stored) {
+            LOG_WARN("DatabaseSink", "Failed to append thumbnail to frame store");
+        }
+    }
+
     std::string cameraId = camera_ ? camera_->getId() : "unknown";
-    sqlite3_bind_text(stmt, 1, cameraId.c_str(), -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 1, cameraId.c_str(), -1, SQLITE_TRANSIENT);
     sqlite3_bind_int64(stmt, 2, timestamp);
-    
-    if (!thumbnail.empty()) {
-        sqlite3_bind_blob(stmt, 3, thumbnail.data(), thumbnail.size(), SQLITE_TRANSIENT);
+
+    if (stored) {
+        sqlite3_bind_int64(stmt, 3, location.segmentId);
+        sqlite3_bind_int64(stmt, 4, location.offset);
+        sqlite3_bind_int64(stmt, 5, location.length);
     } else {
         sqlite3_bind_null(stmt, 3);
+        sqlite3_bind_null(stmt, 4);
+        sqlite3_bind_null(stmt, 5);
     }
+
+    sqlite3_bind_int(stmt, 6, thumbnailWidth_);
+    sqlite3_bind_int(stmt, 7, thumbnailHeight_);
     
-    sqlite3_bind_int(stmt, 4, thumbnailWidth_);
-    sqlite3_bind_int(stmt, 5, thumbnailHeight_);
-    
-    rc = sqlite3_step(stmt);
+    int rc = sqlite3_step(stmt);
     int64_t frameId = -1;
     if (rc == SQLITE_DONE) {
         frameId = sqlite3_last_insert_rowid(db_);
@@ -735,33 +1289,33 @@ int64_t DatabaseSink::insertFrame(const cv::Mat& frame) {
     } else {
         LOG_ERROR("DatabaseSink", "Failed to insert frame: " + std::string(sqlite3_errmsg(db_)));
     }
-    
-    sqlite3_finalize(stmt);
+
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
     return frameId;
 }
 
-std::string DatabaseSink::generateThumbnail(const cv::Mat& frame) {
+utils::JpegBuffer DatabaseSink::generateThumbnail(const cv::Mat& frame) {
     if (frame.empty()) {
-        return "";
+        return nullptr;
     }
-    
+
     try {
         cv::Mat thumbnail;
         cv::resize(frame, thumbnail, cv::Size(thumbnailWidth_, thumbnailHeight_));
-        
-        std::vector<uchar> buffer;
-        std::vector<int> params = {cv::IMWRITE_JPEG_QUALITY, 85};
-        
-        if (!cv::imencode(".jpg", thumbnail, buffer, params)) {
+
+        // Shared encoder: hardware fast path when the box has one, and
+        // the bytes land in a pooled refcounted buffer rather than a
+        // sink-private copy
+        utils::JpegBuffer buffer = utils::JpegEncoder::getInstance().encode(thumbnail, 85);
+        if (!buffer) {
             LOG_ERROR("DatabaseSink", "Failed to encode thumbnail as JPEG");
-            return "";
         }
-        
-        return std::string(buffer.begin(), buffer.end());
-        
+        return buffer;
+
     } catch (const std::exception& e) {
         LOG_ERROR("DatabaseSink", "Exception in generateThumbnail: " + std::string(e.what()));
-        return "";
+        return nullptr;
     }
 }
 
@@ -794,11 +1348,8 @@ bool DatabaseSink::deleteDataForCamera(const std::string& cameraId, std::functio
             }
             
             // Close the database connection
-            std::lock_guard<std::mutex> lock(dbMutex_);
-            if (db_) {
-                sqlite3_close(db_);
-                db_ = nullptr;
-            }
+            std::lock_guard<std::mutex> lock(dbLock());
+            closeConnection();
             isInitialized_ = false;
             
             if (progressCallback) progressCallback(60.0, "Database connection closed");
@@ -837,7 +1388,16 @@ bool DatabaseSink::deleteDataForCamera(const std::string& cameraId, std::functio
                     LOG_INFO("DatabaseSink", "Deleted SHM file: " + shmPath);
                 }
             }
-            
+
+            // Also remove the camera's thumbnail segment directory
+            std::string framesDir = "./data/telemetry_" + cameraId + "_frames";
+            if (std::filesystem::exists(framesDir)) {
+                std::filesystem::remove_all(framesDir, ec);
+                if (!ec) {
+                    LOG_INFO("DatabaseSink", "Deleted frame store directory: " + framesDir);
+                }
+            }
+
             if (progressCallback) progressCallback(100.0, "Database file deleted successfully");
             return true;
         } else {
@@ -863,22 +1423,16 @@ nlohmann::json DatabaseSink::getAnalytics(const std::string& cameraId) const {
         return nlohmann::json::object();
     }
     
-    // Minimize mutex lock time - don't hold it during entire query
-    sqlite3* dbConnection = nullptr;
-    {
-        std::lock_guard<std::mutex> lock(dbMutex_);
-        dbConnection = db_;
-        if (!dbConnection) {
-            return nlohmann::json::object();
-        }
+    // Dashboard reads run on their own pooled read-only connection so
+    // they never queue on the writer's connection mutex
+    auto lease = utils::SqliteReadPool::getInstance().acquire(dbPath_);
+    if (!lease) {
+        return nlohmann::json::object();
     }
-    
+
     nlohmann::json result;
-    
+
     try {
-        // Set query timeout to prevent long-running queries
-        sqlite3_exec(dbConnection, "PRAGMA busy_timeout=10000;", nullptr, nullptr, nullptr);
-        
         // Get event counts by type from aggregate table (ultra-fast!)
         const char* eventTypeSql = R"(
             SELECT event_type, total_count 
@@ -887,21 +1441,20 @@ nlohmann::json DatabaseSink::getAnalytics(const std::string& cameraId) const {
             ORDER BY total_count DESC
         )";
         
-        sqlite3_stmt* stmt;
-        int rc = sqlite3_prepare_v2(dbConnection, eventTypeSql, -1, &stmt, nullptr);
-        
+        sqlite3_stmt* stmt = lease->prepareCached(eventTypeSql);
+
         nlohmann::json eventCounts = nlohmann::json::object();
         int totalEvents = 0;
-        if (rc == SQLITE_OK) {
+        if (stmt) {
             sqlite3_bind_text(stmt, 1, cameraId.c_str(), -1, SQLITE_STATIC);
-            
+
             while (sqlite3_step(stmt) == SQLITE_ROW) {
                 int eventType = sqlite3_column_int(stmt, 0);
                 int count = sqlite3_column_int(stmt, 1);
                 eventCounts[std::to_string(eventType)] = count;
                 totalEvents += count;
             }
-            sqlite3_finalize(stmt);
+            sqlite3_reset(stmt);
         }
         
         // Get class counts from aggregate table (ultra-fast!)
@@ -914,11 +1467,11 @@ nlohmann::json DatabaseSink::getAnalytics(const std::string& cameraId) const {
             LIMIT 25
         )";
         
-        rc = sqlite3_prepare_v2(dbConnection, classSql, -1, &stmt, nullptr);
+        stmt = lease->prepareCached(classSql);
         nlohmann::json classCounts = nlohmann::json::array();
-        if (rc == SQLITE_OK) {
+        if (stmt) {
             sqlite3_bind_text(stmt, 1, cameraId.c_str(), -1, SQLITE_STATIC);
-            
+
             while (sqlite3_step(stmt) == SQLITE_ROW) {
                 nlohmann::json classCount;
                 const char* className = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
@@ -926,7 +1479,7 @@ nlohmann::json DatabaseSink::getAnalytics(const std::string& cameraId) const {
                 classCount["count"] = sqlite3_column_int(stmt, 1);
                 classCounts.push_back(classCount);
             }
-            sqlite3_finalize(stmt);
+            sqlite3_reset(stmt);
         }
         
         // Get time range and recent activity from analytics summary (ultra-fast!)
@@ -936,8 +1489,8 @@ nlohmann::json DatabaseSink::getAnalytics(const std::string& cameraId) const {
             WHERE camera_id = ? AND summary_key IN ('time_range', 'recent_activity')
         )";
         
-        rc = sqlite3_prepare_v2(dbConnection, summarySql, -1, &stmt, nullptr);
-        if (rc == SQLITE_OK) {
+        stmt = lease->prepareCached(summarySql);
+        if (stmt) {
             sqlite3_bind_text(stmt, 1, cameraId.c_str(), -1, SQLITE_STATIC);
             
             while (sqlite3_step(stmt) == SQLITE_ROW) {
@@ -964,9 +1517,9 @@ nlohmann::json DatabaseSink::getAnalytics(const std::string& cameraId) const {
                     }
                 }
             }
-            sqlite3_finalize(stmt);
+            sqlite3_reset(stmt);
         }
-        
+
         // Build result
         result["event_counts"] = eventCounts;
         result["class_counts"] = classCounts;
@@ -990,22 +1543,15 @@ nlohmann::json DatabaseSink::getTimeSeriesData(const std::string& cameraId, int6
         return nlohmann::json::array();
     }
     
-    // Minimize mutex lock time
-    sqlite3* dbConnection = nullptr;
-    {
-        std::lock_guard<std::mutex> lock(dbMutex_);
-        dbConnection = db_;
-        if (!dbConnection) {
-            return nlohmann::json::array();
-        }
+    // Pooled read-only connection keeps this off the writer's mutex
+    auto lease = utils::SqliteReadPool::getInstance().acquire(dbPath_);
+    if (!lease) {
+        return nlohmann::json::array();
     }
-    
+
     nlohmann::json result = nlohmann::json::array();
-    
+
     try {
-        // Set query timeout
-        sqlite3_exec(dbConnection, "PRAGMA busy_timeout=10000;", nullptr, nullptr, nullptr);
-        
         // Determine appropriate bucket size based on time range
         int64_t timeRange = end_time - start_time;
         int64_t bucketSize;
@@ -1042,10 +1588,9 @@ nlohmann::json DatabaseSink::getTimeSeriesData(const std::string& cameraId, int6
             LIMIT 5000
         )";
         
-        sqlite3_stmt* stmt;
-        int rc = sqlite3_prepare_v2(dbConnection, timeSeriesSql.c_str(), -1, &stmt, nullptr);
-        
-        if (rc == SQLITE_OK) {
+        sqlite3_stmt* stmt = lease->prepareCached(timeSeriesSql);
+
+        if (stmt) {
             sqlite3_bind_text(stmt, 1, cameraId.c_str(), -1, SQLITE_STATIC);
             sqlite3_bind_int64(stmt, 2, bucketSize);
             
@@ -1069,8 +1614,8 @@ nlohmann::json DatabaseSink::getTimeSeriesData(const std::string& cameraId, int6
                 
                 result.push_back(dataPoint);
             }
-            sqlite3_finalize(stmt);
-            
+            sqlite3_reset(stmt);
+
             LOG_INFO("DatabaseSink", "Fast time series query returned " + std::to_string(result.size()) + " data points");
         }
         
@@ -1082,28 +1627,303 @@ nlohmann::json DatabaseSink::getTimeSeriesData(const std::string& cameraId, int6
     return result;
 }
 
+std::string DatabaseSink::streamEvents(const std::string& cameraId, int64_t cursor,
+                                       int limit, int64_t start_time, int64_t end_time) const {
+    if (limit < 1) {
+        limit = 1;
+    } else if (limit > 1000) {
+        limit = 1000;
+    }
+
+    if (!db_) {
+        LOG_WARN("DatabaseSink", "Database not available for event export");
+        return "{\"events\":[],\"next_cursor\":0,\"has_more\":false}";
+    }
+
+    // Pooled read-only connection keeps paging off the writer's mutex
+    auto lease = utils::SqliteReadPool::getInstance().acquire(dbPath_);
+    if (!lease) {
+        return "{\"events\":[],\"next_cursor\":0,\"has_more\":false}";
+    }
+
+    std::string out;
+    out.reserve(static_cast<size_t>(limit) * 160); // Rough row estimate keeps growth amortized
+    out += "{\"events\":[";
+
+    int64_t lastId = cursor;
+    size_t rowCount = 0;
+
+    try {
+        // Keyset pagination on the primary key: constant cost per page
+        // regardless of how deep into the table the client is
+        std::string sql = R"(
+            SELECT id, timestamp, event_type, source_id, properties, frame_id
+            FROM telemetry_events
+            WHERE camera_id = ? AND id > ?
+        )";
+        if (start_time > 0) {
+            sql += " AND timestamp >= ?";
+        }
+        if (end_time > 0) {
+            sql += " AND timestamp <= ?";
+        }
+        sql += " ORDER BY id ASC LIMIT ?";
+
+        sqlite3_stmt* stmt = lease->prepareCached(sql);
+        if (stmt) {
+            int param = 1;
+            sqlite3_bind_text(stmt, param++, cameraId.c_str(), -1, SQLITE_STATIC);
+            sqlite3_bind_int64(stmt, param++, cursor);
+            if (start_time > 0) {
+                sqlite3_bind_int64(stmt, param++, start_time);
+            }
+            if (end_time > 0) {
+                sqlite3_bind_int64(stmt, param++, end_time);
+            }
+            // Fetch one extra row so has_more never needs a count query
+            sqlite3_bind_int(stmt, param++, limit + 1);
+
+            while (sqlite3_step(stmt) == SQLITE_ROW && rowCount < static_cast<size_t>(limit)) {
+                // Everything except properties goes through nlohmann for
+                // correct escaping; the properties column is CHECKed as
+                // valid JSON at insert time and spliced in verbatim
+                nlohmann::json row;
+                row["id"] = sqlite3_column_int64(stmt, 0);
+                row["timestamp"] = sqlite3_column_int64(stmt, 1);
+                row["event_type"] = sqlite3_column_int(stmt, 2);
+                const char* sourceId = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 3));
+                row["source_id"] = sourceId ? sanitizeUTF8(sourceId) : "";
+                if (sqlite3_column_type(stmt, 5) != SQLITE_NULL) {
+                    row["frame_id"] = sqlite3_column_int64(stmt, 5);
+                }
+
+                if (rowCount > 0) {
+                    out += ',';
+                }
+                std::string rowText = row.dump();
+                const char* properties = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 4));
+                // dump() of an object always ends in '}', so the raw
+                // properties text slots in before the closing brace
+                out.append(rowText, 0, rowText.size() - 1);
+                out += ",\"properties\":";
+                out += properties ? properties : "{}";
+                out += '}';
+
+                lastId = sqlite3_column_int64(stmt, 0);
+                rowCount++;
+            }
+
+            // A leftover row after the page filled means another page exists
+            const bool hasMore = (rowCount == static_cast<size_t>(limit)) &&
+                                 (sqlite3_stmt_busy(stmt) != 0);
+            sqlite3_reset(stmt);
+
+            out += "],\"next_cursor\":" + std::to_string(lastId) +
+                   ",\"has_more\":" + (hasMore ? "true" : "false") + "}";
+            return out;
+        }
+
+        LOG_ERROR("DatabaseSink", "Failed to prepare event export query: " +
+                  std::string(sqlite3_errmsg(lease->handle())));
+    } catch (const std::exception& e) {
+        LOG_ERROR("DatabaseSink", "Exception in streamEvents: " + std::string(e.what()));
+    }
+
+    return "{\"events\":[],\"next_cursor\":" + std::to_string(cursor) +
+           ",\"has_more\":false}";
+}
+
+namespace {
+
+// Little-endian append helpers for the columnar export payload
+void appendU32(std::string& out, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        out += static_cast<char>((value >> (i * 8)) & 0xFF);
+    }
+}
+
+void appendI64(std::string& out, int64_t value) {
+    uint64_t bits = static_cast<uint64_t>(value);
+    for (int i = 0; i < 8; i++) {
+        out += static_cast<char>((bits >> (i * 8)) & 0xFF);
+    }
+}
+
+/**
+ * @brief One dictionary-encoded string column under construction
+ *
+ * Each distinct value is stored once; rows record its uint32 index. For
+ * telemetry exports the source/class/zone columns have a handful of
+ * distinct values across millions of rows, so the index array dominates
+ * and the column compresses to ~4 bytes per row.
+ */
+struct DictColumn {
+    std::unordered_map<std::string, uint32_t> lookup;
+    std::vector<std::string> values;
+    std::vector<uint32_t> indices;
+
+    void add(const std::string& value) {
+        auto it = lookup.find(value);
+        if (it == lookup.end()) {
+            it = lookup.emplace(value, static_cast<uint32_t>(values.size())).first;
+            values.push_back(value);
+        }
+        indices.push_back(it->second);
+    }
+
+    void serialize(std::string& out) const {
+        appendU32(out, static_cast<uint32_t>(values.size()));
+        for (const auto& value : values) {
+            appendU32(out, static_cast<uint32_t>(value.size()));
+            out += value;
+        }
+        for (uint32_t index : indices) {
+            appendU32(out, index);
+        }
+    }
+};
+
+} // namespace
+
+std::string DatabaseSink::exportEventsColumnar(const std::string& cameraId,
+                                               int64_t start_time, int64_t end_time) const {
+    if (!db_) {
+        LOG_WARN("DatabaseSink", "Database not available for columnar export");
+        return "";
+    }
+
+    // Pooled read-only connection: a full-range export can run for a
+    // while and must not hold up the writer
+    auto lease = utils::SqliteReadPool::getInstance().acquire(dbPath_);
+    if (!lease) {
+        return "";
+    }
+
+    std::vector<int64_t> ids;
+    std::vector<int64_t> timestamps;
+    std::string eventTypes; // one uint8 per row
+    DictColumn sourceIds;
+    DictColumn classNames;
+    DictColumn zoneIds;
+
+    try {
+        std::string sql = R"(
+            SELECT id, timestamp, event_type, source_id, properties
+            FROM telemetry_events
+            WHERE camera_id = ?
+        )";
+        if (start_time > 0) {
+            sql += " AND timestamp >= ?";
+        }
+        if (end_time > 0) {
+            sql += " AND timestamp <= ?";
+        }
+        sql += " ORDER BY id ASC";
+
+        sqlite3_stmt* stmt = lease->prepareCached(sql);
+        if (!stmt) {
+            LOG_ERROR("DatabaseSink", "Failed to prepare columnar export query: " +
+                      std::string(sqlite3_errmsg(lease->handle())));
+            return "";
+        }
+
+        int param = 1;
+        sqlite3_bind_text(stmt, param++, cameraId.c_str(), -1, SQLITE_STATIC);
+        if (start_time > 0) {
+            sqlite3_bind_int64(stmt, param++, start_time);
+        }
+        if (end_time > 0) {
+            sqlite3_bind_int64(stmt, param++, end_time);
+        }
+
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            ids.push_back(sqlite3_column_int64(stmt, 0));
+            timestamps.push_back(sqlite3_column_int64(stmt, 1));
+            eventTypes += static_cast<char>(sqlite3_column_int(stmt, 2) & 0xFF);
+
+            const char* sourceId = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 3));
+            sourceIds.add(sourceId ? sourceId : "");
+
+            // class_name and zone_id live inside the properties JSON;
+            // pull just those two fields so the export stays narrow
+            std::string className;
+            std::string zoneId;
+            const char* properties = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 4));
+            if (properties) {
+                try {
+                    auto props = nlohmann::json::parse(properties);
+                    if (props.contains("class_name") && props["class_name"].is_string()) {
+                        className = props["class_name"].get<std::string>();
+                    }
+                    if (props.contains("zone_id") && props["zone_id"].is_string()) {
+                        zoneId = props["zone_id"].get<std::string>();
+                    }
+                } catch (...) {
+                    // Malformed properties row: export empty strings
+                }
+            }
+            classNames.add(className);
+            zoneIds.add(zoneId);
+        }
+        sqlite3_reset(stmt);
+    } catch (const std::exception& e) {
+        LOG_ERROR("DatabaseSink", "Exception in exportEventsColumnar: " + std::string(e.what()));
+        return "";
+    }
+
+    const uint64_t rowCount = ids.size();
+
+    nlohmann::json header;
+    header["camera_id"] = cameraId;
+    header["columns"] = nlohmann::json::array({
+        {{"name", "id"}, {"type", "int64"}},
+        {{"name", "timestamp"}, {"type", "int64"}},
+        {{"name", "event_type"}, {"type", "uint8"}},
+        {{"name", "source_id"}, {"type", "dict"}},
+        {{"name", "class_name"}, {"type", "dict"}},
+        {{"name", "zone_id"}, {"type", "dict"}},
+    });
+    const std::string headerText = header.dump();
+
+    std::string out;
+    out.reserve(headerText.size() + rowCount * 25 + 64); // int64s + uint8 + 3 dict indices
+    out += "TAPC";
+    appendU32(out, 1); // format version
+    appendI64(out, static_cast<int64_t>(rowCount));
+    appendU32(out, static_cast<uint32_t>(headerText.size()));
+    out += headerText;
+
+    for (int64_t id : ids) {
+        appendI64(out, id);
+    }
+    for (int64_t timestamp : timestamps) {
+        appendI64(out, timestamp);
+    }
+    out += eventTypes;
+    sourceIds.serialize(out);
+    classNames.serialize(out);
+    zoneIds.serialize(out);
+
+    LOG_INFO("DatabaseSink", "Columnar export for " + cameraId + ": " +
+             std::to_string(rowCount) + " rows, " + std::to_string(out.size()) + " bytes");
+    return out;
+}
+
 nlohmann::json DatabaseSink::getDwellTimeAnalytics(const std::string& cameraId, int64_t start_time, int64_t end_time) const {
     if (!db_) {
         LOG_WARN("DatabaseSink", "Database not available for dwell time analytics");
         return nlohmann::json::array();
     }
     
-    // Minimize mutex lock time
-    sqlite3* dbConnection = nullptr;
-    {
-        std::lock_guard<std::mutex> lock(dbMutex_);
-        dbConnection = db_;
-        if (!dbConnection) {
-            return nlohmann::json::array();
-        }
+    // Pooled read-only connection keeps this off the writer's mutex
+    auto lease = utils::SqliteReadPool::getInstance().acquire(dbPath_);
+    if (!lease) {
+        return nlohmann::json::array();
     }
-    
+
     nlohmann::json result = nlohmann::json::array();
-    
+
     try {
-        // Set query timeout
-        sqlite3_exec(dbConnection, "PRAGMA busy_timeout=10000;", nullptr, nullptr, nullptr);
-        
         LOG_INFO("DatabaseSink", "Fast dwell time query from pre-computed table");
         
         // Query pre-computed dwell times (ultra-fast!)
@@ -1122,10 +1942,9 @@ nlohmann::json DatabaseSink::getDwellTimeAnalytics(const std::string& cameraId,
             LIMIT 500
         )";
         
-        sqlite3_stmt* stmt;
-        int rc = sqlite3_prepare_v2(dbConnection, dwellTimeSql.c_str(), -1, &stmt, nullptr);
-        
-        if (rc == SQLITE_OK) {
+        sqlite3_stmt* stmt = lease->prepareCached(dwellTimeSql);
+
+        if (stmt) {
             sqlite3_bind_text(stmt, 1, cameraId.c_str(), -1, SQLITE_STATIC);
             
             if (start_time > 0 && end_time > 0) {
@@ -1150,8 +1969,8 @@ nlohmann::json DatabaseSink::getDwellTimeAnalytics(const std::string& cameraId,
                 
                 result.push_back(dwellRecord);
             }
-            sqlite3_finalize(stmt);
-            
+            sqlite3_reset(stmt);
+
             LOG_INFO("DatabaseSink", "Fast dwell time query returned " + std::to_string(result.size()) + " records");
         }
         
@@ -1172,7 +1991,73 @@ nlohmann::json DatabaseSink::getEventSummary(const std::string& cameraId) const
 }
 
 nlohmann::json DatabaseSink::getZoneLineCounts(const std::string& cameraId, int64_t start_time, int64_t end_time) const {
-    return nlohmann::json::array();
+    if (!db_) {
+        return nlohmann::json::array();
+    }
+
+    // Pooled read-only connection keeps this off the writer's mutex
+    auto lease = utils::SqliteReadPool::getInstance().acquire(dbPath_);
+    if (!lease) {
+        return nlohmann::json::array();
+    }
+
+    nlohmann::json result = nlohmann::json::array();
+
+    try {
+        // Served entirely from the incremental zone rollups — no raw
+        // events scan. Minute buckets for intraday ranges, hour buckets
+        // for anything longer.
+        int64_t timeRange = end_time - start_time;
+        int64_t bucketSize = (start_time > 0 && end_time > 0 && timeRange <= 86400000)
+            ? 60000 : 3600000;
+
+        std::string sql = R"(
+            SELECT zone_id, direction, class_name, bucket_timestamp, SUM(event_count) as total_count
+            FROM zone_counts_buckets
+            WHERE camera_id = ? AND bucket_size = ?
+        )";
+        if (start_time > 0 && end_time > 0) {
+            sql += " AND bucket_timestamp >= ? AND bucket_timestamp <= ?";
+        }
+        sql += R"(
+            GROUP BY zone_id, direction, class_name, bucket_timestamp
+            ORDER BY bucket_timestamp ASC
+            LIMIT 5000
+        )";
+
+        sqlite3_stmt* stmt = lease->prepareCached(sql);
+        if (stmt) {
+            sqlite3_bind_text(stmt, 1, cameraId.c_str(), -1, SQLITE_STATIC);
+            sqlite3_bind_int64(stmt, 2, bucketSize);
+            if (start_time > 0 && end_time > 0) {
+                sqlite3_bind_int64(stmt, 3, start_time);
+                sqlite3_bind_int64(stmt, 4, end_time);
+            }
+
+            while (sqlite3_step(stmt) == SQLITE_ROW) {
+                nlohmann::json dataPoint;
+                const char* zoneId = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+                const char* direction = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
+                const char* className = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 2));
+                dataPoint["zone_id"] = zoneId ? sanitizeUTF8(zoneId) : "";
+                dataPoint["direction"] = direction ? direction : "";
+                if (className && className[0] != '\0') {
+                    dataPoint["class_name"] = sanitizeUTF8(className);
+                } else {
+                    dataPoint["class_name"] = nullptr;
+                }
+                dataPoint["timestamp"] = sqlite3_column_int64(stmt, 3);
+                dataPoint["count"] = sqlite3_column_int(stmt, 4);
+                result.push_back(dataPoint);
+            }
+            sqlite3_reset(stmt);
+        }
+    } catch (const std::exception& e) {
+        LOG_ERROR("DatabaseSink", "Exception in getZoneLineCounts: " + std::string(e.what()));
+        result = nlohmann::json::array();
+    }
+
+    return result;
 }
 
 nlohmann::json DatabaseSink::getClassBasedHeatmapData(const std::string& cameraId) const {
@@ -1241,9 +2126,6 @@ bool DatabaseSink::createAggregateTables() {
     return true; // No aggregate tables in simplified version
 }
 
-bool DatabaseSink::processBatch(const TelemetryBatch& batch) {
-    return processTelemetry(batch.frame, batch.events);
-}
 
 int64_t DatabaseSink::insertFrame(int64_t timestamp, const std::string& thumbnail) {
     // Not used in simplified version
@@ -1259,7 +2141,7 @@ void DatabaseSink::cleanupOldData() {
         return;
     }
     
-    std::lock_guard<std::mutex> lock(dbMutex_);
+    std::lock_guard<std::mutex> lock(dbLock());
     
     int64_t cutoffTime = std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::system_clock::now().time_since_epoch()).count() - 
@@ -1295,7 +2177,22 @@ void DatabaseSink::cleanupOldData() {
             LOG_INFO("DatabaseSink", "Deleted " + std::to_string(deletedFrames) + " old frames");
         }
     }
-    
+
+    // Reclaim thumbnail storage by unlinking whole segment files that no
+    // surviving frame row references anymore
+    if (frameStore_) {
+        const char* minSegmentSql = "SELECT MIN(segment_id) FROM frames WHERE segment_id IS NOT NULL";
+        rc = sqlite3_prepare_v2(db_, minSegmentSql, -1, &stmt, nullptr);
+        if (rc == SQLITE_OK) {
+            int64_t oldestLiveSegment = INT64_MAX;
+            if (sqlite3_step(stmt) == SQLITE_ROW && sqlite3_column_type(stmt, 0) != SQLITE_NULL) {
+                oldestLiveSegment = sqlite3_column_int64(stmt, 0);
+            }
+            sqlite3_finalize(stmt);
+            frameStore_->removeSegmentsBefore(oldestLiveSegment);
+        }
+    }
+
     // Clean up aggregate tables
     cleanupAggregateData(cutoffTime);
     
@@ -1337,6 +2234,27 @@ void DatabaseSink::cleanupAggregateData(int64_t cutoffTime) {
         }
     }
     
+    // Clean up old zone rollups (minute buckets trimmed early, hour
+    // buckets kept for the full retention period)
+    const char* deleteZoneCountsSql = R"(
+        DELETE FROM zone_counts_buckets
+        WHERE (bucket_size <= 60000 AND bucket_timestamp < ?)
+           OR (bucket_size > 60000 AND bucket_timestamp < ?)
+    )";
+    rc = sqlite3_prepare_v2(db_, deleteZoneCountsSql, -1, &stmt, nullptr);
+    if (rc == SQLITE_OK) {
+        int64_t currentTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        sqlite3_bind_int64(stmt, 1, currentTime - (7LL * 24 * 60 * 60 * 1000)); // 7 days for minute buckets
+        sqlite3_bind_int64(stmt, 2, cutoffTime);
+        sqlite3_step(stmt);
+        int deletedZoneCounts = sqlite3_changes(db_);
+        sqlite3_finalize(stmt);
+        if (deletedZoneCounts > 0) {
+            LOG_INFO("DatabaseSink", "Deleted " + std::to_string(deletedZoneCounts) + " old zone count buckets");
+        }
+    }
+
     // Clean up old dwell times (beyond retention period)
     const char* deleteDwellTimesSql = "DELETE FROM dwell_times WHERE first_seen < ?";
     rc = sqlite3_prepare_v2(db_, deleteDwellTimesSql, -1, &stmt, nullptr);
@@ -1424,7 +2342,30 @@ bool DatabaseSink::initializeWriterDB() {
 }
 
 void DatabaseSink::writerThreadFunction() {
-    // Not used in simplified version
+    LOG_INFO("DatabaseSink", "Writer thread started");
+
+    while (true) {
+        TelemetryBatch batch;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            queueCv_.wait(lock, [this]() {
+                return !batchQueue_.empty() || !writerThreadRunning_.load();
+            });
+
+            if (batchQueue_.empty()) {
+                // Shutdown requested and the queue is drained
+                break;
+            }
+
+            batch = std::move(batchQueue_.front());
+            batchQueue_.pop();
+            queuedBatches_--;
+        }
+
+        processBatch(batch);
+    }
+
+    LOG_INFO("DatabaseSink", "Writer thread stopped");
 }
 
 nlohmann::json DatabaseSink::getDatabasePerformanceStats(const std::string& cameraId) const {
@@ -1434,17 +2375,16 @@ nlohmann::json DatabaseSink::getDatabasePerformanceStats(const std::string& came
     }
     
     // Minimize mutex lock time
-    sqlite3* dbConnection = nullptr;
-    {
-        std::lock_guard<std::mutex> lock(dbMutex_);
-        dbConnection = db_;
-        if (!dbConnection) {
-            return nlohmann::json::object();
-        }
+    // Pooled read-only connection; the stats queries are ad hoc shapes,
+    // so they are prepared directly rather than through the cache
+    auto lease = utils::SqliteReadPool::getInstance().acquire(dbPath_);
+    if (!lease) {
+        return nlohmann::json::object();
     }
-    
+    sqlite3* dbConnection = lease->handle();
+
     nlohmann::json result;
-    
+
     try {
         // Get database size and table statistics
         const char* dbStatsSql = R"(
@@ -1569,18 +2509,15 @@ nlohmann::json DatabaseSink::explainQuery(const std::string& query) const {
         return nlohmann::json::object();
     }
     
-    // Minimize mutex lock time
-    sqlite3* dbConnection = nullptr;
-    {
-        std::lock_guard<std::mutex> lock(dbMutex_);
-        dbConnection = db_;
-        if (!dbConnection) {
-            return nlohmann::json::object();
-        }
+    // Pooled read-only connection; EXPLAIN text is one-off, so no cache
+    auto lease = utils::SqliteReadPool::getInstance().acquire(dbPath_);
+    if (!lease) {
+        return nlohmann::json::object();
     }
-    
+    sqlite3* dbConnection = lease->handle();
+
     nlohmann::json result;
-    
+
     try {
         // Add EXPLAIN QUERY PLAN to the query
         std::string explainQuery = "EXPLAIN QUERY PLAN " + query;
@@ -1659,6 +2596,35 @@ void DatabaseSink::updateAggregateTablesForEvent(const TelemetryEvent& event, co
         
         // 3. Update time series buckets for multiple bucket sizes
         updateTimeSeriesBuckets(cameraId, timestamp, eventType, className);
+
+        // 3b. Update per-zone rollups so "per hour per zone" dashboards
+        // never scan the raw events table. Line crossings carry an
+        // explicit direction; polygon entry/exit events map to in/out.
+        {
+            std::string zoneId;
+            std::string direction;
+            if (eventJson.contains("properties") && eventJson["properties"].is_object()) {
+                const auto& props = eventJson["properties"];
+                if (props.contains("zone_id") && props["zone_id"].is_string()) {
+                    zoneId = sanitizeUTF8(props["zone_id"].get<std::string>());
+                }
+                if (eventType == static_cast<int>(TelemetryEventType::CROSSING)) {
+                    if (props.contains("direction") && props["direction"].is_string()) {
+                        direction = props["direction"].get<std::string>();
+                    }
+                } else if (props.contains("event_type") && props["event_type"].is_string()) {
+                    std::string customType = props["event_type"].get<std::string>();
+                    if (customType == "zone_entry") {
+                        direction = "in";
+                    } else if (customType == "zone_exit") {
+                        direction = "out";
+                    }
+                }
+            }
+            if (!zoneId.empty() && !direction.empty()) {
+                updateZoneCountBuckets(cameraId, zoneId, direction, className, timestamp);
+            }
+        }
         
         // 4. Update dwell times (for tracking/detection events with track_id)
         if ((eventType == 0 || eventType == 1) && !trackId.empty() && !className.empty()) {
@@ -1776,6 +2742,45 @@ void DatabaseSink::updateTimeSeriesBuckets(const std::string& cameraId, int64_t
     }
 }
 
+void DatabaseSink::updateZoneCountBuckets(const std::string& cameraId, const std::string& zoneId,
+                                          const std::string& direction, const std::string& className,
+                                          int64_t timestamp) {
+    // Minute buckets serve intraday zoom, hour buckets everything longer
+    static const int64_t bucketSizes[] = {
+        60000,      // 1 minute
+        3600000     // 1 hour
+    };
+
+    for (int64_t bucketSize : bucketSizes) {
+        int64_t bucketTimestamp = (timestamp / bucketSize) * bucketSize;
+
+        const char* sql = R"(
+            INSERT INTO zone_counts_buckets (camera_id, zone_id, bucket_timestamp, bucket_size, direction, class_name, event_count, last_updated)
+            VALUES (?, ?, ?, ?, ?, ?, 1, strftime('%s', 'now') * 1000)
+            ON CONFLICT (camera_id, zone_id, bucket_timestamp, bucket_size, direction, class_name)
+            DO UPDATE SET
+                event_count = event_count + 1,
+                last_updated = strftime('%s', 'now') * 1000
+        )";
+
+        sqlite3_stmt* stmt;
+        int rc = sqlite3_prepare_v2(db_, sql, -1, &stmt, nullptr);
+        if (rc == SQLITE_OK) {
+            sqlite3_bind_text(stmt, 1, cameraId.c_str(), -1, SQLITE_STATIC);
+            sqlite3_bind_text(stmt, 2, zoneId.c_str(), -1, SQLITE_STATIC);
+            sqlite3_bind_int64(stmt, 3, bucketTimestamp);
+            sqlite3_bind_int64(stmt, 4, bucketSize);
+            sqlite3_bind_text(stmt, 5, direction.c_str(), -1, SQLITE_STATIC);
+            // Empty string rather than NULL so the upsert key always
+            // matches (NULL never equals NULL in the conflict check)
+            sqlite3_bind_text(stmt, 6, className.c_str(), -1, SQLITE_STATIC);
+
+            sqlite3_step(stmt);
+            sqlite3_finalize(stmt);
+        }
+    }
+}
+
 void DatabaseSink::updateDwellTimes(const std::string& cameraId, const std::string& trackId, const std::string& className, int64_t timestamp) {
     const char* sql = R"(
         INSERT INTO dwell_times (camera_id, track_id, class_name, first_seen, last_seen, detection_count, last_updated) 
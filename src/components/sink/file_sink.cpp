@@ -1,6 +1,23 @@
 #include "components/sink/file_sink.h"
 #include <iostream>
 #include <filesystem>
+#include <fstream>
+#include <array>
+#include <sstream>
+#include <cstdio>
+#include <chrono>
+
+namespace {
+
+/**
+ * @brief Current wall-clock time in epoch milliseconds
+ */
+int64_t nowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
 
 namespace tapi {
 
@@ -12,6 +29,17 @@ FileSink::FileSink(const std::string& id, Camera* camera, const std::string& typ
       fps_(30),
       fourcc_("mp4v"),
       useRawFrame_(false),
+      useHardwareAccel_(true),
+      hwAccelType_("auto"),
+      activeEncoder_("software"),
+      recordOnEvent_(false),
+      preEventSeconds_(5),
+      postEventSeconds_(5),
+      postRollFramesLeft_(0),
+      segmentSeconds_(0),
+      maxSegments_(0),
+      segmentIndex_(0),
+      segmentFrameCount_(0),
       isInitialized_(false),
       frameCount_(0) {
     
@@ -45,9 +73,38 @@ FileSink::FileSink(const std::string& id, Camera* camera, const std::string& typ
     if (config_.contains("use_raw_frame")) {
         useRawFrame_ = config_["use_raw_frame"];
     }
-    
-    std::cout << "Created FileSink with ID: " << id << ", path: " << filePath_ 
-              << ", raw frame: " << (useRawFrame_ ? "yes" : "no") << std::endl;
+
+    if (config_.contains("use_hw_accel")) {
+        useHardwareAccel_ = config_["use_hw_accel"];
+    }
+
+    if (config_.contains("hw_accel_type")) {
+        hwAccelType_ = config_["hw_accel_type"];
+    }
+
+    if (config_.contains("record_on_event")) {
+        recordOnEvent_ = config_["record_on_event"];
+    }
+
+    if (config_.contains("pre_event_seconds")) {
+        preEventSeconds_ = config_["pre_event_seconds"];
+    }
+
+    if (config_.contains("post_event_seconds")) {
+        postEventSeconds_ = config_["post_event_seconds"];
+    }
+
+    if (config_.contains("segment_seconds")) {
+        segmentSeconds_ = config_["segment_seconds"];
+    }
+
+    if (config_.contains("max_segments")) {
+        maxSegments_ = config_["max_segments"];
+    }
+
+    std::cout << "Created FileSink with ID: " << id << ", path: " << filePath_
+              << ", raw frame: " << (useRawFrame_ ? "yes" : "no")
+              << ", hardware encoding: " << (useHardwareAccel_ ? hwAccelType_ : "disabled") << std::endl;
 }
 
 FileSink::~FileSink() {
@@ -67,23 +124,25 @@ bool FileSink::initialize() {
         // Initialize video writer
         if (!isInitialized_) {
             std::lock_guard<std::mutex> lock(videoWriterMutex_);
-            
-            // Get FourCC code
-            int fourcc = cv::VideoWriter::fourcc(
-                fourcc_[0], fourcc_[1], fourcc_[2], fourcc_[3]);
-            
-            // Open video writer
-            videoWriter_.open(filePath_, fourcc, fps_, cv::Size(frameWidth_, frameHeight_));
-            
-            if (!videoWriter_.isOpened()) {
-                std::cerr << "Failed to open video writer for file: " << filePath_ << std::endl;
+
+            // Segmented recording writes numbered siblings of the
+            // configured path; legacy mode keeps one growing file
+            std::string outputPath = (segmentSeconds_ > 0) ? nextSegmentPath() : filePath_;
+
+            if (!openWriter(outputPath)) {
                 return false;
             }
-            
+
+            if (segmentSeconds_ > 0) {
+                segments_.push_back(Segment{currentSegmentPath_, nowMs(), 0});
+                writeSegmentIndex();
+            }
+
             isInitialized_ = true;
             frameCount_ = 0;
+            segmentFrameCount_ = 0;
         }
-        
+
         return true;
     } catch (const std::exception& e) {
         std::cerr << "Error initializing FileSink: " << e.what() << std::endl;
@@ -91,6 +150,187 @@ bool FileSink::initialize() {
     }
 }
 
+void FileSink::detectHardwareAcceleration() {
+    if (!useHardwareAccel_ || hwAccelType_ != "auto") {
+        return;
+    }
+
+    // Probe GStreamer for hardware encoder elements, mirroring the
+    // detection done on the source side for decoders
+    std::array<char, 128> buffer;
+    std::string gstElements;
+    std::unique_ptr<FILE, decltype(&pclose)> pipe(
+        popen("gst-inspect-1.0 2>/dev/null", "r"), pclose);
+
+    if (pipe) {
+        while (fgets(buffer.data(), buffer.size(), pipe.get()) != nullptr) {
+            gstElements += buffer.data();
+        }
+    }
+
+    if (gstElements.find("nvv4l2h264enc") != std::string::npos &&
+        gstElements.find("nvvidconv") != std::string::npos) {
+        std::cout << "NVIDIA encoder elements detected in GStreamer, using NVIDIA hardware encoding" << std::endl;
+        hwAccelType_ = "nvidia";
+        return;
+    }
+
+    if (gstElements.find("vaapih264enc") != std::string::npos) {
+        std::cout << "VA-API encoder elements detected in GStreamer, using VA-API hardware encoding" << std::endl;
+        hwAccelType_ = "vaapi";
+        return;
+    }
+
+    std::cout << "No hardware encoder detected, using software encoding" << std::endl;
+    hwAccelType_ = "none";
+}
+
+std::string FileSink::buildEncoderPipeline() const {
+    std::ostringstream pipeline;
+    pipeline << "appsrc ! videoconvert ! ";
+
+    if (hwAccelType_ == "nvidia") {
+        pipeline << "nvvidconv ! nvv4l2h264enc ! ";
+    } else if (hwAccelType_ == "vaapi") {
+        pipeline << "vaapih264enc ! ";
+    } else {
+        return "";
+    }
+
+    pipeline << "h264parse ! qtmux ! filesink location=" << currentSegmentPath_;
+    return pipeline.str();
+}
+
+bool FileSink::openWriter(const std::string& path) {
+    currentSegmentPath_ = path;
+    activeEncoder_ = "software";
+
+    // Try a hardware encoder pipeline first; falls back to the
+    // plain CPU VideoWriter below when unavailable
+    if (useHardwareAccel_) {
+        detectHardwareAcceleration();
+
+        std::string pipeline = buildEncoderPipeline();
+        if (!pipeline.empty()) {
+            videoWriter_.open(pipeline, cv::CAP_GSTREAMER, 0, fps_,
+                              cv::Size(frameWidth_, frameHeight_), true);
+            if (videoWriter_.isOpened()) {
+                activeEncoder_ = hwAccelType_;
+                std::cout << "FileSink using " << hwAccelType_
+                          << " hardware encoder for file: " << path << std::endl;
+            } else {
+                std::cerr << "Failed to open " << hwAccelType_
+                          << " encoder pipeline, falling back to software encoding" << std::endl;
+            }
+        }
+    }
+
+    if (!videoWriter_.isOpened()) {
+        // Get FourCC code
+        int fourcc = cv::VideoWriter::fourcc(
+            fourcc_[0], fourcc_[1], fourcc_[2], fourcc_[3]);
+
+        // Open video writer
+        videoWriter_.open(path, fourcc, fps_, cv::Size(frameWidth_, frameHeight_));
+
+        if (!videoWriter_.isOpened()) {
+            std::cerr << "Failed to open video writer for file: " << path << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::string FileSink::nextSegmentPath() {
+    std::filesystem::path base(filePath_);
+    std::string extension = base.extension().string();
+    if (extension.empty()) {
+        extension = ".mp4";
+    }
+
+    char suffix[16];
+    std::snprintf(suffix, sizeof(suffix), "_%06llu",
+                  static_cast<unsigned long long>(++segmentIndex_));
+
+    std::filesystem::path segment = base.parent_path() /
+        (base.stem().string() + suffix + extension);
+    return segment.string();
+}
+
+bool FileSink::rotateSegmentLocked() {
+    // Finalize the current segment so the muxer writes its trailer; the
+    // file is then contiguous and complete on disk before the index
+    // advertises its successor
+    videoWriter_.release();
+    if (!segments_.empty()) {
+        segments_.back().endMs = nowMs();
+    }
+
+    if (!openWriter(nextSegmentPath())) {
+        std::cerr << "Failed to open next recording segment, stopping segmented recording" << std::endl;
+        isInitialized_ = false;
+        return false;
+    }
+
+    segments_.push_back(Segment{currentSegmentPath_, nowMs(), 0});
+    segmentFrameCount_ = 0;
+
+    // Retention removes whole segments, oldest first: one unlink per
+    // expired segment instead of rewriting a long recording
+    while (maxSegments_ > 0 && segments_.size() > static_cast<size_t>(maxSegments_)) {
+        std::error_code ec;
+        std::filesystem::remove(segments_.front().path, ec);
+        if (ec) {
+            std::cerr << "Failed to remove expired segment " << segments_.front().path
+                      << ": " << ec.message() << std::endl;
+        }
+        segments_.pop_front();
+    }
+
+    writeSegmentIndex();
+    return true;
+}
+
+void FileSink::writeSegmentIndex() const {
+    std::filesystem::path base(filePath_);
+    std::filesystem::path indexPath = base.parent_path() /
+        (base.stem().string() + ".index.json");
+
+    nlohmann::json index;
+    index["base_path"] = filePath_;
+    index["segment_seconds"] = segmentSeconds_;
+    nlohmann::json segmentList = nlohmann::json::array();
+    for (const auto& segment : segments_) {
+        segmentList.push_back({
+            {"path", segment.path},
+            {"start_ms", segment.startMs},
+            {"end_ms", segment.endMs}
+        });
+    }
+    index["segments"] = std::move(segmentList);
+
+    // Write to a temp sibling and rename over the index: rename is atomic
+    // on the same filesystem, so readers never see a partial index even
+    // if we crash mid-rotation
+    std::filesystem::path tempPath = indexPath;
+    tempPath += ".tmp";
+
+    std::ofstream out(tempPath);
+    if (!out) {
+        std::cerr << "Failed to write segment index: " << tempPath << std::endl;
+        return;
+    }
+    out << index.dump(2);
+    out.close();
+
+    std::error_code ec;
+    std::filesystem::rename(tempPath, indexPath, ec);
+    if (ec) {
+        std::cerr << "Failed to publish segment index: " << ec.message() << std::endl;
+    }
+}
+
 bool FileSink::start() {
     if (running_) {
         return true; // Already running
@@ -117,8 +357,22 @@ bool FileSink::stop() {
         std::lock_guard<std::mutex> lock(videoWriterMutex_);
         videoWriter_.release();
         isInitialized_ = false;
+        segmentFrameCount_ = 0;
+
+        // Publish the final segment list so retention tooling sees the
+        // last (possibly short) segment
+        if (segmentSeconds_ > 0 && !segments_.empty()) {
+            if (segments_.back().endMs == 0) {
+                segments_.back().endMs = nowMs();
+            }
+            writeSegmentIndex();
+        }
     }
-    
+
+    // Drop any buffered pre-roll frames
+    preEventBuffer_.clear();
+    postRollFramesLeft_ = 0;
+
     running_ = false;
     return true;
 }
@@ -154,7 +408,43 @@ bool FileSink::updateConfig(const nlohmann::json& config) {
     if (config.contains("use_raw_frame")) {
         useRawFrame_ = config["use_raw_frame"];
     }
-    
+
+    if (config.contains("use_hw_accel") && config["use_hw_accel"] != useHardwareAccel_) {
+        useHardwareAccel_ = config["use_hw_accel"];
+        needReinit = true;
+    }
+
+    if (config.contains("hw_accel_type") && config["hw_accel_type"] != hwAccelType_) {
+        hwAccelType_ = config["hw_accel_type"];
+        needReinit = true;
+    }
+
+    if (config.contains("record_on_event")) {
+        recordOnEvent_ = config["record_on_event"];
+        if (!recordOnEvent_) {
+            preEventBuffer_.clear();
+            postRollFramesLeft_ = 0;
+        }
+    }
+
+    if (config.contains("pre_event_seconds")) {
+        preEventSeconds_ = config["pre_event_seconds"];
+    }
+
+    if (config.contains("post_event_seconds")) {
+        postEventSeconds_ = config["post_event_seconds"];
+    }
+
+    if (config.contains("segment_seconds") && config["segment_seconds"] != segmentSeconds_) {
+        segmentSeconds_ = config["segment_seconds"];
+        needReinit = true;
+    }
+
+    if (config.contains("max_segments")) {
+        // Applies at the next rotation; no reinit needed
+        maxSegments_ = config["max_segments"];
+    }
+
     // Update config object
     for (auto it = config.begin(); it != config.end(); ++it) {
         config_[it.key()] = it.value();
@@ -189,15 +479,31 @@ nlohmann::json FileSink::getStatus() const {
     status["fps"] = fps_;
     status["fourcc"] = fourcc_;
     status["use_raw_frame"] = useRawFrame_;
-    
+    status["use_hw_accel"] = useHardwareAccel_;
+    status["encoder"] = activeEncoder_;
+    status["record_on_event"] = recordOnEvent_;
+    status["pre_event_seconds"] = preEventSeconds_;
+    status["post_event_seconds"] = postEventSeconds_;
+    status["buffered_frames"] = preEventBuffer_.size();
+    status["segment_seconds"] = segmentSeconds_;
+    if (segmentSeconds_ > 0) {
+        status["max_segments"] = maxSegments_;
+        status["current_segment"] = currentSegmentPath_;
+        status["segment_count"] = segments_.size();
+    }
+
     return status;
 }
 
 bool FileSink::processFrame(const cv::Mat& frame) {
+    return processFrame(frame, {});
+}
+
+bool FileSink::processFrame(const cv::Mat& frame, const std::vector<TelemetryEvent>& events) {
     if (!running_ || !isInitialized_) {
         return false;
     }
-    
+
     try {
         // Resize frame if necessary
         cv::Mat outputFrame;
@@ -206,7 +512,7 @@ bool FileSink::processFrame(const cv::Mat& frame) {
         } else {
             outputFrame = frame.clone();
         }
-        
+
         // Draw frame number in bottom right corner
         std::string frameText = std::to_string(frameCount_);
         int fontFace = cv::FONT_HERSHEY_SIMPLEX;
@@ -215,32 +521,119 @@ bool FileSink::processFrame(const cv::Mat& frame) {
         int baseline = 0;
         cv::Size textSize = cv::getTextSize(frameText, fontFace, fontScale, thickness, &baseline);
         cv::Point textOrg(outputFrame.cols - textSize.width - 10, outputFrame.rows - 10);
-        
+
         // Draw text shadow (for better visibility)
-        cv::putText(outputFrame, frameText, cv::Point(textOrg.x + 1, textOrg.y + 1), 
+        cv::putText(outputFrame, frameText, cv::Point(textOrg.x + 1, textOrg.y + 1),
                     fontFace, fontScale, cv::Scalar(0, 0, 0), thickness);
         // Draw text in white
-        cv::putText(outputFrame, frameText, textOrg, 
+        cv::putText(outputFrame, frameText, textOrg,
                     fontFace, fontScale, cv::Scalar(255, 255, 255), thickness);
-        
-        // Write frame to video
-        {
-            std::lock_guard<std::mutex> lock(videoWriterMutex_);
-            if (videoWriter_.isOpened()) {
-                videoWriter_.write(outputFrame);
-                frameCount_++;
-                return true;
+
+        // Continuous mode: every frame goes straight to disk
+        if (!recordOnEvent_) {
+            return writeFrame(outputFrame);
+        }
+
+        // Event-gated mode: hold frames in the pre-roll ring buffer and
+        // only hit the disk around triggering events
+        if (shouldTrigger(events)) {
+            // Flush the buffered pre-roll, then start the post-roll window
+            for (const auto& buffered : preEventBuffer_) {
+                writeFrame(buffered);
             }
+            preEventBuffer_.clear();
+            postRollFramesLeft_ = postEventSeconds_ * fps_;
+            return writeFrame(outputFrame);
+        }
+
+        if (postRollFramesLeft_ > 0) {
+            postRollFramesLeft_--;
+            return writeFrame(outputFrame);
+        }
+
+        // Armed: buffer the frame, dropping the oldest beyond the pre-roll
+        preEventBuffer_.push_back(outputFrame);
+        size_t capacity = static_cast<size_t>(preEventSeconds_) * static_cast<size_t>(fps_);
+        while (preEventBuffer_.size() > capacity) {
+            preEventBuffer_.pop_front();
         }
+        return true;
     } catch (const std::exception& e) {
         std::cerr << "Error processing frame in FileSink: " << e.what() << std::endl;
     }
-    
+
+    return false;
+}
+
+bool FileSink::shouldTrigger(const std::vector<TelemetryEvent>& events) const {
+    for (const auto& event : events) {
+        // Crossing events (line/zone) and custom events (alarms etc.)
+        // trigger recording; per-frame detection/tracking events would
+        // effectively re-enable continuous recording
+        if (event.getType() == TelemetryEventType::CROSSING ||
+            event.getType() == TelemetryEventType::CUSTOM) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FileSink::writeFrame(const cv::Mat& frame) {
+    std::lock_guard<std::mutex> lock(videoWriterMutex_);
+
+    // Segment boundary: close the finished segment and open the next one
+    // before this frame lands on disk
+    if (segmentSeconds_ > 0 &&
+        segmentFrameCount_ >= static_cast<size_t>(segmentSeconds_) * static_cast<size_t>(fps_)) {
+        if (!rotateSegmentLocked()) {
+            return false;
+        }
+    }
+
+    if (videoWriter_.isOpened()) {
+        videoWriter_.write(frame);
+        frameCount_++;
+        segmentFrameCount_++;
+        return true;
+    }
     return false;
 }
 
 std::string FileSink::getFilePath() const {
-    return filePath_;
+    return (segmentSeconds_ > 0 && !currentSegmentPath_.empty()) ? currentSegmentPath_ : filePath_;
+}
+
+nlohmann::json FileSink::getSegmentsInRange(int64_t fromMs, int64_t toMs) const {
+    nlohmann::json result = nlohmann::json::array();
+    std::lock_guard<std::mutex> lock(videoWriterMutex_);
+
+    for (const auto& segment : segments_) {
+        // A live segment (endMs == 0) extends to now
+        int64_t effectiveEnd = (segment.endMs > 0) ? segment.endMs : nowMs();
+        if (toMs > 0 && segment.startMs > toMs) {
+            continue;
+        }
+        if (fromMs > 0 && effectiveEnd < fromMs) {
+            continue;
+        }
+        result.push_back({
+            {"file", std::filesystem::path(segment.path).filename().string()},
+            {"path", segment.path},
+            {"start_ms", segment.startMs},
+            {"end_ms", segment.endMs}
+        });
+    }
+    return result;
+}
+
+std::string FileSink::resolveSegmentPath(const std::string& fileName) const {
+    std::lock_guard<std::mutex> lock(videoWriterMutex_);
+    for (const auto& segment : segments_) {
+        if (std::filesystem::path(segment.path).filename().string() == fileName) {
+            return segment.path;
+        }
+    }
+    return "";
 }
 
 } // namespace tapi 
\ No newline at end of file
@@ -0,0 +1,198 @@
+#include "components/sink/frame_store.h"
+#include "logger.h"
+#include <filesystem>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+namespace tapi {
+
+FrameStore::FrameStore(const std::string& directory, size_t segmentSize)
+    : directory_(directory),
+      segmentSize_(segmentSize),
+      fd_(-1),
+      mapped_(nullptr),
+      currentSegmentId_(0),
+      writeOffset_(0) {
+}
+
+FrameStore::~FrameStore() {
+    close();
+}
+
+bool FrameStore::open() {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (mapped_) {
+        return true;
+    }
+
+    try {
+        std::filesystem::create_directories(directory_);
+    } catch (const std::exception& e) {
+        LOG_ERROR("FrameStore", "Failed to create segment directory " + directory_ + ": " + std::string(e.what()));
+        return false;
+    }
+
+    // Resume after the highest existing segment so old locators stay valid
+    int64_t maxSegmentId = -1;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(directory_, ec)) {
+        const std::string name = entry.path().filename().string();
+        if (name.rfind("frames_", 0) == 0 && entry.path().extension() == ".seg") {
+            try {
+                int64_t id = std::stoll(name.substr(7));
+                maxSegmentId = std::max(maxSegmentId, id);
+            } catch (const std::exception&) {
+                // Not one of ours, skip
+            }
+        }
+    }
+
+    return openSegment(maxSegmentId + 1);
+}
+
+void FrameStore::close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closeSegment();
+}
+
+bool FrameStore::append(const std::string& data, Location& location) {
+    return append(reinterpret_cast<const uint8_t*>(data.data()), data.size(), location);
+}
+
+bool FrameStore::append(const uint8_t* data, size_t size, Location& location) {
+    if (!data || size == 0) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!mapped_) {
+        return false;
+    }
+
+    if (size > segmentSize_) {
+        LOG_ERROR("FrameStore", "Blob of " + std::to_string(size) + " bytes exceeds segment size");
+        return false;
+    }
+
+    // Rotate when the blob does not fit in the active segment
+    if (writeOffset_ + size > segmentSize_) {
+        int64_t nextSegmentId = currentSegmentId_ + 1;
+        closeSegment();
+        if (!openSegment(nextSegmentId)) {
+            return false;
+        }
+    }
+
+    std::memcpy(mapped_ + writeOffset_, data, size);
+
+    location.segmentId = currentSegmentId_;
+    location.offset = static_cast<int64_t>(writeOffset_);
+    location.length = static_cast<int64_t>(size);
+
+    writeOffset_ += size;
+    return true;
+}
+
+std::string FrameStore::read(const Location& location) const {
+    if (location.length <= 0 || location.offset < 0) {
+        return "";
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Fast path: the blob lives in the active mapping
+    if (mapped_ && location.segmentId == currentSegmentId_) {
+        if (static_cast<size_t>(location.offset + location.length) > writeOffset_) {
+            return "";
+        }
+        return std::string(reinterpret_cast<const char*>(mapped_ + location.offset),
+                           static_cast<size_t>(location.length));
+    }
+
+    int fd = ::open(segmentPath(location.segmentId).c_str(), O_RDONLY);
+    if (fd < 0) {
+        return "";
+    }
+
+    std::string data(static_cast<size_t>(location.length), '\0');
+    ssize_t bytesRead = ::pread(fd, &data[0], static_cast<size_t>(location.length), location.offset);
+    ::close(fd);
+
+    if (bytesRead != static_cast<ssize_t>(location.length)) {
+        return "";
+    }
+    return data;
+}
+
+int FrameStore::removeSegmentsBefore(int64_t oldestLiveSegmentId) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    int removed = 0;
+    for (int64_t id = 0; id < oldestLiveSegmentId && id < currentSegmentId_; id++) {
+        std::error_code ec;
+        if (std::filesystem::remove(segmentPath(id), ec) && !ec) {
+            removed++;
+        }
+    }
+
+    if (removed > 0) {
+        LOG_INFO("FrameStore", "Removed " + std::to_string(removed) + " expired segment files from " + directory_);
+    }
+    return removed;
+}
+
+bool FrameStore::openSegment(int64_t segmentId) {
+    std::string path = segmentPath(segmentId);
+
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd_ < 0) {
+        LOG_ERROR("FrameStore", "Failed to open segment file: " + path);
+        return false;
+    }
+
+    if (::ftruncate(fd_, static_cast<off_t>(segmentSize_)) != 0) {
+        LOG_ERROR("FrameStore", "Failed to size segment file: " + path);
+        ::close(fd_);
+        fd_ = -1;
+        return false;
+    }
+
+    void* mapping = ::mmap(nullptr, segmentSize_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (mapping == MAP_FAILED) {
+        LOG_ERROR("FrameStore", "Failed to map segment file: " + path);
+        ::close(fd_);
+        fd_ = -1;
+        return false;
+    }
+
+    mapped_ = static_cast<uint8_t*>(mapping);
+    currentSegmentId_ = segmentId;
+    writeOffset_ = 0;
+    return true;
+}
+
+void FrameStore::closeSegment() {
+    if (mapped_) {
+        ::msync(mapped_, writeOffset_, MS_ASYNC);
+        ::munmap(mapped_, segmentSize_);
+        mapped_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        // Trim the preallocated tail so closed segments only occupy used bytes
+        if (::ftruncate(fd_, static_cast<off_t>(writeOffset_)) != 0) {
+            LOG_WARN("FrameStore", "Failed to trim segment file " + segmentPath(currentSegmentId_));
+        }
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+std::string FrameStore::segmentPath(int64_t segmentId) const {
+    return directory_ + "/frames_" + std::to_string(segmentId) + ".seg";
+}
+
+} // namespace tapi
@@ -0,0 +1,358 @@
+#include "components/sink/shm_export_sink.h"
+#include "utils/shm_utils.h"
+#include "logger.h"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+namespace tapi {
+
+namespace {
+
+// Keep slot headers (and therefore payloads) cache-line aligned so the
+// writer and a reader polling seq do not false-share payload bytes
+constexpr size_t SLOT_ALIGNMENT = 64;
+
+size_t alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+int64_t unixMillis() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+ShmExportSink::ShmExportSink(const std::string& id, Camera* camera, const std::string& type, const nlohmann::json& config)
+    : SinkComponent(id, camera),
+      type_(type),
+      slotCount_(4),
+      frameWidth_(640),
+      frameHeight_(480),
+      exportEvents_(true),
+      eventCapacity_(16384),
+      isInitialized_(false) {
+
+    // Set initial configuration
+    config_ = config;
+
+    // Parse config
+    if (config_.contains("name")) {
+        name_ = config_["name"];
+    } else {
+        // Default region prefix; consumers open /<name>_frames
+        name_ = "tapi_" + id;
+    }
+
+    if (config_.contains("slot_count")) {
+        slotCount_ = config_["slot_count"];
+    }
+
+    if (config_.contains("width")) {
+        frameWidth_ = config_["width"];
+    }
+
+    if (config_.contains("height")) {
+        frameHeight_ = config_["height"];
+    }
+
+    if (config_.contains("export_events")) {
+        exportEvents_ = config_["export_events"];
+    }
+
+    if (config_.contains("event_capacity")) {
+        eventCapacity_ = config_["event_capacity"];
+    }
+
+    slotCount_ = std::max(2, slotCount_);
+
+    std::cout << "Created ShmExportSink with ID: " << id << ", regions: /" << name_
+              << "_frames" << (exportEvents_ ? " + /" + name_ + "_events" : "")
+              << ", " << slotCount_ << " slots at " << frameWidth_ << "x"
+              << frameHeight_ << std::endl;
+}
+
+ShmExportSink::~ShmExportSink() {
+    if (running_) {
+        stop();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    destroyRing(frameRing_);
+    destroyRing(eventRing_);
+}
+
+bool ShmExportSink::initialize() {
+    std::cout << "Initializing ShmExportSink: " << getId() << std::endl;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (isInitialized_) {
+        return true;
+    }
+
+    frameRing_.key = "/" + name_ + "_frames";
+    const size_t frameCapacity =
+        static_cast<size_t>(frameWidth_) * static_cast<size_t>(frameHeight_) * 3;
+    if (!createRing(frameRing_, frameCapacity)) {
+        return false;
+    }
+
+    if (exportEvents_) {
+        eventRing_.key = "/" + name_ + "_events";
+        if (!createRing(eventRing_, static_cast<size_t>(eventCapacity_))) {
+            destroyRing(frameRing_);
+            return false;
+        }
+    }
+
+    isInitialized_ = true;
+    return true;
+}
+
+bool ShmExportSink::createRing(Ring& ring, size_t payloadCapacity) {
+    const size_t stride =
+        alignUp(sizeof(tapi_shm_slot_header) + payloadCapacity, SLOT_ALIGNMENT);
+    const size_t total =
+        sizeof(tapi_shm_ring_header) + static_cast<size_t>(slotCount_) * stride;
+
+    int fd = -1;
+    triton::client::Error err =
+        triton::client::CreateSharedMemoryRegion(ring.key, total, &fd);
+    if (!err.IsOk()) {
+        LOG_ERROR("ShmExportSink", "Failed to create region " + ring.key + ": " + err.Message());
+        return false;
+    }
+
+    void* addr = nullptr;
+    err = triton::client::MapSharedMemory(fd, 0, total, &addr);
+    if (!err.IsOk()) {
+        LOG_ERROR("ShmExportSink", "Failed to map region " + ring.key + ": " + err.Message());
+        triton::client::CloseSharedMemory(fd);
+        triton::client::UnlinkSharedMemoryRegion(ring.key);
+        return false;
+    }
+
+    std::memset(addr, 0, total);
+    auto* header = static_cast<tapi_shm_ring_header*>(addr);
+    header->magic = TAPI_SHM_MAGIC;
+    header->version = TAPI_SHM_VERSION;
+    header->slot_count = static_cast<uint32_t>(slotCount_);
+    header->slot_stride = static_cast<uint32_t>(stride);
+    header->payload_capacity = static_cast<uint32_t>(payloadCapacity);
+
+    ring.fd = fd;
+    ring.addr = addr;
+    ring.size = total;
+    ring.sequence = 0;
+    return true;
+}
+
+void ShmExportSink::destroyRing(Ring& ring) {
+    if (ring.addr) {
+        triton::client::UnmapSharedMemory(ring.addr, ring.size);
+        ring.addr = nullptr;
+    }
+    if (ring.fd >= 0) {
+        triton::client::CloseSharedMemory(ring.fd);
+        ring.fd = -1;
+    }
+    if (!ring.key.empty()) {
+        triton::client::UnlinkSharedMemoryRegion(ring.key);
+    }
+    ring.size = 0;
+    ring.sequence = 0;
+}
+
+bool ShmExportSink::start() {
+    if (running_) {
+        return true; // Already running
+    }
+
+    if (!isInitialized_ && !initialize()) {
+        return false;
+    }
+
+    std::cout << "Starting ShmExportSink: " << getId() << std::endl;
+    running_ = true;
+    return true;
+}
+
+bool ShmExportSink::stop() {
+    if (!running_) {
+        return true; // Already stopped
+    }
+
+    std::cout << "Stopping ShmExportSink: " << getId() << std::endl;
+
+    // Unlink so consumers see the regions disappear rather than go stale
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        destroyRing(frameRing_);
+        destroyRing(eventRing_);
+        isInitialized_ = false;
+    }
+
+    running_ = false;
+    return true;
+}
+
+bool ShmExportSink::updateConfig(const nlohmann::json& config) {
+    bool needReinit = false;
+
+    if (config.contains("name") && config["name"] != name_) {
+        name_ = config["name"];
+        needReinit = true;
+    }
+
+    if (config.contains("slot_count") && config["slot_count"] != slotCount_) {
+        slotCount_ = std::max(2, config["slot_count"].get<int>());
+        needReinit = true;
+    }
+
+    if (config.contains("width") && config["width"] != frameWidth_) {
+        frameWidth_ = config["width"];
+        needReinit = true;
+    }
+
+    if (config.contains("height") && config["height"] != frameHeight_) {
+        frameHeight_ = config["height"];
+        needReinit = true;
+    }
+
+    if (config.contains("export_events") && config["export_events"] != exportEvents_) {
+        exportEvents_ = config["export_events"];
+        needReinit = true;
+    }
+
+    if (config.contains("event_capacity") && config["event_capacity"] != eventCapacity_) {
+        eventCapacity_ = config["event_capacity"];
+        needReinit = true;
+    }
+
+    // Update config object
+    for (auto it = config.begin(); it != config.end(); ++it) {
+        config_[it.key()] = it.value();
+    }
+
+    // Reinitialize if necessary
+    if (needReinit && running_) {
+        stop();
+        return initialize() && start();
+    }
+
+    return true;
+}
+
+nlohmann::json ShmExportSink::getConfig() const {
+    return config_;
+}
+
+nlohmann::json ShmExportSink::getStatus() const {
+    auto status = Component::getStatus();
+
+    // Override the generic "sink" type with the specific sink type
+    status["type"] = "shm_export";
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    status["initialized"] = isInitialized_;
+    status["frame_region"] = frameRing_.key;
+    status["frames_published"] = frameRing_.sequence;
+    status["export_events"] = exportEvents_;
+    if (exportEvents_) {
+        status["event_region"] = eventRing_.key;
+        status["events_published"] = eventRing_.sequence;
+    }
+    status["slot_count"] = slotCount_;
+    status["resolution"] = {
+        {"width", frameWidth_},
+        {"height", frameHeight_}
+    };
+
+    return status;
+}
+
+bool ShmExportSink::processFrame(const cv::Mat& frame, const std::vector<TelemetryEvent>& events) {
+    if (!running_ || frame.empty()) {
+        return false;
+    }
+
+    try {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!isInitialized_) {
+            return false;
+        }
+
+        // Resize into the reused staging buffer if necessary; a frame
+        // already at the export resolution is copied straight from its
+        // own rows
+        const cv::Mat* output = &frame;
+        if (frame.cols != frameWidth_ || frame.rows != frameHeight_) {
+            cv::resize(frame, scaled_, cv::Size(frameWidth_, frameHeight_));
+            output = &scaled_;
+        }
+
+        if (output->isContinuous()) {
+            publish(frameRing_, output->ptr<uint8_t>(0),
+                    static_cast<size_t>(frameWidth_) * frameHeight_ * 3,
+                    frameWidth_, frameHeight_, 3);
+        } else {
+            // Row-padded frames (pooled plane views) are compacted into
+            // the staging buffer first so the slot payload is dense
+            output->copyTo(scaled_);
+            publish(frameRing_, scaled_.ptr<uint8_t>(0),
+                    static_cast<size_t>(frameWidth_) * frameHeight_ * 3,
+                    frameWidth_, frameHeight_, 3);
+        }
+
+        if (exportEvents_ && !events.empty()) {
+            nlohmann::json eventArray = nlohmann::json::array();
+            for (const auto& event : events) {
+                eventArray.push_back(event.toJson());
+            }
+            const std::string payload = eventArray.dump();
+            publish(eventRing_, reinterpret_cast<const uint8_t*>(payload.data()),
+                    payload.size(), 0, 0, 0);
+        }
+
+        return true;
+    } catch (const std::exception& e) {
+        std::cerr << "Error publishing frame in ShmExportSink: " << e.what() << std::endl;
+    }
+
+    return false;
+}
+
+bool ShmExportSink::publish(Ring& ring, const uint8_t* payload, size_t payloadBytes,
+                            uint32_t width, uint32_t height, uint32_t channels) {
+    auto* header = static_cast<tapi_shm_ring_header*>(ring.addr);
+    if (!header) {
+        return false;
+    }
+    if (payloadBytes > header->payload_capacity) {
+        LOG_WARN("ShmExportSink", "Payload of " + std::to_string(payloadBytes) +
+                 " bytes exceeds slot capacity in " + ring.key + ", truncating");
+        payloadBytes = header->payload_capacity;
+    }
+
+    const uint64_t next = ring.sequence + 1;
+    tapi_shm_slot_header* slot = tapi_shm_slot(
+        ring.addr, header, static_cast<uint32_t>((next - 1) % header->slot_count));
+
+    // Seqlock write: odd seq marks the slot in flight, the even store
+    // publishes it, and the head store points readers at it
+    __atomic_store_n(&slot->seq, 2 * next - 1, __ATOMIC_RELEASE);
+    slot->frame_index = next;
+    slot->timestamp_ms = unixMillis();
+    slot->width = width;
+    slot->height = height;
+    slot->channels = channels;
+    slot->payload_bytes = static_cast<uint32_t>(payloadBytes);
+    std::memcpy(tapi_shm_slot_payload(slot), payload, payloadBytes);
+    __atomic_store_n(&slot->seq, 2 * next, __ATOMIC_RELEASE);
+    __atomic_store_n(&header->head, next, __ATOMIC_RELEASE);
+
+    ring.sequence = next;
+    return true;
+}
+
+} // namespace tapi
@@ -1,11 +1,14 @@
 #include "components/source/gstreamer_source.h"
 #include <iostream>
+#include <algorithm>
 #include <chrono>
 #include <thread>
 #include <sstream>
 #include <array>
 #include <memory>
 #include <logger.h>
+#include "utils/config_diff.h"
+#include "utils/thread_affinity.h"
 
 namespace tapi {
 
@@ -19,6 +22,7 @@ GStreamerSource::GStreamerSource(const std::string& id, Camera* camera,
       format_("h264"),
       quality_(0.8),
       stopRequested_(false),
+      frameRing_(4),  // Small ring: stale frames are dropped, not queued
       useHardwareAccel_(true),
       hwAccelType_("auto"),  // Auto-detect hardware acceleration by default
       frameCount_(0),
@@ -27,7 +31,14 @@ GStreamerSource::GStreamerSource(const std::string& id, Camera* camera,
       rtspTransport_("tcp"),  // Default to TCP for RTSP
       latency_(0),         // Default latency to 0ms for minimal delay
       skipBufferedFrames_(true),  // Enable frame skipping by default to maintain real-time
-      isFileSource_(false) {  // Initialize file source flag
+      isFileSource_(false),   // Initialize file source flag
+      isPushSource_(false) {
+
+    // Shared buffer pool so frames flow to the camera pipeline by handle
+    // instead of by deep copy. The detector plane gets its own pool so the
+    // two geometries never fight over the same free list.
+    framePool_ = std::make_shared<FramePool>();
+    detectorPlanePool_ = std::make_shared<FramePool>();
     
     std::cout << "Creating GStreamer source: " << getId() << " of type: " << type_ << std::endl;
     
@@ -52,9 +63,19 @@ bool GStreamerSource::initialize() {
         // Determine if this is a file source
         SourceProtocol protocol = parseSourceProtocol(url_);
         isFileSource_ = (protocol == SourceProtocol::FILE || type_ == "file");
-        
-        // Build GStreamer pipeline based on configuration
-        std::string pipeline = buildPipeline();
+        isPushSource_ = (url_.find("push://") == 0);
+
+        if (isPushSource_) {
+            // Push sources have no capture pipeline at all: frames arrive
+            // through pushFrame() and are published straight into the ring
+            std::cout << "Push source detected - frames are ingested via the REST push endpoint" << std::endl;
+            isFileSource_ = false;
+            needsScaling_ = false;
+            return true;
+        }
+
+        // Build GStreamer pipeline based on configuration (cached for reconnects)
+        const std::string& pipeline = pipelineDescription();
         std::cout << "Opening pipeline: " << pipeline << std::endl;
         
         if (isFileSource_) {
@@ -174,7 +195,10 @@ bool GStreamerSource::start() {
     stopRequested_ = false;
     running_ = true;
     
-    if (isFileSource_) {
+    if (isPushSource_) {
+        // Frames are produced by pushFrame() callers; nothing to capture
+        std::cout << "Push source started - waiting for pushed frames" << std::endl;
+    } else if (isFileSource_) {
         // For file sources, no background thread needed
         std::cout << "File source started in direct read mode - no background thread" << std::endl;
     } else {
@@ -203,20 +227,47 @@ bool GStreamerSource::stop() {
     
     // Release resources
     cap_.release();
-    
+
+    // Drain any queued frames so their buffers can be recycled or freed
+    {
+        CapturedFrame captured;
+        while (frameRing_.pop(captured)) {
+            captured.full.reset();
+            captured.plane.reset();
+        }
+    }
+    lastDetectorPlane_.reset();
+
     running_ = false;
     return true;
 }
 
 bool GStreamerSource::updateConfig(const nlohmann::json& config) {
-    bool needsRestart = running_;
+    // Classify the incoming changes: only keys that feed the pipeline
+    // description force a stop/start. Pacing and frame-skip tweaks — and
+    // no-op updates where the client PUTs back the config it just read —
+    // apply live without dropping frames.
+    static const std::unordered_set<std::string> kRestartRequiredKeys = {
+        "url", "width", "height", "fps", "format", "quality",
+        "use_hw_accel", "hw_accel_type", "rtsp_transport", "latency"
+    };
+    ConfigDiff diff = diffConfig(config_, config, kRestartRequiredKeys);
+    bool needsRestart = running_ && diff.requiresRestart();
+
+    if (diff.requiresRestart()) {
+        // The pipeline description changes, so the cached description is
+        // rebuilt on the next (re)connect
+        cachedPipeline_.clear();
+    }
     bool hwAccelChanged = false;
-    
-    // Stop if running
+
+    // Stop if running and the change cannot be absorbed live
     if (needsRestart) {
+        LOG_INFO("GStreamerSource", "Restarting source " + getId() +
+                 " to apply config change: " + diff.restartKeysSummary());
         stop();
     }
-    
+
     // Update configuration
     if (config.contains("url")) {
         url_ = config["url"];
@@ -287,14 +338,20 @@ bool GStreamerSource::updateConfig(const nlohmann::json& config) {
         skipBufferedFrames_ = config["skip_buffered_frames"];
     }
     
-    // Save the new configuration
-    config_ = config;
-    
-    // Restart if it was running
+    // Merge the new configuration over the saved one, so a partial hot
+    // update (e.g. just skip_buffered_frames) doesn't discard the stored
+    // values future updates are diffed against
+    if (config_.is_object()) {
+        config_.update(config);
+    } else {
+        config_ = config;
+    }
+
+    // Restart if it was running and the change requires it
     if (needsRestart) {
         return start();
     }
-    
+
     return true;
 }
 
@@ -316,7 +373,10 @@ nlohmann::json GStreamerSource::getStatus() const {
     status["url"] = url_;
     status["hardware_acceleration"] = useHardwareAccel_ ? "enabled" : "disabled";
     status["is_file_source"] = isFileSource_;
-    status["frame_reading_mode"] = isFileSource_ ? "direct" : "background_thread";
+    status["is_push_source"] = isPushSource_;
+    status["frame_reading_mode"] = isPushSource_ ? "push"
+                                 : isFileSource_ ? "direct"
+                                                 : "background_thread";
     
     // Add more detailed hardware acceleration information
     if (useHardwareAccel_) {
@@ -346,22 +406,45 @@ nlohmann::json GStreamerSource::getStatus() const {
     if (!lastError_.empty()) {
         status["last_error"] = lastError_;
     }
-    
+
+    if (framePool_) {
+        status["frame_pool"] = framePool_->getStats();
+    }
+    if (detectorPlanePool_ && detectorPlaneWidth_.load(std::memory_order_relaxed) > 0) {
+        status["detector_plane_pool"] = detectorPlanePool_->getStats();
+    }
+
+    // Capture-to-processing handoff statistics
+    status["queued_frames"] = frameRing_.size();
+    status["dropped_frames"] = frameRing_.dropped();
+    status["suspended"] = suspended_.load(std::memory_order_relaxed);
+
     return status;
 }
 
 cv::Mat GStreamerSource::getFrame() {
-    if (!running_ || !cap_.isOpened()) {
+    FramePtr frame = getFrameHandle();
+    if (!frame) {
         return cv::Mat();
     }
-    
+    // Header copy shares the pooled buffer - no pixel copy
+    return *frame;
+}
+
+FramePtr GStreamerSource::getFrameHandle() {
+    // Push sources never open cap_ — their frames arrive via pushFrame()
+    // and only transit the ring, so only capture-based sources gate on it
+    if (!running_ || (!isPushSource_ && !cap_.isOpened())) {
+        return nullptr;
+    }
+
     if (isFileSource_) {
-        // For file sources: directly read the next frame
+        // For file sources: directly read the next frame into a pooled buffer
         std::lock_guard<std::mutex> lock(frameMutex_);
-        
+
         cv::Mat frame;
         bool ret = cap_.read(frame);
-        
+
         if (!ret || frame.empty()) {
             // Check if we've reached the end of the file
             if (cap_.get(cv::CAP_PROP_POS_FRAMES) >= cap_.get(cv::CAP_PROP_FRAME_COUNT)) {
@@ -370,8 +453,7 @@ cv::Mat GStreamerSource::getFrame() {
                 cap_.release();
                 
                 // Reopen the file source
-                std::string pipeline = buildPipeline();
-                cap_.open(pipeline, cv::CAP_GSTREAMER);
+                cap_.open(pipelineDescription(), cv::CAP_GSTREAMER);
                 
                 if (!cap_.isOpened()) {
                     // Fall back to direct file opening if GStreamer fails
@@ -382,34 +464,107 @@ cv::Mat GStreamerSource::getFrame() {
                     ret = cap_.read(frame);
                 } else {
                     std::cerr << "Failed to reopen video file for looping" << std::endl;
-                    return cv::Mat();
+                    return nullptr;
                 }
             }
-            
+
             if (!ret || frame.empty()) {
                 std::cerr << "Failed to read frame from file" << std::endl;
-                return cv::Mat();
+                return nullptr;
             }
         }
-        
-        // Scale the frame if needed
-        if (needsScaling_ && !frame.empty()) {
-            cv::Mat scaledFrame;
-            cv::resize(frame, scaledFrame, cv::Size(width_, height_), 0, 0, cv::INTER_LINEAR);
-            frame = scaledFrame;
+
+        // Move the decoded frame into a pooled buffer (scaling directly into
+        // the pool when dimensions need to change)
+        FramePtr pooled;
+        if (needsScaling_) {
+            pooled = framePool_->acquire(height_, width_, frame.type());
+            cv::resize(frame, *pooled, cv::Size(width_, height_), 0, 0, cv::INTER_LINEAR);
+        } else {
+            pooled = framePool_->clone(frame);
         }
-        
+
         // Update statistics
         frameCount_++;
-        
-        return frame.clone();
+
+        lastDetectorPlane_ = makeDetectorPlane(*pooled);
+        lastCaptureTime_ = std::chrono::steady_clock::now();
+        return pooled;
     } else {
-        // For live sources: return the latest frame captured by the background thread
-        std::lock_guard<std::mutex> lock(frameMutex_);
-        return latestFrame_.clone();
+        // For live sources: pop the oldest frame from the lock-free ring.
+        // The capture thread never blocks on us; under load it drops stale
+        // frames at the producer side instead.
+        CapturedFrame captured;
+        if (!frameRing_.pop(captured)) {
+            return nullptr; // No new frame since the last call
+        }
+        lastDetectorPlane_ = captured.plane;
+        lastCaptureTime_ = captured.captureTime;
+        return captured.full;
     }
 }
 
+void GStreamerSource::setDetectorPlaneSize(int width, int height) {
+    detectorPlaneWidth_.store(width > 0 ? width : 0, std::memory_order_relaxed);
+    detectorPlaneHeight_.store(height > 0 ? height : 0, std::memory_order_relaxed);
+}
+
+FramePtr GStreamerSource::getDetectorPlaneHandle() {
+    return lastDetectorPlane_;
+}
+
+FramePtr GStreamerSource::makeDetectorPlane(const cv::Mat& full) {
+    const int planeWidth = detectorPlaneWidth_.load(std::memory_order_relaxed);
+    const int planeHeight = detectorPlaneHeight_.load(std::memory_order_relaxed);
+    if (planeWidth <= 0 || planeHeight <= 0 || full.empty()) {
+        return nullptr;
+    }
+
+    // No point producing a "downscaled" plane that isn't smaller; the
+    // consumer's full-frame fallback handles this case
+    if (planeWidth >= full.cols && planeHeight >= full.rows) {
+        return nullptr;
+    }
+
+    FramePtr plane = detectorPlanePool_->acquire(planeHeight, planeWidth, full.type());
+    cv::resize(full, *plane, cv::Size(planeWidth, planeHeight), 0, 0, cv::INTER_LINEAR);
+    return plane;
+}
+
+bool GStreamerSource::pushFrame(const unsigned char* data, size_t size) {
+    if (!running_ || !isPushSource_ || data == nullptr || size == 0) {
+        return false;
+    }
+
+    // HTTP handler threads can push concurrently but the ring is
+    // single-producer, so serialize here; contention is per-burst, not
+    // per-pixel, since the decode happens inside the critical section
+    // into a buffer only this caller holds
+    std::lock_guard<std::mutex> lock(pushMutex_);
+
+    // Wrap the encoded bytes without copying, then decode straight into a
+    // pooled buffer. cv::imdecode reuses the destination allocation when
+    // the geometry matches, so steady-state pushes perform no frame-sized
+    // allocations.
+    cv::Mat encoded(1, static_cast<int>(size), CV_8UC1,
+                    const_cast<unsigned char*>(data));
+    FramePtr pooled = framePool_->acquire(height_, width_, CV_8UC3);
+    cv::imdecode(encoded, cv::IMREAD_COLOR, pooled.get());
+    if (pooled->empty()) {
+        lastError_ = "Failed to decode pushed image";
+        return false;
+    }
+
+    CapturedFrame captured;
+    captured.captureTime = std::chrono::steady_clock::now();
+    captured.plane = makeDetectorPlane(*pooled);
+    captured.full = std::move(pooled);
+
+    frameRing_.push(std::move(captured));
+    frameCount_++;
+    return true;
+}
+
 void GStreamerSource::setAdaptiveTiming(bool enable) {
     // This method is now a no-op, kept for backward compatibility
     // We store the value but don't use it in our simplified model
@@ -496,6 +651,8 @@ SourceProtocol GStreamerSource::parseSourceProtocol(const std::string& uri) cons
         return SourceProtocol::HTTP;
     } else if (uri.find("csi://") == 0) {
         return SourceProtocol::CSI;
+    } else if (uri.find("push://") == 0) {
+        return SourceProtocol::IMAGE; // Still images pushed via the REST endpoint
     }
     
     // Check for device paths and file patterns
@@ -548,11 +705,21 @@ std::string GStreamerSource::buildPipeline() {
                 if (hwAccelType_ == "nvidia") {
                     // NVIDIA hardware acceleration for H.264
                     pipeline << "nvv4l2decoder ! nvvidconv ! ";
-                    pipeline << "video/x-raw, format=BGRx ! videoconvert ! videoscale ! ";
+                    // Pin the target geometry on the hardware converter so
+                    // scaling happens there; the remaining videoconvert only
+                    // repacks BGRx to the BGR the OpenCV appsink consumes
+                    pipeline << "video/x-raw, width=" << std::to_string(width_)
+                             << ", height=" << std::to_string(height_)
+                             << ", format=BGRx ! videoconvert ! ";
                 } else if (hwAccelType_ == "vaapi") {
                     // VA-API hardware acceleration for H.264
                     pipeline << "vaapidecode ! vaapipostproc ! ";
-                    pipeline << "video/x-raw, format=BGRx ! videoconvert ! videoscale ! ";
+                    // Pin the target geometry on the hardware converter so
+                    // scaling happens there; the remaining videoconvert only
+                    // repacks BGRx to the BGR the OpenCV appsink consumes
+                    pipeline << "video/x-raw, width=" << std::to_string(width_)
+                             << ", height=" << std::to_string(height_)
+                             << ", format=BGRx ! videoconvert ! ";
                 } else if (hwAccelType_ == "omx") {
                     // OMX hardware acceleration for H.264
                     pipeline << "omxh264dec ! ";
@@ -575,11 +742,21 @@ std::string GStreamerSource::buildPipeline() {
                 if (hwAccelType_ == "nvidia") {
                     // NVIDIA hardware acceleration for H.265
                     pipeline << "nvv4l2decoder ! nvvidconv ! ";
-                    pipeline << "video/x-raw, format=BGRx ! videoconvert ! videoscale ! ";
+                    // Pin the target geometry on the hardware converter so
+                    // scaling happens there; the remaining videoconvert only
+                    // repacks BGRx to the BGR the OpenCV appsink consumes
+                    pipeline << "video/x-raw, width=" << std::to_string(width_)
+                             << ", height=" << std::to_string(height_)
+                             << ", format=BGRx ! videoconvert ! ";
                 } else if (hwAccelType_ == "vaapi") {
                     // VA-API hardware acceleration for H.265
                     pipeline << "vaapidecode ! vaapipostproc ! ";
-                    pipeline << "video/x-raw, format=BGRx ! videoconvert ! videoscale ! ";
+                    // Pin the target geometry on the hardware converter so
+                    // scaling happens there; the remaining videoconvert only
+                    // repacks BGRx to the BGR the OpenCV appsink consumes
+                    pipeline << "video/x-raw, width=" << std::to_string(width_)
+                             << ", height=" << std::to_string(height_)
+                             << ", format=BGRx ! videoconvert ! ";
                 } else if (hwAccelType_ == "omx") {
                     // OMX hardware acceleration for H.265
                     pipeline << "omxh265dec ! ";
@@ -620,10 +797,18 @@ std::string GStreamerSource::buildPipeline() {
         if (useHardwareAccel_) {
             if (hwAccelType_ == "nvidia") {
                 pipeline << "nvvidconv ! ";
-                pipeline << "video/x-raw, format=BGRx ! videoconvert ! videoscale ! ";
+                // Hardware-side scaling: geometry goes on the converter's
+                // caps, leaving videoconvert just the BGRx-to-BGR repack
+                pipeline << "video/x-raw, width=" << std::to_string(width_)
+                         << ", height=" << std::to_string(height_)
+                         << ", format=BGRx ! videoconvert ! ";
             } else if (hwAccelType_ == "vaapi") {
                 pipeline << "vaapipostproc ! ";
-                pipeline << "video/x-raw, format=BGRx ! videoconvert ! videoscale ! ";
+                // Hardware-side scaling: geometry goes on the converter's
+                // caps, leaving videoconvert just the BGRx-to-BGR repack
+                pipeline << "video/x-raw, width=" << std::to_string(width_)
+                         << ", height=" << std::to_string(height_)
+                         << ", format=BGRx ! videoconvert ! ";
             } else {
                 pipeline << "videoconvert ! videoscale ! ";
             }
@@ -677,10 +862,18 @@ std::string GStreamerSource::buildPipeline() {
         if (useHardwareAccel_) {
             if (hwAccelType_ == "nvidia") {
                 pipeline << "nvvidconv interpolation-method=5 ! ";
-                pipeline << "video/x-raw, format=BGRx ! videoconvert ! videoscale ! ";
+                // Hardware-side scaling: geometry goes on the converter's
+                // caps, leaving videoconvert just the BGRx-to-BGR repack
+                pipeline << "video/x-raw, width=" << std::to_string(width_)
+                         << ", height=" << std::to_string(height_)
+                         << ", format=BGRx ! videoconvert ! ";
             } else if (hwAccelType_ == "vaapi") {
                 pipeline << "vaapipostproc ! ";
-                pipeline << "video/x-raw, format=BGRx ! videoconvert ! videoscale ! ";
+                // Hardware-side scaling: geometry goes on the converter's
+                // caps, leaving videoconvert just the BGRx-to-BGR repack
+                pipeline << "video/x-raw, width=" << std::to_string(width_)
+                         << ", height=" << std::to_string(height_)
+                         << ", format=BGRx ! videoconvert ! ";
             } else {
                 pipeline << "videoconvert ! videoscale ! ";
             }
@@ -703,7 +896,11 @@ std::string GStreamerSource::buildPipeline() {
         pipeline << "appsink drop=false max-buffers=1 sync=false emit-signals=false";
         std::cout << "Using direct file mode: sync=false, drop=false for frame-by-frame processing" << std::endl;
     } else {
-        // For live sources, keep existing low-latency settings
+        // For live sources, keep existing low-latency settings. The leaky
+        // queue ahead of the sink sheds oldest-first inside GStreamer when
+        // the reader falls behind, so latency stays bounded instead of
+        // backing pressure up into the RTSP session until it degrades
+        pipeline << "queue leaky=downstream max-size-buffers=2 ! ";
         pipeline << "appsink drop=true max-buffers=1 sync=false";
         std::cout << "Using live timing mode: sync=false, drop=true for low latency" << std::endl;
     }
@@ -711,60 +908,107 @@ std::string GStreamerSource::buildPipeline() {
     return pipeline.str();
 }
 
+const std::string& GStreamerSource::pipelineDescription() {
+    if (cachedPipeline_.empty()) {
+        cachedPipeline_ = buildPipeline();
+    }
+    return cachedPipeline_;
+}
+
 void GStreamerSource::captureThread() {
     // This method is only called for live sources (not file sources)
     LOG_INFO("Camera", "Background processing thread for camera " + getId() + " started");
+
+    // Capture threads join the pipeline core group so decoded frames and
+    // the pool buffers they first touch stay NUMA-local to processing
+    utils::ThreadAffinity::pinPipelineThread("capture " + getId());
     
     cv::Mat frame;
     auto startTime = std::chrono::steady_clock::now();
     int localFrameCount = 0;
     int consecutiveFailures = 0;
+    int reconnectDelayMs = kInitialReconnectDelayMs;
     
     std::cout << "Live source detected - using minimal sleep for CPU efficiency" << std::endl;
     
     while (!stopRequested_) {
+        // Suspended: nobody is consuming frames, so keep the session
+        // alive with grab() (no retrieve, no BGR conversion into a Mat)
+        // and skip pooling entirely. Resuming is just the next full read.
+        const bool suspendedNow = suspended_.load(std::memory_order_relaxed);
+
         // Simple, direct frame reading approach
-        bool ret = cap_.read(frame);
-        
+        bool ret = suspendedNow ? cap_.grab() : cap_.read(frame);
+
         // Check for stop request after read
         if (stopRequested_) break;
-        
-        if (!ret || frame.empty()) {
+
+        if (!ret || (!suspendedNow && frame.empty())) {
             consecutiveFailures++;
-            
+
             // Don't spam logs for repeated failures
             if (consecutiveFailures <= 1) {
                 std::cerr << "Failed to read frame" << std::endl;
             }
-            
+
             // Handle different source types - reopen if needed
-            if (type_ == "rtsp" && consecutiveFailures <= 10) {
+            if (type_ == "rtsp") {
+                // Exponential backoff between reconnects: cellular links
+                // drop dozens of times a day, so hammering a dead endpoint
+                // only delays the moment it comes back. Sleep in short
+                // slices so stop requests stay responsive.
+                int remaining = reconnectDelayMs;
+                while (remaining > 0 && !stopRequested_) {
+                    const int slice = std::min(remaining, 50);
+                    std::this_thread::sleep_for(std::chrono::milliseconds(slice));
+                    remaining -= slice;
+                }
+                if (stopRequested_) break;
+
                 reopenRtspStream();
+                reconnectDelayMs = std::min(reconnectDelayMs * 2, kMaxReconnectDelayMs);
             } else {
-                // For other source types or after too many failures, just sleep a bit
+                // For other source types, just sleep a bit
                 std::this_thread::sleep_for(std::chrono::milliseconds(10));
             }
-            
+
             // Check for stop requests after handling failures
             if (stopRequested_) break;
             continue;
         }
-        
-        // Reset failure counter when we successfully read a frame
+
+        // Reset failure counter and reconnect backoff on a good frame
         consecutiveFailures = 0;
-        
-        // Scale the frame if needed (when dimensions don't match requested)
-        if (needsScaling_ && !frame.empty()) {
-            cv::Mat scaledFrame;
-            cv::resize(frame, scaledFrame, cv::Size(width_, height_), 0, 0, cv::INTER_LINEAR);
-            frame = scaledFrame;
+        reconnectDelayMs = kInitialReconnectDelayMs;
+
+        if (suspendedNow) {
+            // Drop the grabbed sample on the floor; the leaky queue and
+            // appsink keep the stream position current while we idle
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            continue;
         }
         
-        // Update frame with simple lock
-        {
-            std::lock_guard<std::mutex> lock(frameMutex_);
-            latestFrame_ = frame.clone();
+        // Publish the frame through the pool: scale directly into a pooled
+        // buffer when needed, otherwise copy once into the pool. Consumers
+        // then share the handle with no further copies.
+        FramePtr pooled;
+        if (needsScaling_) {
+            pooled = framePool_->acquire(height_, width_, frame.type());
+            cv::resize(frame, *pooled, cv::Size(width_, height_), 0, 0, cv::INTER_LINEAR);
+        } else {
+            pooled = framePool_->clone(frame);
         }
+
+        // Downscale the detector plane here, off the processing path, so
+        // one resize per frame is shared by every detector downstream
+        CapturedFrame captured;
+        captured.captureTime = std::chrono::steady_clock::now();
+        captured.plane = makeDetectorPlane(*pooled);
+        captured.full = std::move(pooled);
+
+        // Hand off through the lock-free ring; if the processing thread has
+        // fallen behind the oldest queued frame is dropped (and counted)
+        frameRing_.push(std::move(captured));
         
         // Update statistics
         localFrameCount++;
@@ -792,10 +1036,11 @@ void GStreamerSource::reopenRtspStream() {
     
     cap_.release();
     if (stopRequested_) return;
-    
-    // Use GStreamer pipeline to ensure dimensions are respected
-    std::string pipeline = buildPipeline();
-    cap_.open(pipeline, cv::CAP_GSTREAMER);
+
+    // Reuse the cached pipeline description: the parsed protocol, decoder
+    // selection and caps are identical to the last successful connect, so
+    // only the RTSP session itself is renegotiated
+    cap_.open(pipelineDescription(), cv::CAP_GSTREAMER);
     
     if (!cap_.isOpened()) {
         std::cerr << "Failed to reconnect to RTSP stream" << std::endl;
@@ -0,0 +1,150 @@
+#include "components/telemetry_codec.h"
+#include "logger.h"
+#include "telemetry.pb.h"
+
+namespace tapi {
+
+namespace proto = tapi::telemetry;
+
+namespace {
+
+/**
+ * @brief Fill a proto event from a tapi::TelemetryEvent
+ */
+void toProto(const TelemetryEvent& event, proto::TelemetryEvent& protoEvent) {
+    protoEvent.set_type(static_cast<proto::TelemetryEventType>(event.getType()));
+    protoEvent.set_source_id(event.getSourceId());
+    protoEvent.set_camera_id(event.getCameraId());
+    protoEvent.set_timestamp_ms(event.getTimestamp());
+
+    if (event.hasClassName()) {
+        protoEvent.set_class_name(event.getClassName());
+    }
+    if (event.hasConfidence()) {
+        protoEvent.set_confidence(event.getConfidence());
+    }
+    if (event.hasTrackId()) {
+        protoEvent.set_track_id(event.getTrackId());
+    }
+    if (event.hasZoneId()) {
+        protoEvent.set_zone_id(event.getZoneId());
+    }
+    if (event.hasBBox()) {
+        const TelemetryBBox& bbox = event.getBBox();
+        proto::BBox* protoBBox = protoEvent.mutable_bbox();
+        protoBBox->set_x(bbox.x);
+        protoBBox->set_y(bbox.y);
+        protoBBox->set_width(bbox.width);
+        protoBBox->set_height(bbox.height);
+    }
+
+    for (const auto& entry : event.getCustomProperties()) {
+        proto::CustomProperty* property = protoEvent.add_custom_properties();
+        property->set_key(entry.first);
+        property->set_json_value(entry.second.dump());
+    }
+}
+
+/**
+ * @brief Rebuild a tapi::TelemetryEvent from its proto form
+ */
+TelemetryEvent fromProto(const proto::TelemetryEvent& protoEvent) {
+    TelemetryEvent event(static_cast<TelemetryEventType>(protoEvent.type()),
+                         protoEvent.source_id(),
+                         protoEvent.timestamp_ms());
+
+    if (!protoEvent.camera_id().empty()) {
+        event.setCameraId(protoEvent.camera_id());
+    }
+    if (protoEvent.has_class_name()) {
+        event.setClassName(protoEvent.class_name());
+    }
+    if (protoEvent.has_confidence()) {
+        event.setConfidence(protoEvent.confidence());
+    }
+    if (protoEvent.has_track_id()) {
+        event.setTrackId(protoEvent.track_id());
+    }
+    if (protoEvent.has_zone_id()) {
+        event.setZoneId(protoEvent.zone_id());
+    }
+    if (protoEvent.has_bbox()) {
+        TelemetryBBox bbox;
+        bbox.x = protoEvent.bbox().x();
+        bbox.y = protoEvent.bbox().y();
+        bbox.width = protoEvent.bbox().width();
+        bbox.height = protoEvent.bbox().height();
+        event.setBBox(bbox);
+    }
+
+    for (const auto& property : protoEvent.custom_properties()) {
+        try {
+            event.setProperty(property.key(), nlohmann::json::parse(property.json_value()));
+        } catch (const nlohmann::json::exception& e) {
+            LOG_WARN("TelemetryCodec", "Skipping custom property '" + property.key() +
+                     "' with malformed JSON value: " + std::string(e.what()));
+        }
+    }
+
+    return event;
+}
+
+} // namespace
+
+std::string TelemetryCodec::encode(const TelemetryEvent& event) {
+    proto::TelemetryEvent protoEvent;
+    toProto(event, protoEvent);
+    return protoEvent.SerializeAsString();
+}
+
+std::string TelemetryCodec::encodeBatch(const std::vector<TelemetryEvent>& events, size_t dropped) {
+    proto::TelemetryEventBatch batch;
+    for (const auto& event : events) {
+        toProto(event, *batch.add_events());
+    }
+    if (dropped > 0) {
+        batch.set_dropped(static_cast<uint32_t>(dropped));
+    }
+    return batch.SerializeAsString();
+}
+
+std::string TelemetryCodec::encodeBatch(const std::vector<TelemetryEventList>& batches, size_t dropped) {
+    proto::TelemetryEventBatch batch;
+    for (const auto& events : batches) {
+        if (!events) {
+            continue;
+        }
+        for (const auto& event : *events) {
+            toProto(event, *batch.add_events());
+        }
+    }
+    if (dropped > 0) {
+        batch.set_dropped(static_cast<uint32_t>(dropped));
+    }
+    return batch.SerializeAsString();
+}
+
+bool TelemetryCodec::decode(const std::string& data, TelemetryEvent& event) {
+    proto::TelemetryEvent protoEvent;
+    if (!protoEvent.ParseFromString(data)) {
+        LOG_ERROR("TelemetryCodec", "Failed to parse telemetry event from protobuf");
+        return false;
+    }
+    event = fromProto(protoEvent);
+    return true;
+}
+
+bool TelemetryCodec::decodeBatch(const std::string& data, std::vector<TelemetryEvent>& events) {
+    proto::TelemetryEventBatch batch;
+    if (!batch.ParseFromString(data)) {
+        LOG_ERROR("TelemetryCodec", "Failed to parse telemetry event batch from protobuf");
+        return false;
+    }
+    events.reserve(events.size() + batch.events_size());
+    for (const auto& protoEvent : batch.events()) {
+        events.push_back(fromProto(protoEvent));
+    }
+    return true;
+}
+
+} // namespace tapi
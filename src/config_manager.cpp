@@ -5,8 +5,8 @@
 
 namespace tapi {
 
-ConfigManager::ConfigManager() 
-    : db_(nullptr), isInitialized_(false) {
+ConfigManager::ConfigManager()
+    : db_(nullptr), isInitialized_(false), configCache_(std::make_shared<ConfigCache>()) {
 }
 
 ConfigManager::~ConfigManager() {
@@ -128,58 +128,93 @@ std::string ConfigManager::getLastError() const {
     return sqlite3_errmsg(db_);
 }
 
+std::shared_ptr<const ConfigManager::ConfigCache> ConfigManager::cacheSnapshot() const {
+    return std::atomic_load_explicit(&configCache_, std::memory_order_acquire);
+}
+
 void ConfigManager::refreshConfigCache() {
-    configCache_.clear();
-    
+    auto cache = std::make_shared<ConfigCache>();
+
     if (!db_) {
+        std::atomic_store_explicit(&configCache_,
+                                   std::shared_ptr<const ConfigCache>(cache),
+                                   std::memory_order_release);
         return;
     }
-    
+
     // General config
     sqlite3_stmt* stmt = nullptr;
     std::string sql = "SELECT key, value FROM config;";
-    
+
     int rc = sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr);
     if (rc != SQLITE_OK) {
         LOG_ERROR("ConfigManager", "Failed to prepare query: " + getLastError());
         return;
     }
-    
+
     while (sqlite3_step(stmt) == SQLITE_ROW) {
         std::string key = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
         std::string value = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
-        
+
         try {
-            configCache_[key] = nlohmann::json::parse(value);
+            (*cache)[key] = nlohmann::json::parse(value);
         } catch (const std::exception& e) {
             LOG_ERROR("ConfigManager", "Failed to parse JSON for key " + key + ": " + e.what());
             // Store as string if parsing fails
-            configCache_[key] = value;
+            (*cache)[key] = value;
         }
     }
-    
+
     sqlite3_finalize(stmt);
+
+    std::atomic_store_explicit(&configCache_,
+                               std::shared_ptr<const ConfigCache>(cache),
+                               std::memory_order_release);
 }
 
 void ConfigManager::updateConfigCache(const std::string& key, const nlohmann::json& value) {
-    configCache_[key] = value;
+    // Copy-on-write: readers keep using the old snapshot until the swap
+    auto cache = std::make_shared<ConfigCache>(*cacheSnapshot());
+    (*cache)[key] = value;
+    std::atomic_store_explicit(&configCache_,
+                               std::shared_ptr<const ConfigCache>(cache),
+                               std::memory_order_release);
 }
 
 void ConfigManager::clearConfigCache(const std::string& key) {
-    if (configCache_.find(key) != configCache_.end()) {
-        configCache_.erase(key);
+    auto current = cacheSnapshot();
+    if (current->find(key) == current->end()) {
+        return;
     }
+    auto cache = std::make_shared<ConfigCache>(*current);
+    cache->erase(key);
+    std::atomic_store_explicit(&configCache_,
+                               std::shared_ptr<const ConfigCache>(cache),
+                               std::memory_order_release);
 }
 
 nlohmann::json ConfigManager::getConfig(const std::string& key) {
+    // Lock-free fast path: cache hits read the current snapshot without
+    // touching the mutex or the database
+    {
+        auto cache = cacheSnapshot();
+        auto it = cache->find(key);
+        if (it != cache->end()) {
+            return it->second;
+        }
+    }
+
     std::lock_guard<std::mutex> lock(mutex_);
-    
-    // Check cache first
-    auto it = configCache_.find(key);
-    if (it != configCache_.end()) {
-        return it->second;
+
+    // Another thread may have cached the key while we waited for the lock
+    {
+        auto cache = cacheSnapshot();
+        auto it = cache->find(key);
+        if (it != cache->end()) {
+            return it->second;
+        }
     }
-    
+
     if (!db_) {
         LOG_ERROR("ConfigManager", "Database not initialized");
         return nlohmann::json();
@@ -301,12 +336,13 @@ nlohmann::json ConfigManager::getAllConfig() {
     
     // Refresh cache to ensure it's up to date
     refreshConfigCache();
-    
+
     nlohmann::json result = nlohmann::json::object();
-    for (const auto& pair : configCache_) {
+    auto cache = cacheSnapshot();
+    for (const auto& pair : *cache) {
         result[pair.first] = pair.second;
     }
-    
+
     return result;
 }
 
@@ -390,6 +426,80 @@ bool ConfigManager::saveCameraConfig(const std::string& cameraId, const nlohmann
     return true;
 }
 
+bool ConfigManager::saveCameraConfigs(const std::vector<std::pair<std::string, nlohmann::json>>& configs) {
+    if (configs.empty()) {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!db_) {
+        LOG_ERROR("ConfigManager", "Database not initialized");
+        return false;
+    }
+
+    // One transaction for the whole batch: a single fsync instead of one
+    // per camera
+    if (!executeSQL("BEGIN IMMEDIATE;")) {
+        return false;
+    }
+
+    sqlite3_stmt* stmt = nullptr;
+    std::string sql =
+        "INSERT INTO camera_config (camera_id, config, updated_at) "
+        "VALUES (?, ?, strftime('%s','now')) "
+        "ON CONFLICT (camera_id) DO UPDATE SET "
+        "config = excluded.config, "
+        "updated_at = excluded.updated_at;";
+
+    int rc = sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr);
+    if (rc != SQLITE_OK) {
+        LOG_ERROR("ConfigManager", "Failed to prepare query: " + getLastError());
+        executeSQL("ROLLBACK;");
+        return false;
+    }
+
+    bool success = true;
+    for (const auto& [cameraId, config] : configs) {
+        std::string configStr;
+        try {
+            configStr = config.dump();
+        } catch (const std::exception& e) {
+            LOG_ERROR("ConfigManager", "Failed to serialize JSON for camera " + cameraId + ": " + e.what());
+            success = false;
+            break;
+        }
+
+        sqlite3_bind_text(stmt, 1, cameraId.c_str(), -1, SQLITE_TRANSIENT);
+        sqlite3_bind_text(stmt, 2, configStr.c_str(), -1, SQLITE_TRANSIENT);
+
+        rc = sqlite3_step(stmt);
+        if (rc != SQLITE_DONE) {
+            LOG_ERROR("ConfigManager", "Failed to save camera config for " + cameraId + ": " + getLastError());
+            success = false;
+            break;
+        }
+
+        sqlite3_reset(stmt);
+        sqlite3_clear_bindings(stmt);
+    }
+
+    sqlite3_finalize(stmt);
+
+    if (!success) {
+        executeSQL("ROLLBACK;");
+        return false;
+    }
+
+    if (!executeSQL("COMMIT;")) {
+        executeSQL("ROLLBACK;");
+        return false;
+    }
+
+    LOG_INFO("ConfigManager", "Saved " + std::to_string(configs.size()) + " camera configuration(s) in one batch");
+    return true;
+}
+
 bool ConfigManager::deleteCameraConfig(const std::string& cameraId) {
     std::lock_guard<std::mutex> lock(mutex_);
     
@@ -456,8 +566,10 @@ nlohmann::json ConfigManager::getAllCameraConfigs() {
 }
 
 bool ConfigManager::isReady() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return isInitialized_ && db_ != nullptr;
+    // Checked on hot paths (e.g. per-frame config reads), so it must not
+    // contend with in-flight database writes. The flag is only set after
+    // db_ is valid and cleared before it is torn down.
+    return isInitialized_.load(std::memory_order_acquire);
 }
 
 std::string ConfigManager::getDatabasePath() const {
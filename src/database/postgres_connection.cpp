@@ -31,13 +31,17 @@ bool PostgreSQLConnection::connect() {
         conn_ = nullptr;
     }
     
+    // Named statements die with the session, so a fresh connection starts
+    // with an empty cache and statements are re-prepared on demand
+    prepared_statements_.clear();
+
     conn_ = PQconnectdb(conninfo_.c_str());
-    
+
     if (!conn_ || PQstatus(conn_) != CONNECTION_OK) {
         handleConnectionError();
         return false;
     }
-    
+
     LOG_INFO("PostgreSQL", "Connected successfully");
     return true;
 }
@@ -130,6 +134,91 @@ PGresult* PostgreSQLConnection::executeParams(const std::string& query,
     return res;
 }
 
+std::shared_ptr<CachedStatement> PostgreSQLConnection::prepare(
+    const std::string& query, const std::vector<std::string>& params) {
+    if (!isConnected() && !reconnect()) {
+        LOG_ERROR("PostgreSQL", "prepare failed: connection is down");
+        return nullptr;
+    }
+    return std::make_shared<CachedStatement>(this, query, params);
+}
+
+PGresult* PostgreSQLConnection::executePrepared(const std::string& query,
+                                                const std::vector<std::string>& params) {
+    std::lock_guard<std::mutex> lock(conn_mutex_);
+
+    if (!conn_ || PQstatus(conn_) != CONNECTION_OK) {
+        LOG_ERROR("PostgreSQL", "Not connected");
+        return nullptr;
+    }
+
+    std::string stmt_name = statementNameLocked(query);
+    if (stmt_name.empty()) {
+        return nullptr;
+    }
+
+    std::vector<const char*> param_values;
+    for (const auto& param : params) {
+        param_values.push_back(param.c_str());
+    }
+
+    PGresult* res = PQexecPrepared(
+        conn_,
+        stmt_name.c_str(),
+        params.size(),
+        param_values.data(),
+        nullptr,  // Text format for all params
+        nullptr,  // Text format for all params
+        0         // Request result in text format
+    );
+
+    ExecStatusType status = PQresultStatus(res);
+
+    if (status != PGRES_TUPLES_OK && status != PGRES_COMMAND_OK) {
+        LOG_ERROR("PostgreSQL", "Prepared query failed: " + std::string(PQerrorMessage(conn_)));
+        PQclear(res);
+        return nullptr;
+    }
+
+    return res;
+}
+
+std::string PostgreSQLConnection::statementNameLocked(const std::string& query) {
+    auto it = prepared_statements_.find(query);
+    if (it != prepared_statements_.end()) {
+        return it->second;
+    }
+
+    std::string name = "tapi_stmt_" + std::to_string(prepared_statements_.size() + 1);
+
+    PGresult* res = PQprepare(conn_, name.c_str(), query.c_str(), 0, nullptr);
+    ExecStatusType status = PQresultStatus(res);
+    PQclear(res);
+
+    if (status != PGRES_COMMAND_OK) {
+        LOG_ERROR("PostgreSQL", "PQprepare failed: " + std::string(PQerrorMessage(conn_)));
+        return "";
+    }
+
+    prepared_statements_[query] = name;
+    return name;
+}
+
+bool PostgreSQLConnection::ping() {
+    std::lock_guard<std::mutex> lock(conn_mutex_);
+
+    if (!conn_ || PQstatus(conn_) != CONNECTION_OK) {
+        return false;
+    }
+
+    PGresult* res = PQexec(conn_, "SELECT 1");
+    bool alive = res && PQresultStatus(res) == PGRES_TUPLES_OK;
+    if (res) {
+        PQclear(res);
+    }
+    return alive;
+}
+
 void PostgreSQLConnection::clearResult(PGresult* result) {
     if (result) {
         PQclear(result);
@@ -164,6 +253,123 @@ void PostgreSQLConnection::handleConnectionError() {
     }
 }
 
+// =====================================================
+// CachedStatement Implementation
+// =====================================================
+
+CachedStatement::CachedStatement(PostgreSQLConnection* conn, std::string query,
+                                 std::vector<std::string> params)
+    : conn_(conn), query_(std::move(query)), params_(std::move(params)) {
+}
+
+std::shared_ptr<QueryResult> CachedStatement::execute() {
+    if (!conn_) {
+        LOG_ERROR("CachedStatement", "No connection available");
+        return nullptr;
+    }
+
+    PGresult* res = conn_->executePrepared(query_, params_);
+
+    // If the link dropped since prepare(), reconnect and retry once; the
+    // reconnect cleared the statement cache, so this re-prepares on demand
+    if (!res && !conn_->isConnected() && conn_->reconnect()) {
+        res = conn_->executePrepared(query_, params_);
+    }
+
+    if (!res) {
+        return nullptr;
+    }
+    return std::make_shared<QueryResult>(res);
+}
+
+// =====================================================
+// QueryResult Implementation
+// =====================================================
+
+QueryResult::QueryResult(PGresult* result) : result_(result) {
+}
+
+QueryResult::~QueryResult() {
+    if (result_) {
+        PQclear(result_);
+        result_ = nullptr;
+    }
+}
+
+size_t QueryResult::rowCount() const {
+    return result_ ? static_cast<size_t>(PQntuples(result_)) : 0;
+}
+
+long QueryResult::affectedRows() const {
+    if (!result_) {
+        return 0;
+    }
+    const char* tuples = PQcmdTuples(result_);
+    if (!tuples || tuples[0] == '\0') {
+        return 0;
+    }
+    try {
+        return std::stol(tuples);
+    } catch (...) {
+        return 0;
+    }
+}
+
+bool QueryResult::isNull(size_t row, int col) const {
+    if (!result_ || row >= rowCount() || col < 0 || col >= PQnfields(result_)) {
+        return true;
+    }
+    return PQgetisnull(result_, static_cast<int>(row), col);
+}
+
+std::string QueryResult::getString(size_t row, int col) const {
+    if (isNull(row, col)) {
+        return "";
+    }
+    return PQgetvalue(result_, static_cast<int>(row), col);
+}
+
+int QueryResult::getInt(size_t row, int col) const {
+    if (isNull(row, col)) {
+        return 0;
+    }
+    try {
+        return std::stoi(PQgetvalue(result_, static_cast<int>(row), col));
+    } catch (...) {
+        return 0;
+    }
+}
+
+long long QueryResult::getInt64(size_t row, int col) const {
+    if (isNull(row, col)) {
+        return 0;
+    }
+    try {
+        return std::stoll(PQgetvalue(result_, static_cast<int>(row), col));
+    } catch (...) {
+        return 0;
+    }
+}
+
+double QueryResult::getDouble(size_t row, int col) const {
+    if (isNull(row, col)) {
+        return 0.0;
+    }
+    try {
+        return std::stod(PQgetvalue(result_, static_cast<int>(row), col));
+    } catch (...) {
+        return 0.0;
+    }
+}
+
+bool QueryResult::getBool(size_t row, int col) const {
+    if (isNull(row, col)) {
+        return false;
+    }
+    std::string val = PQgetvalue(result_, static_cast<int>(row), col);
+    return (val == "t" || val == "true" || val == "1");
+}
+
 // =====================================================
 // PostgreSQLConnectionPool Implementation
 // =====================================================
@@ -220,36 +426,42 @@ void PostgreSQLConnectionPool::initializePool() {
 }
 
 PostgreSQLConnectionPool::ConnectionGuard PostgreSQLConnectionPool::getConnection() {
-    std::unique_lock<std::mutex> lock(pool_mutex_);
-    
-    // Wait for available connection
-    pool_cv_.wait(lock, [this] { 
-        return !available_connections_.empty() || shutdown_; 
-    });
-    
-    if (shutdown_) {
-        return ConnectionGuard(this, nullptr);
-    }
-    
-    auto conn = available_connections_.front();
-    available_connections_.pop();
-    
-    // Verify connection is still valid
-    if (!conn->isConnected()) {
+    for (int attempt = 0; attempt <= config_.max_retries; ++attempt) {
+        std::unique_lock<std::mutex> lock(pool_mutex_);
+
+        // Wait for available connection
+        pool_cv_.wait(lock, [this] {
+            return !available_connections_.empty() || shutdown_;
+        });
+
+        if (shutdown_) {
+            return ConnectionGuard(this, nullptr);
+        }
+
+        auto conn = available_connections_.front();
+        available_connections_.pop();
+
+        // Verify connection is still valid
+        if (conn->isConnected()) {
+            return ConnectionGuard(this, conn);
+        }
+
         LOG_WARN("PostgreSQLPool", "Connection was stale, reconnecting...");
-        if (!conn->reconnect()) {
-            // Return to pool and try again
-            available_connections_.push(conn);
-            lock.unlock();
-            pool_cv_.notify_one();
-            
-            // Retry
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
-            return getConnection();
+        if (conn->reconnect()) {
+            return ConnectionGuard(this, conn);
         }
+
+        // Return to pool and retry up to config_.max_retries times
+        available_connections_.push(conn);
+        lock.unlock();
+        pool_cv_.notify_one();
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
     }
-    
-    return ConnectionGuard(this, conn);
+
+    LOG_ERROR("PostgreSQLPool", "No usable connection after " +
+              std::to_string(config_.max_retries) + " retries");
+    return ConnectionGuard(this, nullptr);
 }
 
 PostgreSQLConnectionPool::ConnectionGuard PostgreSQLConnectionPool::getConnection(int timeout_ms) {
@@ -299,6 +511,41 @@ int PostgreSQLConnectionPool::getTotalConnections() const {
     return all_connections_.size();
 }
 
+int PostgreSQLConnectionPool::healthCheck() {
+    // Take the idle connections out of the pool so the round-trip pings
+    // never run under pool_mutex_ and checkouts keep flowing
+    std::vector<std::shared_ptr<PostgreSQLConnection>> idle;
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        while (!available_connections_.empty()) {
+            idle.push_back(available_connections_.front());
+            available_connections_.pop();
+        }
+    }
+
+    int healthy = 0;
+    for (auto& conn : idle) {
+        if (conn->ping()) {
+            healthy++;
+        } else if (conn->reconnect()) {
+            LOG_INFO("PostgreSQLPool", "Health check revived a dead connection");
+            healthy++;
+        }
+        // A connection that cannot reconnect goes back regardless; checkout
+        // retries the reconnect when it is next handed out
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        for (auto& conn : idle) {
+            available_connections_.push(conn);
+        }
+    }
+    pool_cv_.notify_all();
+
+    return healthy;
+}
+
 bool PostgreSQLConnectionPool::executeQuick(const std::string& query) {
     auto guard = getConnection();
     if (!guard.isValid()) return false;
@@ -11,7 +11,16 @@ namespace database {
 // =====================================================
 
 RedisCache::RedisCache(const Config& config)
-    : config_(config), context_(nullptr) {
+    : config_(config), context_(nullptr),
+      breaker_(utils::CircuitBreaker::Config{
+          config.breaker_failure_threshold, config.breaker_open_duration_ms}) {
+    if (localCacheEnabled()) {
+        int shard_count = std::max(1, config_.local_cache_shards);
+        local_shards_.reserve(shard_count);
+        for (int i = 0; i < shard_count; ++i) {
+            local_shards_.push_back(std::make_unique<LocalCacheShard>());
+        }
+    }
     connect();
 }
 
@@ -67,58 +76,174 @@ bool RedisCache::reconnect() {
     return connect();
 }
 
+// =====================================================
+// In-process LRU (fronts GET so hot license/entitlement
+// keys never leave the process in steady state)
+// =====================================================
+
+RedisCache::LocalCacheShard& RedisCache::shardFor(const std::string& key) {
+    size_t hash = std::hash<std::string>{}(key);
+    return *local_shards_[hash % local_shards_.size()];
+}
+
+bool RedisCache::localGet(const std::string& key, std::string& value, bool allow_stale) {
+    if (!localCacheEnabled()) return false;
+
+    LocalCacheShard& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.entries.find(key);
+    if (it == shard.entries.end()) {
+        return false;
+    }
+
+    // Stale reads keep the entry around: it is the last-known-good value
+    // served while the circuit breaker has Redis marked down
+    if (!allow_stale && std::chrono::steady_clock::now() > it->second.expiry) {
+        shard.lru.erase(it->second.lru_it);
+        shard.entries.erase(it);
+        return false;
+    }
+
+    // Move to front of the LRU order
+    shard.lru.splice(shard.lru.begin(), shard.lru, it->second.lru_it);
+    value = it->second.value;
+    return true;
+}
+
+void RedisCache::localPut(const std::string& key, const std::string& value, int ttl_seconds) {
+    if (!localCacheEnabled()) return;
+
+    // Never cache locally for longer than the staleness bound, even when
+    // the Redis entry itself lives longer
+    int local_ttl = config_.local_cache_ttl_seconds;
+    if (ttl_seconds > 0 && ttl_seconds < local_ttl) {
+        local_ttl = ttl_seconds;
+    }
+    auto expiry = std::chrono::steady_clock::now() + std::chrono::seconds(local_ttl);
+
+    LocalCacheShard& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.entries.find(key);
+    if (it != shard.entries.end()) {
+        it->second.value = value;
+        it->second.expiry = expiry;
+        shard.lru.splice(shard.lru.begin(), shard.lru, it->second.lru_it);
+        return;
+    }
+
+    shard.lru.push_front(key);
+    shard.entries[key] = LocalCacheShard::Entry{value, expiry, shard.lru.begin()};
+
+    if (shard.entries.size() > static_cast<size_t>(std::max(1, config_.local_cache_entries_per_shard))) {
+        shard.entries.erase(shard.lru.back());
+        shard.lru.pop_back();
+    }
+}
+
+void RedisCache::localErase(const std::string& key) {
+    if (!localCacheEnabled()) return;
+
+    LocalCacheShard& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.entries.find(key);
+    if (it != shard.entries.end()) {
+        shard.lru.erase(it->second.lru_it);
+        shard.entries.erase(it);
+    }
+}
+
+void RedisCache::localClear() {
+    if (!localCacheEnabled()) return;
+
+    for (auto& shard : local_shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        shard->entries.clear();
+        shard->lru.clear();
+    }
+}
+
 bool RedisCache::set(const std::string& key, const std::string& value) {
-    return retryOperation([&]() {
+    bool success = retryOperation([&]() {
         std::lock_guard<std::mutex> lock(redis_mutex_);
         if (!context_) return false;
-        
+
         redisReply* reply = (redisReply*)redisCommand(context_, "SET %s %s", key.c_str(), value.c_str());
-        bool success = checkReply(reply);
+        bool ok = checkReply(reply);
         freeReply(reply);
-        return success;
+        return ok;
     });
+    if (success) {
+        localPut(key, value, -1);
+    }
+    return success;
 }
 
 bool RedisCache::set(const std::string& key, const std::string& value, int ttl_seconds) {
-    return retryOperation([&]() {
+    bool success = retryOperation([&]() {
         std::lock_guard<std::mutex> lock(redis_mutex_);
         if (!context_) return false;
-        
-        redisReply* reply = (redisReply*)redisCommand(context_, "SETEX %s %d %s", 
+
+        redisReply* reply = (redisReply*)redisCommand(context_, "SETEX %s %d %s",
                                                        key.c_str(), ttl_seconds, value.c_str());
-        bool success = checkReply(reply);
+        bool ok = checkReply(reply);
         freeReply(reply);
-        return success;
+        return ok;
     });
+    if (success) {
+        localPut(key, value, ttl_seconds);
+    }
+    return success;
 }
 
 bool RedisCache::get(const std::string& key, std::string& value) {
-    return retryOperation([&]() {
+    // Hot keys are served from the in-process LRU; Redis is only a
+    // refresh source once the local entry expires
+    if (localGet(key, value)) {
+        return true;
+    }
+
+    bool found = retryOperation([&]() {
         std::lock_guard<std::mutex> lock(redis_mutex_);
         if (!context_) return false;
-        
+
         redisReply* reply = (redisReply*)redisCommand(context_, "GET %s", key.c_str());
         if (!reply || reply->type == REDIS_REPLY_NIL) {
             freeReply(reply);
             return false;
         }
-        
+
         if (reply->type == REDIS_REPLY_STRING) {
             value = std::string(reply->str, reply->len);
             freeReply(reply);
             return true;
         }
-        
+
         freeReply(reply);
         return false;
     });
+    if (found) {
+        localPut(key, value, -1);
+        return true;
+    }
+
+    // While the breaker has Redis marked down, an expired local entry is
+    // still the best answer available — serve the last-known-good value
+    // instead of reporting a miss for a key that probably exists
+    if (breaker_.state() != utils::CircuitBreaker::State::CLOSED) {
+        return localGet(key, value, /*allow_stale=*/true);
+    }
+    return false;
 }
 
 bool RedisCache::del(const std::string& key) {
+    localErase(key);
     return retryOperation([&]() {
         std::lock_guard<std::mutex> lock(redis_mutex_);
         if (!context_) return false;
-        
+
         redisReply* reply = (redisReply*)redisCommand(context_, "DEL %s", key.c_str());
         bool success = checkReply(reply);
         freeReply(reply);
@@ -139,6 +264,7 @@ bool RedisCache::exists(const std::string& key) {
 }
 
 bool RedisCache::expire(const std::string& key, int ttl_seconds) {
+    localErase(key);
     return retryOperation([&]() {
         std::lock_guard<std::mutex> lock(redis_mutex_);
         if (!context_) return false;
@@ -357,8 +483,8 @@ int RedisCache::llen(const std::string& key) {
 
 bool RedisCache::mset(const std::map<std::string, std::string>& keyvals) {
     if (keyvals.empty()) return true;
-    
-    return retryOperation([&]() {
+
+    bool success = retryOperation([&]() {
         std::lock_guard<std::mutex> lock(redis_mutex_);
         if (!context_) return false;
         
@@ -377,10 +503,16 @@ bool RedisCache::mset(const std::map<std::string, std::string>& keyvals) {
         }
         
         redisReply* reply = (redisReply*)redisCommandArgv(context_, argv.size(), argv.data(), argvlen.data());
-        bool success = checkReply(reply);
+        bool ok = checkReply(reply);
         freeReply(reply);
-        return success;
+        return ok;
     });
+    if (success) {
+        for (const auto& pair : keyvals) {
+            localPut(pair.first, pair.second, -1);
+        }
+    }
+    return success;
 }
 
 std::map<std::string, std::string> RedisCache::mget(const std::vector<std::string>& keys) {
@@ -440,6 +572,174 @@ std::vector<std::string> RedisCache::keys(const std::string& pattern) {
     return result;
 }
 
+std::map<std::string, std::string> RedisCache::getMany(const std::vector<std::string>& keys) {
+    std::map<std::string, std::string> result;
+    if (keys.empty()) return result;
+
+    auto batch = pipeline();
+    for (const auto& key : keys) {
+        batch.get(key);
+    }
+
+    auto replies = batch.execute();
+    for (size_t i = 0; i < replies.size() && i < keys.size(); ++i) {
+        if (replies[i].ok) {
+            result[keys[i]] = replies[i].value;
+        }
+    }
+
+    return result;
+}
+
+bool RedisCache::setMany(const std::map<std::string, std::string>& keyvals, int ttl_seconds) {
+    if (keyvals.empty()) return true;
+
+    // MSET cannot attach TTLs, so pipeline individual SET ... EX commands;
+    // the whole batch still costs a single round-trip
+    auto batch = pipeline();
+    for (const auto& pair : keyvals) {
+        batch.set(pair.first, pair.second, ttl_seconds);
+    }
+
+    auto replies = batch.execute();
+    if (replies.size() != keyvals.size()) {
+        return false;
+    }
+
+    for (const auto& reply : replies) {
+        if (!reply.ok) {
+            return false;
+        }
+    }
+
+    for (const auto& pair : keyvals) {
+        localPut(pair.first, pair.second, ttl_seconds);
+    }
+
+    return true;
+}
+
+RedisCache::Pipeline& RedisCache::Pipeline::get(const std::string& key) {
+    commands_.push_back({"GET", key});
+    return *this;
+}
+
+RedisCache::Pipeline& RedisCache::Pipeline::set(const std::string& key, const std::string& value, int ttl_seconds) {
+    if (ttl_seconds > 0) {
+        commands_.push_back({"SET", key, value, "EX", std::to_string(ttl_seconds)});
+    } else {
+        commands_.push_back({"SET", key, value});
+    }
+    return *this;
+}
+
+RedisCache::Pipeline& RedisCache::Pipeline::del(const std::string& key) {
+    commands_.push_back({"DEL", key});
+    return *this;
+}
+
+RedisCache::Pipeline& RedisCache::Pipeline::exists(const std::string& key) {
+    commands_.push_back({"EXISTS", key});
+    return *this;
+}
+
+RedisCache::Pipeline& RedisCache::Pipeline::expire(const std::string& key, int ttl_seconds) {
+    commands_.push_back({"EXPIRE", key, std::to_string(ttl_seconds)});
+    return *this;
+}
+
+std::vector<RedisCache::PipelineReply> RedisCache::Pipeline::execute() {
+    auto replies = cache_.executePipeline(commands_);
+    commands_.clear();
+    return replies;
+}
+
+std::vector<RedisCache::PipelineReply> RedisCache::executePipeline(const std::vector<std::vector<std::string>>& commands) {
+    std::vector<PipelineReply> results;
+    if (commands.empty()) return results;
+
+    // Pipelined writes bypass the single-key paths, so drop any local
+    // entries they touch before the batch goes out
+    for (const auto& command : commands) {
+        if (command.size() >= 2 &&
+            (command[0] == "SET" || command[0] == "DEL" || command[0] == "EXPIRE")) {
+            localErase(command[1]);
+        }
+    }
+
+    retryOperation([&]() {
+        std::lock_guard<std::mutex> lock(redis_mutex_);
+        if (!context_) return false;
+
+        results.clear();
+        results.reserve(commands.size());
+
+        // Queue all commands into the output buffer in one go
+        for (const auto& command : commands) {
+            std::vector<const char*> argv;
+            std::vector<size_t> argvlen;
+            argv.reserve(command.size());
+            argvlen.reserve(command.size());
+
+            for (const auto& arg : command) {
+                argv.push_back(arg.c_str());
+                argvlen.push_back(arg.length());
+            }
+
+            if (redisAppendCommandArgv(context_, argv.size(), argv.data(), argvlen.data()) != REDIS_OK) {
+                handleError("pipeline append");
+                return false;
+            }
+        }
+
+        // Flush and collect one reply per queued command
+        bool allOk = true;
+        for (size_t i = 0; i < commands.size(); ++i) {
+            redisReply* reply = nullptr;
+            if (redisGetReply(context_, (void**)&reply) != REDIS_OK) {
+                // Connection is broken mid-pipeline; drop it so the retry
+                // (or next operation) starts from a clean context
+                handleError("pipeline reply");
+                results.push_back(PipelineReply{});
+                allOk = false;
+                continue;
+            }
+
+            PipelineReply parsed;
+            if (reply) {
+                switch (reply->type) {
+                    case REDIS_REPLY_STRING:
+                        parsed.ok = true;
+                        parsed.value = std::string(reply->str, reply->len);
+                        break;
+                    case REDIS_REPLY_STATUS:
+                        parsed.ok = true;
+                        parsed.value = std::string(reply->str, reply->len);
+                        break;
+                    case REDIS_REPLY_INTEGER:
+                        parsed.ok = true;
+                        parsed.integer = reply->integer;
+                        break;
+                    case REDIS_REPLY_ERROR:
+                        parsed.value = std::string(reply->str, reply->len);
+                        allOk = false;
+                        break;
+                    case REDIS_REPLY_NIL:
+                    default:
+                        break;
+                }
+            }
+
+            results.push_back(parsed);
+            freeReply(reply);
+        }
+
+        return allOk;
+    });
+
+    return results;
+}
+
 int RedisCache::deletePattern(const std::string& pattern) {
     auto keys_to_delete = keys(pattern);
     int deleted = 0;
@@ -454,6 +754,7 @@ int RedisCache::deletePattern(const std::string& pattern) {
 }
 
 long long RedisCache::incr(const std::string& key) {
+    localErase(key);
     return retryOperation([&]() {
         std::lock_guard<std::mutex> lock(redis_mutex_);
         if (!context_) return 0LL;
@@ -469,6 +770,7 @@ long long RedisCache::incr(const std::string& key) {
 }
 
 long long RedisCache::incrby(const std::string& key, long long increment) {
+    localErase(key);
     return retryOperation([&]() {
         std::lock_guard<std::mutex> lock(redis_mutex_);
         if (!context_) return 0LL;
@@ -484,6 +786,7 @@ long long RedisCache::incrby(const std::string& key, long long increment) {
 }
 
 long long RedisCache::decr(const std::string& key) {
+    localErase(key);
     return retryOperation([&]() {
         std::lock_guard<std::mutex> lock(redis_mutex_);
         if (!context_) return 0LL;
@@ -499,6 +802,7 @@ long long RedisCache::decr(const std::string& key) {
 }
 
 long long RedisCache::decrby(const std::string& key, long long decrement) {
+    localErase(key);
     return retryOperation([&]() {
         std::lock_guard<std::mutex> lock(redis_mutex_);
         if (!context_) return 0LL;
@@ -523,6 +827,7 @@ bool RedisCache::invalidatePattern(const std::string& pattern) {
 
 bool RedisCache::flushAll() {
     LOG_WARN("RedisCache", "FLUSHALL called - clearing entire Redis cache!");
+    localClear();
     return retryOperation([&]() {
         std::lock_guard<std::mutex> lock(redis_mutex_);
         if (!context_) return false;
@@ -623,26 +928,40 @@ void RedisCache::freeReply(redisReply* reply) {
 
 template<typename Func>
 auto RedisCache::retryOperation(Func&& func) -> decltype(func()) {
+    // Fail fast while the circuit is open so a stalled Redis never costs
+    // callers the full timeout x retries budget
+    if (!breaker_.allowRequest()) {
+        return decltype(func())();
+    }
+
     for (int attempt = 0; attempt < config_.max_retries; ++attempt) {
         try {
             auto result = func();
             if (result || attempt == config_.max_retries - 1) {
+                // Judge backend health by the link, not the reply value:
+                // a NIL GET is a healthy interaction
+                if (isConnected()) {
+                    breaker_.recordSuccess();
+                } else {
+                    breaker_.recordFailure();
+                }
                 return result;
             }
         } catch (const std::exception& e) {
             LOG_WARN("RedisCache", "Operation failed (attempt " + std::to_string(attempt + 1) + "): " + e.what());
         }
-        
+
         // Exponential backoff
         int delay_ms = 100 * (1 << attempt);
         std::this_thread::sleep_for(std::chrono::milliseconds(delay_ms));
-        
+
         // Try to reconnect
         if (!isConnected()) {
             reconnect();
         }
     }
-    
+
+    breaker_.recordFailure();
     return decltype(func())();
 }
 
@@ -6,6 +6,9 @@
 
 namespace tapi {
 
+// Frames between prune passes over the per-track crossing state map
+static const uint64_t kCrossingStatePruneInterval = 300;
+
 // Implementation of the StringToPosition function
 Position StringToPosition(const std::string& posStr) {
     if (posStr == "TOP_LEFT") return Position::TOP_LEFT;
@@ -148,7 +151,8 @@ void LineZone::reset() {
     outCount_ = 0;
     inCountPerClass_.clear();
     outCountPerClass_.clear();
-    crossingStateHistory_.clear();
+    crossingStates_.clear();
+    frameCounter_ = 0;
     classIdToName_.clear();
 }
 
@@ -265,7 +269,20 @@ std::vector<Event> LineZone::processTracks(const std::vector<Track>& tracks) {
     if (tracks.empty()) {
         return crossingEvents; // No tracks to process
     }
-    
+
+    // Periodically prune state for tracks that haven't been observed in a
+    // while, so the state map stays bounded by the number of live tracks
+    frameCounter_++;
+    if (frameCounter_ % kCrossingStatePruneInterval == 0) {
+        for (auto it = crossingStates_.begin(); it != crossingStates_.end();) {
+            if (frameCounter_ - it->second.lastSeen > kCrossingStatePruneInterval) {
+                it = crossingStates_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
     // Convert tracks to detections for processing
     std::vector<Detection> detections;
     for (const auto& track : tracks) {
@@ -355,35 +372,31 @@ std::vector<Event> LineZone::processTracks(const std::vector<Track>& tracks) {
         
         int trackId = tracks[i].trackId;
         bool trackerState = hasAnyLeftTrigger[detIndex];
-        
-        auto& crossingHistory = crossingStateHistory_[trackId];
-        crossingHistory.push_back(trackerState);
-        
-        // Keep history at specified length
-        while (crossingHistory.size() > crossingHistoryLength_) {
-            crossingHistory.pop_front();
-        }
-        
-        // Need enough history to make a decision
-        if (crossingHistory.size() < crossingHistoryLength_) {
-            continue;
-        }
-        
-        // Get the oldest state and check if it's been consistent
-        bool oldestState = crossingHistory.front();
-        
-        // If the state appears more than once, it means there was no clean transition
-        size_t oldestStateCount = 0;
-        for (const auto& state : crossingHistory) {
-            if (state == oldestState) {
-                oldestStateCount++;
+
+        // Incremental crossing state machine: the old state window fired
+        // when its oldest entry differed from every newer one, i.e. when
+        // the side flipped and then stayed stable for
+        // crossingHistoryLength_ - 1 consecutive observations
+        auto& state = crossingStates_[trackId];
+        if (state.runLength == 0) {
+            // First observation for this track
+            state.side = trackerState;
+            state.runLength = 1;
+        } else if (trackerState == state.side) {
+            if (state.runLength < crossingHistoryLength_) {
+                state.runLength++;
             }
+        } else {
+            state.side = trackerState;
+            state.hasPreviousRun = true;
+            state.runLength = 1;
         }
-        
-        if (oldestStateCount > 1) {
+        state.lastSeen = frameCounter_;
+
+        if (!state.hasPreviousRun || state.runLength != crossingHistoryLength_ - 1) {
             continue; // No clean transition
         }
-        
+
         // Determine direction of crossing
         int classId = 0;
         try {
@@ -2,10 +2,24 @@
 #include <iostream>
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <chrono>
 
 namespace tapi {
 
+namespace {
+
+// Cell classifications for the rasterized zone mask
+constexpr uint8_t kMaskOutside = 0;
+constexpr uint8_t kMaskInside = 1;
+constexpr uint8_t kMaskBoundary = 2;
+
+// Upper bound on mask cells, so a misconfigured cell size cannot allocate
+// an unbounded grid
+constexpr int kMaskMaxCells = 1 << 22;
+
+} // namespace
+
 // Constructor
 PolygonZone::PolygonZone(const std::string& id,
                        const std::vector<cv::Point2f>& polygon,
@@ -15,8 +29,16 @@ PolygonZone::PolygonZone(const std::string& id,
     : id_(id),
       streamId_(streamId),
       polygon_(polygon),
+      maskEnabled_(false),
+      maskCellSize_(4),
+      maskOriginX_(0.0f),
+      maskOriginY_(0.0f),
+      maskSignature_(0),
       inCount_(0),
       outCount_(0),
+      entryDebounceFrames_(1),
+      exitDebounceFrames_(1),
+      minEventIntervalMs_(0),
       initialized_(false) {
           
     // Set up triggering anchors
@@ -55,17 +77,9 @@ bool PolygonZone::initialize() {
     }
     
     try {
-        // Calculate the frame resolution based on the polygon
-        int maxX = 0, maxY = 0;
-        for (const auto& point : polygon_) {
-            maxX = std::max(maxX, static_cast<int>(point.x));
-            maxY = std::max(maxY, static_cast<int>(point.y));
-        }
-        frameResolution_ = cv::Size(maxX + 2, maxY + 2);
-        
-        // Create the mask for point-in-polygon testing
-        createMask();
-        
+        // Build the preprocessed edge set for point-in-polygon testing
+        rebuildEdges();
+
         initialized_ = true;
         return true;
     } catch (const std::exception& e) {
@@ -83,6 +97,7 @@ void PolygonZone::reset() {
     inCountPerClass_.clear();
     outCountPerClass_.clear();
     zoneStateHistory_.clear();
+    trackStates_.clear();
     classIdToName_.clear();
 }
 
@@ -95,17 +110,9 @@ const std::vector<cv::Point2f>& PolygonZone::getPolygon() const {
 void PolygonZone::setPolygon(const std::vector<cv::Point2f>& polygon) {
 
     polygon_ = polygon;
-    
-    // Recalculate frame resolution and update mask
-    int maxX = 0, maxY = 0;
-    for (const auto& point : polygon_) {
-        maxX = std::max(maxX, static_cast<int>(point.x));
-        maxY = std::max(maxY, static_cast<int>(point.y));
-    }
-    frameResolution_ = cv::Size(maxX + 2, maxY + 2);
-        
-    // Create new mask
-    createMask();
+
+    // Rebuild the preprocessed edge set
+    rebuildEdges();
 }
 
 // Update polygon zone configuration
@@ -157,7 +164,31 @@ bool PolygonZone::updateConfig(const nlohmann::json& config) {
             std::lock_guard<std::mutex> lock(countMutex_);
             triggeringClasses_ = newTriggeringClasses;
         }
-        
+
+        // Check for debouncing configuration changes
+        if (config.contains("entry_debounce_frames")) {
+            entryDebounceFrames_ = std::max(1, config["entry_debounce_frames"].get<int>());
+        }
+
+        if (config.contains("exit_debounce_frames")) {
+            exitDebounceFrames_ = std::max(1, config["exit_debounce_frames"].get<int>());
+        }
+
+        if (config.contains("min_event_interval_ms")) {
+            minEventIntervalMs_ = std::max<int64_t>(0, config["min_event_interval_ms"].get<int64_t>());
+        }
+
+        // Rasterized containment mask settings
+        if (config.contains("use_zone_mask")) {
+            maskEnabled_ = config["use_zone_mask"].get<bool>();
+            maskSignature_ = 0; // force a rebuild with the new setting
+        }
+
+        if (config.contains("zone_mask_scale")) {
+            maskCellSize_ = std::max(1, config["zone_mask_scale"].get<int>());
+            maskSignature_ = 0;
+        }
+
         return true;
     } catch (const std::exception& e) {
         std::cerr << "Error updating polygon zone config: " << e.what() << std::endl;
@@ -167,25 +198,39 @@ bool PolygonZone::updateConfig(const nlohmann::json& config) {
 
 // Process tracks to detect zone entry/exit
 std::vector<Event> PolygonZone::processTracks(const std::vector<Track>& tracks) {
-    std::vector<Event> zoneEvents;
-    
     if (!initialized_) {
         if (!initialize()) {
-            return zoneEvents;
+            return {};
         }
     }
-    
+
     if (tracks.empty()) {
+        return {};
+    }
+
+    // Compute zone membership straight from the track buffer, then feed
+    // the precomputed-membership overload
+    std::vector<bool> inZone = computeAnchorsInZone(tracks);
+
+    return processTracks(tracks, inZone);
+}
+
+// Process tracks using precomputed zone membership
+std::vector<Event> PolygonZone::processTracks(const std::vector<Track>& tracks,
+                                              const std::vector<bool>& inZone) {
+    std::vector<Event> zoneEvents;
+
+    if (!initialized_ || tracks.empty() || inZone.size() != tracks.size()) {
         return zoneEvents;
     }
-    
-    // Convert tracks to detections for processing, filtering by class
-    std::vector<Detection> detections;
-    std::vector<size_t> trackIndices; // Keep track of original track indices
-    
+
+    // Update class ID to name mapping
+    updateClassIdToName(tracks);
+
+    // Check for zone entry/exit events
     for (size_t i = 0; i < tracks.size(); i++) {
         const auto& track = tracks[i];
-        
+
         // Filter by triggering classes if specified
         if (!triggeringClasses_.empty()) {
             bool classMatches = false;
@@ -199,64 +244,49 @@ std::vector<Event> PolygonZone::processTracks(const std::vector<Track>& tracks)
                 continue; // Skip this track as it's not in the triggering classes
             }
         }
-        
-        Detection det;
-        det.bbox = track.bbox;
-        det.confidence = track.confidence;
-        det.classId = track.classId;
-        det.className = track.className;
-        det.timestamp = track.timestamp;
-        detections.push_back(det);
-        trackIndices.push_back(i);
-    }
-    
-    // If no detections remain after filtering, return empty events
-    if (detections.empty()) {
-        return zoneEvents;
-    }
-    
-    // Compute which detections are in the zone
-    std::vector<bool> inZone = computeAnchorsInZone(detections);
-    
-    // Update class ID to name mapping
-    updateClassIdToName(detections);
-    
-    // Check for zone entry/exit events
-    for (size_t i = 0; i < detections.size(); i++) {
-        size_t originalTrackIndex = trackIndices[i];
-        const auto& track = tracks[originalTrackIndex];
-        
+
         int trackId = track.trackId;
         bool currentState = inZone[i];
-        
-        // Get previous state from history
-        bool previousState = false;
-        bool stateChanged = false;
-        
-        auto it = zoneStateHistory_.find(trackId);
-        if (it != zoneStateHistory_.end() && !it->second.empty()) {
-            previousState = it->second.back();
-            stateChanged = currentState != previousState;
-        } else {
-            // No history for this track, so initialize
-            zoneStateHistory_[trackId] = std::deque<bool>();
-        }
-        
-        // Update state history
-        zoneStateHistory_[trackId].push_back(currentState);
-        
+
+        // Update raw state history
+        auto& history = zoneStateHistory_[trackId];
+        history.push_back(currentState);
+
         // Keep history manageable
-        if (zoneStateHistory_[trackId].size() > 10) {
-            zoneStateHistory_[trackId].pop_front();
+        if (history.size() > 10) {
+            history.pop_front();
         }
-        
-        // Skip if state hasn't changed
-        if (!stateChanged && it != zoneStateHistory_.end()) {
+
+        // Debounced state machine: the raw membership flag must disagree
+        // with the confirmed state for the configured number of
+        // consecutive frames before the state flips and an event fires. A
+        // track flapping at the zone edge emits one entry/exit pair
+        // instead of a pair per frame.
+        auto& state = trackStates_[trackId];
+        if (currentState == state.inside) {
+            state.streak = 0;
             continue;
         }
-        
-        // If this is a new track or state changed, check for events
-        if (currentState && (it == zoneStateHistory_.end() || stateChanged)) {
+
+        state.streak++;
+        const int requiredFrames = currentState ? entryDebounceFrames_ : exitDebounceFrames_;
+        if (state.streak < requiredFrames) {
+            continue;
+        }
+
+        // Rate cap: hold the flip until the interval passes; the
+        // saturated streak retries on the next frame
+        int64_t eventTimestamp = getCurrentTimestamp();
+        if (minEventIntervalMs_ > 0 && state.lastEventMs > 0 &&
+            (eventTimestamp - state.lastEventMs) < minEventIntervalMs_) {
+            continue;
+        }
+
+        state.inside = currentState;
+        state.streak = 0;
+        state.lastEventMs = eventTimestamp;
+
+        if (currentState) {
             // Object entered the zone
             int classId = 0;
             try {
@@ -267,7 +297,7 @@ std::vector<Event> PolygonZone::processTracks(const std::vector<Track>& tracks)
             
             // Create zone entry event
             Event zoneEvent;
-            zoneEvent.timestamp = getCurrentTimestamp();
+            zoneEvent.timestamp = eventTimestamp;
             zoneEvent.objectId = std::to_string(trackId);
             zoneEvent.className = track.className;
             
@@ -297,7 +327,7 @@ std::vector<Event> PolygonZone::processTracks(const std::vector<Track>& tracks)
                 zoneEvent.metadata["current_count"] = std::to_string(inCount_ - outCount_);
                 zoneEvents.push_back(zoneEvent);
             } // Lock released here
-        } else if (!currentState && stateChanged) {
+        } else {
             // Object exited the zone
             int classId = 0;
             try {
@@ -308,7 +338,7 @@ std::vector<Event> PolygonZone::processTracks(const std::vector<Track>& tracks)
             
             // Create zone exit event
             Event zoneEvent;
-            zoneEvent.timestamp = getCurrentTimestamp();
+            zoneEvent.timestamp = eventTimestamp;
             zoneEvent.objectId = std::to_string(trackId);
             zoneEvent.className = track.className;
             
@@ -347,110 +377,222 @@ std::vector<Event> PolygonZone::processTracks(const std::vector<Track>& tracks)
     return zoneEvents;
 }
 
-// Create mask from polygon for efficient point-in-polygon testing
-void PolygonZone::createMask() {
+// Rebuild the preprocessed edge set used for point-in-polygon testing
+void PolygonZone::rebuildEdges() {
+    edges_.build(polygon_);
+}
 
-    mask_ = cv::Mat::zeros(frameResolution_, CV_8UC1);
-    
-    // Convert floating point polygon to integer polygon for drawing
-    std::vector<cv::Point> intPolygon;
-    for (const auto& pt : polygon_) {
-        intPolygon.push_back(cv::Point(static_cast<int>(pt.x), static_cast<int>(pt.y)));
+// Hash the vertex set; cheap enough to evaluate per frame and stable across
+// the manager's normalized/pixel polygon swaps
+uint64_t PolygonZone::polygonSignature() const {
+    uint64_t hash = 1469598103934665603ull;
+    for (const auto& p : polygon_) {
+        uint32_t bits;
+        std::memcpy(&bits, &p.x, sizeof(bits));
+        hash = (hash ^ bits) * 1099511628211ull;
+        std::memcpy(&bits, &p.y, sizeof(bits));
+        hash = (hash ^ bits) * 1099511628211ull;
     }
-    
-    std::vector<std::vector<cv::Point>> polygons = {intPolygon};
-    cv::fillPoly(mask_, polygons, cv::Scalar(255));
-    
+    return hash ^ polygon_.size();
 }
 
-// Check if detections are in the zone
-std::vector<bool> PolygonZone::computeAnchorsInZone(const std::vector<Detection>& detections) const {
-    std::vector<bool> isInZone(detections.size(), false);
-    
-    if (detections.empty() || !initialized_) {
+// Rasterize the current polygon into the downsampled containment mask
+void PolygonZone::rebuildMask() const {
+    mask_.release();
+    maskSignature_ = 0;
+
+    if (polygon_.size() < 3) {
+        return;
+    }
+
+    float minX = polygon_[0].x, maxX = polygon_[0].x;
+    float minY = polygon_[0].y, maxY = polygon_[0].y;
+    for (const auto& p : polygon_) {
+        minX = std::min(minX, p.x);
+        maxX = std::max(maxX, p.x);
+        minY = std::min(minY, p.y);
+        maxY = std::max(maxY, p.y);
+    }
+
+    const float cell = static_cast<float>(maskCellSize_);
+
+    // One spare cell on every side so the boundary dilation below has room
+    maskOriginX_ = minX - cell;
+    maskOriginY_ = minY - cell;
+    const int gridW = static_cast<int>((maxX - maskOriginX_) / cell) + 2;
+    const int gridH = static_cast<int>((maxY - maskOriginY_) / cell) + 2;
+
+    // Degenerate or absurd grids (e.g. normalized coordinates before the
+    // first frame arrives) leave the mask empty; containment falls back to
+    // the exact edge test
+    if (gridW < 3 || gridH < 3 || gridW > kMaskMaxCells / gridH) {
+        return;
+    }
+
+    std::vector<cv::Point> scaled;
+    scaled.reserve(polygon_.size());
+    for (const auto& p : polygon_) {
+        scaled.emplace_back(
+            static_cast<int>(std::lround((p.x - maskOriginX_) / cell)),
+            static_cast<int>(std::lround((p.y - maskOriginY_) / cell)));
+    }
+
+    cv::Mat filled = cv::Mat::zeros(gridH, gridW, CV_8U);
+    const std::vector<std::vector<cv::Point>> polys = {scaled};
+    cv::fillPoly(filled, polys, cv::Scalar(1));
+
+    // A one-cell dilation/erosion brackets the true edge (and the half-cell
+    // vertex quantization above): cells the dilated raster misses are
+    // definitely outside, cells the eroded raster keeps are definitely
+    // inside, and the ring in between is re-tested exactly
+    cv::Mat dilated, eroded;
+    cv::dilate(filled, dilated, cv::Mat());
+    cv::erode(filled, eroded, cv::Mat());
+
+    mask_ = cv::Mat(gridH, gridW, CV_8U, cv::Scalar(kMaskBoundary));
+    mask_.setTo(kMaskOutside, dilated == 0);
+    mask_.setTo(kMaskInside, eroded == 1);
+
+    maskSignature_ = polygonSignature();
+}
+
+// Shared anchor-in-zone kernel: only the bounding box of each item is
+// read, so Detection and Track buffers use the same code path
+template <typename BoxedItem>
+std::vector<bool> PolygonZone::anchorsInZoneImpl(const std::vector<BoxedItem>& items) const {
+    std::vector<bool> isInZone(items.size(), false);
+
+    if (items.empty() || !initialized_ || edges_.empty()) {
         return isInZone;
     }
-    
 
-    
-    // Process each detection
-    for (size_t i = 0; i < detections.size(); i++) {
-        const auto& bbox = detections[i].bbox;
-        
-        
-        // Get anchor points for this bounding box
-        std::vector<cv::Point> anchorPoints;
+    const size_t numAnchors = triggeringAnchors_.size();
+
+    // Pack every anchor point of every item into SoA arrays, then test
+    // them all against the polygon with one vectorized kernel call
+    PackedPoints anchorPoints;
+    anchorPoints.reserve(items.size() * numAnchors);
+
+    for (size_t i = 0; i < items.size(); i++) {
+        const auto& bbox = items[i].bbox;
+
         for (const auto& anchorPos : triggeringAnchors_) {
             switch (anchorPos) {
                 case Position::TOP_LEFT:
-                    anchorPoints.emplace_back(bbox.x, bbox.y);
+                    anchorPoints.add(bbox.x, bbox.y);
                     break;
                 case Position::TOP_RIGHT:
-                    anchorPoints.emplace_back(bbox.x + bbox.width, bbox.y);
+                    anchorPoints.add(bbox.x + bbox.width, bbox.y);
                     break;
                 case Position::BOTTOM_LEFT:
-                    anchorPoints.emplace_back(bbox.x, bbox.y + bbox.height);
+                    anchorPoints.add(bbox.x, bbox.y + bbox.height);
                     break;
                 case Position::BOTTOM_RIGHT:
-                    anchorPoints.emplace_back(bbox.x + bbox.width, bbox.y + bbox.height);
+                    anchorPoints.add(bbox.x + bbox.width, bbox.y + bbox.height);
                     break;
                 case Position::CENTER:
-                    anchorPoints.emplace_back(bbox.x + bbox.width / 2, bbox.y + bbox.height / 2);
+                    anchorPoints.add(bbox.x + bbox.width / 2, bbox.y + bbox.height / 2);
                     break;
                 case Position::TOP_CENTER:
-                    anchorPoints.emplace_back(bbox.x + bbox.width / 2, bbox.y);
+                    anchorPoints.add(bbox.x + bbox.width / 2, bbox.y);
                     break;
                 case Position::BOTTOM_CENTER:
-                    anchorPoints.emplace_back(bbox.x + bbox.width / 2, bbox.y + bbox.height);
+                    anchorPoints.add(bbox.x + bbox.width / 2, bbox.y + bbox.height);
                     break;
                 case Position::CENTER_LEFT:
-                    anchorPoints.emplace_back(bbox.x, bbox.y + bbox.height / 2);
+                    anchorPoints.add(bbox.x, bbox.y + bbox.height / 2);
                     break;
                 case Position::CENTER_RIGHT:
-                    anchorPoints.emplace_back(bbox.x + bbox.width, bbox.y + bbox.height / 2);
+                    anchorPoints.add(bbox.x + bbox.width, bbox.y + bbox.height / 2);
                     break;
                 default:
                     // For CENTER_OF_MASS or any other case, use center
-                    anchorPoints.emplace_back(bbox.x + bbox.width / 2, bbox.y + bbox.height / 2);
+                    anchorPoints.add(bbox.x + bbox.width / 2, bbox.y + bbox.height / 2);
                     break;
             }
         }
-        
-        // Check if all anchor points are inside the polygon
-        bool allAnchorsInZone = true;
-        for (size_t j = 0; j < anchorPoints.size(); ++j) {
-            const auto& point = anchorPoints[j];
-            
-            // Check if point is within image boundaries
-            if (point.x < 0 || point.y < 0 || 
-                point.x >= frameResolution_.width || point.y >= frameResolution_.height) {
-                allAnchorsInZone = false;
-                break;
+    }
+
+    std::vector<uint8_t> inside;
+
+    if (maskEnabled_ && (mask_.empty() || maskSignature_ != polygonSignature())) {
+        // The polygon changed since the mask was built (zone edit or
+        // resolution change); rebuild before testing
+        rebuildMask();
+    }
+
+    if (maskEnabled_ && !mask_.empty()) {
+        // One cell load per point; only boundary cells need the exact test
+        const size_t total = anchorPoints.size();
+        inside.assign(total, 0);
+
+        PackedPoints boundaryPoints;
+        std::vector<size_t> boundaryIndices;
+        const float invCell = 1.0f / static_cast<float>(maskCellSize_);
+
+        for (size_t p = 0; p < total; p++) {
+            const int cx = static_cast<int>((anchorPoints.x[p] - maskOriginX_) * invCell);
+            const int cy = static_cast<int>((anchorPoints.y[p] - maskOriginY_) * invCell);
+            if (cx < 0 || cy < 0 || cx >= mask_.cols || cy >= mask_.rows) {
+                continue; // outside the bounding box means outside the zone
             }
-            
-            // Check if point is inside polygon using the mask
-            try {
-                bool insidePolygon = mask_.at<uchar>(point.y, point.x) > 0;
-                
-                if (!insidePolygon) {
-                    allAnchorsInZone = false;
-                    break;
-                }
-            } catch (const std::exception& e) {
-                std::cerr << "Error checking if point is inside polygon: " << e.what() 
-                         << " at point (" << point.x << "," << point.y << ")" << std::endl;
+            const uint8_t cellState = mask_.at<uint8_t>(cy, cx);
+            if (cellState == kMaskInside) {
+                inside[p] = 1;
+            } else if (cellState == kMaskBoundary) {
+                boundaryIndices.push_back(p);
+                boundaryPoints.add(anchorPoints.x[p], anchorPoints.y[p]);
+            }
+        }
+
+        if (!boundaryIndices.empty()) {
+            std::vector<uint8_t> boundaryInside;
+            edges_.testPoints(boundaryPoints, boundaryInside);
+            for (size_t j = 0; j < boundaryIndices.size(); j++) {
+                inside[boundaryIndices[j]] = boundaryInside[j];
+            }
+        }
+    } else {
+        edges_.testPoints(anchorPoints, inside);
+    }
+
+    // An item is in the zone only if all of its anchor points are inside
+    for (size_t i = 0; i < items.size(); i++) {
+        bool allAnchorsInZone = true;
+        for (size_t j = 0; j < numAnchors; j++) {
+            if (!inside[i * numAnchors + j]) {
                 allAnchorsInZone = false;
                 break;
             }
         }
-        
         isInZone[i] = allAnchorsInZone;
-        
     }
-    
+
     return isInZone;
 }
 
+// Check if detections are in the zone
+std::vector<bool> PolygonZone::computeAnchorsInZone(const std::vector<Detection>& detections) const {
+    return anchorsInZoneImpl(detections);
+}
+
+// Check if tracks are in the zone (no Detection conversion needed)
+std::vector<bool> PolygonZone::computeAnchorsInZone(const std::vector<Track>& tracks) const {
+    return anchorsInZoneImpl(tracks);
+}
+
+// Update class ID to name mapping from tracks
+void PolygonZone::updateClassIdToName(const std::vector<Track>& tracks) {
+    for (const auto& track : tracks) {
+        try {
+            int classId = std::stoi(track.classId);
+            classIdToName_[classId] = track.className;
+        } catch (...) {
+            // Skip if class ID is not an integer
+        }
+    }
+}
+
 // Update class ID to name mapping
 void PolygonZone::updateClassIdToName(const std::vector<Detection>& detections) {
     for (const auto& detection : detections) {
@@ -5,7 +5,7 @@
 namespace tapi {
 
 GlobalConfig::GlobalConfig()
-    : aiServerUrl_("http://localhost:8000"), useSharedMemory_(false), port_(8080) {
+    : settings_(std::make_shared<const Settings>()) {
 }
 
 GlobalConfig& GlobalConfig::getInstance() {
@@ -13,120 +13,98 @@ GlobalConfig& GlobalConfig::getInstance() {
     return instance;
 }
 
+std::shared_ptr<const GlobalConfig::Settings> GlobalConfig::snapshot() const {
+    return std::atomic_load_explicit(&settings_, std::memory_order_acquire);
+}
+
+void GlobalConfig::publish(Settings settings) {
+    std::atomic_store_explicit(&settings_,
+                               std::shared_ptr<const Settings>(std::make_shared<Settings>(std::move(settings))),
+                               std::memory_order_release);
+}
+
 bool GlobalConfig::initialize(const std::string& aiServerUrl, bool useSharedMemory, int port) {
     std::lock_guard<std::mutex> lock(mutex_);
-    
+
+    Settings settings = *snapshot();
+
     // Check environment variables first - they take highest precedence
     const char* envServerUrl = getenv("AI_SERVER_URL");
     if (envServerUrl && strlen(envServerUrl) > 0) {
-        aiServerUrl_ = envServerUrl;
-        LOG_INFO("GlobalConfig", "Using AI server URL from environment: " + aiServerUrl_);
+        settings.aiServerUrl = envServerUrl;
+        LOG_INFO("GlobalConfig", "Using AI server URL from environment: " + settings.aiServerUrl);
     } else {
         // Try alternative environment variable names as fallback
         envServerUrl = getenv("SERVER_URL");
         if (envServerUrl && strlen(envServerUrl) > 0) {
-            aiServerUrl_ = envServerUrl;
-            LOG_INFO("GlobalConfig", "Using SERVER_URL from environment: " + aiServerUrl_);
+            settings.aiServerUrl = envServerUrl;
+            LOG_INFO("GlobalConfig", "Using SERVER_URL from environment: " + settings.aiServerUrl);
         } else {
             // Use the provided URL from command line or default value
-            aiServerUrl_ = aiServerUrl;
-            LOG_INFO("GlobalConfig", "Using AI server URL from command line: " + aiServerUrl_);
+            settings.aiServerUrl = aiServerUrl;
+            LOG_INFO("GlobalConfig", "Using AI server URL from command line: " + settings.aiServerUrl);
         }
     }
-    
+
     // Check environment variable for shared memory setting
     const char* envSharedMem = getenv("USE_SHARED_MEMORY");
     if (envSharedMem && (std::string(envSharedMem) == "1" || std::string(envSharedMem) == "true")) {
-        useSharedMemory_ = true;
+        settings.useSharedMemory = true;
         LOG_INFO("GlobalConfig", "Using shared memory setting from environment: true");
     } else {
         // Use the provided value from command line or default value
-        useSharedMemory_ = useSharedMemory;
-        LOG_INFO("GlobalConfig", "Using shared memory setting from command line: " + std::string(useSharedMemory_ ? "true" : "false"));
+        settings.useSharedMemory = useSharedMemory;
+        LOG_INFO("GlobalConfig", "Using shared memory setting from command line: " + std::string(settings.useSharedMemory ? "true" : "false"));
     }
-    
+
     // Set environment variable for components that check it directly
-    if (useSharedMemory_) {
+    if (settings.useSharedMemory) {
         setenv("USE_SHARED_MEMORY", "1", 1); // overwrite existing value if any
     } else {
         unsetenv("USE_SHARED_MEMORY");
     }
-    
+
     // Set port from command line
-    port_ = port;
-    LOG_INFO("GlobalConfig", "Using port: " + std::to_string(port_));
-    
+    settings.port = port;
+    LOG_INFO("GlobalConfig", "Using port: " + std::to_string(settings.port));
+
+    publish(settings);
+
     // Store the configuration in the ConfigManager for persistence
     // Only do this if ConfigManager is initialized to avoid errors
     if (ConfigManager::getInstance().isReady()) {
-        ConfigManager::getInstance().setConfig("ai_server_url", aiServerUrl_);
-        ConfigManager::getInstance().setConfig("use_shared_memory", useSharedMemory_);
-        ConfigManager::getInstance().setConfig("port", port_);
+        ConfigManager::getInstance().setConfig("ai_server_url", settings.aiServerUrl);
+        ConfigManager::getInstance().setConfig("use_shared_memory", settings.useSharedMemory);
+        ConfigManager::getInstance().setConfig("port", settings.port);
         LOG_INFO("GlobalConfig", "Updated ConfigManager with current global settings");
     }
-    
+
     return true;
 }
 
 std::string GlobalConfig::getAiServerUrl() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    
-    // Always check environment variables first - they take highest precedence
-    const char* envServerUrl = getenv("AI_SERVER_URL");
-    if (envServerUrl && strlen(envServerUrl) > 0) {
-        LOG_INFO("GlobalConfig", "getAiServerUrl: Using value from AI_SERVER_URL env: " + std::string(envServerUrl));
-        return envServerUrl;
-    }
-    
-    // Try alternative environment variable names as fallback
-    envServerUrl = getenv("SERVER_URL");
-    if (envServerUrl && strlen(envServerUrl) > 0) {
-        LOG_INFO("GlobalConfig", "getAiServerUrl: Using value from SERVER_URL env: " + std::string(envServerUrl));
-        return envServerUrl;
-    }
-    
-    // Check ConfigManager for stored value - this takes precedence over the member variable
-    // because it could have been updated through the API
-    // Only check ConfigManager if it's initialized
-    if (ConfigManager::getInstance().isReady()) {
-        auto configValue = ConfigManager::getInstance().getConfig("ai_server_url");
-        
-        // BUG FIX: Check if configValue itself has an "ai_server_url" field
-        // This is what the API returns from the config endpoint
-        if (!configValue.empty()) {
-            if (configValue.is_string()) {
-                LOG_INFO("GlobalConfig", "getAiServerUrl: Using string value from ConfigManager: " + configValue.get<std::string>());
-                return configValue.get<std::string>();
-            } 
-            else if (configValue.is_object() && configValue.contains("ai_server_url") && configValue["ai_server_url"].is_string()) {
-                std::string configUrl = configValue["ai_server_url"].get<std::string>();
-                LOG_INFO("GlobalConfig", "getAiServerUrl: Using value from ConfigManager object: " + configUrl);
-                return configUrl;
-            }
-        }
-    } else {
-        LOG_INFO("GlobalConfig", "getAiServerUrl: ConfigManager not ready, skipping config check");
-    }
-    
-    // Otherwise return the stored value
-    LOG_INFO("GlobalConfig", "getAiServerUrl: Using value from instance variable: " + aiServerUrl_);
-    return aiServerUrl_;
+    // Environment and ConfigManager precedence is resolved when the
+    // snapshot is built (initialize() and the setters), so hot-path
+    // readers pay a single atomic load instead of env lookups and
+    // database-backed config reads per call
+    return snapshot()->aiServerUrl;
 }
 
 bool GlobalConfig::getUseSharedMemory() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return useSharedMemory_;
+    return snapshot()->useSharedMemory;
 }
 
 int GlobalConfig::getPort() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return port_;
+    return snapshot()->port;
 }
 
 void GlobalConfig::setAiServerUrl(const std::string& url) {
     std::lock_guard<std::mutex> lock(mutex_);
-    aiServerUrl_ = url;
-    
+
+    Settings settings = *snapshot();
+    settings.aiServerUrl = url;
+    publish(std::move(settings));
+
     // Also update in ConfigManager for persistence
     ConfigManager::getInstance().setConfig("ai_server_url", url);
     LOG_INFO("GlobalConfig", "AI server URL updated to: " + url);
@@ -134,15 +112,18 @@ void GlobalConfig::setAiServerUrl(const std::string& url) {
 
 void GlobalConfig::setUseSharedMemory(bool use) {
     std::lock_guard<std::mutex> lock(mutex_);
-    useSharedMemory_ = use;
-    
+
+    Settings settings = *snapshot();
+    settings.useSharedMemory = use;
+    publish(std::move(settings));
+
     // Update environment variable
     if (use) {
         setenv("USE_SHARED_MEMORY", "1", 1);
     } else {
         unsetenv("USE_SHARED_MEMORY");
     }
-    
+
     // Also update in ConfigManager for persistence
     ConfigManager::getInstance().setConfig("use_shared_memory", use);
     LOG_INFO("GlobalConfig", "Use shared memory updated to: " + std::string(use ? "true" : "false"));
@@ -150,11 +131,14 @@ void GlobalConfig::setUseSharedMemory(bool use) {
 
 void GlobalConfig::setPort(int port) {
     std::lock_guard<std::mutex> lock(mutex_);
-    port_ = port;
-    
+
+    Settings settings = *snapshot();
+    settings.port = port;
+    publish(std::move(settings));
+
     // Also update in ConfigManager for persistence
     ConfigManager::getInstance().setConfig("port", port);
     LOG_INFO("GlobalConfig", "Port updated to: " + std::to_string(port));
 }
 
-} // namespace tapi 
\ No newline at end of file
+} // namespace tapi
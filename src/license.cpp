@@ -312,6 +312,8 @@ std::string sinkTypeToString(SinkType type) {
             return "websocket";
         case SinkType::MQTT:
             return "mqtt";
+        case SinkType::SHM_EXPORT:
+            return "shm_export";
         default:
             return "unknown";
     }
@@ -335,6 +337,8 @@ SinkType stringToSinkType(const std::string& typeStr) {
         return SinkType::WEBSOCKET;
     } else if (typeStr == "mqtt") {
         return SinkType::MQTT;
+    } else if (typeStr == "shm_export") {
+        return SinkType::SHM_EXPORT;
     }
     
     LOG_ERROR("License", "Unknown sink type: " + typeStr);
@@ -375,6 +379,7 @@ ComponentPermissionHelper::ComponentPermissionHelper() {
     sinkPermissions_[SinkType::DATABASE] = {false, false, false, true};
     sinkPermissions_[SinkType::WEBSOCKET] = {false, false, false, true};
     sinkPermissions_[SinkType::MQTT] = {false, false, false, true};
+    sinkPermissions_[SinkType::SHM_EXPORT] = {false, true, true, true};
 }
 
 bool ComponentPermissionHelper::isComponentAllowed(
@@ -1,11 +1,17 @@
 #include <iostream>
 #include <memory>
 #include <csignal>
+#include <string>
+#include <vector>
 #include <boost/program_options.hpp>
 #include "api.h"
 #include "logger.h"
 #include "config_manager.h"
 #include "global_config.h"
+#include "utils/thread_affinity.h"
+#include "shard_supervisor.h"
+#include "camera_manager.h"
+#include "state_snapshot_service.h"
 
 namespace po = boost::program_options;
 using namespace tapi;
@@ -73,7 +79,10 @@ int main(int argc, char* argv[]) {
         ("log-level", po::value<std::string>()->default_value("info"), "Log level (trace, debug, info, warn, error, fatal, off)")
         ("log-file", po::value<std::string>(), "Log file path")
         ("ai-server-url", po::value<std::string>()->default_value("http://localhost:8000"), "URL for the AI server")
-        ("use-shared-memory", po::value<bool>()->default_value(false), "Use shared memory for communicating with Triton server (requires shared memory configuration)");
+        ("use-shared-memory", po::value<bool>()->default_value(false), "Use shared memory for communicating with Triton server (requires shared memory configuration)")
+        ("shard-workers", po::value<int>()->default_value(0), "Run as supervisor with N worker processes, each hosting a camera shard on port+1..port+N (0 = single process)")
+        ("shard-index", po::value<int>()->default_value(-1), "Shard owned by this worker (set by the supervisor)")
+        ("shard-count", po::value<int>()->default_value(1), "Total shard count (set by the supervisor)");
     
     po::variables_map vm;
     try {
@@ -110,9 +119,51 @@ int main(int argc, char* argv[]) {
         LOG_INFO("Main", "Logging to file: " + logFilePath);
     }
     
+    // Shard mode: this process becomes the supervisor and each worker is
+    // a fresh copy of the binary owning one camera shard on its own port
+    // (see shard_supervisor.h). A worker crash costs that shard only.
+    int shardWorkers = vm["shard-workers"].as<int>();
+    if (shardWorkers > 0) {
+        std::vector<std::vector<std::string>> workerArgs;
+        for (int i = 0; i < shardWorkers; ++i) {
+            std::vector<std::string> args = {
+                "--port", std::to_string(port + 1 + i),
+                "--shard-index", std::to_string(i),
+                "--shard-count", std::to_string(shardWorkers),
+                "--license-key", licenseKey,
+                "--ai-server-url", aiServerUrl,
+                "--use-shared-memory", useSharedMemory ? "1" : "0",
+                "--log-level", vm["log-level"].as<std::string>(),
+            };
+            if (vm.count("log-file")) {
+                args.push_back("--log-file");
+                args.push_back(vm["log-file"].as<std::string>() + "." + std::to_string(i));
+            }
+            workerArgs.push_back(std::move(args));
+        }
+        LOG_INFO("Main", "Starting shard supervisor with " +
+                 std::to_string(shardWorkers) + " workers on ports " +
+                 std::to_string(port + 1) + "-" + std::to_string(port + shardWorkers));
+        return runShardSupervisor(argv[0], workerArgs);
+    }
+
+    int shardIndex = vm["shard-index"].as<int>();
+    int shardCount = vm["shard-count"].as<int>();
+    if (shardIndex >= 0 && shardCount > 1) {
+        CameraManager::getInstance().setShardPolicy(shardIndex, shardCount);
+        LOG_INFO("Main", "Running as shard worker " + std::to_string(shardIndex) +
+                 " of " + std::to_string(shardCount));
+    }
+
     LOG_INFO("Main", "Starting tAPI on port " + std::to_string(port));
     LOG_INFO("Main", "Log level set to: " + vm["log-level"].as<std::string>());
     
+    // Keep API serving off the pipeline cores when a placement policy is
+    // configured: Crow workers are spawned from this thread and inherit
+    // the mask, while pipeline threads pin themselves to their own group
+    // (see utils/thread_affinity.h)
+    utils::ThreadAffinity::pinApiThread("main");
+
     try {
         // Initialize global configuration
         if (!GlobalConfig::getInstance().initialize(aiServerUrl, useSharedMemory, port)) {
@@ -139,11 +190,19 @@ int main(int argc, char* argv[]) {
             LOG_WARN("Main", "Failed to load saved configurations, starting with empty state");
         }
         
+        // With the components recreated, feed back the last counter
+        // snapshot and start taking new ones; a crash now costs at most
+        // one snapshot interval of zone counting
+        StateSnapshotService::getInstance().restore();
+        StateSnapshotService::getInstance().start();
+
         LOG_INFO("Main", "Vision pipeline system initialized and ready");
 
         // Start the server in multithreaded mode for concurrent request handling
         apiServer->start(true);
-        
+
+        StateSnapshotService::getInstance().stop();
+
     } catch (const std::exception& e) {
         LOG_FATAL("Main", std::string("Fatal error: ") + e.what());
         return 1;
@@ -0,0 +1,314 @@
+#include "mjpeg_streamer.h"
+#include "camera_manager.h"
+#include "logger.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <string_view>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace tapi {
+
+// Multipart boundary used between JPEG parts
+static const char* MJPEG_BOUNDARY = "tapiframe";
+
+// How long a client loop sleeps between cache polls while waiting for a
+// new frame generation
+static const int FRAME_POLL_INTERVAL_MS = 5;
+
+MjpegStreamer::MjpegStreamer(int port)
+    : port_(port), listenFd_(-1), running_(false) {
+}
+
+MjpegStreamer::~MjpegStreamer() {
+    stop();
+}
+
+bool MjpegStreamer::start() {
+    if (running_) {
+        return true;
+    }
+
+    listenFd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd_ < 0) {
+        LOG_ERROR("MjpegStreamer", "Failed to create listen socket: " + std::string(strerror(errno)));
+        return false;
+    }
+
+    int reuse = 1;
+    setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(static_cast<uint16_t>(port_));
+
+    if (::bind(listenFd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+        LOG_ERROR("MjpegStreamer", "Failed to bind port " + std::to_string(port_) + ": " + std::string(strerror(errno)));
+        ::close(listenFd_);
+        listenFd_ = -1;
+        return false;
+    }
+
+    if (::listen(listenFd_, 16) < 0) {
+        LOG_ERROR("MjpegStreamer", "Failed to listen on port " + std::to_string(port_) + ": " + std::string(strerror(errno)));
+        ::close(listenFd_);
+        listenFd_ = -1;
+        return false;
+    }
+
+    running_ = true;
+    acceptThread_ = std::thread(&MjpegStreamer::acceptLoop, this);
+
+    LOG_INFO("MjpegStreamer", "MJPEG streaming server listening on port " + std::to_string(port_));
+    return true;
+}
+
+void MjpegStreamer::stop() {
+    if (!running_) {
+        return;
+    }
+
+    running_ = false;
+
+    // Closing the listen socket unblocks accept()
+    if (listenFd_ >= 0) {
+        ::shutdown(listenFd_, SHUT_RDWR);
+        ::close(listenFd_);
+        listenFd_ = -1;
+    }
+
+    if (acceptThread_.joinable()) {
+        acceptThread_.join();
+    }
+
+    // Client loops observe running_ within one frame interval
+    std::vector<ClientWorker> clients;
+    {
+        std::lock_guard<std::mutex> lock(clientsMutex_);
+        clients.swap(clients_);
+    }
+    for (auto& client : clients) {
+        if (client.thread.joinable()) {
+            client.thread.join();
+        }
+    }
+
+    LOG_INFO("MjpegStreamer", "MJPEG streaming server stopped");
+}
+
+int MjpegStreamer::getPort() const {
+    return port_;
+}
+
+void MjpegStreamer::acceptLoop() {
+    while (running_) {
+        sockaddr_in clientAddr;
+        socklen_t clientLen = sizeof(clientAddr);
+        int clientFd = ::accept(listenFd_, reinterpret_cast<sockaddr*>(&clientAddr), &clientLen);
+
+        // Reap writers that have finished so reconnecting viewers don't
+        // accumulate joinable threads for the server's lifetime
+        reapFinishedClients();
+
+        if (clientFd < 0) {
+            if (running_) {
+                LOG_WARN("MjpegStreamer", "accept() failed: " + std::string(strerror(errno)));
+            }
+            continue;
+        }
+
+        // Disable Nagle so each frame is pushed out immediately
+        int noDelay = 1;
+        setsockopt(clientFd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+        auto done = std::make_shared<std::atomic<bool>>(false);
+        std::lock_guard<std::mutex> lock(clientsMutex_);
+        clients_.push_back(ClientWorker{
+            std::thread([this, clientFd, done] {
+                handleClient(clientFd);
+                done->store(true, std::memory_order_release);
+            }),
+            done});
+    }
+}
+
+void MjpegStreamer::reapFinishedClients() {
+    std::lock_guard<std::mutex> lock(clientsMutex_);
+    for (auto it = clients_.begin(); it != clients_.end();) {
+        if (it->done->load(std::memory_order_acquire)) {
+            if (it->thread.joinable()) {
+                it->thread.join();
+            }
+            it = clients_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+// Send the full buffer, returning false on any socket error
+static bool sendAll(int fd, const char* data, size_t length) {
+    size_t sent = 0;
+    while (sent < length) {
+        ssize_t n = ::send(fd, data + sent, length - sent, MSG_NOSIGNAL);
+        if (n <= 0) {
+            return false;
+        }
+        sent += static_cast<size_t>(n);
+    }
+    return true;
+}
+
+// Extract a numeric query parameter from a request path, clamped to a range
+static int queryParam(const std::string& path, const std::string& name, int defaultValue, int minValue, int maxValue) {
+    auto pos = path.find(name + "=");
+    if (pos == std::string::npos) {
+        return defaultValue;
+    }
+    try {
+        int value = std::stoi(path.substr(pos + name.size() + 1));
+        return std::max(minValue, std::min(maxValue, value));
+    } catch (...) {
+        return defaultValue;
+    }
+}
+
+void MjpegStreamer::handleClient(int clientFd) {
+    // Read the request head; only the request line matters here
+    std::string request;
+    char buffer[2048];
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < 16384) {
+        ssize_t n = ::recv(clientFd, buffer, sizeof(buffer), 0);
+        if (n <= 0) {
+            ::close(clientFd);
+            return;
+        }
+        request.append(buffer, static_cast<size_t>(n));
+    }
+
+    // Expect: GET /api/v1/cameras/<id>/stream[?fps=N&quality=Q&raw=1]
+    std::string path;
+    {
+        // Slice method and path out of the request line without a stringstream
+        std::string_view line(request);
+        line = line.substr(0, line.find("\r\n"));
+
+        const size_t methodEnd = line.find(' ');
+        std::string_view method = line.substr(0, methodEnd);
+        if (methodEnd != std::string_view::npos) {
+            std::string_view rest = line.substr(methodEnd + 1);
+            path.assign(rest.substr(0, rest.find(' ')));
+        }
+        if (method != "GET") {
+            static const char* response = "HTTP/1.1 405 Method Not Allowed\r\nConnection: close\r\n\r\n";
+            sendAll(clientFd, response, strlen(response));
+            ::close(clientFd);
+            return;
+        }
+    }
+
+    std::string cameraId;
+    {
+        static const std::string prefix = "/api/v1/cameras/";
+        auto streamPos = path.find("/stream");
+        if (path.rfind(prefix, 0) == 0 && streamPos != std::string::npos) {
+            cameraId = path.substr(prefix.size(), streamPos - prefix.size());
+        }
+    }
+
+    auto camera = CameraManager::getInstance().getCamera(cameraId);
+    if (!camera) {
+        static const char* response = "HTTP/1.1 404 Not Found\r\nConnection: close\r\n\r\nCamera not found";
+        sendAll(clientFd, response, strlen(response));
+        ::close(clientFd);
+        return;
+    }
+
+    int fps = queryParam(path, "fps", 10, 1, 30);
+    int quality = queryParam(path, "quality", 80, 1, 100);
+    bool raw = queryParam(path, "raw", 0, 0, 1) != 0;
+
+    std::string header =
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: multipart/x-mixed-replace; boundary=" + std::string(MJPEG_BOUNDARY) + "\r\n"
+        "Cache-Control: no-cache, no-store\r\n"
+        "Pragma: no-cache\r\n"
+        "Connection: close\r\n"
+        "\r\n";
+    if (!sendAll(clientFd, header.data(), header.size())) {
+        ::close(clientFd);
+        return;
+    }
+
+    LOG_INFO("MjpegStreamer", "Client subscribed to camera " + cameraId + " at " + std::to_string(fps) + " fps");
+
+    const auto frameInterval = std::chrono::milliseconds(1000 / fps);
+    auto nextFrameDue = std::chrono::steady_clock::now();
+    auto lastLivenessProbe = std::chrono::steady_clock::now();
+    uint64_t lastGeneration = 0;
+    bool clientGone = false;
+
+    while (running_) {
+        // Per-client throttle: never deliver faster than the requested rate
+        std::this_thread::sleep_until(nextFrameDue);
+        nextFrameDue = std::chrono::steady_clock::now() + frameInterval;
+
+        // Wait for a new frame generation; the cache hands every subscriber
+        // the same encoded buffer, so only the first poller pays the encode
+        uint64_t generation = 0;
+        std::shared_ptr<const std::vector<uchar>> jpeg;
+        while (running_) {
+            jpeg = raw ? camera->getRawFrameJpegCached(quality, generation)
+                       : camera->getLatestFrameJpegCached(quality, generation);
+            if (jpeg && generation != lastGeneration) {
+                break;
+            }
+
+            // An idle camera produces no frames, so nothing below ever
+            // writes to the socket and a vanished client would otherwise
+            // never be noticed. The stream is GET-only, so a readable
+            // socket means hangup (recv 0) or error, never data to serve.
+            auto now = std::chrono::steady_clock::now();
+            if (now - lastLivenessProbe >= std::chrono::milliseconds(500)) {
+                lastLivenessProbe = now;
+                char probe;
+                ssize_t n = ::recv(clientFd, &probe, 1, MSG_DONTWAIT | MSG_PEEK);
+                if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+                    clientGone = true;
+                    break;
+                }
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(FRAME_POLL_INTERVAL_MS));
+        }
+        if (!running_ || clientGone || !jpeg) {
+            break;
+        }
+        lastGeneration = generation;
+
+        std::string partHeader =
+            "--" + std::string(MJPEG_BOUNDARY) + "\r\n"
+            "Content-Type: image/jpeg\r\n"
+            "Content-Length: " + std::to_string(jpeg->size()) + "\r\n"
+            "\r\n";
+        if (!sendAll(clientFd, partHeader.data(), partHeader.size()) ||
+            !sendAll(clientFd, reinterpret_cast<const char*>(jpeg->data()), jpeg->size()) ||
+            !sendAll(clientFd, "\r\n", 2)) {
+            break;
+        }
+    }
+
+    LOG_INFO("MjpegStreamer", "Client disconnected from camera " + cameraId);
+    ::close(clientFd);
+}
+
+} // namespace tapi
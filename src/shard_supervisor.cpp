@@ -0,0 +1,155 @@
+#include "shard_supervisor.h"
+#include "logger.h"
+
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <thread>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace tapi {
+
+namespace {
+
+/// Set by the signal handler; checked by the supervisor loop
+volatile sig_atomic_t shutdownRequested = 0;
+
+void supervisorSignalHandler(int) {
+    shutdownRequested = 1;
+}
+
+/// Restart backoff bounds for crashing workers
+constexpr int kInitialRestartDelayMs = 1000;
+constexpr int kMaxRestartDelayMs = 30000;
+/// A worker alive this long gets its backoff reset
+constexpr int kStableUptimeMs = 60000;
+
+/**
+ * @brief Bookkeeping for one worker slot
+ */
+struct WorkerSlot {
+    pid_t pid = -1;
+    int restartDelayMs = kInitialRestartDelayMs;
+    std::chrono::steady_clock::time_point startedAt;
+    std::chrono::steady_clock::time_point restartDue;
+    bool pendingRestart = false;
+};
+
+pid_t spawnWorker(const std::string& binaryPath, const std::vector<std::string>& args) {
+    std::vector<char*> argv;
+    argv.push_back(const_cast<char*>(binaryPath.c_str()));
+    for (const auto& arg : args) {
+        argv.push_back(const_cast<char*>(arg.c_str()));
+    }
+    argv.push_back(nullptr);
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        execv(binaryPath.c_str(), argv.data());
+        // Only reached when exec fails
+        _exit(127);
+    }
+    return pid;
+}
+
+} // namespace
+
+int runShardSupervisor(const std::string& binaryPath,
+                       const std::vector<std::vector<std::string>>& workerArgs) {
+    std::signal(SIGINT, supervisorSignalHandler);
+    std::signal(SIGTERM, supervisorSignalHandler);
+
+    std::vector<WorkerSlot> slots(workerArgs.size());
+    for (size_t i = 0; i < slots.size(); ++i) {
+        slots[i].pid = spawnWorker(binaryPath, workerArgs[i]);
+        slots[i].startedAt = std::chrono::steady_clock::now();
+        LOG_INFO("ShardSupervisor", "Started worker " + std::to_string(i) +
+                 " (pid " + std::to_string(slots[i].pid) + ")");
+    }
+
+    bool forwardedShutdown = false;
+    while (true) {
+        if (shutdownRequested && !forwardedShutdown) {
+            LOG_INFO("ShardSupervisor", "Shutdown requested, stopping workers");
+            for (const auto& slot : slots) {
+                if (slot.pid > 0) {
+                    kill(slot.pid, SIGTERM);
+                }
+            }
+            forwardedShutdown = true;
+        }
+
+        // Reap any exited workers
+        int status = 0;
+        pid_t exited;
+        while ((exited = waitpid(-1, &status, WNOHANG)) > 0) {
+            for (size_t i = 0; i < slots.size(); ++i) {
+                if (slots[i].pid != exited) {
+                    continue;
+                }
+                slots[i].pid = -1;
+                if (forwardedShutdown) {
+                    LOG_INFO("ShardSupervisor", "Worker " + std::to_string(i) + " stopped");
+                    break;
+                }
+
+                // Crash or unexpected exit: schedule a restart with
+                // backoff, resetting it after a stable run
+                auto uptime = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - slots[i].startedAt).count();
+                if (uptime >= kStableUptimeMs) {
+                    slots[i].restartDelayMs = kInitialRestartDelayMs;
+                }
+                LOG_WARN("ShardSupervisor", "Worker " + std::to_string(i) +
+                         " exited (" +
+                         (WIFSIGNALED(status)
+                              ? "signal " + std::to_string(WTERMSIG(status))
+                              : "status " + std::to_string(WEXITSTATUS(status))) +
+                         "), restarting in " +
+                         std::to_string(slots[i].restartDelayMs) + " ms");
+                slots[i].pendingRestart = true;
+                slots[i].restartDue = std::chrono::steady_clock::now() +
+                    std::chrono::milliseconds(slots[i].restartDelayMs);
+                slots[i].restartDelayMs =
+                    std::min(slots[i].restartDelayMs * 2, kMaxRestartDelayMs);
+                break;
+            }
+        }
+
+        // Restart workers whose backoff has elapsed
+        if (!forwardedShutdown) {
+            auto now = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < slots.size(); ++i) {
+                if (slots[i].pendingRestart && now >= slots[i].restartDue) {
+                    slots[i].pid = spawnWorker(binaryPath, workerArgs[i]);
+                    slots[i].startedAt = now;
+                    slots[i].pendingRestart = false;
+                    LOG_INFO("ShardSupervisor", "Restarted worker " + std::to_string(i) +
+                             " (pid " + std::to_string(slots[i].pid) + ")");
+                }
+            }
+        }
+
+        // During shutdown, exit once every worker is gone
+        if (forwardedShutdown) {
+            bool anyAlive = false;
+            for (const auto& slot : slots) {
+                if (slot.pid > 0) {
+                    anyAlive = true;
+                    break;
+                }
+            }
+            if (!anyAlive) {
+                LOG_INFO("ShardSupervisor", "All workers stopped, exiting");
+                return 0;
+            }
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+}
+
+} // namespace tapi
@@ -0,0 +1,143 @@
+#include "state_snapshot_service.h"
+#include "camera_manager.h"
+#include "logger.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sys/stat.h>
+
+namespace tapi {
+
+StateSnapshotService& StateSnapshotService::getInstance() {
+    static StateSnapshotService instance;
+    return instance;
+}
+
+StateSnapshotService::StateSnapshotService()
+    : snapshotPath_("./data/state_snapshot.json"),
+      running_(false) {
+}
+
+void StateSnapshotService::start() {
+    if (running_.exchange(true)) {
+        return;
+    }
+    ::mkdir("./data", 0755); // Same location as the telemetry databases
+    thread_ = std::thread(&StateSnapshotService::snapshotThreadFunction, this);
+    LOG_INFO("StateSnapshot", "Periodic state snapshots every " +
+             std::to_string(kSnapshotIntervalMs) + " ms to " + snapshotPath_);
+}
+
+void StateSnapshotService::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    // One final snapshot so a clean shutdown loses nothing
+    snapshotNow();
+}
+
+void StateSnapshotService::snapshotThreadFunction() {
+    while (running_) {
+        {
+            std::unique_lock<std::mutex> lock(cvMutex_);
+            cv_.wait_for(lock, std::chrono::milliseconds(kSnapshotIntervalMs),
+                         [this] { return !running_.load(); });
+        }
+        if (!running_) {
+            break;
+        }
+        snapshotNow();
+    }
+}
+
+bool StateSnapshotService::snapshotNow() {
+    nlohmann::json snapshot;
+    snapshot["version"] = 1;
+    snapshot["saved_at"] = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    nlohmann::json cameras = nlohmann::json::object();
+    auto cameraList = CameraManager::getInstance().getAllCameras();
+    for (const auto& camera : *cameraList) {
+        nlohmann::json components = nlohmann::json::object();
+        for (const auto& component : camera->getAllComponents()) {
+            auto state = component->getPersistentState();
+            if (!state.empty()) {
+                components[component->getId()] = std::move(state);
+            }
+        }
+        if (!components.empty()) {
+            cameras[camera->getId()] = {{"components", std::move(components)}};
+        }
+    }
+    snapshot["cameras"] = std::move(cameras);
+
+    // Write-then-rename so the file on disk is always a complete
+    // snapshot; a crash mid-write leaves the previous one intact
+    std::string tempPath = snapshotPath_ + ".tmp";
+    {
+        std::ofstream out(tempPath, std::ios::trunc);
+        if (!out) {
+            LOG_WARN("StateSnapshot", "Cannot write snapshot to " + tempPath);
+            return false;
+        }
+        out << snapshot.dump();
+        out.flush();
+        if (!out) {
+            LOG_WARN("StateSnapshot", "Short write on snapshot " + tempPath);
+            return false;
+        }
+    }
+    if (std::rename(tempPath.c_str(), snapshotPath_.c_str()) != 0) {
+        LOG_WARN("StateSnapshot", "Failed to swap snapshot into place");
+        return false;
+    }
+    return true;
+}
+
+bool StateSnapshotService::restore() {
+    std::ifstream in(snapshotPath_);
+    if (!in) {
+        LOG_INFO("StateSnapshot", "No state snapshot to restore");
+        return false;
+    }
+
+    nlohmann::json snapshot;
+    try {
+        in >> snapshot;
+    } catch (const std::exception& e) {
+        LOG_WARN("StateSnapshot", std::string("Ignoring unreadable snapshot: ") + e.what());
+        return false;
+    }
+    if (!snapshot.contains("cameras") || !snapshot["cameras"].is_object()) {
+        return false;
+    }
+
+    int restored = 0;
+    for (const auto& [cameraId, cameraState] : snapshot["cameras"].items()) {
+        auto camera = CameraManager::getInstance().getCamera(cameraId);
+        if (!camera) {
+            // Camera removed since the snapshot (or owned by another shard)
+            continue;
+        }
+        if (!cameraState.contains("components") || !cameraState["components"].is_object()) {
+            continue;
+        }
+        for (const auto& [componentId, state] : cameraState["components"].items()) {
+            auto component = camera->getComponent(componentId);
+            if (component && component->restorePersistentState(state)) {
+                restored++;
+            }
+        }
+    }
+    LOG_INFO("StateSnapshot", "Restored state for " + std::to_string(restored) +
+             " component(s)");
+    return restored > 0;
+}
+
+} // namespace tapi
@@ -0,0 +1,239 @@
+#include "telemetry_broadcaster.h"
+#include "components/telemetry_codec.h"
+#include "logger.h"
+
+#include <chrono>
+
+namespace tapi {
+
+// How often buffered events are flushed to subscribers
+static const int FLUSH_INTERVAL_MS = 100;
+
+// Flush early once any subscriber has this many events buffered, so event
+// storms produce bounded-size batches instead of waiting out the interval
+static const size_t FLUSH_THRESHOLD_EVENTS = 64;
+
+// Maximum events buffered per subscriber between flushes; beyond this the
+// oldest events are dropped and reported in the next batch
+static const size_t MAX_PENDING_EVENTS = 256;
+
+TelemetryBroadcaster& TelemetryBroadcaster::getInstance() {
+    static TelemetryBroadcaster instance;
+    return instance;
+}
+
+TelemetryBroadcaster::TelemetryBroadcaster()
+    : running_(true), subscriberCount_(0) {
+    flushThread_ = std::thread(&TelemetryBroadcaster::flushLoop, this);
+    LOG_INFO("TelemetryBroadcaster", "Telemetry broadcaster started");
+}
+
+TelemetryBroadcaster::~TelemetryBroadcaster() {
+    shutdown();
+}
+
+void TelemetryBroadcaster::publish(const std::string& cameraId, const TelemetryEventList& events) {
+    // Fast path: nothing to do when nobody is listening
+    if (subscriberCount_.load(std::memory_order_acquire) == 0 || !events || events->empty()) {
+        return;
+    }
+
+    bool thresholdReached = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& [handle, subscriber] : subscribers_) {
+            (void)handle;
+            if (!subscriber.cameraFilter.empty() && subscriber.cameraFilter != cameraId) {
+                continue;
+            }
+
+            // Slow consumer: shed whole batches from the oldest end until
+            // the new one fits. The subscriber only ever holds references,
+            // so lag costs refcounts, not event copies.
+            while (subscriber.pendingEvents + events->size() > MAX_PENDING_EVENTS &&
+                   !subscriber.pending.empty()) {
+                const size_t oldest = subscriber.pending.front()->size();
+                subscriber.pending.erase(subscriber.pending.begin());
+                subscriber.pendingEvents -= oldest;
+                subscriber.dropped += oldest;
+                subscriber.droppedTotal += oldest;
+            }
+
+            // Buffer a reference to the shared batch; serialization happens
+            // at flush time in whichever format the subscriber asked for
+            subscriber.pending.push_back(events);
+            subscriber.pendingEvents += events->size();
+
+            if (subscriber.pendingEvents >= FLUSH_THRESHOLD_EVENTS) {
+                thresholdReached = true;
+            }
+        }
+    }
+
+    // Size window: wake the flush thread early during event storms so
+    // batches stay bounded instead of piling up until the next interval
+    if (thresholdReached) {
+        cv_.notify_one();
+    }
+}
+
+void TelemetryBroadcaster::addSubscriber(void* handle, const std::string& cameraFilter, SendFunction send) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Subscriber subscriber;
+    subscriber.id = nextSubscriberId_++;
+    subscriber.cameraFilter = cameraFilter;
+    subscriber.send = std::move(send);
+    subscribers_[handle] = std::move(subscriber);
+    subscriberCount_.store(subscribers_.size(), std::memory_order_release);
+
+    LOG_INFO("TelemetryBroadcaster", "Subscriber added (" + std::to_string(subscribers_.size()) +
+             " total), camera filter: " + (cameraFilter.empty() ? "<all>" : cameraFilter));
+}
+
+void TelemetryBroadcaster::setSubscriberFilter(void* handle, const std::string& cameraFilter) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = subscribers_.find(handle);
+    if (it != subscribers_.end()) {
+        it->second.cameraFilter = cameraFilter;
+    }
+}
+
+void TelemetryBroadcaster::setSubscriberFormat(void* handle, bool binary) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = subscribers_.find(handle);
+    if (it != subscribers_.end()) {
+        it->second.binary = binary;
+    }
+}
+
+void TelemetryBroadcaster::removeSubscriber(void* handle) {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    // Wait out any batch the flush thread is currently sending to this
+    // subscriber: the send callback references the connection the caller
+    // is about to destroy, so returning mid-delivery would hand the flush
+    // thread a dangling connection
+    deliveryDoneCV_.wait(lock, [this, handle] {
+        auto it = subscribers_.find(handle);
+        return it == subscribers_.end() || !it->second.inDelivery;
+    });
+
+    subscribers_.erase(handle);
+    subscriberCount_.store(subscribers_.size(), std::memory_order_release);
+
+    LOG_INFO("TelemetryBroadcaster", "Subscriber removed (" + std::to_string(subscribers_.size()) + " remaining)");
+}
+
+size_t TelemetryBroadcaster::getSubscriberCount() const {
+    return subscriberCount_.load(std::memory_order_acquire);
+}
+
+nlohmann::json TelemetryBroadcaster::getSubscriberStats() const {
+    nlohmann::json stats = nlohmann::json::array();
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& [handle, subscriber] : subscribers_) {
+        (void)handle;
+        nlohmann::json entry;
+        entry["id"] = subscriber.id;
+        entry["camera_filter"] = subscriber.cameraFilter;
+        entry["pending_events"] = subscriber.pendingEvents;
+        entry["dropped_total"] = subscriber.droppedTotal;
+        stats.push_back(std::move(entry));
+    }
+    return stats;
+}
+
+void TelemetryBroadcaster::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return; // Already shut down
+        }
+        running_ = false;
+        subscribers_.clear();
+        subscriberCount_.store(0, std::memory_order_release);
+    }
+
+    cv_.notify_all();
+
+    if (flushThread_.joinable()) {
+        flushThread_.join();
+    }
+
+    LOG_INFO("TelemetryBroadcaster", "Telemetry broadcaster shut down");
+}
+
+void TelemetryBroadcaster::flushLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_) {
+        cv_.wait_for(lock, std::chrono::milliseconds(FLUSH_INTERVAL_MS));
+        if (!running_) {
+            break;
+        }
+
+        // Collect the batches under the lock, deliver them outside it so a
+        // slow socket never stalls the pipeline's publish path
+        struct Delivery {
+            void* handle;
+            SendFunction send;
+            std::string message;
+            bool binary;
+        };
+        std::vector<Delivery> deliveries;
+        for (auto& [handle, subscriber] : subscribers_) {
+            if (subscriber.pending.empty()) {
+                continue;
+            }
+
+            std::string message;
+            if (subscriber.binary) {
+                message = TelemetryCodec::encodeBatch(subscriber.pending, subscriber.dropped);
+            } else {
+                nlohmann::json batch;
+                batch["type"] = "telemetry";
+                nlohmann::json eventArray = nlohmann::json::array();
+                for (const auto& sharedBatch : subscriber.pending) {
+                    for (const auto& event : *sharedBatch) {
+                        eventArray.push_back(event.toJson());
+                    }
+                }
+                batch["events"] = std::move(eventArray);
+                if (subscriber.dropped > 0) {
+                    batch["dropped"] = subscriber.dropped;
+                }
+                message = batch.dump();
+            }
+
+            // Mark the subscriber in-delivery before dropping the lock so
+            // removeSubscriber() blocks until the send below has finished
+            // instead of letting the connection die under it
+            subscriber.inDelivery = true;
+            deliveries.push_back(Delivery{handle, subscriber.send, std::move(message), subscriber.binary});
+            subscriber.pending.clear();
+            subscriber.pendingEvents = 0;
+            subscriber.dropped = 0;
+        }
+
+        lock.unlock();
+        for (auto& delivery : deliveries) {
+            try {
+                delivery.send(delivery.message, delivery.binary);
+            } catch (const std::exception& e) {
+                LOG_WARN("TelemetryBroadcaster", "Failed to deliver batch: " + std::string(e.what()));
+            }
+        }
+        lock.lock();
+
+        if (!deliveries.empty()) {
+            for (const auto& delivery : deliveries) {
+                auto it = subscribers_.find(delivery.handle);
+                if (it != subscribers_.end()) {
+                    it->second.inDelivery = false;
+                }
+            }
+            deliveryDoneCV_.notify_all();
+        }
+    }
+}
+
+} // namespace tapi
@@ -7,12 +7,38 @@
 
 namespace tapi {
 
-Logger::Logger() 
+// Ring capacity; must be a power of two. At ~200 bytes per record this
+// bounds pending log memory to about 1.5 MB.
+static const size_t LOG_RING_CAPACITY = 8192;
+
+// How long the writer thread sleeps when the ring is empty
+static const int WRITER_IDLE_WAIT_MS = 20;
+
+Logger::Logger()
     : currentLevel_(LogLevel::INFO),
-      consoleLogging_(true) {
+      consoleLogging_(true),
+      ring_(LOG_RING_CAPACITY),
+      enqueuePos_(0),
+      dequeuePos_(0),
+      droppedCount_(0),
+      running_(true) {
+    // Seed the slot sequences for the Vyukov hand-off protocol
+    for (size_t i = 0; i < ring_.size(); ++i) {
+        ring_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    writerThread_ = std::thread(&Logger::writerLoop, this);
 }
 
 Logger::~Logger() {
+    // Stop the writer and drain whatever is still queued
+    {
+        std::lock_guard<std::mutex> lock(writerMutex_);
+        running_ = false;
+    }
+    writerCv_.notify_all();
+    if (writerThread_.joinable()) {
+        writerThread_.join();
+    }
     closeLogFile();
 }
 
@@ -31,27 +57,27 @@ LogLevel Logger::getLogLevel() const {
 
 bool Logger::setOutputFile(const std::string& filename) {
     std::lock_guard<std::mutex> lock(logMutex_);
-    
+
     // Close any existing log file
     if (logFile_.is_open()) {
         logFile_.close();
     }
-    
+
     // Create directory if it doesn't exist
     std::filesystem::path filePath(filename);
     std::filesystem::path directory = filePath.parent_path();
-    
+
     if (!directory.empty()) {
         std::filesystem::create_directories(directory);
     }
-    
+
     // Open new log file
     logFile_.open(filename, std::ios::out | std::ios::app);
     if (!logFile_.is_open()) {
         std::cerr << "Failed to open log file: " << filename << std::endl;
         return false;
     }
-    
+
     return true;
 }
 
@@ -71,32 +97,136 @@ void Logger::log(LogLevel level, const std::string& source, const std::string& m
     if (level < currentLevel_) {
         return;
     }
-    
+
     // Format the log message
     std::stringstream logStream;
     logStream << getCurrentTimestamp() << " ["
               << levelToString(level) << "] ["
               << source << "] "
               << message;
-    
-    std::string logMessage = logStream.str();
-    
-    // Acquire lock for thread safety during writing
-    std::lock_guard<std::mutex> lock(logMutex_);
-    
-    // Write to console if enabled
-    if (consoleLogging_.load(std::memory_order_relaxed)) {
-        // Use different output streams based on level
-        if (level >= LogLevel::ERROR) {
-            std::cerr << logMessage << std::endl;
+
+    // Hand the record to the writer thread; when the ring is full the
+    // record is dropped and counted rather than blocking the caller
+    if (!enqueue(level, logStream.str())) {
+        droppedCount_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // Errors should reach the sinks promptly; everything else rides the
+    // writer's next batch
+    if (level >= LogLevel::ERROR) {
+        writerCv_.notify_one();
+    }
+}
+
+bool Logger::enqueue(LogLevel level, std::string message) {
+    const size_t mask = ring_.size() - 1;
+    size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+
+    for (;;) {
+        Slot& slot = ring_[pos & mask];
+        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+        if (diff == 0) {
+            // Slot is free; try to claim it
+            if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                slot.level = level;
+                slot.message = std::move(message);
+                slot.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+            // compare_exchange updated pos; retry with the new value
+        } else if (diff < 0) {
+            // Ring is full
+            return false;
         } else {
-            std::cout << logMessage << std::endl;
+            // Another producer claimed this slot; reload and retry
+            pos = enqueuePos_.load(std::memory_order_relaxed);
         }
     }
-    
-    // Write to file if open
+}
+
+void Logger::writerLoop() {
+    const size_t mask = ring_.size() - 1;
+    std::vector<Record> batch;
+
+    auto drainRing = [&]() {
+        // Single consumer: no compare-exchange needed on dequeuePos_
+        for (;;) {
+            size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+            Slot& slot = ring_[pos & mask];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1) < 0) {
+                break; // Ring is empty
+            }
+
+            batch.push_back(Record{slot.level, std::move(slot.message)});
+
+            // Recycle the slot for the producers' next lap
+            slot.sequence.store(pos + ring_.size(), std::memory_order_release);
+            dequeuePos_.store(pos + 1, std::memory_order_relaxed);
+        }
+    };
+
+    while (true) {
+        batch.clear();
+        drainRing();
+
+        // Report records dropped since the last batch
+        size_t dropped = droppedCount_.exchange(0, std::memory_order_relaxed);
+        if (dropped > 0) {
+            batch.push_back(Record{
+                LogLevel::WARN,
+                getCurrentTimestamp() + " [WARN ] [Logger] Dropped " +
+                    std::to_string(dropped) + " log record(s): ring buffer full"});
+        }
+
+        if (!batch.empty()) {
+            writeBatch(batch);
+        }
+
+        std::unique_lock<std::mutex> lock(writerMutex_);
+        if (!running_) {
+            break;
+        }
+        writerCv_.wait_for(lock, std::chrono::milliseconds(WRITER_IDLE_WAIT_MS));
+    }
+
+    // Final drain so shutdown messages are not lost
+    batch.clear();
+    drainRing();
+    if (!batch.empty()) {
+        writeBatch(batch);
+    }
+}
+
+void Logger::writeBatch(const std::vector<Record>& records) {
+    std::lock_guard<std::mutex> lock(logMutex_);
+
+    for (const auto& record : records) {
+        // Write to console if enabled
+        if (consoleLogging_.load(std::memory_order_relaxed)) {
+            // Use different output streams based on level
+            if (record.level >= LogLevel::ERROR) {
+                std::cerr << record.message << '\n';
+            } else {
+                std::cout << record.message << '\n';
+            }
+        }
+
+        // Write to file if open
+        if (logFile_.is_open()) {
+            logFile_ << record.message << '\n';
+        }
+    }
+
+    // Flush once per batch instead of once per record
+    if (consoleLogging_.load(std::memory_order_relaxed)) {
+        std::cout.flush();
+        std::cerr.flush();
+    }
     if (logFile_.is_open()) {
-        logFile_ << logMessage << std::endl;
         logFile_.flush();
     }
 }
@@ -143,12 +273,12 @@ std::string Logger::getCurrentTimestamp() {
     auto now_time_t = std::chrono::system_clock::to_time_t(now);
     auto now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
         now.time_since_epoch()) % 1000;
-    
+
     std::stringstream ss;
     ss << std::put_time(std::localtime(&now_time_t), "%Y-%m-%d %H:%M:%S");
     ss << '.' << std::setfill('0') << std::setw(3) << now_ms.count();
-    
+
     return ss.str();
 }
 
-} // namespace tapi 
\ No newline at end of file
+} // namespace tapi
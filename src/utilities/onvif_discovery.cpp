@@ -16,10 +16,12 @@
 #include <arpa/inet.h>
 #include <ifaddrs.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
 
 namespace tapi {
 
-const std::string ONVIF_DISCOVERY_MESSAGE = 
+const std::string ONVIF_DISCOVERY_MESSAGE =
     "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
     "<e:Envelope xmlns:e=\"http://www.w3.org/2003/05/soap-envelope\" "
     "xmlns:w=\"http://schemas.xmlsoap.org/ws/2004/08/addressing\" "
@@ -37,31 +39,50 @@ const std::string ONVIF_DISCOVERY_MESSAGE =
     "</e:Body>"
     "</e:Envelope>";
 
+// How often probes are re-sent while waiting for responses
+static const int PROBE_RESEND_INTERVAL_SECS = 5;
+
+// Unicast probing is limited to subnets at least this specific, so a
+// misconfigured /8 never turns discovery into a network-wide scan
+static const int UNICAST_MIN_PREFIX_LENGTH = 24;
+
+namespace {
+
+/// A local IPv4 interface eligible for discovery probes
+struct ProbeInterface {
+    std::string name;
+    in_addr address;
+    in_addr netmask;
+};
+
+} // namespace
+
 OnvifDiscovery::OnvifDiscovery() {}
 
-std::vector<OnvifCamera> OnvifDiscovery::discoverCameras(int timeoutSeconds, const std::string& networkInterface) {
+std::vector<OnvifCamera> OnvifDiscovery::discoverCameras(int timeoutSeconds, const std::string& networkInterface,
+                                                         CameraFoundCallback onCameraFound) {
     const int discoveryPort = 3702; // Standard WS-Discovery port
     std::vector<OnvifCamera> discoveredCameras;
-    
+
     try {
         std::cout << "Starting ONVIF discovery with timeout: " << timeoutSeconds << " seconds" << std::endl;
         if (!networkInterface.empty()) {
             std::cout << "Using network interface: " << networkInterface << std::endl;
         }
-        
-        // Get a list of network interfaces for debugging
+
+        // Collect IPv4 interfaces (address + netmask) for probing
         std::cout << "Available network interfaces:" << std::endl;
-        std::vector<std::string> networkInterfaces;
+        std::vector<ProbeInterface> probeInterfaces;
         struct ifaddrs *ifaddr, *ifa;
-        
+
         if (getifaddrs(&ifaddr) == -1) {
             std::cerr << "Failed to get network interfaces" << std::endl;
         } else {
             for (ifa = ifaddr; ifa != nullptr; ifa = ifa->ifa_next) {
-                if (ifa->ifa_addr == nullptr) {
+                if (ifa->ifa_addr == nullptr || ifa->ifa_netmask == nullptr) {
                     continue;
                 }
-                
+
                 // Only consider IPv4 interfaces
                 if (ifa->ifa_addr->sa_family == AF_INET) {
                     char host[NI_MAXHOST];
@@ -69,255 +90,291 @@ std::vector<OnvifCamera> OnvifDiscovery::discoverCameras(int timeoutSeconds, con
                                         host, NI_MAXHOST, nullptr, 0, NI_NUMERICHOST);
                     if (s == 0) {
                         std::cout << "  - " << ifa->ifa_name << ": " << host << std::endl;
-                        networkInterfaces.push_back(std::string(ifa->ifa_name) + " (" + host + ")");
+
+                        // Skip loopback addresses
+                        if (std::string(host).substr(0, 3) == "127") {
+                            continue;
+                        }
+
+                        // When an interface address was specified, only probe through it
+                        if (!networkInterface.empty() && networkInterface != host) {
+                            continue;
+                        }
+
+                        ProbeInterface iface;
+                        iface.name = ifa->ifa_name;
+                        iface.address = ((struct sockaddr_in*)ifa->ifa_addr)->sin_addr;
+                        iface.netmask = ((struct sockaddr_in*)ifa->ifa_netmask)->sin_addr;
+                        probeInterfaces.push_back(iface);
                     }
                 }
             }
             freeifaddrs(ifaddr);
         }
-        
-        // Create a raw socket for improved multicast handling
+
+        // One non-blocking socket carries everything: multicast, broadcast
+        // and unicast probes go out on it, and all responses come back on it
         int sock = socket(AF_INET, SOCK_DGRAM, 0);
         if (sock < 0) {
             std::cerr << "Error creating socket: " << strerror(errno) << std::endl;
             return discoveredCameras;
         }
-        
+
         // Allow socket reuse
         int reuse = 1;
         if (setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) < 0) {
             std::cerr << "Error setting SO_REUSEADDR: " << strerror(errno) << std::endl;
         }
 
-        // Set receive timeout
-        struct timeval tv;
-        tv.tv_sec = 1;
-        tv.tv_usec = 0;
-        if (setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) < 0) {
-            std::cerr << "Error setting SO_RCVTIMEO: " << strerror(errno) << std::endl;
+        // Non-blocking: the receive loop waits in poll() instead of eating
+        // one-second receive timeouts between responses
+        int flags = fcntl(sock, F_GETFL, 0);
+        if (flags < 0 || fcntl(sock, F_SETFL, flags | O_NONBLOCK) < 0) {
+            std::cerr << "Error setting O_NONBLOCK: " << strerror(errno) << std::endl;
         }
-        
+
         // Enable receiving messages from all interfaces
         struct sockaddr_in addr;
         memset(&addr, 0, sizeof(addr));
         addr.sin_family = AF_INET;
         addr.sin_addr.s_addr = htonl(INADDR_ANY);
         addr.sin_port = htons(discoveryPort);
-        
+
         if (bind(sock, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
             std::cerr << "Error binding socket: " << strerror(errno) << std::endl;
             close(sock);
             return discoveredCameras;
         }
-        
+
         std::cout << "Socket bound successfully" << std::endl;
-        
+
         // Join multicast group (239.255.255.250) on all interfaces
         struct ip_mreq mreq;
         mreq.imr_multiaddr.s_addr = inet_addr("239.255.255.250");
         mreq.imr_interface.s_addr = htonl(INADDR_ANY);
-        
+
         if (setsockopt(sock, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) < 0) {
             std::cerr << "Error joining multicast group: " << strerror(errno) << std::endl;
         } else {
             std::cout << "Joined multicast group 239.255.255.250" << std::endl;
         }
-        
-        // Send discovery messages to multicast address
+
+        // Enable broadcasting
+        int broadcast = 1;
+        if (setsockopt(sock, SOL_SOCKET, SO_BROADCAST, &broadcast, sizeof(broadcast)) < 0) {
+            std::cerr << "Error setting SO_BROADCAST: " << strerror(errno) << std::endl;
+        }
+
         struct sockaddr_in multicastAddr;
         memset(&multicastAddr, 0, sizeof(multicastAddr));
         multicastAddr.sin_family = AF_INET;
         multicastAddr.sin_addr.s_addr = inet_addr("239.255.255.250");
         multicastAddr.sin_port = htons(discoveryPort);
-        
-        // Try sending through all interfaces if not specified
-        if (networkInterface.empty()) {
-            for (const auto& iface : networkInterfaces) {
-                size_t pos = iface.find("(");
-                size_t endPos = iface.find(")");
-                if (pos != std::string::npos && endPos != std::string::npos) {
-                    std::string ifaceName = iface.substr(0, pos - 1);
-                    std::string ipAddress = iface.substr(pos + 1, endPos - pos - 1);
-                    
-                    // Skip loopback addresses
-                    if (ipAddress.substr(0, 3) == "127") {
-                        continue;
-                    }
-                    
-                    // Set outgoing interface
-                    struct in_addr localInterface;
-                    localInterface.s_addr = inet_addr(ipAddress.c_str());
-                    if (setsockopt(sock, IPPROTO_IP, IP_MULTICAST_IF, &localInterface, sizeof(localInterface)) < 0) {
-                        std::cerr << "Error setting outgoing interface " << ipAddress << ": " << strerror(errno) << std::endl;
-                        continue;
-                    }
-                    
-                    std::cout << "Sending discovery message through interface " << ifaceName << " (" << ipAddress << ")" << std::endl;
-                    if (sendto(sock, ONVIF_DISCOVERY_MESSAGE.c_str(), ONVIF_DISCOVERY_MESSAGE.length(), 0,
-                               (struct sockaddr*)&multicastAddr, sizeof(multicastAddr)) < 0) {
-                        std::cerr << "Error sending discovery message: " << strerror(errno) << std::endl;
+
+        struct sockaddr_in broadcastAddr;
+        memset(&broadcastAddr, 0, sizeof(broadcastAddr));
+        broadcastAddr.sin_family = AF_INET;
+        broadcastAddr.sin_addr.s_addr = htonl(INADDR_BROADCAST);
+        broadcastAddr.sin_port = htons(discoveryPort);
+
+        // Send one round of probes: multicast per interface, one broadcast,
+        // and a unicast probe to every host of each sufficiently small
+        // subnet. Unicast sends are fire-and-forget datagrams, so probing a
+        // whole /24 costs a few milliseconds rather than a blocking
+        // round-trip per host.
+        auto sendProbes = [&](bool verbose) {
+            for (const auto& iface : probeInterfaces) {
+                // Set outgoing interface for the multicast probe
+                if (setsockopt(sock, IPPROTO_IP, IP_MULTICAST_IF, &iface.address, sizeof(iface.address)) < 0) {
+                    if (verbose) {
+                        std::cerr << "Error setting outgoing interface " << iface.name
+                                  << ": " << strerror(errno) << std::endl;
                     }
+                    continue;
+                }
+
+                if (verbose) {
+                    char host[INET_ADDRSTRLEN];
+                    inet_ntop(AF_INET, &iface.address, host, INET_ADDRSTRLEN);
+                    std::cout << "Sending discovery message through interface " << iface.name
+                              << " (" << host << ")" << std::endl;
                 }
-            }
-        } else {
-            // Send through specified interface
-            struct in_addr localInterface;
-            localInterface.s_addr = inet_addr(networkInterface.c_str());
-            if (setsockopt(sock, IPPROTO_IP, IP_MULTICAST_IF, &localInterface, sizeof(localInterface)) < 0) {
-                std::cerr << "Error setting outgoing interface " << networkInterface << ": " << strerror(errno) << std::endl;
-            } else {
-                std::cout << "Sending discovery message through interface " << networkInterface << std::endl;
                 if (sendto(sock, ONVIF_DISCOVERY_MESSAGE.c_str(), ONVIF_DISCOVERY_MESSAGE.length(), 0,
-                           (struct sockaddr*)&multicastAddr, sizeof(multicastAddr)) < 0) {
+                           (struct sockaddr*)&multicastAddr, sizeof(multicastAddr)) < 0 && verbose) {
                     std::cerr << "Error sending discovery message: " << strerror(errno) << std::endl;
                 }
+
+                // Unicast probes reach cameras that ignore multicast (a
+                // common default on enterprise switches with snooping)
+                uint32_t mask = ntohl(iface.netmask.s_addr);
+                int prefixLength = __builtin_popcount(mask);
+                if (prefixLength < UNICAST_MIN_PREFIX_LENGTH || prefixLength >= 31) {
+                    continue;
+                }
+
+                uint32_t network = ntohl(iface.address.s_addr) & mask;
+                uint32_t hostCount = (~mask) - 1; // Exclude network and broadcast addresses
+                uint32_t ownAddress = ntohl(iface.address.s_addr);
+
+                if (verbose) {
+                    std::cout << "Sending unicast probes to " << hostCount
+                              << " host(s) on " << iface.name << std::endl;
+                }
+
+                struct sockaddr_in unicastAddr;
+                memset(&unicastAddr, 0, sizeof(unicastAddr));
+                unicastAddr.sin_family = AF_INET;
+                unicastAddr.sin_port = htons(discoveryPort);
+
+                for (uint32_t host = 1; host <= hostCount; ++host) {
+                    uint32_t target = network | host;
+                    if (target == ownAddress) {
+                        continue;
+                    }
+                    unicastAddr.sin_addr.s_addr = htonl(target);
+                    sendto(sock, ONVIF_DISCOVERY_MESSAGE.c_str(), ONVIF_DISCOVERY_MESSAGE.length(), 0,
+                           (struct sockaddr*)&unicastAddr, sizeof(unicastAddr));
+                }
+            }
+
+            if (verbose) {
+                std::cout << "Sending broadcast discovery message" << std::endl;
             }
-        }
-        
-        // Also try direct broadcast to local network
-        struct sockaddr_in broadcastAddr;
-        memset(&broadcastAddr, 0, sizeof(broadcastAddr));
-        broadcastAddr.sin_family = AF_INET;
-        broadcastAddr.sin_addr.s_addr = htonl(INADDR_BROADCAST);
-        broadcastAddr.sin_port = htons(discoveryPort);
-        
-        // Enable broadcasting
-        int broadcast = 1;
-        if (setsockopt(sock, SOL_SOCKET, SO_BROADCAST, &broadcast, sizeof(broadcast)) < 0) {
-            std::cerr << "Error setting SO_BROADCAST: " << strerror(errno) << std::endl;
-        } else {
-            std::cout << "Sending broadcast discovery message" << std::endl;
             if (sendto(sock, ONVIF_DISCOVERY_MESSAGE.c_str(), ONVIF_DISCOVERY_MESSAGE.length(), 0,
-                       (struct sockaddr*)&broadcastAddr, sizeof(broadcastAddr)) < 0) {
+                       (struct sockaddr*)&broadcastAddr, sizeof(broadcastAddr)) < 0 && verbose) {
                 std::cerr << "Error sending broadcast message: " << strerror(errno) << std::endl;
             }
-        }
-        
-        // Receive responses until timeout
+        };
+
+        sendProbes(true);
+
+        // Collect responses until the timeout, waking only when data
+        // arrives or a probe round is due
         auto startTime = std::chrono::steady_clock::now();
-        std::chrono::seconds timeout(timeoutSeconds);
-        
+        auto deadline = startTime + std::chrono::seconds(timeoutSeconds);
+        auto nextProbeTime = startTime + std::chrono::seconds(PROBE_RESEND_INTERVAL_SECS);
+
         char buffer[10240]; // 10KB buffer for responses
-        
+
         std::cout << "Waiting for responses for " << timeoutSeconds << " seconds..." << std::endl;
-        
-        while (std::chrono::steady_clock::now() - startTime < timeout) {
-            struct sockaddr_in senderAddr;
-            socklen_t senderAddrLen = sizeof(senderAddr);
-            
-            int bytesReceived = recvfrom(sock, buffer, sizeof(buffer) - 1, 0,
-                                         (struct sockaddr*)&senderAddr, &senderAddrLen);
-            
-            if (bytesReceived > 0) {
+
+        while (true) {
+            auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                break;
+            }
+
+            // Re-send probes periodically to catch cameras that missed the
+            // first round
+            if (now >= nextProbeTime) {
+                std::cout << "Re-sending discovery messages..." << std::endl;
+                sendProbes(false);
+                nextProbeTime = now + std::chrono::seconds(PROBE_RESEND_INTERVAL_SECS);
+            }
+
+            auto waitUntil = std::min(deadline, nextProbeTime);
+            int waitMs = static_cast<int>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(waitUntil - now).count());
+
+            struct pollfd pfd;
+            pfd.fd = sock;
+            pfd.events = POLLIN;
+            int ready = poll(&pfd, 1, std::max(waitMs, 0));
+            if (ready < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                std::cerr << "Error polling socket: " << strerror(errno) << std::endl;
+                break;
+            }
+            if (ready == 0) {
+                continue; // Timed out; loop to re-probe or finish
+            }
+
+            // Drain every datagram that arrived while we slept
+            for (;;) {
+                struct sockaddr_in senderAddr;
+                socklen_t senderAddrLen = sizeof(senderAddr);
+
+                int bytesReceived = recvfrom(sock, buffer, sizeof(buffer) - 1, 0,
+                                             (struct sockaddr*)&senderAddr, &senderAddrLen);
+
+                if (bytesReceived < 0) {
+                    if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                        std::cerr << "Error receiving data: " << strerror(errno) << std::endl;
+                    }
+                    break;
+                }
+                if (bytesReceived == 0) {
+                    break;
+                }
+
                 // Null-terminate the received data
                 buffer[bytesReceived] = '\0';
-                
+
                 // Get sender's IP address
                 char senderIP[INET_ADDRSTRLEN];
                 inet_ntop(AF_INET, &(senderAddr.sin_addr), senderIP, INET_ADDRSTRLEN);
-                
+
                 std::cout << "Received " << bytesReceived << " bytes from " << senderIP << std::endl;
-                
-                    // Process the response
-                    std::string response(buffer, bytesReceived);
-                
-                // Debug: Print a portion of the response
-                std::cout << "Response preview: " << response.substr(0, 100) << "..." << std::endl;
-                    
-                    // Parse the response to extract device information
+
+                // Process the response
+                std::string response(buffer, bytesReceived);
+
+                // Parse the response to extract device information
                 OnvifCamera camera = parseDiscoveryResponse(response, senderIP);
-                    
-                    // Only add if we got valid data
-                    if (!camera.xaddrs.empty()) {
-                    std::cout << "Found camera: " << camera.name 
-                              << " at " << camera.ipAddress 
+
+                // Only add if we got valid data
+                if (!camera.xaddrs.empty()) {
+                    std::cout << "Found camera: " << camera.name
+                              << " at " << camera.ipAddress
                               << " with xaddrs: " << camera.xaddrs << std::endl;
-                    
-                        // Check if we already have this camera
-                        auto it = std::find_if(discoveredCameras.begin(), discoveredCameras.end(),
-                            [&camera](const OnvifCamera& c) { 
-                                return c.xaddrs == camera.xaddrs; 
-                            });
-                        
-                        // If this is a new camera, add it
-                        if (it == discoveredCameras.end()) {
+
+                    // Check if we already have this camera
+                    auto it = std::find_if(discoveredCameras.begin(), discoveredCameras.end(),
+                        [&camera](const OnvifCamera& c) {
+                            return c.xaddrs == camera.xaddrs;
+                        });
+
+                    // If this is a new camera, add it
+                    if (it == discoveredCameras.end()) {
                         std::cout << "Adding new camera to results" << std::endl;
-                            // Try to get RTSP URLs for this camera
-                            getRtspUrlsForCamera(camera);
-                            discoveredCameras.push_back(camera);
+                        // Try to get RTSP URLs for this camera
+                        getRtspUrlsForCamera(camera);
+                        discoveredCameras.push_back(camera);
+
+                        // Surface the camera to the caller right away
+                        // rather than making it wait for the full timeout
+                        if (onCameraFound) {
+                            onCameraFound(camera);
+                        }
                     } else {
                         std::cout << "Camera already in results, skipping" << std::endl;
                     }
                 } else {
                     std::cout << "Received response didn't contain valid camera information" << std::endl;
                 }
-            } else if (errno != EAGAIN && errno != EWOULDBLOCK) {
-                std::cerr << "Error receiving data: " << strerror(errno) << std::endl;
-            }
-            
-            // Display status every second
-            static auto lastStatusTime = startTime;
-            auto now = std::chrono::steady_clock::now();
-            if (now - lastStatusTime >= std::chrono::seconds(1)) {
-                lastStatusTime = now;
-                int elapsedSeconds = std::chrono::duration_cast<std::chrono::seconds>(now - startTime).count();
-                std::cout << "Still listening for responses... (" << elapsedSeconds << "s elapsed)" << std::endl;
-                
-                // Re-send discovery message every 5 seconds to improve chances of discovery
-                if (elapsedSeconds % 5 == 0) {
-                    std::cout << "Re-sending discovery messages..." << std::endl;
-                    
-                    // Send through all interfaces again
-                    if (networkInterface.empty()) {
-                        for (const auto& iface : networkInterfaces) {
-                            size_t pos = iface.find("(");
-                            size_t endPos = iface.find(")");
-                            if (pos != std::string::npos && endPos != std::string::npos) {
-                                std::string ipAddress = iface.substr(pos + 1, endPos - pos - 1);
-                                // Skip loopback addresses
-                                if (ipAddress.substr(0, 3) == "127") {
-                                    continue;
-                                }
-                                struct in_addr localInterface;
-                                localInterface.s_addr = inet_addr(ipAddress.c_str());
-                                setsockopt(sock, IPPROTO_IP, IP_MULTICAST_IF, &localInterface, sizeof(localInterface));
-                                sendto(sock, ONVIF_DISCOVERY_MESSAGE.c_str(), ONVIF_DISCOVERY_MESSAGE.length(), 0,
-                                       (struct sockaddr*)&multicastAddr, sizeof(multicastAddr));
-                            }
-                        }
-                    } else {
-                        struct in_addr localInterface;
-                        localInterface.s_addr = inet_addr(networkInterface.c_str());
-                        setsockopt(sock, IPPROTO_IP, IP_MULTICAST_IF, &localInterface, sizeof(localInterface));
-                        sendto(sock, ONVIF_DISCOVERY_MESSAGE.c_str(), ONVIF_DISCOVERY_MESSAGE.length(), 0,
-                               (struct sockaddr*)&multicastAddr, sizeof(multicastAddr));
-                    }
-                    
-                    // Also broadcast
-                    sendto(sock, ONVIF_DISCOVERY_MESSAGE.c_str(), ONVIF_DISCOVERY_MESSAGE.length(), 0,
-                           (struct sockaddr*)&broadcastAddr, sizeof(broadcastAddr));
-                }
             }
         }
-        
+
         // Clean up
         close(sock);
-        
+
         std::cout << "Discovery completed: found " << discoveredCameras.size() << " ONVIF camera(s)" << std::endl;
     }
     catch (const std::exception& e) {
         std::cerr << "Error in ONVIF discovery: " << e.what() << std::endl;
     }
-    
+
     return discoveredCameras;
 }
 
 OnvifCamera OnvifDiscovery::parseDiscoveryResponse(const std::string& response, const std::string& ipAddress) {
     std::cout << "Parsing discovery response from " << ipAddress << std::endl;
-    
+
     OnvifCamera camera;
     camera.ipAddress = ipAddress;
-    
+
     // Extract XAddrs (service endpoints)
     std::regex xaddrsRegex("<d:XAddrs>([^<]+)</d:XAddrs>");
     std::smatch xaddrsMatch;
@@ -326,7 +383,7 @@ OnvifCamera OnvifDiscovery::parseDiscoveryResponse(const std::string& response,
         std::cout << "Found XAddrs: " << camera.xaddrs << std::endl;
     } else {
         std::cout << "XAddrs not found in response" << std::endl;
-        
+
         // Try alternative regex patterns
         std::regex altXaddrsRegex("<XAddrs>([^<]+)</XAddrs>");
         if (std::regex_search(response, xaddrsMatch, altXaddrsRegex)) {
@@ -334,7 +391,7 @@ OnvifCamera OnvifDiscovery::parseDiscoveryResponse(const std::string& response,
             std::cout << "Found XAddrs (alternative pattern): " << camera.xaddrs << std::endl;
         }
     }
-    
+
     // Extract device types
     std::regex typesRegex("<d:Types>([^<]+)</d:Types>");
     std::smatch typesMatch;
@@ -343,7 +400,7 @@ OnvifCamera OnvifDiscovery::parseDiscoveryResponse(const std::string& response,
         std::cout << "Found Types: " << camera.types << std::endl;
     } else {
         std::cout << "Types not found in response" << std::endl;
-        
+
         // Try alternative regex pattern
         std::regex altTypesRegex("<Types>([^<]+)</Types>");
         if (std::regex_search(response, typesMatch, altTypesRegex)) {
@@ -351,7 +408,7 @@ OnvifCamera OnvifDiscovery::parseDiscoveryResponse(const std::string& response,
             std::cout << "Found Types (alternative pattern): " << camera.types << std::endl;
         }
     }
-    
+
     // Extract endpoint reference address
     std::regex epRefRegex("<wsa:Address>([^<]+)</wsa:Address>");
     std::smatch epRefMatch;
@@ -360,7 +417,7 @@ OnvifCamera OnvifDiscovery::parseDiscoveryResponse(const std::string& response,
         std::cout << "Found Endpoint Reference: " << camera.endpointReference << std::endl;
     } else {
         std::cout << "Endpoint Reference not found in response" << std::endl;
-        
+
         // Try alternative regex pattern
         std::regex altEpRefRegex("<Address>([^<]+)</Address>");
         if (std::regex_search(response, epRefMatch, altEpRefRegex)) {
@@ -368,14 +425,14 @@ OnvifCamera OnvifDiscovery::parseDiscoveryResponse(const std::string& response,
             std::cout << "Found Endpoint Reference (alternative pattern): " << camera.endpointReference << std::endl;
         }
     }
-    
+
     // Extract scope information
     std::regex scopesRegex("<d:Scopes>([^<]+)</d:Scopes>");
     std::smatch scopesMatch;
     if (std::regex_search(response, scopesMatch, scopesRegex)) {
         std::string scopes = scopesMatch[1];
         std::cout << "Found Scopes: " << scopes << std::endl;
-        
+
         // Extract name from scopes
         std::regex nameRegex("onvif://www\\.onvif\\.org/name/([^ ]+)");
         std::smatch nameMatch;
@@ -387,7 +444,7 @@ OnvifCamera OnvifDiscovery::parseDiscoveryResponse(const std::string& response,
         } else {
             std::cout << "Name not found in scopes" << std::endl;
         }
-        
+
         // Extract hardware information
         std::regex hardwareRegex("onvif://www\\.onvif\\.org/hardware/([^ ]+)");
         std::smatch hardwareMatch;
@@ -400,13 +457,13 @@ OnvifCamera OnvifDiscovery::parseDiscoveryResponse(const std::string& response,
         }
     } else {
         std::cout << "Scopes not found in response" << std::endl;
-        
+
         // Try alternative regex pattern
         std::regex altScopesRegex("<Scopes>([^<]+)</Scopes>");
         if (std::regex_search(response, scopesMatch, altScopesRegex)) {
             std::string scopes = scopesMatch[1];
             std::cout << "Found Scopes (alternative pattern): " << scopes << std::endl;
-            
+
             // Process scopes as above...
             std::regex nameRegex("onvif://www\\.onvif\\.org/name/([^ ]+)");
             std::smatch nameMatch;
@@ -415,7 +472,7 @@ OnvifCamera OnvifDiscovery::parseDiscoveryResponse(const std::string& response,
                 camera.name = std::regex_replace(camera.name, std::regex("%20"), " ");
                 std::cout << "Found Name (from alt scopes): " << camera.name << std::endl;
             }
-            
+
             std::regex hardwareRegex("onvif://www\\.onvif\\.org/hardware/([^ ]+)");
             std::smatch hardwareMatch;
             if (std::regex_search(scopes, hardwareMatch, hardwareRegex)) {
@@ -425,29 +482,29 @@ OnvifCamera OnvifDiscovery::parseDiscoveryResponse(const std::string& response,
             }
         }
     }
-    
+
     // If no name was found, use IP address as a fallback
     if (camera.name.empty()) {
         camera.name = "ONVIF Camera (" + ipAddress + ")";
         std::cout << "Using fallback name: " << camera.name << std::endl;
     }
-    
+
     return camera;
 }
 
 void OnvifDiscovery::getRtspUrlsForCamera(OnvifCamera& camera) {
     std::cout << "Generating RTSP URLs for camera at " << camera.ipAddress << std::endl;
-    
+
     // Extract service URL
     std::string serviceUrl = camera.xaddrs;
     if (serviceUrl.empty()) {
         std::cout << "Warning: No XAddrs available, cannot reliably determine RTSP URLs" << std::endl;
         return;
     }
-    
+
     // Many ONVIF cameras follow standard RTSP URL patterns
     // Try to build some common RTSP URL patterns based on the IP address
-    
+
     // The most common RTSP URL patterns
     std::vector<std::string> rtspPatterns = {
         "rtsp://" + camera.ipAddress + ":554/onvif1",
@@ -469,15 +526,15 @@ void OnvifDiscovery::getRtspUrlsForCamera(OnvifCamera& camera) {
         "rtsp://" + camera.ipAddress + ":554/video1",
         "rtsp://" + camera.ipAddress + ":554/video"
     };
-    
+
     // Add these patterns to the camera's RTSP URLs
     camera.rtspUrls = rtspPatterns;
-    
+
     std::cout << "Generated " << rtspPatterns.size() << " potential RTSP URLs" << std::endl;
     for (const auto& url : rtspPatterns) {
         std::cout << "  - " << url << std::endl;
     }
-    
+
     // Note: A more robust implementation would make an actual ONVIF request
     // to get the exact RTSP URLs, but that requires ONVIF client implementation
     // which is beyond the scope of this example.
@@ -485,7 +542,7 @@ void OnvifDiscovery::getRtspUrlsForCamera(OnvifCamera& camera) {
 
 nlohmann::json OnvifDiscovery::camerasToJson(const std::vector<OnvifCamera>& cameras) {
     nlohmann::json result = nlohmann::json::array();
-    
+
     for (const auto& camera : cameras) {
         nlohmann::json cameraJson;
         cameraJson["name"] = camera.name;
@@ -494,18 +551,18 @@ nlohmann::json OnvifDiscovery::camerasToJson(const std::vector<OnvifCamera>& cam
         cameraJson["endpoint_reference"] = camera.endpointReference;
         cameraJson["types"] = camera.types;
         cameraJson["xaddrs"] = camera.xaddrs;
-        
+
         // Add RTSP URLs
         nlohmann::json rtspUrls = nlohmann::json::array();
         for (const auto& url : camera.rtspUrls) {
             rtspUrls.push_back(url);
         }
         cameraJson["rtsp_urls"] = rtspUrls;
-        
+
         result.push_back(cameraJson);
     }
-    
+
     return result;
 }
 
-} // namespace tapi 
\ No newline at end of file
+} // namespace tapi
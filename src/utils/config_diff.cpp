@@ -0,0 +1,46 @@
+#include "utils/config_diff.h"
+
+namespace tapi {
+
+std::string ConfigDiff::restartKeysSummary() const {
+    std::string summary;
+    for (const auto& key : restartKeys) {
+        if (!summary.empty()) {
+            summary += ", ";
+        }
+        summary += key;
+    }
+    return summary;
+}
+
+ConfigDiff diffConfig(
+    const nlohmann::json& current,
+    const nlohmann::json& incoming,
+    const std::unordered_set<std::string>& restartRequiredKeys) {
+
+    ConfigDiff diff;
+
+    if (!incoming.is_object()) {
+        return diff;
+    }
+
+    for (auto it = incoming.begin(); it != incoming.end(); ++it) {
+        // Unchanged values are not changes, regardless of classification
+        if (current.is_object()) {
+            auto currentIt = current.find(it.key());
+            if (currentIt != current.end() && *currentIt == it.value()) {
+                continue;
+            }
+        }
+
+        if (restartRequiredKeys.count(it.key()) > 0) {
+            diff.restartKeys.push_back(it.key());
+        } else {
+            diff.hotKeys.push_back(it.key());
+        }
+    }
+
+    return diff;
+}
+
+} // namespace tapi
@@ -0,0 +1,163 @@
+#include "utils/cuda_shm_utils.h"
+#include <cstring>
+#include <iostream>
+#include "utils/shm_utils.h"
+
+namespace tapi
+{
+    namespace utils
+    {
+
+        TritonCudaSharedMemory::TritonCudaSharedMemory()
+            : devPtr_(nullptr), size_(0), isValid_(false), registered_(false),
+              registeredClient_(nullptr)
+        {
+            std::memset(&handle_, 0, sizeof(handle_));
+        }
+
+        TritonCudaSharedMemory::~TritonCudaSharedMemory()
+        {
+            cleanup();
+        }
+
+        std::string TritonCudaSharedMemory::createRegion(size_t byteSize, const std::string &name)
+        {
+#ifdef TRITON_ENABLE_GPU
+            // Clean up any previous region
+            cleanup();
+
+            if (name.empty())
+            {
+                name_ = "tapi_cuda_" + TritonSharedMemory::generateRandomString();
+            }
+            else
+            {
+                name_ = name;
+            }
+
+            size_ = byteSize;
+
+            cudaError_t err = cudaMalloc(&devPtr_, size_);
+            if (err != cudaSuccess)
+            {
+                std::cerr << "Failed to allocate CUDA shared memory region: "
+                          << cudaGetErrorString(err) << std::endl;
+                devPtr_ = nullptr;
+                return "";
+            }
+
+            err = cudaIpcGetMemHandle(&handle_, devPtr_);
+            if (err != cudaSuccess)
+            {
+                std::cerr << "Failed to get cudaIpc handle: " << cudaGetErrorString(err) << std::endl;
+                cudaFree(devPtr_);
+                devPtr_ = nullptr;
+                return "";
+            }
+
+            isValid_ = true;
+            return name_;
+#else
+            (void)byteSize;
+            (void)name;
+            std::cerr << "CUDA shared memory requested but binary was built without TRITON_ENABLE_GPU" << std::endl;
+            return "";
+#endif // TRITON_ENABLE_GPU
+        }
+
+        bool TritonCudaSharedMemory::registerWithTritonServer(
+            triton::client::InferenceServerGrpcClient *client)
+        {
+            if (!isValid_ || client == nullptr)
+            {
+                return false;
+            }
+
+            std::cout << "Registering CUDA shared memory region '" << name_
+                      << "' (" << size_ << " bytes) with Triton server" << std::endl;
+
+            triton::client::Error err =
+                client->RegisterCudaSharedMemory(name_, handle_, 0 /* device_id */, size_);
+            if (!err.IsOk())
+            {
+                std::cerr << "Failed to register CUDA shared memory: " << err.Message() << std::endl;
+                return false;
+            }
+
+            registered_ = true;
+            registeredClient_ = client;
+            return true;
+        }
+
+        bool TritonCudaSharedMemory::unregisterFromTritonServer()
+        {
+            if (!registered_ || registeredClient_ == nullptr)
+            {
+                return true; // Nothing to unregister
+            }
+
+            triton::client::Error err = registeredClient_->UnregisterCudaSharedMemory(name_);
+            registered_ = false;
+            registeredClient_ = nullptr;
+
+            if (!err.IsOk())
+            {
+                std::cerr << "Failed to unregister CUDA shared memory: " << err.Message() << std::endl;
+                return false;
+            }
+
+            std::cout << "Unregistered CUDA shared memory region '" << name_ << "'" << std::endl;
+            return true;
+        }
+
+        bool TritonCudaSharedMemory::copyFromHost(const void *data, size_t byteSize)
+        {
+#ifdef TRITON_ENABLE_GPU
+            if (!isValid_ || byteSize > size_)
+            {
+                return false;
+            }
+
+            cudaError_t err = cudaMemcpy(devPtr_, data, byteSize, cudaMemcpyHostToDevice);
+            if (err != cudaSuccess)
+            {
+                std::cerr << "Failed to copy tensor to CUDA shared memory: "
+                          << cudaGetErrorString(err) << std::endl;
+                return false;
+            }
+
+            return true;
+#else
+            (void)data;
+            (void)byteSize;
+            return false;
+#endif // TRITON_ENABLE_GPU
+        }
+
+        bool TritonCudaSharedMemory::isValid() const
+        {
+            return isValid_ && devPtr_ != nullptr;
+        }
+
+        void TritonCudaSharedMemory::cleanup()
+        {
+            if (registered_)
+            {
+                unregisterFromTritonServer();
+            }
+
+#ifdef TRITON_ENABLE_GPU
+            if (devPtr_ != nullptr)
+            {
+                cudaFree(devPtr_);
+                devPtr_ = nullptr;
+            }
+#endif // TRITON_ENABLE_GPU
+
+            name_.clear();
+            size_ = 0;
+            isValid_ = false;
+        }
+
+    } // namespace utils
+} // namespace tapi
@@ -0,0 +1,93 @@
+#include "utils/frame_memory_budget.h"
+#include "utils/frame_pool.h"
+#include "logger.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace tapi {
+namespace utils {
+
+FrameMemoryBudget& FrameMemoryBudget::getInstance() {
+    static FrameMemoryBudget instance;
+    return instance;
+}
+
+FrameMemoryBudget::FrameMemoryBudget()
+    : budgetBytes_(0),
+      usedBytes_(0),
+      trims_(0) {
+    const char* env = std::getenv("TAPI_FRAME_BUDGET_MB");
+    if (env && *env) {
+        try {
+            long mb = std::stol(env);
+            if (mb > 0) {
+                budgetBytes_ = static_cast<size_t>(mb) * 1024 * 1024;
+                LOG_INFO("FrameMemoryBudget", "Frame memory budget set to " +
+                         std::to_string(mb) + " MB");
+            }
+        } catch (const std::exception&) {
+            LOG_WARN("FrameMemoryBudget", std::string("Ignoring unparseable TAPI_FRAME_BUDGET_MB: ") + env);
+        }
+    }
+}
+
+bool FrameMemoryBudget::shouldShed(ShedClass cls) const {
+    if (budgetBytes_ == 0) {
+        return false;
+    }
+    size_t used = usedBytes_.load(std::memory_order_relaxed);
+    switch (cls) {
+        case ShedClass::Annotation:
+            return used >= static_cast<size_t>(budgetBytes_ * kAnnotationShedRatio);
+        case ShedClass::Recording:
+            return used >= budgetBytes_;
+    }
+    return false;
+}
+
+void FrameMemoryBudget::addBytes(size_t bytes) {
+    size_t used = usedBytes_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    if (budgetBytes_ != 0 && used > budgetBytes_) {
+        shedIdleBuffers();
+    }
+}
+
+void FrameMemoryBudget::subBytes(size_t bytes) {
+    usedBytes_.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+void FrameMemoryBudget::registerPool(FramePool* pool) {
+    std::lock_guard<std::mutex> lock(poolsMutex_);
+    pools_.push_back(pool);
+}
+
+void FrameMemoryBudget::unregisterPool(FramePool* pool) {
+    std::lock_guard<std::mutex> lock(poolsMutex_);
+    pools_.erase(std::remove(pools_.begin(), pools_.end(), pool), pools_.end());
+}
+
+void FrameMemoryBudget::shedIdleBuffers() {
+    // Idle free-list buffers are pure headroom; reclaim them before any
+    // work is shed. Pools repopulate their lists once usage drops.
+    trims_.fetch_add(1, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(poolsMutex_);
+    for (FramePool* pool : pools_) {
+        pool->trimFree();
+    }
+}
+
+nlohmann::json FrameMemoryBudget::getStats() const {
+    nlohmann::json stats;
+    stats["budget_bytes"] = budgetBytes_;
+    stats["used_bytes"] = usedBytes_.load(std::memory_order_relaxed);
+    stats["idle_trims"] = trims_.load(std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(poolsMutex_);
+        stats["pools"] = pools_.size();
+    }
+    return stats;
+}
+
+} // namespace utils
+} // namespace tapi
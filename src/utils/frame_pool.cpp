@@ -0,0 +1,117 @@
+#include "utils/frame_pool.h"
+#include "utils/frame_memory_budget.h"
+
+namespace tapi {
+
+namespace {
+/// Bytes owned by a buffer for budget accounting
+size_t matBytes(const cv::Mat& mat) {
+    return mat.total() * mat.elemSize();
+}
+} // namespace
+
+FramePool::FramePool(size_t maxFree)
+    : maxFree_(maxFree),
+      allocated_(0),
+      outstanding_(0),
+      reuses_(0) {
+    utils::FrameMemoryBudget::getInstance().registerPool(this);
+}
+
+FramePool::~FramePool() {
+    utils::FrameMemoryBudget::getInstance().unregisterPool(this);
+    // Outstanding handles hold a weak reference to the pool and fall back
+    // to plain delete once it is gone; only the idle buffers are ours to
+    // account for here.
+    for (const auto& mat : freeList_) {
+        utils::FrameMemoryBudget::getInstance().subBytes(matBytes(*mat));
+    }
+}
+
+FramePtr FramePool::acquire(int rows, int cols, int type) {
+    std::unique_ptr<cv::Mat> mat;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!freeList_.empty()) {
+            mat = std::move(freeList_.back());
+            freeList_.pop_back();
+            reuses_++;
+        } else {
+            mat.reset(new cv::Mat());
+            allocated_++;
+        }
+        outstanding_++;
+    }
+
+    // No-op when the recycled buffer already has the right geometry; the
+    // budget sees only the delta when a reallocation actually happens
+    size_t before = matBytes(*mat);
+    mat->create(rows, cols, type);
+    size_t after = matBytes(*mat);
+    if (after > before) {
+        utils::FrameMemoryBudget::getInstance().addBytes(after - before);
+    } else if (before > after) {
+        utils::FrameMemoryBudget::getInstance().subBytes(before - after);
+    }
+
+    std::weak_ptr<FramePool> self = weak_from_this();
+    return FramePtr(mat.release(), [self](cv::Mat* m) {
+        if (auto pool = self.lock()) {
+            pool->release(m);
+        } else {
+            utils::FrameMemoryBudget::getInstance().subBytes(matBytes(*m));
+            delete m;
+        }
+    });
+}
+
+FramePtr FramePool::clone(const cv::Mat& src) {
+    FramePtr dst = acquire(src.rows, src.cols, src.type());
+    src.copyTo(*dst);
+    return dst;
+}
+
+void FramePool::release(cv::Mat* mat) {
+    // If an external cv::Mat header still shares this pixel data (the API
+    // layer keeps headers to the latest published frame), drop our data
+    // reference so the reader keeps a valid buffer and we recycle an empty
+    // mat instead.
+    if (mat->u && mat->u->refcount > 1) {
+        utils::FrameMemoryBudget::getInstance().subBytes(matBytes(*mat));
+        mat->release();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        outstanding_--;
+        if (freeList_.size() < maxFree_) {
+            freeList_.emplace_back(mat);
+            return;
+        }
+    }
+    utils::FrameMemoryBudget::getInstance().subBytes(matBytes(*mat));
+    delete mat;
+}
+
+void FramePool::trimFree() {
+    std::vector<std::unique_ptr<cv::Mat>> victims;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        victims.swap(freeList_);
+    }
+    for (const auto& mat : victims) {
+        utils::FrameMemoryBudget::getInstance().subBytes(matBytes(*mat));
+    }
+}
+
+nlohmann::json FramePool::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    nlohmann::json stats;
+    stats["allocated"] = allocated_;
+    stats["outstanding"] = outstanding_;
+    stats["free"] = freeList_.size();
+    stats["reuses"] = reuses_;
+    return stats;
+}
+
+} // namespace tapi
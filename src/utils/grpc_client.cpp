@@ -28,6 +28,7 @@
 #define TRITON_INFERENCE_SERVER_CLIENT_CLASS InferenceServerGrpcClient
 #include "utils/grpc_client.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <fstream>
@@ -36,6 +37,8 @@
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "utils/common.h"
 
@@ -44,14 +47,21 @@ namespace {
 
 //==============================================================================
 
-// Use map to keep track of GRPC channels. <key, value> : <url, <shared_count,
-// Channel*, Stub*>> If context is created on url that has established Channel
-// and hasn't reached max shared count, then reuse it.
-std::map<
-    std::string, std::tuple<
-                     size_t, std::shared_ptr<grpc::Channel>,
-                     std::shared_ptr<inference::GRPCInferenceService::Stub>>>
-    grpc_channel_stub_map_;
+// Process-wide pool of GRPC channels keyed by server url. gRPC
+// multiplexes concurrent requests as HTTP/2 streams over one channel, so
+// every client created for the same url shares a small fixed set of
+// channels (round-robin) instead of opening its own connection. Stubs are
+// shared along with their channel.
+struct GrpcChannelPool {
+  // Index of the next channel to hand out, advanced per client so stream
+  // load spreads evenly across the pool.
+  size_t next_idx = 0;
+  std::vector<std::pair<
+      std::shared_ptr<grpc::Channel>,
+      std::shared_ptr<inference::GRPCInferenceService::Stub>>>
+      channels;
+};
+std::map<std::string, GrpcChannelPool> grpc_channel_stub_map_;
 std::mutex grpc_channel_stub_map_mtx_;
 
 std::string
@@ -85,22 +95,23 @@ GetStub(
 {
   std::lock_guard<std::mutex> lock(grpc_channel_stub_map_mtx_);
 
-  // Limit the number of sharing for each channel connects to the url,
-  // distributing clients to different channels relieves
-  // the pressure of reaching max connection concurrency
-  // https://grpc.io/docs/guides/performance/ (4th point)
-  static const size_t max_share_count =
-      std::stoul(GetEnvironmentVariableOrDefault(
-          "TRITON_CLIENT_GRPC_CHANNEL_MAX_SHARE_COUNT", "6"));
-  const auto& channel_itr = grpc_channel_stub_map_.find(url);
-  // Reuse cached channel if the channel is found in the map and
-  // use_cached_channel flag is true
-  if ((channel_itr != grpc_channel_stub_map_.end()) && use_cached_channel) {
-    // check if NewStub should be created
-    const auto& shared_count = std::get<0>(channel_itr->second);
-    if (shared_count % max_share_count != 0) {
-      std::get<0>(channel_itr->second)++;
-      return std::get<2>(channel_itr->second);
+  // Number of connections shared per server url. One multiplexed channel
+  // is enough for most deployments; raising this fans streams across
+  // additional connections when the server caps HTTP/2
+  // MAX_CONCURRENT_STREAMS or a single connection saturates.
+  // https://grpc.io/docs/guides/performance/
+  static const size_t channels_per_url = std::max<size_t>(
+      1, std::stoul(GetEnvironmentVariableOrDefault(
+             "TRITON_CLIENT_GRPC_CHANNELS_PER_URL", "2")));
+
+  if (use_cached_channel) {
+    auto& pool = grpc_channel_stub_map_[url];
+    if (pool.channels.size() >= channels_per_url) {
+      // Pool is full: hand out pooled channels round-robin so stream
+      // load spreads evenly
+      const auto& entry = pool.channels[pool.next_idx % pool.channels.size()];
+      pool.next_idx++;
+      return entry.second;
     }
   }
 
@@ -136,21 +147,62 @@ GetStub(
   std::shared_ptr<inference::GRPCInferenceService::Stub> stub =
       inference::GRPCInferenceService::NewStub(channel);
 
-  // If `use_cached_channel` is true, create no new channels even if there
-  // are no cached channels.
+  // Grow the pool toward channels_per_url; once full, every subsequent
+  // client for this url shares the pooled channels above.
   if (use_cached_channel) {
-    // Replace if channel / stub have been in the map
-    if (channel_itr != grpc_channel_stub_map_.end()) {
-      channel_itr->second = std::make_tuple(1, channel, stub);
-    } else {
-      grpc_channel_stub_map_.insert(
-          std::make_pair(url, std::make_tuple(1, channel, stub)));
-    }
+    grpc_channel_stub_map_[url].channels.emplace_back(channel, stub);
   }
 
   return stub;
 }
 
+// Process-wide pool of response protobuf messages, one pool per message
+// type. A cleared protobuf message keeps the heap blocks backing its
+// repeated fields and byte strings, so recycling messages amortizes the
+// per-call allocations the same way arena reuse would — without tying
+// message lifetime to a client or stream: results handed to callers hold
+// their message through a pool-returning deleter and recycle it whenever
+// they are destroyed.
+template <typename MessageType>
+class ResponseMessagePool {
+ public:
+  static std::shared_ptr<MessageType> Acquire()
+  {
+    static auto pool = std::make_shared<ResponseMessagePool>();
+
+    MessageType* message = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(pool->mtx_);
+      if (!pool->messages_.empty()) {
+        message = pool->messages_.back().release();
+        pool->messages_.pop_back();
+      }
+    }
+    if (message == nullptr) {
+      message = new MessageType();
+    }
+
+    std::shared_ptr<ResponseMessagePool> self = pool;
+    return std::shared_ptr<MessageType>(message, [self](MessageType* msg) {
+      msg->Clear();
+      std::lock_guard<std::mutex> lock(self->mtx_);
+      if (self->messages_.size() < max_pooled_messages_) {
+        self->messages_.emplace_back(msg);
+      } else {
+        delete msg;
+      }
+    });
+  }
+
+ private:
+  // Bounds the memory retained by idle messages; in steady state the pool
+  // holds roughly the number of responses in flight at once.
+  static constexpr size_t max_pooled_messages_ = 16;
+
+  std::mutex mtx_;
+  std::vector<std::unique_ptr<MessageType>> messages_;
+};
+
 /// Set client timeout
 ///
 /// \param client_timeout_ms Deadline for timeout in microseconds
@@ -173,7 +225,8 @@ class GrpcInferRequest : public InferRequest {
  public:
   GrpcInferRequest(InferenceServerClient::OnCompleteFn callback = nullptr)
       : InferRequest(callback), grpc_status_(),
-        grpc_response_(std::make_shared<inference::ModelInferResponse>())
+        grpc_response_(
+            ResponseMessagePool<inference::ModelInferResponse>::Acquire())
   {
   }
 
@@ -1468,6 +1521,12 @@ InferenceServerGrpcClient::PreRunProcessing(
     }
   }
 
+  // Pre-size the repeated fields so the loops below never grow them
+  // incrementally; the exact tensor counts are known from the call itself.
+  infer_request_.mutable_inputs()->Reserve(inputs.size());
+  infer_request_.mutable_outputs()->Reserve(outputs.size());
+  infer_request_.mutable_raw_input_contents()->Reserve(inputs.size());
+
   int index = 0;
   infer_request_.mutable_raw_input_contents()->Clear();
   for (const auto input : inputs) {
@@ -1629,7 +1688,7 @@ void
 InferenceServerGrpcClient::AsyncStreamTransfer()
 {
   std::shared_ptr<inference::ModelStreamInferResponse> response =
-      std::make_shared<inference::ModelStreamInferResponse>();
+      ResponseMessagePool<inference::ModelStreamInferResponse>::Acquire();
   // End loop if Read() returns false
   // (stream ended and all responses are drained)
   while (grpc_stream_->Read(response.get())) {
@@ -1667,7 +1726,7 @@ InferenceServerGrpcClient::AsyncStreamTransfer()
       std::cout << response->DebugString() << std::endl;
     }
     stream_callback_(stream_result);
-    response = std::make_shared<inference::ModelStreamInferResponse>();
+    response = ResponseMessagePool<inference::ModelStreamInferResponse>::Acquire();
   }
   grpc_stream_->Finish();
 }
@@ -33,6 +33,8 @@
 #include <atomic>
 #include <climits>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <deque>
 #include <iostream>
 #include <string>
@@ -62,6 +64,14 @@ namespace {
 
 constexpr char kContentLengthHTTPHeader[] = "Content-Length";
 
+// Sizing for the keep-alive connection pool maintained by the multi
+// handle. Each client instance targets a single endpoint, so the
+// per-host limit bounds concurrent connections to that endpoint while
+// the cache size keeps completed connections open for reuse instead of
+// re-establishing TCP (and TLS) for every asynchronous inference.
+constexpr long kKeepAliveConnectionsPerEndpoint = 8;
+constexpr long kMaxCachedConnections = 16;
+
 //==============================================================================
 
 // Global initialization for libcurl. Libcurl requires global
@@ -345,6 +355,11 @@ class HttpInferRequest : public InferRequest {
   // be valid during the transfer and can be freed once transfer is completed.
   struct curl_slist* header_list_;
 
+  // Signature of the static portion of 'header_list_' (everything but
+  // the inference-header-length entry); the client uses it to decide
+  // whether a reclaimed list can serve a later request.
+  std::string header_signature_;
+
   // HTTP response code for the inference request
   long http_code_;
 
@@ -1367,6 +1382,12 @@ InferenceServerHttpClient::InferenceServerHttpClient(
       easy_handle_(reinterpret_cast<void*>(curl_easy_init())),
       multi_handle_(curl_multi_init())
 {
+  // Keep completed connections cached in the multi handle so subsequent
+  // asynchronous requests reuse them rather than reconnecting.
+  curl_multi_setopt(multi_handle_, CURLMOPT_MAXCONNECTS, kMaxCachedConnections);
+  curl_multi_setopt(
+      multi_handle_, CURLMOPT_MAX_HOST_CONNECTIONS,
+      kKeepAliveConnectionsPerEndpoint);
 }
 
 InferenceServerHttpClient::~InferenceServerHttpClient()
@@ -1387,6 +1408,12 @@ InferenceServerHttpClient::~InferenceServerHttpClient()
   if (easy_handle_ != nullptr) {
     curl_easy_cleanup(reinterpret_cast<CURL*>(easy_handle_));
   }
+  for (auto easy_handle : easy_handle_pool_) {
+    curl_easy_cleanup(reinterpret_cast<CURL*>(easy_handle));
+  }
+  for (auto& pooled : header_list_pool_) {
+    curl_slist_free_all(pooled.list);
+  }
   curl_multi_cleanup(multi_handle_);
 }
 
@@ -1823,6 +1850,9 @@ InferenceServerHttpClient::Infer(
         easy_handle_, CURLINFO_RESPONSE_CODE, &sync_request->http_code_);
   }
 
+  // Transfer finished; pool the header list for the next request
+  ReclaimHeaderList(sync_request.get());
+
   InferResultHttp::Create(result, sync_request);
 
   sync_request->Timer().CaptureTimestamp(RequestTimers::Kind::REQUEST_END);
@@ -1870,13 +1900,13 @@ InferenceServerHttpClient::AsyncInfer(
 
   async_request->Timer().CaptureTimestamp(RequestTimers::Kind::REQUEST_START);
 
-  CURL* multi_easy_handle = curl_easy_init();
+  CURL* multi_easy_handle = reinterpret_cast<CURL*>(GetAsyncEasyHandle());
   Error err = PreRunProcessing(
       reinterpret_cast<void*>(multi_easy_handle), request_uri, options, inputs,
       outputs, headers, query_params, request_compression_algorithm,
       response_compression_algorithm, async_request);
   if (!err.IsOk()) {
-    curl_easy_cleanup(multi_easy_handle);
+    ReleaseAsyncEasyHandle(reinterpret_cast<void*>(multi_easy_handle));
     return err;
   }
 
@@ -1884,6 +1914,7 @@ InferenceServerHttpClient::AsyncInfer(
     std::lock_guard<std::mutex> lock(mutex_);
 
     if (exiting_) {
+      curl_easy_cleanup(multi_easy_handle);
       return Error("Client is exiting.");
     }
 
@@ -2159,6 +2190,9 @@ InferenceServerHttpClient::PreRunProcessing(
   curl_easy_setopt(curl, CURLOPT_USERAGENT, "libcurl-agent/1.0");
   curl_easy_setopt(curl, CURLOPT_POST, 1L);
   curl_easy_setopt(curl, CURLOPT_TCP_NODELAY, 1L);
+  // Probe pooled keep-alive connections so a silently dropped connection
+  // is detected instead of surfacing as a failed inference.
+  curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
 
   if (options.client_timeout_ != 0) {
     uint64_t timeout_ms = (options.client_timeout_ / 1000);
@@ -2193,34 +2227,50 @@ InferenceServerHttpClient::PreRunProcessing(
     return err;
   }
 
-  struct curl_slist* list = nullptr;
-
   std::string infer_hdr{
       std::string(kInferHeaderContentLengthHTTPHeader) + ": " +
       std::to_string(http_request->request_json_.Size())};
-  list = curl_slist_append(list, infer_hdr.c_str());
-  list = curl_slist_append(list, "Expect:");
-  if (all_inputs_are_json) {
-    list = curl_slist_append(list, "Content-Type: application/json");
-  } else {
-    list = curl_slist_append(list, "Content-Type: application/octet-stream");
-  }
 
+  // Signature of every header entry except the length prefix above;
+  // steady-state inference traffic repeats it verbatim, so completed
+  // requests' lists are pooled and reused when the signature matches.
+  std::string header_signature{all_inputs_are_json ? "json" : "binary"};
   for (const auto& pr : headers) {
-    std::string hdr = pr.first + ": " + pr.second;
-    list = curl_slist_append(list, hdr.c_str());
+    header_signature += '\n' + pr.first + ": " + pr.second;
+  }
+  if (request_compression_algorithm != CompressionType::NONE) {
+    header_signature += (request_compression_algorithm ==
+                         CompressionType::DEFLATE)
+                            ? "\ndeflate"
+                            : "\ngzip";
   }
 
-  // Compress data if requested
-  switch (request_compression_algorithm) {
-    case CompressionType::NONE:
-      break;
-    case CompressionType::DEFLATE:
-      list = curl_slist_append(list, "Content-Encoding: deflate");
-      break;
-    case CompressionType::GZIP:
-      list = curl_slist_append(list, "Content-Encoding: gzip");
-      break;
+  struct curl_slist* list = AcquireHeaderList(header_signature, infer_hdr);
+  if (list == nullptr) {
+    list = curl_slist_append(list, infer_hdr.c_str());
+    list = curl_slist_append(list, "Expect:");
+    if (all_inputs_are_json) {
+      list = curl_slist_append(list, "Content-Type: application/json");
+    } else {
+      list = curl_slist_append(list, "Content-Type: application/octet-stream");
+    }
+
+    for (const auto& pr : headers) {
+      std::string hdr = pr.first + ": " + pr.second;
+      list = curl_slist_append(list, hdr.c_str());
+    }
+
+    // Compress data if requested
+    switch (request_compression_algorithm) {
+      case CompressionType::NONE:
+        break;
+      case CompressionType::DEFLATE:
+        list = curl_slist_append(list, "Content-Encoding: deflate");
+        break;
+      case CompressionType::GZIP:
+        list = curl_slist_append(list, "Content-Encoding: gzip");
+        break;
+    }
   }
   switch (response_compression_algorithm) {
     case CompressionType::NONE:
@@ -2234,8 +2284,10 @@ InferenceServerHttpClient::PreRunProcessing(
   }
   curl_easy_setopt(curl, CURLOPT_HTTPHEADER, list);
 
-  // The list will be freed when the request is destructed
+  // The list is reclaimed into the pool on completion, or freed by the
+  // request destructor on error paths
   http_request->header_list_ = list;
+  http_request->header_signature_ = std::move(header_signature);
 
   if (verbose_) {
     std::cout << "inference request: " << http_request->request_json_.Contents()
@@ -2245,6 +2297,71 @@ InferenceServerHttpClient::PreRunProcessing(
   return Error::Success;
 }
 
+void*
+InferenceServerHttpClient::GetAsyncEasyHandle()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!easy_handle_pool_.empty()) {
+      void* easy_handle = easy_handle_pool_.back();
+      easy_handle_pool_.pop_back();
+      return easy_handle;
+    }
+  }
+  return reinterpret_cast<void*>(curl_easy_init());
+}
+
+void
+InferenceServerHttpClient::ReleaseAsyncEasyHandle(void* easy_handle)
+{
+  // Clear the per-request options; the underlying connection belongs to
+  // the multi handle's cache and survives the reset.
+  curl_easy_reset(reinterpret_cast<CURL*>(easy_handle));
+  std::lock_guard<std::mutex> lock(mutex_);
+  easy_handle_pool_.push_back(easy_handle);
+}
+
+struct curl_slist*
+InferenceServerHttpClient::AcquireHeaderList(
+    const std::string& signature, const std::string& infer_hdr)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  while (!header_list_pool_.empty()) {
+    PooledHeaderList pooled = std::move(header_list_pool_.back());
+    header_list_pool_.pop_back();
+    if (pooled.signature != signature) {
+      // Header set changed (e.g. different custom headers); the stale
+      // list is of no further use
+      curl_slist_free_all(pooled.list);
+      continue;
+    }
+    // Rewrite the per-request length entry in place; it is always the
+    // first node and everything after it matches the signature. The
+    // node's string was allocated with strdup by curl, so free/strdup
+    // pairs with it.
+    free(pooled.list->data);
+    pooled.list->data = strdup(infer_hdr.c_str());
+    if (pooled.list->data == nullptr) {
+      curl_slist_free_all(pooled.list);
+      continue;
+    }
+    return pooled.list;
+  }
+  return nullptr;
+}
+
+void
+InferenceServerHttpClient::ReclaimHeaderList(HttpInferRequest* request)
+{
+  if (request->header_list_ == nullptr) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  header_list_pool_.push_back(
+      {request->header_list_, std::move(request->header_signature_)});
+  request->header_list_ = nullptr;
+}
+
 void
 InferenceServerHttpClient::AsyncTransfer()
 {
@@ -2310,12 +2427,16 @@ InferenceServerHttpClient::AsyncTransfer()
       }
 
       async_request->http_code_ = http_code;
+      // Transfer finished; pool the header list for the next request
+      ReclaimHeaderList(async_request.get());
       InferResult* result;
       InferResultHttp::Create(&result, async_request);
       async_request->callback_(result);
       ongoing_async_requests.erase(itr);
       curl_multi_remove_handle(multi_handle_, msg->easy_handle);
-      curl_easy_cleanup(msg->easy_handle);
+      // The connection stays cached in the multi handle; the reset easy
+      // handle is pooled for the next request to pick it back up.
+      ReleaseAsyncEasyHandle(msg->easy_handle);
     }
 
     // Wait for activity on existing requests or
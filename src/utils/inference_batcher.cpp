@@ -0,0 +1,446 @@
+#include "utils/inference_batcher.h"
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include "logger.h"
+
+namespace tapi {
+
+// How long the dispatcher waits for a streamed batch result before
+// failing the batch. Generous compared to any sane inference time so it
+// only fires when the stream itself has died.
+static constexpr int STREAM_RESULT_TIMEOUT_SECS = 30;
+
+InferenceBatcher& InferenceBatcher::getInstance() {
+    static InferenceBatcher instance;
+    return instance;
+}
+
+InferenceBatcher::InferenceBatcher()
+    : stopRequested_(false),
+      batchWindowMicros_(10000),
+      maxBatchSize_(16),
+      streamingEnabled_(true),
+      streamRequestSeq_(0),
+      batchCount_(0),
+      itemCount_(0),
+      expiredCount_(0),
+      rejectedCount_(0),
+      backendLatencyEwmaMicros_(0) {
+    dispatcher_ = std::thread(&InferenceBatcher::dispatcherLoop, this);
+}
+
+InferenceBatcher::~InferenceBatcher() {
+    stopRequested_ = true;
+    cv_.notify_all();
+    if (dispatcher_.joinable()) {
+        dispatcher_.join();
+    }
+
+    // Fail anything still pending so waiters are not stuck
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& item : pending_) {
+        Response response;
+        response.error = "Batcher shutting down";
+        item.promise.set_value(std::move(response));
+    }
+    pending_.clear();
+}
+
+void InferenceBatcher::setBatchWindowMicros(int64_t micros) {
+    batchWindowMicros_ = micros;
+}
+
+void InferenceBatcher::setMaxBatchSize(size_t maxBatch) {
+    maxBatchSize_ = std::max<size_t>(1, maxBatch);
+}
+
+void InferenceBatcher::setStreamingEnabled(bool enabled) {
+    streamingEnabled_ = enabled;
+}
+
+std::string InferenceBatcher::batchKey(const Request& request) {
+    std::ostringstream key;
+    key << request.protocol << "|" << request.serverUrl << "|" << request.modelId
+        << "|" << request.inputName << "|" << request.datatype;
+    for (int64_t dim : request.itemShape) {
+        key << "," << dim;
+    }
+    return key.str();
+}
+
+std::future<InferenceBatcher::Response> InferenceBatcher::submit(Request request) {
+    PendingItem item;
+    item.request = std::move(request);
+    item.enqueuedAt = std::chrono::steady_clock::now();
+    std::future<Response> future = item.promise.get_future();
+
+    // Admission control: once the measured backend round trip alone
+    // exceeds a best-effort item's freshness budget, the result would be
+    // stale on arrival, so refuse it up front rather than queueing work
+    // the backend cannot finish in time. Priority items are always
+    // admitted and degrade by latency, not by loss.
+    const int64_t ewma = backendLatencyEwmaMicros_.load(std::memory_order_relaxed);
+    if (item.request.priority <= 0 && item.request.deadlineMicros > 0 && ewma > 0 &&
+        ewma + batchWindowMicros_.load() > item.request.deadlineMicros) {
+        rejectedCount_.fetch_add(1, std::memory_order_relaxed);
+        Response response;
+        response.error = "Rejected: measured backend latency exceeds request deadline";
+        item.promise.set_value(std::move(response));
+        return future;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.push_back(std::move(item));
+    }
+    cv_.notify_one();
+
+    return future;
+}
+
+void InferenceBatcher::dispatcherLoop() {
+    while (!stopRequested_) {
+        std::vector<PendingItem> batch;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return stopRequested_ || !pending_.empty(); });
+            if (stopRequested_) {
+                return;
+            }
+
+            // Age out best-effort items whose deadline passed while they
+            // waited; priority items are served late rather than dropped
+            auto now = std::chrono::steady_clock::now();
+            std::vector<PendingItem> live;
+            live.reserve(pending_.size());
+            for (auto& item : pending_) {
+                if (item.request.priority <= 0 && item.request.deadlineMicros > 0 &&
+                    now - item.enqueuedAt >
+                        std::chrono::microseconds(item.request.deadlineMicros)) {
+                    expiredCount_.fetch_add(1, std::memory_order_relaxed);
+                    Response response;
+                    response.error = "Dropped: deadline expired before dispatch";
+                    item.promise.set_value(std::move(response));
+                } else {
+                    live.push_back(std::move(item));
+                }
+            }
+            pending_ = std::move(live);
+            if (pending_.empty()) {
+                continue;
+            }
+
+            // Dispatch order: higher tier first, oldest first within a
+            // tier, so priority cameras preempt queue position under load
+            auto dispatchesBefore = [](const PendingItem& a, const PendingItem& b) {
+                if (a.request.priority != b.request.priority) {
+                    return a.request.priority > b.request.priority;
+                }
+                return a.enqueuedAt < b.enqueuedAt;
+            };
+
+            // Wait out the aggregation window so frames from other cameras
+            // can join this batch, seeding it from the item that should
+            // dispatch first rather than plain queue order
+            auto seed = std::min_element(pending_.begin(), pending_.end(),
+                                         dispatchesBefore);
+            std::string key = batchKey(seed->request);
+            auto deadline = std::chrono::steady_clock::now() +
+                            std::chrono::microseconds(batchWindowMicros_.load());
+            while (std::chrono::steady_clock::now() < deadline && !stopRequested_) {
+                size_t compatible = 0;
+                for (const auto& item : pending_) {
+                    if (batchKey(item.request) == key) {
+                        compatible++;
+                    }
+                }
+                if (compatible >= maxBatchSize_) {
+                    break; // Batch is full, dispatch now
+                }
+                cv_.wait_until(lock, deadline);
+            }
+
+            // Pull compatible items out of the pending list, preserving
+            // the order of the rest; when more are compatible than fit,
+            // the batch takes them in dispatch order so best-effort frames
+            // are the ones left waiting
+            std::vector<PendingItem> compatible;
+            std::vector<PendingItem> remaining;
+            for (auto& item : pending_) {
+                if (batchKey(item.request) == key) {
+                    compatible.push_back(std::move(item));
+                } else {
+                    remaining.push_back(std::move(item));
+                }
+            }
+            std::stable_sort(compatible.begin(), compatible.end(), dispatchesBefore);
+            for (auto& item : compatible) {
+                if (batch.size() < maxBatchSize_) {
+                    batch.push_back(std::move(item));
+                } else {
+                    remaining.push_back(std::move(item));
+                }
+            }
+            pending_ = std::move(remaining);
+        }
+
+        if (!batch.empty()) {
+            runBatch(std::move(batch));
+        }
+    }
+}
+
+triton::client::InferenceServerHttpClient* InferenceBatcher::getHttpClient(const std::string& serverUrl) {
+    auto it = httpClients_.find(serverUrl);
+    if (it != httpClients_.end()) {
+        return it->second.get();
+    }
+
+    std::unique_ptr<triton::client::InferenceServerHttpClient> client;
+    triton::client::Error err =
+        triton::client::InferenceServerHttpClient::Create(&client, serverUrl, false);
+    if (!err.IsOk()) {
+        LOG_ERROR("InferenceBatcher", "Failed to create HTTP client for " + serverUrl + ": " + err.Message());
+        return nullptr;
+    }
+    auto* raw = client.get();
+    httpClients_[serverUrl] = std::move(client);
+    return raw;
+}
+
+triton::client::InferenceServerGrpcClient* InferenceBatcher::getGrpcClient(const std::string& serverUrl) {
+    auto it = grpcClients_.find(serverUrl);
+    if (it != grpcClients_.end()) {
+        return it->second.get();
+    }
+
+    // Strip scheme and map the default HTTP port to the gRPC port, matching
+    // the detector's client setup
+    std::string grpcUrl = serverUrl;
+    if (grpcUrl.find("http://") == 0) {
+        grpcUrl = grpcUrl.substr(7);
+    } else if (grpcUrl.find("https://") == 0) {
+        grpcUrl = grpcUrl.substr(8);
+    }
+    if (!grpcUrl.empty() && grpcUrl.back() == '/') {
+        grpcUrl.pop_back();
+    }
+    size_t colonPos = grpcUrl.rfind(':');
+    if (colonPos != std::string::npos && grpcUrl.substr(colonPos + 1) == "8000") {
+        grpcUrl = grpcUrl.substr(0, colonPos) + ":8001";
+    }
+
+    std::unique_ptr<triton::client::InferenceServerGrpcClient> client;
+    triton::client::Error err =
+        triton::client::InferenceServerGrpcClient::Create(&client, grpcUrl, false);
+    if (!err.IsOk()) {
+        LOG_ERROR("InferenceBatcher", "Failed to create gRPC client for " + grpcUrl + ": " + err.Message());
+        return nullptr;
+    }
+
+    // Open a long-lived bidirectional stream so each batch is a stream
+    // write instead of a fresh unary RPC. The callback runs on the
+    // client's stream worker thread and files results by request id.
+    if (streamingEnabled_) {
+        auto state = std::make_shared<StreamState>();
+        triton::client::Error streamErr = client->StartStream(
+            [state](triton::client::InferResult* rawResult) {
+                std::unique_ptr<triton::client::InferResult> result(rawResult);
+                std::string requestId;
+                if (!result->Id(&requestId).IsOk() || requestId.empty()) {
+                    LOG_WARN("InferenceBatcher", "Dropping streamed result without a request id");
+                    return;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    state->results[requestId] = std::move(result);
+                }
+                state->cv.notify_all();
+            });
+        if (streamErr.IsOk()) {
+            grpcStreams_[serverUrl] = state;
+            LOG_INFO("InferenceBatcher", "Streaming inference enabled for " + grpcUrl);
+        } else {
+            LOG_WARN("InferenceBatcher", "Failed to start inference stream for " + grpcUrl +
+                     ", falling back to unary: " + streamErr.Message());
+        }
+    }
+
+    auto* raw = client.get();
+    grpcClients_[serverUrl] = std::move(client);
+    return raw;
+}
+
+void InferenceBatcher::runBatch(std::vector<PendingItem> items) {
+    const Request& first = items.front().request;
+    const size_t batchSize = items.size();
+
+    auto failAll = [&items](const std::string& error) {
+        for (auto& item : items) {
+            Response response;
+            response.error = error;
+            item.promise.set_value(std::move(response));
+        }
+    };
+
+    const auto batchStart = std::chrono::steady_clock::now();
+
+    try {
+        // Batched input shape: leading dim becomes the batch size
+        std::vector<int64_t> batchShape = first.itemShape;
+        batchShape[0] = static_cast<int64_t>(batchSize);
+
+        triton::client::InferInput* rawInput = nullptr;
+        triton::client::Error err = triton::client::InferInput::Create(
+            &rawInput, first.inputName, batchShape, first.datatype);
+        if (!err.IsOk()) {
+            failAll("Failed to create batched input: " + err.Message());
+            return;
+        }
+        std::unique_ptr<triton::client::InferInput> input(rawInput);
+
+        for (const auto& item : items) {
+            err = input->AppendRaw(item.request.inputData);
+            if (!err.IsOk()) {
+                failAll("Failed to append batch item: " + err.Message());
+                return;
+            }
+        }
+
+        std::vector<std::unique_ptr<triton::client::InferRequestedOutput>> outputs;
+        std::vector<const triton::client::InferRequestedOutput*> outputPtrs;
+        for (const auto& name : first.outputNames) {
+            triton::client::InferRequestedOutput* rawOutput = nullptr;
+            err = triton::client::InferRequestedOutput::Create(&rawOutput, name);
+            if (!err.IsOk()) {
+                failAll("Failed to create output '" + name + "': " + err.Message());
+                return;
+            }
+            outputs.emplace_back(rawOutput);
+            outputPtrs.push_back(rawOutput);
+        }
+
+        std::vector<triton::client::InferInput*> inputPtrs{input.get()};
+        triton::client::InferOptions options(first.modelId);
+        triton::client::InferResult* rawResult = nullptr;
+
+        if (first.protocol == "grpc") {
+            auto* client = getGrpcClient(first.serverUrl);
+            if (!client) {
+                failAll("No gRPC client available for " + first.serverUrl);
+                return;
+            }
+
+            auto streamIt = grpcStreams_.find(first.serverUrl);
+            if (streamIt != grpcStreams_.end()) {
+                // Streaming path: write the batch to the open stream and
+                // wait for the correlated response
+                auto state = streamIt->second;
+                options.request_id_ =
+                    "batch-" + std::to_string(streamRequestSeq_.fetch_add(1));
+                err = client->AsyncStreamInfer(options, inputPtrs, outputPtrs);
+                if (!err.IsOk()) {
+                    // Stream write failed, so the stream is likely dead;
+                    // tear it down and let this and later batches go unary
+                    LOG_WARN("InferenceBatcher", "Stream write to " + first.serverUrl +
+                             " failed, reverting to unary: " + err.Message());
+                    client->StopStream();
+                    grpcStreams_.erase(streamIt);
+                    err = client->Infer(&rawResult, options, inputPtrs, outputPtrs);
+                } else {
+                    std::unique_lock<std::mutex> lock(state->mutex);
+                    bool arrived = state->cv.wait_for(
+                        lock, std::chrono::seconds(STREAM_RESULT_TIMEOUT_SECS),
+                        [&] { return state->results.count(options.request_id_) > 0; });
+                    if (!arrived) {
+                        failAll("Timed out waiting for streamed inference result from " +
+                                first.serverUrl);
+                        return;
+                    }
+                    rawResult = state->results[options.request_id_].release();
+                    state->results.erase(options.request_id_);
+                    // Stream delivery reports per-request errors on the
+                    // result rather than the call
+                    err = rawResult->RequestStatus();
+                }
+            } else {
+                err = client->Infer(&rawResult, options, inputPtrs, outputPtrs);
+            }
+        } else {
+            auto* client = getHttpClient(first.serverUrl);
+            if (!client) {
+                failAll("No HTTP client available for " + first.serverUrl);
+                return;
+            }
+            err = client->Infer(&rawResult, options, inputPtrs, outputPtrs);
+        }
+
+        std::unique_ptr<triton::client::InferResult> result(rawResult);
+        if (!err.IsOk()) {
+            failAll("Batched inference failed: " + err.Message());
+            return;
+        }
+
+        // Feed the measured round trip into the 1/8-weight EWMA that
+        // drives best-effort admission control
+        const int64_t sample = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - batchStart).count();
+        const int64_t prev = backendLatencyEwmaMicros_.load(std::memory_order_relaxed);
+        backendLatencyEwmaMicros_.store(prev == 0 ? sample : (prev * 7 + sample) / 8,
+                                        std::memory_order_relaxed);
+
+        // Demultiplex: each output tensor has the batch as its leading
+        // dimension, so every item owns an equal slice of the raw bytes
+        std::vector<Response> responses(batchSize);
+        for (auto& response : responses) {
+            response.ok = true;
+        }
+
+        for (const auto& name : first.outputNames) {
+            const uint8_t* buf = nullptr;
+            size_t byteSize = 0;
+            err = result->RawData(name, &buf, &byteSize);
+            if (!err.IsOk()) {
+                failAll("Error getting output '" + name + "': " + err.Message());
+                return;
+            }
+            if (byteSize % batchSize != 0) {
+                failAll("Output '" + name + "' size is not divisible by batch size");
+                return;
+            }
+            size_t itemBytes = byteSize / batchSize;
+            for (size_t i = 0; i < batchSize; i++) {
+                responses[i].outputs[name].assign(buf + i * itemBytes,
+                                                  buf + (i + 1) * itemBytes);
+            }
+        }
+
+        for (size_t i = 0; i < batchSize; i++) {
+            items[i].promise.set_value(std::move(responses[i]));
+        }
+
+        batchCount_.fetch_add(1, std::memory_order_relaxed);
+        itemCount_.fetch_add(batchSize, std::memory_order_relaxed);
+    } catch (const std::exception& e) {
+        failAll(std::string("Exception in batched inference: ") + e.what());
+    }
+}
+
+nlohmann::json InferenceBatcher::getStats() const {
+    nlohmann::json stats;
+    uint64_t batches = batchCount_.load();
+    uint64_t items = itemCount_.load();
+    stats["batches"] = batches;
+    stats["items"] = items;
+    stats["avg_batch_size"] = batches > 0 ? static_cast<double>(items) / batches : 0.0;
+    stats["batch_window_us"] = batchWindowMicros_.load();
+    stats["max_batch_size"] = maxBatchSize_.load();
+    stats["grpc_streaming"] = streamingEnabled_.load();
+    stats["expired_items"] = expiredCount_.load();
+    stats["rejected_items"] = rejectedCount_.load();
+    stats["backend_latency_ewma_us"] = backendLatencyEwmaMicros_.load();
+    return stats;
+}
+
+} // namespace tapi
@@ -0,0 +1,230 @@
+#include "utils/jpeg_encoder.h"
+#include "logger.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#include <gst/gst.h>
+#include <gst/app/gstappsink.h>
+#include <gst/app/gstappsrc.h>
+
+namespace tapi {
+namespace utils {
+
+JpegEncoder& JpegEncoder::getInstance() {
+    static JpegEncoder instance;
+    return instance;
+}
+
+JpegEncoder::JpegEncoder() {
+    const char* env = std::getenv("TAPI_HW_JPEG");
+    if (env && std::string(env) == "off") {
+        LOG_INFO("JpegEncoder", "Hardware JPEG encoding disabled via TAPI_HW_JPEG=off");
+        return;
+    }
+    detectHardwareEncoder();
+}
+
+JpegEncoder::~JpegEncoder() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    destroyPipeline();
+}
+
+void JpegEncoder::detectHardwareEncoder() {
+    // OpenCV's GStreamer backend usually initialized the library already;
+    // gst_init is idempotent so the explicit call is just insurance for
+    // encode-before-capture startup orders
+    if (!gst_is_initialized()) {
+        gst_init(nullptr, nullptr);
+    }
+
+    // Preference order matches GStreamerSource: NVIDIA first, then VAAPI
+    for (const char* candidate : {"nvjpegenc", "vaapijpegenc"}) {
+        GstElementFactory* factory = gst_element_factory_find(candidate);
+        if (factory) {
+            gst_object_unref(factory);
+            hwElement_ = candidate;
+            LOG_INFO("JpegEncoder", "Using hardware JPEG encoder: " + hwElement_);
+            return;
+        }
+    }
+
+    LOG_INFO("JpegEncoder", "No hardware JPEG encoder found, using cv::imencode");
+}
+
+std::string JpegEncoder::activeEncoder() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (hwElement_.empty() || hwDisabled_) ? "imencode" : hwElement_;
+}
+
+bool JpegEncoder::ensurePipeline(int width, int height, int quality) {
+    if (pipeline_ && pipelineWidth_ == width && pipelineHeight_ == height &&
+        pipelineQuality_ == quality) {
+        return true;
+    }
+    destroyPipeline();
+
+    // Both nvjpegenc and vaapijpegenc take a quality property on the same
+    // 1-100 scale as IMWRITE_JPEG_QUALITY
+    std::string description =
+        "appsrc name=src is-live=true format=time ! videoconvert ! " +
+        hwElement_ + " quality=" + std::to_string(quality) +
+        " ! appsink name=sink sync=false max-buffers=2 drop=false";
+
+    GError* error = nullptr;
+    GstElement* pipeline = gst_parse_launch(description.c_str(), &error);
+    if (!pipeline) {
+        LOG_ERROR("JpegEncoder", "Failed to build hardware encode pipeline: " +
+                  std::string(error ? error->message : "unknown error"));
+        if (error) {
+            g_error_free(error);
+        }
+        return false;
+    }
+    if (error) {
+        g_error_free(error);
+    }
+
+    GstElement* appsrc = gst_bin_get_by_name(GST_BIN(pipeline), "src");
+    GstElement* appsink = gst_bin_get_by_name(GST_BIN(pipeline), "sink");
+
+    GstCaps* caps = gst_caps_new_simple(
+        "video/x-raw",
+        "format", G_TYPE_STRING, "BGR",
+        "width", G_TYPE_INT, width,
+        "height", G_TYPE_INT, height,
+        "framerate", GST_TYPE_FRACTION, 0, 1,
+        nullptr);
+    gst_app_src_set_caps(GST_APP_SRC(appsrc), caps);
+    gst_caps_unref(caps);
+
+    if (gst_element_set_state(pipeline, GST_STATE_PLAYING) == GST_STATE_CHANGE_FAILURE) {
+        LOG_ERROR("JpegEncoder", "Hardware encode pipeline refused to start");
+        gst_object_unref(appsrc);
+        gst_object_unref(appsink);
+        gst_object_unref(pipeline);
+        return false;
+    }
+
+    pipeline_ = pipeline;
+    appsrc_ = appsrc;
+    appsink_ = appsink;
+    pipelineWidth_ = width;
+    pipelineHeight_ = height;
+    pipelineQuality_ = quality;
+    return true;
+}
+
+void JpegEncoder::destroyPipeline() {
+    if (!pipeline_) {
+        return;
+    }
+    gst_element_set_state(GST_ELEMENT(pipeline_), GST_STATE_NULL);
+    gst_object_unref(GST_ELEMENT(appsrc_));
+    gst_object_unref(GST_ELEMENT(appsink_));
+    gst_object_unref(GST_ELEMENT(pipeline_));
+    pipeline_ = nullptr;
+    appsrc_ = nullptr;
+    appsink_ = nullptr;
+    pipelineWidth_ = 0;
+    pipelineHeight_ = 0;
+    pipelineQuality_ = 0;
+}
+
+bool JpegEncoder::encodeHardware(const cv::Mat& frame, int quality,
+                                 std::vector<uchar>& out) {
+    if (!ensurePipeline(frame.cols, frame.rows, quality)) {
+        return false;
+    }
+
+    // appsrc takes ownership of the buffer, so the frame bytes are copied
+    // in; non-continuous headers (ROI views) are compacted first
+    const cv::Mat continuous = frame.isContinuous() ? frame : frame.clone();
+    const size_t size = continuous.total() * continuous.elemSize();
+    GstBuffer* buffer = gst_buffer_new_allocate(nullptr, size, nullptr);
+    gst_buffer_fill(buffer, 0, continuous.data, size);
+
+    if (gst_app_src_push_buffer(GST_APP_SRC(appsrc_), buffer) != GST_FLOW_OK) {
+        LOG_ERROR("JpegEncoder", "Hardware encoder rejected frame push");
+        return false;
+    }
+
+    // Bounded wait: a wedged hardware encoder must not stall snapshot
+    // routes, it just demotes us to the software path
+    GstSample* sample = gst_app_sink_try_pull_sample(GST_APP_SINK(appsink_),
+                                                     500 * GST_MSECOND);
+    if (!sample) {
+        LOG_ERROR("JpegEncoder", "Timed out waiting for hardware encoder output");
+        return false;
+    }
+
+    GstBuffer* outBuffer = gst_sample_get_buffer(sample);
+    GstMapInfo map;
+    if (!outBuffer || !gst_buffer_map(outBuffer, &map, GST_MAP_READ)) {
+        gst_sample_unref(sample);
+        return false;
+    }
+    out.assign(map.data, map.data + map.size);
+    gst_buffer_unmap(outBuffer, &map);
+    gst_sample_unref(sample);
+    return true;
+}
+
+JpegBuffer JpegEncoder::acquireBuffer() {
+    std::vector<uchar>* raw = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(bufferMutex_);
+        if (!freeBuffers_.empty()) {
+            raw = freeBuffers_.back().release();
+            freeBuffers_.pop_back();
+        }
+    }
+    if (!raw) {
+        raw = new std::vector<uchar>();
+    }
+    raw->clear(); // Keeps capacity, so warm buffers encode with no allocation
+
+    return JpegBuffer(raw, [this](std::vector<uchar>* buffer) {
+        releaseBuffer(buffer);
+    });
+}
+
+void JpegEncoder::releaseBuffer(std::vector<uchar>* buffer) {
+    std::lock_guard<std::mutex> lock(bufferMutex_);
+    if (freeBuffers_.size() < kMaxFreeBuffers) {
+        freeBuffers_.emplace_back(buffer);
+    } else {
+        delete buffer;
+    }
+}
+
+JpegBuffer JpegEncoder::encode(const cv::Mat& frame, int quality) {
+    if (frame.empty()) {
+        return nullptr;
+    }
+
+    JpegBuffer buffer = acquireBuffer();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!hwElement_.empty() && !hwDisabled_) {
+            if (encodeHardware(frame, quality, *buffer)) {
+                return buffer;
+            }
+            // Sticky demotion: one runtime failure means every future
+            // encode goes through cv::imencode without re-probing
+            LOG_ERROR("JpegEncoder", "Hardware JPEG path failed, falling back to cv::imencode for this process");
+            hwDisabled_ = true;
+            destroyPipeline();
+        }
+    }
+
+    std::vector<int> params = {cv::IMWRITE_JPEG_QUALITY, quality};
+    if (!cv::imencode(".jpg", frame, *buffer, params)) {
+        return nullptr;
+    }
+    return buffer;
+}
+
+} // namespace utils
+} // namespace tapi
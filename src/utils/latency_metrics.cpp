@@ -0,0 +1,218 @@
+#include "utils/latency_metrics.h"
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+namespace tapi {
+
+LatencyMetrics::Histogram::Histogram(std::string stageName, std::string component)
+    : stage(std::move(stageName)), componentId(std::move(component)) {
+    for (auto& bucket : buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+LatencyMetrics::LatencyMetrics()
+    : histograms_(std::make_shared<HistogramMap>()),
+      counters_(std::make_shared<CounterMap>()) {
+}
+
+LatencyMetrics& LatencyMetrics::getInstance() {
+    static LatencyMetrics instance;
+    return instance;
+}
+
+std::shared_ptr<const LatencyMetrics::HistogramMap> LatencyMetrics::snapshot() const {
+    return std::atomic_load_explicit(&histograms_, std::memory_order_acquire);
+}
+
+std::shared_ptr<LatencyMetrics::Histogram> LatencyMetrics::getOrCreate(
+    const std::string& key, const std::string& stage, const std::string& componentId) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Another thread may have inserted the key while we waited on the lock
+    auto current = snapshot();
+    auto it = current->find(key);
+    if (it != current->end()) {
+        return it->second;
+    }
+
+    auto histogram = std::make_shared<Histogram>(stage, componentId);
+    auto next = std::make_shared<HistogramMap>(*current);
+    (*next)[key] = histogram;
+    std::atomic_store_explicit(&histograms_,
+                               std::shared_ptr<const HistogramMap>(std::move(next)),
+                               std::memory_order_release);
+    return histogram;
+}
+
+void LatencyMetrics::record(const std::string& stage, const std::string& componentId,
+                            int64_t micros) {
+    const std::string key = stage + "|" + componentId;
+    std::shared_ptr<Histogram> histogram;
+    {
+        auto current = snapshot();
+        auto it = current->find(key);
+        if (it != current->end()) {
+            histogram = it->second;
+        }
+    }
+    if (!histogram) {
+        histogram = getOrCreate(key, stage, componentId);
+    }
+
+    StageHandle(std::move(histogram)).record(micros);
+}
+
+LatencyMetrics::StageHandle LatencyMetrics::stageHandle(const std::string& stage,
+                                                        const std::string& componentId) {
+    return StageHandle(getOrCreate(stage + "|" + componentId, stage, componentId));
+}
+
+void LatencyMetrics::StageHandle::record(int64_t micros) const {
+    if (!histogram_) {
+        return;
+    }
+    if (micros < 0) {
+        micros = 0;
+    }
+
+    // Bucket index is the position of the sample's highest set bit, so
+    // bucket i covers (2^(i-1), 2^i] microseconds
+    size_t index = 0;
+    uint64_t value = static_cast<uint64_t>(micros);
+    while (value > (1ULL << index) && index < BUCKET_COUNT - 1) {
+        index++;
+    }
+
+    histogram_->buckets[index].fetch_add(1, std::memory_order_relaxed);
+    histogram_->count.fetch_add(1, std::memory_order_relaxed);
+    histogram_->sumMicros.fetch_add(static_cast<uint64_t>(micros),
+                                    std::memory_order_relaxed);
+}
+
+std::shared_ptr<const LatencyMetrics::CounterMap> LatencyMetrics::counterSnapshot() const {
+    return std::atomic_load_explicit(&counters_, std::memory_order_acquire);
+}
+
+std::shared_ptr<LatencyMetrics::Counter> LatencyMetrics::getOrCreateCounter(
+    const std::string& key, const std::string& name, const std::string& labels) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Another thread may have inserted the key while we waited on the lock
+    auto current = counterSnapshot();
+    auto it = current->find(key);
+    if (it != current->end()) {
+        return it->second;
+    }
+
+    auto counter = std::make_shared<Counter>(name, labels);
+    auto next = std::make_shared<CounterMap>(*current);
+    (*next)[key] = counter;
+    std::atomic_store_explicit(&counters_,
+                               std::shared_ptr<const CounterMap>(std::move(next)),
+                               std::memory_order_release);
+    return counter;
+}
+
+void LatencyMetrics::incrementCounter(const std::string& name, const std::string& labels) {
+    addToCounter(name, labels, 1);
+}
+
+void LatencyMetrics::addToCounter(const std::string& name, const std::string& labels, uint64_t delta) {
+    const std::string key = name + "{" + labels + "}";
+    std::shared_ptr<Counter> counter;
+    {
+        auto current = counterSnapshot();
+        auto it = current->find(key);
+        if (it != current->end()) {
+            counter = it->second;
+        }
+    }
+    if (!counter) {
+        counter = getOrCreateCounter(key, name, labels);
+    }
+    counter->value.fetch_add(delta, std::memory_order_relaxed);
+}
+
+LatencyMetrics::StageTotals LatencyMetrics::stageTotals(const std::string& stage) const {
+    StageTotals totals;
+    auto current = snapshot();
+    for (const auto& pair : *current) {
+        if (pair.second->stage == stage) {
+            totals.count += pair.second->count.load(std::memory_order_relaxed);
+            totals.sumMicros += pair.second->sumMicros.load(std::memory_order_relaxed);
+        }
+    }
+    return totals;
+}
+
+std::string LatencyMetrics::renderPrometheus() const {
+    std::ostringstream out;
+    out << "# HELP tapi_stage_latency_seconds Per-stage frame pipeline latency.\n";
+    out << "# TYPE tapi_stage_latency_seconds histogram\n";
+
+    auto current = snapshot();
+
+    // Stable output order makes scrapes diffable
+    std::vector<std::shared_ptr<Histogram>> ordered;
+    ordered.reserve(current->size());
+    for (const auto& pair : *current) {
+        ordered.push_back(pair.second);
+    }
+    std::sort(ordered.begin(), ordered.end(),
+              [](const std::shared_ptr<Histogram>& a, const std::shared_ptr<Histogram>& b) {
+                  if (a->stage != b->stage) {
+                      return a->stage < b->stage;
+                  }
+                  return a->componentId < b->componentId;
+              });
+
+    for (const auto& histogram : ordered) {
+        const std::string labels = "stage=\"" + histogram->stage +
+                                   "\",component=\"" + histogram->componentId + "\"";
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < BUCKET_COUNT - 1; i++) {
+            cumulative += histogram->buckets[i].load(std::memory_order_relaxed);
+            const double upperSeconds = static_cast<double>(1ULL << i) / 1e6;
+            out << "tapi_stage_latency_seconds_bucket{" << labels << ",le=\""
+                << upperSeconds << "\"} " << cumulative << "\n";
+        }
+        const uint64_t count = histogram->count.load(std::memory_order_relaxed);
+        out << "tapi_stage_latency_seconds_bucket{" << labels << ",le=\"+Inf\"} "
+            << count << "\n";
+        out << "tapi_stage_latency_seconds_sum{" << labels << "} "
+            << static_cast<double>(histogram->sumMicros.load(std::memory_order_relaxed)) / 1e6
+            << "\n";
+        out << "tapi_stage_latency_seconds_count{" << labels << "} " << count << "\n";
+    }
+
+    auto currentCounters = counterSnapshot();
+    std::vector<std::shared_ptr<Counter>> orderedCounters;
+    orderedCounters.reserve(currentCounters->size());
+    for (const auto& pair : *currentCounters) {
+        orderedCounters.push_back(pair.second);
+    }
+    std::sort(orderedCounters.begin(), orderedCounters.end(),
+              [](const std::shared_ptr<Counter>& a, const std::shared_ptr<Counter>& b) {
+                  if (a->name != b->name) {
+                      return a->name < b->name;
+                  }
+                  return a->labels < b->labels;
+              });
+
+    std::string lastName;
+    for (const auto& counter : orderedCounters) {
+        if (counter->name != lastName) {
+            out << "# TYPE " << counter->name << " counter\n";
+            lastName = counter->name;
+        }
+        out << counter->name << "{" << counter->labels << "} "
+            << counter->value.load(std::memory_order_relaxed) << "\n";
+    }
+
+    return out.str();
+}
+
+} // namespace tapi
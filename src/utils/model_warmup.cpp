@@ -0,0 +1,216 @@
+#include "utils/model_warmup.h"
+#include "utils/grpc_client.h"
+#include "logger.h"
+
+#include <chrono>
+#include <cstdint>
+#include <set>
+#include <thread>
+
+namespace tapi {
+
+// Detector default when a processor entry has no explicit model_id
+// (matches the ObjectDetectorProcessor constructor default)
+static const char* DEFAULT_DETECTION_MODEL = "yolov7";
+
+// Bytes per element for the tensor datatypes the server reports
+static size_t elementSize(const std::string& datatype) {
+    if (datatype == "FP64" || datatype == "INT64" || datatype == "UINT64") return 8;
+    if (datatype == "FP32" || datatype == "INT32" || datatype == "UINT32") return 4;
+    if (datatype == "FP16" || datatype == "INT16" || datatype == "UINT16") return 2;
+    if (datatype == "INT8" || datatype == "UINT8" || datatype == "BOOL") return 1;
+    return 0;  // BYTES and anything unknown: no fixed element size
+}
+
+// Same HTTP-to-gRPC endpoint normalization as the detector: strip the
+// scheme and move the conventional Triton HTTP port to the gRPC one
+static std::string toGrpcUrl(std::string url) {
+    if (url.find("http://") == 0) {
+        url = url.substr(7);
+    } else if (url.find("https://") == 0) {
+        url = url.substr(8);
+    }
+    if (!url.empty() && url.back() == '/') {
+        url.pop_back();
+    }
+    size_t colonPos = url.rfind(':');
+    if (colonPos != std::string::npos && url.substr(colonPos + 1) == "8000") {
+        url = url.substr(0, colonPos) + ":8001";
+    }
+    return url;
+}
+
+std::vector<std::string> ModelWarmup::collectModelIds(const nlohmann::json& allCameras) {
+    std::vector<std::string> modelIds;
+    std::set<std::string> seen;
+
+    if (!allCameras.is_object()) {
+        return modelIds;
+    }
+
+    for (const auto& entry : allCameras.items()) {
+        const auto& cameraConfig = entry.value();
+        if (!cameraConfig.contains("processors") || !cameraConfig["processors"].is_array()) {
+            continue;
+        }
+
+        for (const auto& spec : cameraConfig["processors"]) {
+            if (!spec.contains("type") || !spec["type"].is_string() ||
+                spec["type"].get<std::string>() != "object_detection") {
+                continue;
+            }
+
+            std::string modelId = DEFAULT_DETECTION_MODEL;
+            if (spec.contains("config") && spec["config"].is_object()) {
+                const auto& config = spec["config"];
+                if (config.contains("model_id") && config["model_id"].is_string() &&
+                    !config["model_id"].get<std::string>().empty()) {
+                    modelId = config["model_id"].get<std::string>();
+                }
+            }
+
+            if (seen.insert(modelId).second) {
+                modelIds.push_back(modelId);
+            }
+        }
+    }
+
+    return modelIds;
+}
+
+bool ModelWarmup::warmupModel(triton::client::InferenceServerGrpcClient* client,
+                              const std::string& modelId, int timeoutSecs) {
+    // Explicit load request. Servers running with repository polling
+    // reject this, which is fine — the readiness poll below still gates
+    // on the model coming up.
+    triton::client::Error err = client->LoadModel(modelId);
+    if (!err.IsOk()) {
+        LOG_WARN("ModelWarmup", "LoadModel for '" + modelId + "' not accepted (" +
+                 err.Message() + "), polling readiness anyway");
+    }
+
+    // Poll until the server reports the model ready
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(timeoutSecs);
+    bool ready = false;
+    for (;;) {
+        err = client->IsModelReady(&ready, modelId);
+        if (err.IsOk() && ready) {
+            break;
+        }
+        if (std::chrono::steady_clock::now() >= deadline) {
+            LOG_WARN("ModelWarmup", "Model '" + modelId + "' not ready after " +
+                     std::to_string(timeoutSecs) + "s, skipping warmup");
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    }
+
+    // Build one zero-filled input tensor per model input and run a single
+    // inference so CUDA graph capture and allocator growth happen now
+    inference::ModelMetadataResponse metadata;
+    err = client->ModelMetadata(&metadata, modelId);
+    if (!err.IsOk()) {
+        LOG_WARN("ModelWarmup", "Failed to get metadata for '" + modelId + "': " + err.Message());
+        return false;
+    }
+
+    std::vector<triton::client::InferInput*> inputs;
+    bool buildFailed = false;
+    for (int i = 0; i < metadata.inputs_size(); ++i) {
+        const auto& inputMeta = metadata.inputs(i);
+
+        size_t elemSize = elementSize(inputMeta.datatype());
+        if (elemSize == 0) {
+            LOG_WARN("ModelWarmup", "Model '" + modelId + "' input '" + inputMeta.name() +
+                     "' has unsupported datatype " + inputMeta.datatype() + ", skipping warmup");
+            buildFailed = true;
+            break;
+        }
+
+        // Dynamic dimensions (batch, variable image sizes) run as 1
+        std::vector<int64_t> shape;
+        size_t elementCount = 1;
+        for (int d = 0; d < inputMeta.shape_size(); ++d) {
+            int64_t dim = inputMeta.shape(d) > 0 ? inputMeta.shape(d) : 1;
+            shape.push_back(dim);
+            elementCount *= static_cast<size_t>(dim);
+        }
+
+        triton::client::InferInput* input = nullptr;
+        err = triton::client::InferInput::Create(&input, inputMeta.name(), shape,
+                                                 inputMeta.datatype());
+        if (!err.IsOk()) {
+            LOG_WARN("ModelWarmup", "Failed to create warmup input for '" + modelId +
+                     "': " + err.Message());
+            buildFailed = true;
+            break;
+        }
+        inputs.push_back(input);
+
+        std::vector<uint8_t> zeros(elementCount * elemSize, 0);
+        err = input->AppendRaw(zeros);
+        if (!err.IsOk()) {
+            LOG_WARN("ModelWarmup", "Failed to fill warmup input for '" + modelId +
+                     "': " + err.Message());
+            buildFailed = true;
+            break;
+        }
+    }
+
+    bool warmed = false;
+    if (!buildFailed && !inputs.empty()) {
+        triton::client::InferOptions options(modelId);
+        triton::client::InferResult* result = nullptr;
+        // Empty requested-output list asks for every output
+        std::vector<const triton::client::InferRequestedOutput*> outputs;
+        err = client->Infer(&result, options, inputs, outputs);
+        if (err.IsOk()) {
+            warmed = true;
+        } else {
+            LOG_WARN("ModelWarmup", "Warmup inference for '" + modelId + "' failed: " +
+                     err.Message());
+        }
+        delete result;
+    }
+
+    for (auto* input : inputs) {
+        delete input;
+    }
+
+    return warmed;
+}
+
+size_t ModelWarmup::warmupModels(const std::string& serverUrl,
+                                 const std::vector<std::string>& modelIds,
+                                 int timeoutSecs) {
+    if (modelIds.empty()) {
+        return 0;
+    }
+
+    std::unique_ptr<triton::client::InferenceServerGrpcClient> client;
+    triton::client::Error err = triton::client::InferenceServerGrpcClient::Create(
+        &client, toGrpcUrl(serverUrl), false);
+    if (!err.IsOk()) {
+        LOG_WARN("ModelWarmup", "Could not reach inference server at " + serverUrl +
+                 " for model warmup: " + err.Message());
+        return 0;
+    }
+
+    size_t warmed = 0;
+    for (const auto& modelId : modelIds) {
+        const auto start = std::chrono::steady_clock::now();
+        if (warmupModel(client.get(), modelId, timeoutSecs)) {
+            auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start).count();
+            LOG_INFO("ModelWarmup", "Model '" + modelId + "' loaded and warmed in " +
+                     std::to_string(elapsedMs) + "ms");
+            warmed++;
+        }
+    }
+
+    LOG_INFO("ModelWarmup", "Warmed " + std::to_string(warmed) + "/" +
+             std::to_string(modelIds.size()) + " model(s) before camera restore");
+    return warmed;
+}
+
+} // namespace tapi
@@ -0,0 +1,68 @@
+#include "utils/motion_gate.h"
+
+namespace tapi {
+
+MotionGate::MotionGate()
+    : enabled_(false),
+      sensitivity_(0.01),
+      heartbeatIntervalMs_(3000),
+      cooldownMs_(2000),
+      pixelThreshold_(25),
+      lastMotionMs_(0),
+      lastInferenceMs_(0),
+      suppressedFrames_(0),
+      totalFrames_(0) {
+}
+
+void MotionGate::configure(const nlohmann::json& config) {
+    if (config.is_null() || !config.is_object() || config.empty()) {
+        enabled_ = false;
+        return;
+    }
+
+    enabled_ = config.value("enabled", false);
+    sensitivity_ = config.value("sensitivity", 0.01);
+    heartbeatIntervalMs_ = config.value("heartbeat_interval_ms", 3000);
+    cooldownMs_ = config.value("cooldown_ms", 2000);
+    pixelThreshold_ = config.value("pixel_threshold", 25);
+}
+
+bool MotionGate::shouldRunInference(const cv::Mat& frame, int64_t timestampMs) {
+    totalFrames_++;
+
+    // The kernel runs even on heartbeat-only frames so the reference
+    // plane never goes stale
+    auto kernelResult = kernel_.process(frame, pixelThreshold_, sensitivity_);
+    motionRois_ = std::move(kernelResult.rois);
+    if (kernelResult.motion) {
+        lastMotionMs_ = timestampMs;
+    }
+
+    const bool inCooldown = (timestampMs - lastMotionMs_.load()) <= cooldownMs_;
+    const bool heartbeatDue = (timestampMs - lastInferenceMs_) >= heartbeatIntervalMs_;
+
+    if (inCooldown || heartbeatDue) {
+        lastInferenceMs_ = timestampMs;
+        return true;
+    }
+
+    suppressedFrames_++;
+    return false;
+}
+
+nlohmann::json MotionGate::getStatus() const {
+    const uint64_t total = totalFrames_.load();
+    const uint64_t suppressed = suppressedFrames_.load();
+
+    nlohmann::json status;
+    status["enabled"] = enabled_;
+    status["total_frames"] = total;
+    status["suppressed_frames"] = suppressed;
+    status["suppressed_ratio"] = total > 0
+        ? static_cast<double>(suppressed) / total : 0.0;
+    status["last_motion_ms"] = lastMotionMs_.load();
+    status["motion_roi_count"] = motionRois_.size();
+    return status;
+}
+
+} // namespace tapi
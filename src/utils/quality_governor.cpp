@@ -0,0 +1,197 @@
+#include "utils/quality_governor.h"
+#include "utils/latency_metrics.h"
+#include "logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace tapi {
+namespace utils {
+
+namespace {
+
+// Read a positive number from the environment, falling back to the
+// default on unset or unparseable values
+double envNumber(const char* name, double fallback) {
+    const char* env = std::getenv(name);
+    if (!env || !*env) {
+        return fallback;
+    }
+    try {
+        double value = std::stod(env);
+        return value > 0 ? value : fallback;
+    } catch (const std::exception&) {
+        LOG_WARN("QualityGovernor", std::string("Ignoring unparseable ") + name + ": " + env);
+        return fallback;
+    }
+}
+
+} // namespace
+
+QualityGovernor& QualityGovernor::getInstance() {
+    static QualityGovernor instance;
+    return instance;
+}
+
+QualityGovernor::QualityGovernor() {
+    const char* env = std::getenv("TAPI_GOVERNOR");
+    enabled_ = !(env && std::string(env) == "0");
+
+    cpuHighPct_ = envNumber("TAPI_GOVERNOR_CPU_HIGH", 85.0);
+    frameAgeHighMs_ = envNumber("TAPI_GOVERNOR_FRAME_AGE_MS", 500.0);
+    maxStrideMultiplier_ = std::max(1, static_cast<int>(envNumber("TAPI_GOVERNOR_MAX_STRIDE", 4.0)));
+
+    if (!enabled_) {
+        LOG_INFO("QualityGovernor", "Disabled via TAPI_GOVERNOR=0");
+        return;
+    }
+
+    running_ = true;
+    thread_ = std::thread(&QualityGovernor::monitorThread, this);
+    LOG_INFO("QualityGovernor", "Monitoring load (CPU high " + std::to_string(static_cast<int>(cpuHighPct_)) +
+             "%, frame age high " + std::to_string(static_cast<int>(frameAgeHighMs_)) +
+             "ms, max stride x" + std::to_string(maxStrideMultiplier_) + ")");
+}
+
+QualityGovernor::~QualityGovernor() {
+    shutdown();
+}
+
+void QualityGovernor::shutdown() {
+    if (running_.exchange(false) && thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void QualityGovernor::monitorThread() {
+    // Prime the deltas so the first real sample covers one full interval
+    sampleCpuPercent();
+    sampleFrameAgeMs();
+
+    int healthySamples = 0;
+
+    while (running_) {
+        for (int i = 0; i < kSampleIntervalSecs * 10 && running_; i++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        if (!running_) {
+            break;
+        }
+
+        const double cpu = sampleCpuPercent();
+        const double ageMs = sampleFrameAgeMs();
+        lastCpuPercent_.store(cpu, std::memory_order_relaxed);
+        lastFrameAgeMs_.store(ageMs, std::memory_order_relaxed);
+
+        const bool overloaded = (cpu >= 0 && cpu >= cpuHighPct_) ||
+                                (ageMs >= 0 && ageMs >= frameAgeHighMs_);
+        // Recovery needs real headroom, not just dipping under the
+        // escalation threshold, so the level does not flap at the edge
+        const bool healthy = (cpu < 0 || cpu <= cpuHighPct_ * 0.8) &&
+                             (ageMs < 0 || ageMs <= frameAgeHighMs_ * 0.5);
+
+        const int current = level_.load(std::memory_order_relaxed);
+
+        if (overloaded) {
+            healthySamples = 0;
+            if (current < kMaxLevel) {
+                applyLevel(current + 1);
+                LOG_WARN("QualityGovernor", "Load high (cpu " + std::to_string(static_cast<int>(cpu)) +
+                         "%, frame age " + std::to_string(static_cast<int>(ageMs)) +
+                         "ms), escalating to level " + std::to_string(current + 1));
+            }
+        } else if (healthy && current > 0) {
+            healthySamples++;
+            if (healthySamples >= kRecoverSamples) {
+                healthySamples = 0;
+                applyLevel(current - 1);
+                LOG_INFO("QualityGovernor", "Load recovered, restoring to level " +
+                         std::to_string(current - 1));
+            }
+        } else {
+            healthySamples = 0;
+        }
+    }
+
+    // Leave the pipeline at full quality when the governor stops
+    applyLevel(0);
+}
+
+void QualityGovernor::applyLevel(int level) {
+    level_.store(level, std::memory_order_relaxed);
+
+    int stride = 1;
+    if (level >= 3) {
+        stride = 4;
+    } else if (level >= 1) {
+        stride = 2;
+    }
+    strideMultiplier_.store(std::min(stride, maxStrideMultiplier_), std::memory_order_relaxed);
+    shedAnnotation_.store(level >= 2, std::memory_order_relaxed);
+    shedRecording_.store(level >= 3, std::memory_order_relaxed);
+
+    LatencyMetrics::getInstance().incrementCounter(
+        "tapi_governor_transitions_total", "level=\"" + std::to_string(level) + "\"");
+}
+
+double QualityGovernor::sampleCpuPercent() {
+    std::ifstream stat("/proc/stat");
+    if (!stat.is_open()) {
+        return -1.0;
+    }
+
+    std::string line;
+    std::getline(stat, line);
+    std::istringstream fields(line);
+
+    std::string label;
+    uint64_t user = 0, nice = 0, system = 0, idle = 0, iowait = 0, irq = 0, softirq = 0, steal = 0;
+    fields >> label >> user >> nice >> system >> idle >> iowait >> irq >> softirq >> steal;
+    if (label != "cpu") {
+        return -1.0;
+    }
+
+    const uint64_t busy = user + nice + system + irq + softirq + steal;
+    const uint64_t total = busy + idle + iowait;
+
+    double percent = -1.0;
+    if (prevCpuTotal_ != 0 && total > prevCpuTotal_) {
+        percent = 100.0 * static_cast<double>(busy - prevCpuBusy_) /
+                  static_cast<double>(total - prevCpuTotal_);
+    }
+    prevCpuBusy_ = busy;
+    prevCpuTotal_ = total;
+    return percent;
+}
+
+double QualityGovernor::sampleFrameAgeMs() {
+    const auto totals = LatencyMetrics::getInstance().stageTotals("frame_age");
+
+    double ageMs = -1.0;
+    if (totals.count > prevAgeCount_) {
+        ageMs = static_cast<double>(totals.sumMicros - prevAgeSumMicros_) /
+                static_cast<double>(totals.count - prevAgeCount_) / 1000.0;
+    }
+    prevAgeCount_ = totals.count;
+    prevAgeSumMicros_ = totals.sumMicros;
+    return ageMs;
+}
+
+nlohmann::json QualityGovernor::getStats() const {
+    nlohmann::json stats;
+    stats["enabled"] = enabled_;
+    stats["level"] = level_.load(std::memory_order_relaxed);
+    stats["stride_multiplier"] = strideMultiplier_.load(std::memory_order_relaxed);
+    stats["shed_annotation"] = shedAnnotation_.load(std::memory_order_relaxed);
+    stats["shed_recording"] = shedRecording_.load(std::memory_order_relaxed);
+    stats["cpu_percent"] = lastCpuPercent_.load(std::memory_order_relaxed);
+    stats["frame_age_ms"] = lastFrameAgeMs_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace utils
+} // namespace tapi
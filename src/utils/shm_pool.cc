@@ -0,0 +1,148 @@
+#include "utils/shm_pool.h"
+#include <iostream>
+
+namespace tapi
+{
+    namespace utils
+    {
+
+        SharedMemoryPool &SharedMemoryPool::getInstance()
+        {
+            static SharedMemoryPool instance;
+            return instance;
+        }
+
+        size_t SharedMemoryPool::sizeClassFor(size_t byteSize)
+        {
+            // Power-of-two classes with a 1 MB floor keep the number of
+            // distinct segments (and server registrations) small
+            size_t classSize = 1 << 20;
+            while (classSize < byteSize)
+            {
+                classSize <<= 1;
+            }
+            return classSize;
+        }
+
+        std::unique_ptr<TritonSharedMemory> SharedMemoryPool::createSegment(size_t classSize)
+        {
+            auto segment = std::unique_ptr<TritonSharedMemory>(new TritonSharedMemory());
+
+            std::string name = "tapi_pool_" + TritonSharedMemory::generateRandomString();
+            std::cout << "SharedMemoryPool: creating segment '" << name << "' ("
+                      << classSize << " bytes)" << std::endl;
+
+            // Create, map and register with the inference server once; the
+            // segment is then reused for the lifetime of the process
+            if (segment->createRegion(classSize, name).empty())
+            {
+                std::cerr << "SharedMemoryPool: failed to create segment of "
+                          << classSize << " bytes" << std::endl;
+                return nullptr;
+            }
+
+            return segment;
+        }
+
+        std::shared_ptr<TritonSharedMemory> SharedMemoryPool::lease(size_t byteSize)
+        {
+            size_t classSize = sizeClassFor(byteSize);
+
+            std::unique_ptr<TritonSharedMemory> segment;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                auto &freeList = freeSegments_[classSize];
+                if (!freeList.empty())
+                {
+                    segment = std::move(freeList.back());
+                    freeList.pop_back();
+                    reuseCount_++;
+                }
+            }
+
+            if (!segment)
+            {
+                // Creation registers with the server over HTTP, so do it
+                // outside the pool lock
+                segment = createSegment(classSize);
+                if (!segment)
+                {
+                    return nullptr;
+                }
+                std::lock_guard<std::mutex> lock(mutex_);
+                totalSegments_++;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                leaseCount_++;
+            }
+
+            // The deleter hands the segment back to the pool instead of
+            // unmapping and unlinking it
+            TritonSharedMemory *raw = segment.release();
+            return std::shared_ptr<TritonSharedMemory>(raw, [classSize](TritonSharedMemory *seg) {
+                SharedMemoryPool::getInstance().release(
+                    classSize, std::unique_ptr<TritonSharedMemory>(seg));
+            });
+        }
+
+        bool SharedMemoryPool::preallocate(size_t byteSize, size_t count)
+        {
+            size_t classSize = sizeClassFor(byteSize);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                auto segment = createSegment(classSize);
+                if (!segment)
+                {
+                    return false;
+                }
+                std::lock_guard<std::mutex> lock(mutex_);
+                freeSegments_[classSize].push_back(std::move(segment));
+                totalSegments_++;
+            }
+
+            return true;
+        }
+
+        void SharedMemoryPool::release(size_t classSize, std::unique_ptr<TritonSharedMemory> segment)
+        {
+            if (!segment)
+            {
+                return;
+            }
+
+            // A segment that lost its mapping is not worth recycling
+            if (!segment->isValid())
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                totalSegments_--;
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            freeSegments_[classSize].push_back(std::move(segment));
+        }
+
+        nlohmann::json SharedMemoryPool::getStats() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            nlohmann::json stats;
+            stats["total_segments"] = totalSegments_;
+            stats["leases"] = leaseCount_;
+            stats["reused_leases"] = reuseCount_;
+
+            nlohmann::json classes = nlohmann::json::object();
+            for (const auto &entry : freeSegments_)
+            {
+                classes[std::to_string(entry.first)] = entry.second.size();
+            }
+            stats["free_by_class"] = classes;
+
+            return stats;
+        }
+
+    } // namespace utils
+} // namespace tapi
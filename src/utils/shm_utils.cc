@@ -109,8 +109,8 @@ namespace tapi
             cleanup();
         }
 
-        std::string TritonSharedMemory::createImageSharedMemory(
-            const cv::Mat &image, const std::string &name, bool skipRegistration)
+        std::string TritonSharedMemory::createRegion(
+            size_t byteSize, const std::string &name, bool skipRegistration)
         {
 
             // Clean up any previous shared memory
@@ -119,19 +119,14 @@ namespace tapi
             // Generate a unique name if one wasn't provided
             if (name.empty())
             {
-                name_ = "tapi_img_" + generateRandomString();
+                name_ = "tapi_shm_" + generateRandomString();
             }
             else
             {
                 name_ = name;
             }
 
-            // Convert image to float32 format for model input
-            // Calculate the size needed for the float32 image (4 bytes per pixel value)
-            size_ = image.total() * image.channels() * sizeof(float);
-
-            std::cout << "Creating shared memory with size: " << size_ << " bytes for image "
-                      << image.cols << "x" << image.rows << "x" << image.channels() << std::endl;
+            size_ = byteSize;
 
             // Create shared memory region
             auto err = triton::client::CreateSharedMemoryRegion(name_, size_, &fd_);
@@ -151,6 +146,36 @@ namespace tapi
                 return "";
             }
 
+            isValid_ = true;
+
+            // Register the shared memory with Triton server if not skipped
+            if (!skipRegistration && !registerWithTritonServer())
+            {
+                std::cerr << "Failed to register shared memory with Triton server" << std::endl;
+                cleanup();
+                return "";
+            }
+
+            return name_;
+        }
+
+        std::string TritonSharedMemory::createImageSharedMemory(
+            const cv::Mat &image, const std::string &name, bool skipRegistration)
+        {
+
+            // Convert image to float32 format for model input
+            // Calculate the size needed for the float32 image (4 bytes per pixel value)
+            size_t byteSize = image.total() * image.channels() * sizeof(float);
+
+            std::cout << "Creating shared memory with size: " << byteSize << " bytes for image "
+                      << image.cols << "x" << image.rows << "x" << image.channels() << std::endl;
+
+            // Create and map the region; registration happens after the copy below
+            if (createRegion(byteSize, name, true).empty())
+            {
+                return "";
+            }
+
             // Convert and normalize the image to float32 (0-1 range)
             // This is usually what neural network models expect
             cv::Mat floatImage;
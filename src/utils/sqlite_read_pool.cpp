@@ -0,0 +1,90 @@
+#include "utils/sqlite_read_pool.h"
+#include "logger.h"
+
+namespace tapi {
+namespace utils {
+
+SqliteReadPool& SqliteReadPool::getInstance() {
+    static SqliteReadPool instance;
+    return instance;
+}
+
+SqliteReadPool::Connection::~Connection() {
+    for (auto& entry : statements_) {
+        sqlite3_finalize(entry.second);
+    }
+    if (db_) {
+        sqlite3_close(db_);
+    }
+}
+
+sqlite3_stmt* SqliteReadPool::Connection::prepareCached(const std::string& sql) {
+    auto it = statements_.find(sql);
+    if (it != statements_.end()) {
+        sqlite3_reset(it->second);
+        sqlite3_clear_bindings(it->second);
+        return it->second;
+    }
+
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+        LOG_WARN("SqliteReadPool", "Failed to prepare query: " +
+                 std::string(sqlite3_errmsg(db_)));
+        return nullptr;
+    }
+
+    // Bound cache: dynamic query shapes (filter permutations) could
+    // otherwise grow it without limit
+    if (statements_.size() >= kMaxCachedStatements) {
+        auto victim = statements_.begin();
+        sqlite3_finalize(victim->second);
+        statements_.erase(victim);
+    }
+    statements_[sql] = stmt;
+    return stmt;
+}
+
+SqliteReadPool::Lease SqliteReadPool::acquire(const std::string& dbPath) {
+    std::unique_ptr<Connection> connection;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = idle_.find(dbPath);
+        if (it != idle_.end() && !it->second.empty()) {
+            connection = std::move(it->second.back());
+            it->second.pop_back();
+        }
+    }
+
+    if (!connection) {
+        sqlite3* db = nullptr;
+        if (sqlite3_open_v2(dbPath.c_str(), &db, SQLITE_OPEN_READONLY, nullptr) != SQLITE_OK) {
+            LOG_WARN("SqliteReadPool", "Failed to open read-only connection to " + dbPath +
+                     ": " + std::string(db ? sqlite3_errmsg(db) : "out of memory"));
+            if (db) {
+                sqlite3_close(db);
+            }
+            return nullptr;
+        }
+
+        // Belt and braces on top of the read-only open, and the same
+        // busy timeout the writer uses so WAL checkpoints never surface
+        // as SQLITE_BUSY to dashboards
+        sqlite3_exec(db, "PRAGMA query_only=ON;", nullptr, nullptr, nullptr);
+        sqlite3_exec(db, "PRAGMA busy_timeout=10000;", nullptr, nullptr, nullptr);
+
+        connection.reset(new Connection(db));
+    }
+
+    Connection* raw = connection.release();
+    return Lease(raw, [this, dbPath](Connection* done) {
+        std::unique_ptr<Connection> returned(done);
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& pool = idle_[dbPath];
+        if (pool.size() < kMaxIdlePerPath) {
+            pool.push_back(std::move(returned));
+        }
+    });
+}
+
+} // namespace utils
+} // namespace tapi
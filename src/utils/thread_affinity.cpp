@@ -0,0 +1,99 @@
+#include "utils/thread_affinity.h"
+#include "logger.h"
+
+#include <cstdlib>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace tapi {
+namespace utils {
+
+std::vector<int> ThreadAffinity::parseCpuList(const std::string& list) {
+    std::vector<int> cores;
+    std::stringstream stream(list);
+    std::string token;
+    while (std::getline(stream, token, ',')) {
+        try {
+            auto dash = token.find('-');
+            if (dash == std::string::npos) {
+                cores.push_back(std::stoi(token));
+            } else {
+                int first = std::stoi(token.substr(0, dash));
+                int last = std::stoi(token.substr(dash + 1));
+                if (last < first) {
+                    return {};
+                }
+                for (int core = first; core <= last; ++core) {
+                    cores.push_back(core);
+                }
+            }
+        } catch (const std::exception&) {
+            return {};
+        }
+    }
+    return cores;
+}
+
+const std::vector<int>& ThreadAffinity::coresFromEnv(const char* envVar) {
+    // Parsed once per variable and cached; placement is fixed for the
+    // lifetime of the process
+    static std::mutex cacheMutex;
+    static std::unordered_map<std::string, std::vector<int>> cache;
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto it = cache.find(envVar);
+    if (it != cache.end()) {
+        return it->second;
+    }
+
+    std::vector<int> cores;
+    const char* value = std::getenv(envVar);
+    if (value && *value) {
+        cores = parseCpuList(value);
+        if (cores.empty()) {
+            LOG_WARN("ThreadAffinity", std::string("Ignoring unparseable cpu list in ") +
+                     envVar + ": " + value);
+        }
+    }
+    return cache.emplace(envVar, std::move(cores)).first->second;
+}
+
+void ThreadAffinity::pinCurrentThread(const std::vector<int>& cores, const std::string& role) {
+    if (cores.empty()) {
+        return;
+    }
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int core : cores) {
+        CPU_SET(core, &set);
+    }
+    int rc = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if (rc != 0) {
+        LOG_WARN("ThreadAffinity", "Failed to pin " + role + " thread (errno " +
+                 std::to_string(rc) + ")");
+    } else {
+        LOG_DEBUG("ThreadAffinity", "Pinned " + role + " thread to " +
+                  std::to_string(cores.size()) + " core(s)");
+    }
+#else
+    (void)role;
+#endif
+}
+
+void ThreadAffinity::pinPipelineThread(const std::string& role) {
+    pinCurrentThread(coresFromEnv("TAPI_PIPELINE_CORES"), role);
+}
+
+void ThreadAffinity::pinApiThread(const std::string& role) {
+    pinCurrentThread(coresFromEnv("TAPI_API_CORES"), role);
+}
+
+} // namespace utils
+} // namespace tapi
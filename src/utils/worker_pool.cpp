@@ -0,0 +1,235 @@
+#include "utils/worker_pool.h"
+#include "utils/thread_affinity.h"
+#include "logger.h"
+
+namespace tapi {
+
+WorkerPool::WorkerPool(size_t numWorkers)
+    : numWorkers_(numWorkers == 0 ? std::max<size_t>(2, std::thread::hardware_concurrency())
+                                  : numWorkers),
+      running_(false),
+      nextQueue_(0),
+      executedCount_(0),
+      stealCount_(0) {
+}
+
+WorkerPool::~WorkerPool() {
+    stop();
+}
+
+void WorkerPool::start() {
+    if (running_.exchange(true)) {
+        return; // Already running
+    }
+
+    queues_.clear();
+    for (size_t i = 0; i < numWorkers_; i++) {
+        queues_.emplace_back(new WorkerQueue());
+    }
+
+    for (size_t i = 0; i < numWorkers_; i++) {
+        workers_.emplace_back(&WorkerPool::workerLoop, this, i);
+    }
+
+    LOG_INFO("WorkerPool", "Started " + std::to_string(numWorkers_) + " pipeline workers");
+}
+
+void WorkerPool::stop() {
+    if (!running_.exchange(false)) {
+        return; // Already stopped
+    }
+
+    timerCV_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers_.clear();
+
+    {
+        std::lock_guard<std::mutex> lock(timerMutex_);
+        while (!timerHeap_.empty()) {
+            timerHeap_.pop();
+        }
+    }
+    for (auto& queue : queues_) {
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->tasks.clear();
+    }
+
+    std::lock_guard<std::mutex> lock(tasksMutex_);
+    tasks_.clear();
+
+    LOG_INFO("WorkerPool", "Stopped pipeline workers");
+}
+
+bool WorkerPool::addRepeatingTask(const std::string& id, TaskFn fn) {
+    if (!running_) {
+        start();
+    }
+
+    TaskPtr task = std::make_shared<Task>();
+    task->id = id;
+    task->fn = std::move(fn);
+
+    {
+        std::lock_guard<std::mutex> lock(tasksMutex_);
+        if (tasks_.find(id) != tasks_.end()) {
+            return false; // Already registered
+        }
+        tasks_[id] = task;
+    }
+
+    scheduleReady(task);
+    return true;
+}
+
+bool WorkerPool::removeRepeatingTask(const std::string& id) {
+    TaskPtr task;
+    {
+        std::lock_guard<std::mutex> lock(tasksMutex_);
+        auto it = tasks_.find(id);
+        if (it == tasks_.end()) {
+            return false;
+        }
+        task = it->second;
+        tasks_.erase(it);
+    }
+
+    // Cancel under tasksMutex_ so it serializes against a worker's
+    // claim-then-check in workerLoop: once we hold the lock the task is
+    // either already executing (we wait below) or will see cancelled
+    // before running its body
+    std::unique_lock<std::mutex> lock(tasksMutex_);
+    task->cancelled = true;
+
+    // Wait for any in-flight execution so the caller can safely tear down
+    // the state the task touches
+    taskDoneCV_.wait(lock, [&task] { return !task->executing.load(); });
+    return true;
+}
+
+void WorkerPool::scheduleReady(const TaskPtr& task) {
+    size_t index = nextQueue_.fetch_add(1) % queues_.size();
+    {
+        std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+        queues_[index]->tasks.push_back(task);
+    }
+    timerCV_.notify_one();
+}
+
+void WorkerPool::scheduleAfter(const TaskPtr& task, std::chrono::milliseconds delay) {
+    {
+        std::lock_guard<std::mutex> lock(timerMutex_);
+        timerHeap_.push(TimedTask{std::chrono::steady_clock::now() + delay, task});
+    }
+    timerCV_.notify_one();
+}
+
+WorkerPool::TaskPtr WorkerPool::popLocal(size_t index) {
+    std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+    if (queues_[index]->tasks.empty()) {
+        return nullptr;
+    }
+    TaskPtr task = queues_[index]->tasks.front();
+    queues_[index]->tasks.pop_front();
+    return task;
+}
+
+WorkerPool::TaskPtr WorkerPool::steal(size_t thief) {
+    // Steal from the back of a victim's queue to reduce contention with
+    // the victim popping from the front
+    for (size_t offset = 1; offset < queues_.size(); offset++) {
+        size_t victim = (thief + offset) % queues_.size();
+        std::lock_guard<std::mutex> lock(queues_[victim]->mutex);
+        if (!queues_[victim]->tasks.empty()) {
+            TaskPtr task = queues_[victim]->tasks.back();
+            queues_[victim]->tasks.pop_back();
+            stealCount_.fetch_add(1, std::memory_order_relaxed);
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+void WorkerPool::workerLoop(size_t index) {
+    // Confine pipeline work to the configured core group (no-op when
+    // TAPI_PIPELINE_CORES is unset); see utils/thread_affinity.h
+    utils::ThreadAffinity::pinPipelineThread("pool worker " + std::to_string(index));
+
+    while (running_) {
+        TaskPtr task = popLocal(index);
+        if (!task) {
+            task = steal(index);
+        }
+
+        if (!task) {
+            // Nothing ready: service the timer heap, waiting until the next
+            // deadline (or a notification) if nothing is due yet
+            std::unique_lock<std::mutex> lock(timerMutex_);
+            if (timerHeap_.empty()) {
+                timerCV_.wait_for(lock, std::chrono::milliseconds(50));
+                continue;
+            }
+            auto now = std::chrono::steady_clock::now();
+            if (timerHeap_.top().due > now) {
+                timerCV_.wait_until(lock, timerHeap_.top().due);
+                continue;
+            }
+            task = timerHeap_.top().task;
+            timerHeap_.pop();
+        }
+
+        // Claim the execution and check for cancellation atomically with
+        // respect to removeRepeatingTask(), which cancels and evaluates its
+        // wait predicate under the same mutex. This closes two windows: a
+        // remover observing "cancelled, not executing" while the body is
+        // about to run, and a completion notify firing between the remover's
+        // predicate check and its re-block.
+        {
+            std::lock_guard<std::mutex> lock(tasksMutex_);
+            if (task->cancelled) {
+                taskDoneCV_.notify_all();
+                continue;
+            }
+            task->executing = true;
+        }
+
+        std::chrono::milliseconds delay(0);
+        try {
+            delay = task->fn();
+        } catch (const std::exception& e) {
+            LOG_ERROR("WorkerPool", "Task " + task->id + " threw: " + e.what());
+            delay = std::chrono::milliseconds(100); // Back off after errors
+        }
+        {
+            std::lock_guard<std::mutex> lock(tasksMutex_);
+            task->executing = false;
+            taskDoneCV_.notify_all();
+        }
+        executedCount_.fetch_add(1, std::memory_order_relaxed);
+
+        if (!task->cancelled) {
+            if (delay.count() <= 0) {
+                scheduleReady(task);
+            } else {
+                scheduleAfter(task, delay);
+            }
+        }
+    }
+}
+
+nlohmann::json WorkerPool::getStats() const {
+    nlohmann::json stats;
+    stats["workers"] = numWorkers_;
+    {
+        std::lock_guard<std::mutex> lock(tasksMutex_);
+        stats["tasks"] = tasks_.size();
+    }
+    stats["executed"] = executedCount_.load();
+    stats["steals"] = stealCount_.load();
+    return stats;
+}
+
+} // namespace tapi
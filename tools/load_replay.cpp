@@ -0,0 +1,339 @@
+/**
+ * @file load_replay.cpp
+ * @brief Replay a captured API request log against a running tAPI instance
+ *
+ * Reads a JSONL request log (one JSON object per line with "method" and
+ * "path", plus optional "body" and "content_type") and fires it at a
+ * running server at configurable concurrency and rate, then reports
+ * per-route throughput and p50/p99/p999 latency. Lines without
+ * method/path are counted and skipped, so partial captures replay
+ * cleanly.
+ *
+ * Usage:
+ *   tAPILoadReplay --log capture.jsonl [--base-url http://localhost:8090]
+ *                  [--concurrency 8] [--rate 0] [--repeat 1]
+ *
+ * --rate is a target in requests/second across all workers (0 = unpaced,
+ * closed loop). --repeat replays the log N times so short captures can
+ * still produce stable percentiles. Meant to be run before raising
+ * Api::configureServerConcurrency limits in production, not after the
+ * box has already melted.
+ */
+
+#include <curl/curl.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace {
+
+struct ReplayRequest {
+    std::string method;
+    std::string path;
+    std::string body;
+    std::string contentType;
+};
+
+struct RouteStats {
+    std::vector<double> latenciesMs;
+    uint64_t failures = 0;
+};
+
+struct Options {
+    std::string logPath;
+    std::string baseUrl = "http://localhost:8090";
+    int concurrency = 8;
+    double rate = 0.0;  // requests/second across all workers, 0 = unpaced
+    int repeat = 1;
+};
+
+size_t discardResponseBody(char* /*ptr*/, size_t size, size_t nmemb, void* /*userdata*/) {
+    return size * nmemb;
+}
+
+bool parseArgs(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        auto nextValue = [&](const char* name) -> const char* {
+            if (i + 1 >= argc) {
+                std::cerr << name << " requires a value" << std::endl;
+                return nullptr;
+            }
+            return argv[++i];
+        };
+
+        if (arg == "--log") {
+            const char* value = nextValue("--log");
+            if (!value) return false;
+            options.logPath = value;
+        } else if (arg == "--base-url") {
+            const char* value = nextValue("--base-url");
+            if (!value) return false;
+            options.baseUrl = value;
+        } else if (arg == "--concurrency") {
+            const char* value = nextValue("--concurrency");
+            if (!value) return false;
+            options.concurrency = std::stoi(value);
+        } else if (arg == "--rate") {
+            const char* value = nextValue("--rate");
+            if (!value) return false;
+            options.rate = std::stod(value);
+        } else if (arg == "--repeat") {
+            const char* value = nextValue("--repeat");
+            if (!value) return false;
+            options.repeat = std::stoi(value);
+        } else if (arg == "--help" || arg == "-h") {
+            std::cout << "Usage: tAPILoadReplay --log <capture.jsonl> [--base-url <url>] "
+                         "[--concurrency <n>] [--rate <rps>] [--repeat <n>]" << std::endl;
+            return false;
+        } else {
+            std::cerr << "Unknown argument: " << arg << std::endl;
+            return false;
+        }
+    }
+
+    if (options.logPath.empty()) {
+        std::cerr << "--log is required (JSONL file with method/path per line)" << std::endl;
+        return false;
+    }
+    if (options.concurrency < 1) {
+        std::cerr << "--concurrency must be at least 1" << std::endl;
+        return false;
+    }
+    if (options.repeat < 1) {
+        std::cerr << "--repeat must be at least 1" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool loadRequestLog(const std::string& path, std::vector<ReplayRequest>& requests,
+                    uint64_t& skipped) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "Cannot open request log: " << path << std::endl;
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        nlohmann::json entry;
+        try {
+            entry = nlohmann::json::parse(line);
+        } catch (const nlohmann::json::exception&) {
+            skipped++;
+            continue;
+        }
+        if (!entry.contains("method") || !entry.contains("path")) {
+            skipped++;
+            continue;
+        }
+
+        ReplayRequest request;
+        request.method = entry.value("method", "GET");
+        request.path = entry.value("path", "/");
+        if (entry.contains("body")) {
+            if (entry["body"].is_string()) {
+                request.body = entry["body"].get<std::string>();
+            } else {
+                request.body = entry["body"].dump();
+            }
+        }
+        request.contentType = entry.value("content_type", "application/json");
+        requests.push_back(std::move(request));
+    }
+    return true;
+}
+
+/**
+ * @brief One worker: closed-loop replay of its slice of the request log
+ *
+ * Workers stride through the log (worker i takes entries i, i+N, ...),
+ * which preserves the capture's route mix per worker. A single easy
+ * handle per worker keeps connections alive across requests, matching
+ * how dashboard clients actually talk to the API.
+ */
+void workerLoop(const Options& options, const std::vector<ReplayRequest>& requests,
+                int workerIndex, std::map<std::string, RouteStats>& routeStats,
+                std::mutex& statsMutex, std::atomic<uint64_t>& paceCounter,
+                std::chrono::steady_clock::time_point paceStart) {
+    CURL* curl = curl_easy_init();
+    if (!curl) {
+        std::cerr << "curl_easy_init failed for worker " << workerIndex << std::endl;
+        return;
+    }
+
+    std::map<std::string, RouteStats> localStats;
+
+    for (int pass = 0; pass < options.repeat; pass++) {
+        for (size_t i = static_cast<size_t>(workerIndex); i < requests.size();
+             i += static_cast<size_t>(options.concurrency)) {
+            const ReplayRequest& request = requests[i];
+
+            // Global pacing: each request claims a slot on a shared
+            // schedule so the aggregate rate holds regardless of how the
+            // routes are distributed across workers
+            if (options.rate > 0.0) {
+                const uint64_t slot = paceCounter.fetch_add(1);
+                const auto due = paceStart + std::chrono::duration_cast<
+                    std::chrono::steady_clock::duration>(
+                        std::chrono::duration<double>(slot / options.rate));
+                std::this_thread::sleep_until(due);
+            }
+
+            curl_easy_reset(curl);
+            const std::string url = options.baseUrl + request.path;
+            curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+            curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, request.method.c_str());
+            curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, discardResponseBody);
+            curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS, 30000L);
+            curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+
+            struct curl_slist* headers = nullptr;
+            if (!request.body.empty()) {
+                curl_easy_setopt(curl, CURLOPT_POSTFIELDS, request.body.c_str());
+                curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE,
+                                 static_cast<long>(request.body.size()));
+                const std::string header = "Content-Type: " + request.contentType;
+                headers = curl_slist_append(headers, header.c_str());
+                curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            const CURLcode result = curl_easy_perform(curl);
+            const double elapsedMs = std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - start).count();
+
+            long statusCode = 0;
+            curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &statusCode);
+
+            const std::string routeKey = request.method + " " + request.path;
+            RouteStats& stats = localStats[routeKey];
+            if (result != CURLE_OK || statusCode >= 500) {
+                stats.failures++;
+            }
+            stats.latenciesMs.push_back(elapsedMs);
+
+            if (headers) {
+                curl_slist_free_all(headers);
+            }
+        }
+    }
+
+    curl_easy_cleanup(curl);
+
+    std::lock_guard<std::mutex> lock(statsMutex);
+    for (auto& pair : localStats) {
+        RouteStats& merged = routeStats[pair.first];
+        merged.failures += pair.second.failures;
+        merged.latenciesMs.insert(merged.latenciesMs.end(),
+                                  pair.second.latenciesMs.begin(),
+                                  pair.second.latenciesMs.end());
+    }
+}
+
+double percentile(const std::vector<double>& sorted, double fraction) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    const size_t index = static_cast<size_t>(fraction * (sorted.size() - 1));
+    return sorted[index];
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseArgs(argc, argv, options)) {
+        return 1;
+    }
+
+    std::vector<ReplayRequest> requests;
+    uint64_t skipped = 0;
+    if (!loadRequestLog(options.logPath, requests, skipped)) {
+        return 1;
+    }
+    if (requests.empty()) {
+        std::cerr << "No replayable entries in " << options.logPath
+                  << " (" << skipped << " lines without method/path)" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Replaying " << requests.size() << " requests x" << options.repeat
+              << " against " << options.baseUrl << " with " << options.concurrency
+              << " workers";
+    if (options.rate > 0.0) {
+        std::cout << " at " << options.rate << " req/s";
+    }
+    if (skipped > 0) {
+        std::cout << " (" << skipped << " log lines skipped)";
+    }
+    std::cout << std::endl;
+
+    curl_global_init(CURL_GLOBAL_ALL);
+
+    std::map<std::string, RouteStats> routeStats;
+    std::mutex statsMutex;
+    std::atomic<uint64_t> paceCounter{0};
+    const auto runStart = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    workers.reserve(options.concurrency);
+    for (int i = 0; i < options.concurrency; i++) {
+        workers.emplace_back(workerLoop, std::cref(options), std::cref(requests), i,
+                             std::ref(routeStats), std::ref(statsMutex),
+                             std::ref(paceCounter), runStart);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    const double runSeconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - runStart).count();
+
+    curl_global_cleanup();
+
+    uint64_t totalRequests = 0;
+    uint64_t totalFailures = 0;
+    std::cout << std::endl;
+    std::cout << "route                                               count   fail    req/s"
+                 "    p50ms    p99ms   p999ms" << std::endl;
+    for (auto& pair : routeStats) {
+        RouteStats& stats = pair.second;
+        std::sort(stats.latenciesMs.begin(), stats.latenciesMs.end());
+        totalRequests += stats.latenciesMs.size();
+        totalFailures += stats.failures;
+
+        char line[256];
+        std::snprintf(line, sizeof(line), "%-48s %8zu %6lu %8.1f %8.2f %8.2f %8.2f",
+                      pair.first.c_str(), stats.latenciesMs.size(),
+                      static_cast<unsigned long>(stats.failures),
+                      stats.latenciesMs.size() / runSeconds,
+                      percentile(stats.latenciesMs, 0.50),
+                      percentile(stats.latenciesMs, 0.99),
+                      percentile(stats.latenciesMs, 0.999));
+        std::cout << line << std::endl;
+    }
+
+    std::cout << std::endl;
+    std::cout << "total: " << totalRequests << " requests, " << totalFailures
+              << " failures, " << runSeconds << "s elapsed, "
+              << totalRequests / runSeconds << " req/s overall" << std::endl;
+
+    return totalFailures == 0 ? 0 : 2;
+}